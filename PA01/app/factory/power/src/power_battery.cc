@@ -11,9 +11,30 @@
 
 #include "./../../factory_app.h"
 
+// 电量平滑：对最近几秒的电量做带遗忘的直线拟合，取当前时刻的拟合值，负载跳变和采样噪声不会误触发关机
+#define POWER_BATTERY_FIT_LAMBDA 0.95f // 200ms 一个样本，有效窗口约 4s
+static fit_stream_t s_power_battery_fit = {0};
+static uint64_t s_power_battery_fit_start = 0;
+
+// 充电状态切换时电压跳变，重新拟合
+static void power_battery_fit_reset(void)
+{
+    fit_stream_init(&s_power_battery_fit, NULL, POWER_BATTERY_FIT_LAMBDA);
+    s_power_battery_fit_start = TIMESTAMP_US;
+}
+
+// 0.636~0.909 <=> 2.1V~3V <=> 0~100%
+static float power_battery_update(void)
+{
+    float t = (TIMESTAMP_US - s_power_battery_fit_start) / 1000000.0f;
+    fit_stream_update(&s_power_battery_fit, t, (g_adc_battery - 0.636f) / (0.909f - 0.636f));
+    return fit_stream_predict(&s_power_battery_fit, t);
+}
+
 static void power_battery_entry(void *args)
 {
     gpio_write(&g_exout_charge_enable, false);
+    power_battery_fit_reset();
     float last_adc_usb = 0;
     for (;;)
     {
@@ -24,6 +45,7 @@ static void power_battery_entry(void *args)
             gpio_write(&g_exout_charge_enable, true);
             // 开启电源RGB灯
             gpio_value_write(&g_rgb_power, (sled_color_t){.rgb = {.r = 0, .g = 0, .b = 255}}.value);
+            power_battery_fit_reset();
             log_info("charge enable.");
         }
         if (g_adc_usb < 0.3f && last_adc_usb > 0.3f)
@@ -31,22 +53,22 @@ static void power_battery_entry(void *args)
             g_factory.status.is_charging = false;
             gpio_write(&g_exout_charge_enable, false);
             gpio_write(&g_rgb_power, false);
+            power_battery_fit_reset();
             log_info("charge disable.");
         }
         last_adc_usb = g_adc_usb;
 
         // 正在充电
-        // 0.636~0.909 <=> 2.1V~3V <=> 0~100%
         if (gpio_read(&g_exout_charge_enable) == true)
         {
             gpio_write(&g_exout_charge_enable, false);
             os_sleep(5);
-            g_factory.value.battery = (g_adc_battery - 0.636f) / (0.909f - 0.636f); // 更新电池电压
+            g_factory.value.battery = power_battery_update(); // 更新电池电压
             gpio_write(&g_exout_charge_enable, true);
         }
         else
         {
-            g_factory.value.battery = (g_adc_battery - 0.636f) / (0.909f - 0.636f);
+            g_factory.value.battery = power_battery_update();
             if (g_factory.value.battery < 0)
             {
                 // 关机
@@ -27,9 +27,21 @@
  */
 #include "./../../factory_app.h"
 
+// 掉电保护：每1s置一次检查标志，由 rf_remap 任务比较并保存，flash 写入不占用定时器服务任务
+static volatile bool rf_remap_save_flag = false;
+static void rf_remap_save_callback(soft_timer_t *timer, void *userdata)
+{
+    rf_remap_save_flag = true;
+}
+static soft_timer_t rf_remap_save_timer = {
+    .name = "rf_remap_save",
+    .callback = rf_remap_save_callback,
+};
+
 static void rf_remap_entry(void *args)
 {
     os_rely_wait(g_data_factory.cfg.user_data != NULL, 10000);
+    soft_timer_start(&g_soft_timer, &rf_remap_save_timer, 1000000, 1000000);
     for (;;)
     {
         os_sleep(10);
@@ -49,13 +61,15 @@ static void rf_remap_entry(void *args)
         fs_inrm303_chnnel_us_set(&g_fs_inrm303, 8, g_adc_sw_left < 0.3 ? 1000 : (g_adc_sw_left < 0.7 ? 1500 : 2000));
         fs_inrm303_chnnel_us_set(&g_fs_inrm303, 9, g_adc_sw_right < 0.3 ? 1000 : (g_adc_sw_right < 0.7 ? 1500 : 2000));
 
-        // 掉电保护
-        time_invoke(1000000, {
+        // 掉电保护，数据有变化时保存
+        if (rf_remap_save_flag)
+        {
+            rf_remap_save_flag = false;
             if (CMP_PREV(g_factory.data) != 0)
             {
                 data_save(&g_data_factory);
             }
-        });
+        }
     }
 }
 
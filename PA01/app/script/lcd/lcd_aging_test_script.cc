@@ -15,56 +15,102 @@ struct __page_lcd_screen
     uint8_t page_size;
 };
 
-static void lcd_aging_slw_callback(void *device, dds_topic_t *topic, void *arg, void *userdata)
+// 定时器只置标志，页面与 LVGL 操作在按钮（gpio）任务的保持按下回调中执行
+static volatile bool lcd_aging_page_flag = false;
+static volatile bool lcd_aging_roller_flag = false;
+
+// 100ms：回到屏幕测试页
+static void lcd_aging_page_step(void)
+{
+    factory_page_t *current_page = g_factory.lvgl.page_path[g_factory.lvgl.page_index];
+    if (current_page == &g_page_home)
+    {
+        ui_hal_page_entry(&g_page_lcd_screen); // 进入屏幕测试
+    }
+    else if (current_page == &g_page_testbox)
+    {
+        ui_hal_page_goback(FACTORY_PAGE_HOME); // 返回首页
+    }
+    else if (current_page == &g_page_msgbox)
+    {
+        ui_hal_page_goback(FACTORY_PAGE_HOME); // 返回首页
+    }
+}
+
+// 3s：测试中切换屏幕
+static void lcd_aging_roller_step(void)
 {
-    factory_page_t *current_page;
     struct __page_lcd_screen *page_lcd_screen = (struct __page_lcd_screen *)g_page_lcd_screen.userdata;
+    if (g_factory.lvgl.page_path[g_factory.lvgl.page_index] != &g_page_lcd_screen)
+    {
+        return;
+    }
 
-    time_invoke(100000, { // 100ms执行一次
-        current_page = g_factory.lvgl.page_path[g_factory.lvgl.page_index];
-        if (current_page != NULL)
-        {
-            if (current_page == &g_page_home)
-            {
-                ui_hal_page_entry(&g_page_lcd_screen); // 进入屏幕测试
-            }
-            else if (current_page == &g_page_testbox)
-            {
-                ui_hal_page_goback(FACTORY_PAGE_HOME); // 返回首页
-            }
-            else if (current_page == &g_page_msgbox)
-            {
-                ui_hal_page_goback(FACTORY_PAGE_HOME); // 返回首页
-            }
-        }
+    if (page_lcd_screen->current == 4)
+    {
+        int32_t value = 1;
+        dds_publish(&g_roller, &g_roller.CHANGED, &value); // 模拟滚轮下滑
+    }
+    else if (page_lcd_screen->current == 5)
+    {
+        int32_t value = -1;
+        dds_publish(&g_roller, &g_roller.CHANGED, &value); // 模拟滚轮上滑
+    }
+    else
+    {
+        page_lcd_screen->current = 4;
+        int32_t value = 1;
+        dds_publish(&g_roller, &g_roller.CHANGED, &value); // 模拟滚轮下滑
+    }
+}
 
-        time_invoke(3000000, { // 3s执行一次
-            // 测试中
-            if (current_page == &g_page_lcd_screen)
-            {
-                if (page_lcd_screen->current == 4)
-                {
-                    int32_t value = 1;
-                    dds_publish(&g_roller, &g_roller.CHANGED, &value); // 模拟滚轮下滑
-                }
-                else if (page_lcd_screen->current == 5)
-                {
-                    int32_t value = -1;
-                    dds_publish(&g_roller, &g_roller.CHANGED, &value); // 模拟滚轮上滑
-                }
-                else
-                {
-                    page_lcd_screen->current = 4;
-                    int32_t value = 1;
-                    dds_publish(&g_roller, &g_roller.CHANGED, &value); // 模拟滚轮下滑
-                }
-            }
-        });
+static void lcd_aging_page_callback(soft_timer_t *timer, void *userdata)
+{
+    lcd_aging_page_flag = true;
+}
+static void lcd_aging_roller_callback(soft_timer_t *timer, void *userdata)
+{
+    lcd_aging_roller_flag = true;
+}
+static soft_timer_t lcd_aging_page_timer = {
+    .name = "lcd_aging_page",
+    .callback = lcd_aging_page_callback,
+};
+static soft_timer_t lcd_aging_roller_timer = {
+    .name = "lcd_aging_roller",
+    .callback = lcd_aging_roller_callback,
+};
 
-    });
+// 左自锁按钮保持按下时老化，释放后停止
+static void lcd_aging_slw_press_callback(void *device, dds_topic_t *topic, void *arg, void *userdata)
+{
+    soft_timer_start(&g_soft_timer, &lcd_aging_page_timer, 0, 100000);       // 100ms执行一次
+    soft_timer_start(&g_soft_timer, &lcd_aging_roller_timer, 3000000, 3000000); // 3s执行一次
+}
+static void lcd_aging_slw_keep_callback(void *device, dds_topic_t *topic, void *arg, void *userdata)
+{
+    if (lcd_aging_page_flag)
+    {
+        lcd_aging_page_flag = false;
+        lcd_aging_page_step();
+    }
+    if (lcd_aging_roller_flag)
+    {
+        lcd_aging_roller_flag = false;
+        lcd_aging_roller_step();
+    }
+}
+static void lcd_aging_slw_release_callback(void *device, dds_topic_t *topic, void *arg, void *userdata)
+{
+    soft_timer_stop(&g_soft_timer, &lcd_aging_page_timer);
+    soft_timer_stop(&g_soft_timer, &lcd_aging_roller_timer);
+    lcd_aging_page_flag = false;
+    lcd_aging_roller_flag = false;
 }
 
 static void lcd_aging_test_script_inti(void)
 {
-    dds_subcribe(&g_btn_slw_left.KEEP_LONG_PRESS, DDS_PRIORITY_NORMAL, lcd_aging_slw_callback, NULL); // 绑定左自锁按钮的长按事件
+    dds_subcribe(&g_btn_slw_left.TO_KEEP_LONG_PRESS, DDS_PRIORITY_NORMAL, lcd_aging_slw_press_callback, NULL);     // 绑定左自锁按钮的保持按下
+    dds_subcribe(&g_btn_slw_left.KEEP_LONG_PRESS, DDS_PRIORITY_NORMAL, lcd_aging_slw_keep_callback, NULL);         // 保持按下期间每次扫描执行到期的步骤
+    dds_subcribe(&g_btn_slw_left.TO_KEEP_LONG_RELEASE, DDS_PRIORITY_NORMAL, lcd_aging_slw_release_callback, NULL); // 绑定左自锁按钮的保持释放
 }
@@ -0,0 +1,284 @@
+/**
+ * @file ahrs_test.cc
+ * @author WittXie
+ * @brief 姿态解算测试：静止姿态收敛与零偏估计、恒定角速度跟踪、合成 IMU 轨迹回放（逐点与批量一致）、Mahony/Madgwick 每次更新耗时
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define AHRS_TEST_RATE 1000.0f       // 采样率（Hz）
+#define AHRS_TEST_TRACE 6000         // 轨迹样本数，6s
+#define AHRS_TEST_FIFO 16            // 批量回放每次读出的样本数
+#define AHRS_TEST_LOOP 10000         // 计时循环次数
+#define AHRS_TEST_GYRO_NOISE 0.005f  // 陀螺噪声标准差（rad/s）
+#define AHRS_TEST_ACCEL_NOISE 0.002f // 加速度噪声标准差（g）
+#define AHRS_TEST_DEG (180.0f / (float)M_PI)
+
+// 真实姿态：双精度四元数（机体到世界）
+typedef struct
+{
+    double q0, q1, q2, q3;
+} ahrs_test_truth_t;
+
+static ahrs_sample_t s_ahrs_test_trace[AHRS_TEST_TRACE];
+static ahrs_test_truth_t s_ahrs_test_truth[AHRS_TEST_TRACE];
+
+// 标准正态随机数（Box-Muller）
+static float ahrs_test_gauss(void)
+{
+    float u1 = (rand() + 0.5f) / ((float)RAND_MAX + 1.0f);
+    float u2 = (rand() + 0.5f) / ((float)RAND_MAX + 1.0f);
+    return sqrtf(-2.0f * logf(u1)) * cosf(2.0f * M_PI * u2);
+}
+
+// 由横滚/俯仰/偏航（ZYX）生成真实姿态
+static ahrs_test_truth_t ahrs_test_euler(double roll, double pitch, double yaw)
+{
+    double cr = cos(roll / 2), sr = sin(roll / 2);
+    double cp = cos(pitch / 2), sp = sin(pitch / 2);
+    double cy = cos(yaw / 2), sy = sin(yaw / 2);
+    ahrs_test_truth_t q = {
+        .q0 = cr * cp * cy + sr * sp * sy,
+        .q1 = sr * cp * cy - cr * sp * sy,
+        .q2 = cr * sp * cy + sr * cp * sy,
+        .q3 = cr * cp * sy - sr * sp * cy,
+    };
+    return q;
+}
+
+// 按机体角速度精确旋转一个步长：q = q ⊗ exp(ω·dt/2)
+static void ahrs_test_rotate(ahrs_test_truth_t *q, double wx, double wy, double wz, double dt)
+{
+    double w = sqrt(wx * wx + wy * wy + wz * wz);
+    if (w <= 0)
+    {
+        return;
+    }
+    double c = cos(w * dt / 2), s = sin(w * dt / 2) / w;
+    double r0 = c, r1 = wx * s, r2 = wy * s, r3 = wz * s;
+    ahrs_test_truth_t p = *q;
+    q->q0 = p.q0 * r0 - p.q1 * r1 - p.q2 * r2 - p.q3 * r3;
+    q->q1 = p.q0 * r1 + p.q1 * r0 + p.q2 * r3 - p.q3 * r2;
+    q->q2 = p.q0 * r2 - p.q1 * r3 + p.q2 * r0 + p.q3 * r1;
+    q->q3 = p.q0 * r3 + p.q1 * r2 - p.q2 * r1 + p.q3 * r0;
+}
+
+// 合成一个样本：角速度 + 零偏 + 噪声，加速度为机体系重力方向 + 噪声
+static ahrs_sample_t ahrs_test_sample(const ahrs_test_truth_t *q, double wx, double wy, double wz, const float *bias)
+{
+    ahrs_sample_t sample = {
+        .gx = (float)wx + bias[0] + AHRS_TEST_GYRO_NOISE * ahrs_test_gauss(),
+        .gy = (float)wy + bias[1] + AHRS_TEST_GYRO_NOISE * ahrs_test_gauss(),
+        .gz = (float)wz + bias[2] + AHRS_TEST_GYRO_NOISE * ahrs_test_gauss(),
+        .ax = (float)(2 * (q->q1 * q->q3 - q->q0 * q->q2)) + AHRS_TEST_ACCEL_NOISE * ahrs_test_gauss(),
+        .ay = (float)(2 * (q->q0 * q->q1 + q->q2 * q->q3)) + AHRS_TEST_ACCEL_NOISE * ahrs_test_gauss(),
+        .az = (float)(q->q0 * q->q0 - q->q1 * q->q1 - q->q2 * q->q2 + q->q3 * q->q3) + AHRS_TEST_ACCEL_NOISE * ahrs_test_gauss(),
+    };
+    return sample;
+}
+
+// 倾斜误差（度）：估计与真实的重力方向夹角，与偏航无关
+static float ahrs_test_tilt_err(const ahrs_t *ahrs, const ahrs_test_truth_t *q)
+{
+    double ex = 2 * (ahrs->q1 * ahrs->q3 - ahrs->q0 * ahrs->q2);
+    double ey = 2 * (ahrs->q0 * ahrs->q1 + ahrs->q2 * ahrs->q3);
+    double ez = ahrs->q0 * ahrs->q0 - ahrs->q1 * ahrs->q1 - ahrs->q2 * ahrs->q2 + ahrs->q3 * ahrs->q3;
+    double tx = 2 * (q->q1 * q->q3 - q->q0 * q->q2);
+    double ty = 2 * (q->q0 * q->q1 + q->q2 * q->q3);
+    double tz = q->q0 * q->q0 - q->q1 * q->q1 - q->q2 * q->q2 + q->q3 * q->q3;
+    double cx = ey * tz - ez * ty, cy = ez * tx - ex * tz, cz = ex * ty - ey * tx;
+    return (float)atan2(sqrt(cx * cx + cy * cy + cz * cz), ex * tx + ey * ty + ez * tz) * AHRS_TEST_DEG;
+}
+
+// 总姿态误差（度）：两四元数间的旋转角
+static float ahrs_test_err(const ahrs_t *ahrs, const ahrs_test_truth_t *q)
+{
+    double dot = fabs(ahrs->q0 * q->q0 + ahrs->q1 * q->q1 + ahrs->q2 * q->q2 + ahrs->q3 * q->q3);
+    return (float)(2 * acos((dot > 1) ? 1 : dot)) * AHRS_TEST_DEG;
+}
+
+static void ahrs_test_init(ahrs_t *ahrs, uint8_t mode)
+{
+    ahrs->cfg.mode = mode;
+    ahrs->cfg.sample_rate = AHRS_TEST_RATE;
+    ahrs->cfg.kp = 2.0f;
+    ahrs->cfg.ki = 0.05f;
+    ahrs->cfg.beta = 0.1f;
+    ahrs->cfg.rest_gyro = 3.0f / AHRS_TEST_DEG;
+    ahrs->cfg.rest_count = 200;
+    ahrs->cfg.bias_alpha = 0.002f;
+    ahrs_init(ahrs);
+}
+
+// 静止：横滚 30° 俯仰 -20°，陀螺带零偏；从单位姿态（跳过首样本对齐）收敛，静止检测估计出零偏
+static uint32_t ahrs_test_static(uint8_t mode)
+{
+    const float bias[3] = {0.01f, -0.02f, 0.005f};
+    ahrs_test_truth_t truth = ahrs_test_euler(30 / AHRS_TEST_DEG, -20 / AHRS_TEST_DEG, 0);
+    ahrs_t ahrs;
+    uint32_t fail = 0;
+
+    ahrs_test_init(&ahrs, mode);
+    ahrs.is_aligned = true; // 从 36° 的初始误差开始收敛
+    uint32_t settle = 0;
+    for (uint32_t n = 0; n < 10 * AHRS_TEST_RATE; n++)
+    {
+        ahrs_sample_t sample = ahrs_test_sample(&truth, 0, 0, 0, bias);
+        ahrs_update(&ahrs, &sample);
+        if (settle == 0 && ahrs_test_tilt_err(&ahrs, &truth) < 2.0f)
+        {
+            settle = n + 1;
+        }
+    }
+    float tilt = ahrs_test_tilt_err(&ahrs, &truth);
+    float bias_err = CMP_MAX(CMP_MAX(fabsf(ahrs.bias[0] - bias[0]), fabsf(ahrs.bias[1] - bias[1])), fabsf(ahrs.bias[2] - bias[2]));
+    fail += (settle == 0) || (settle > 5 * AHRS_TEST_RATE) || !(tilt < 0.5f);
+    fail += !ahrs_is_rest(&ahrs) || !(bias_err < 2e-3f);
+
+    // 首样本对齐：第一次更新后倾斜误差即在噪声量级
+    ahrs_test_init(&ahrs, mode);
+    ahrs_sample_t sample = ahrs_test_sample(&truth, 0, 0, 0, bias);
+    ahrs_update(&ahrs, &sample);
+    float align = ahrs_test_tilt_err(&ahrs, &truth);
+    fail += !(align < 2.0f);
+
+    print("static %s: settle %u ms, tilt %.3f deg, bias err %.2e rad/s, align %.3f deg\r\n",
+          mode == AHRS_MODE_MAHONY ? "mahony" : "madgwick", settle, tilt, bias_err, align);
+    return fail;
+}
+
+// 恒定角速度：横滚 20° 下绕机体 z 轴 90°/s 转 4s（一整周），倾斜与总误差（含偏航）都有界
+static uint32_t ahrs_test_rate(uint8_t mode)
+{
+    const float bias[3] = {0};
+    const double wz = 90 / AHRS_TEST_DEG, dt = 1.0 / AHRS_TEST_RATE;
+    ahrs_test_truth_t truth = ahrs_test_euler(20 / AHRS_TEST_DEG, 0, 0);
+    ahrs_t ahrs;
+    uint32_t fail = 0;
+
+    ahrs_test_init(&ahrs, mode);
+    ahrs.cfg.rest_gyro = 0; // 转动中不估计零偏
+    float tilt_max = 0;
+    for (uint32_t n = 0; n < 4 * AHRS_TEST_RATE; n++)
+    {
+        ahrs_test_rotate(&truth, 0, 0, wz, dt);
+        ahrs_sample_t sample = ahrs_test_sample(&truth, 0, 0, wz, bias);
+        ahrs_update(&ahrs, &sample);
+        if (n > AHRS_TEST_RATE / 10)
+        {
+            tilt_max = CMP_MAX(tilt_max, ahrs_test_tilt_err(&ahrs, &truth));
+        }
+    }
+    float err = ahrs_test_err(&ahrs, &truth);
+    fail += !(tilt_max < 1.0f) || !(err < 2.0f);
+    print("rate %s: tilt max %.3f deg, total err %.3f deg after 360 deg\r\n",
+          mode == AHRS_MODE_MAHONY ? "mahony" : "madgwick", tilt_max, err);
+    return fail;
+}
+
+// 合成轨迹：静止 1s → 横滚 60°/s 1s → 俯仰 -45°/s 1s → 偏航 90°/s 并横滚回摆 2s → 静止 1s
+static void ahrs_test_trace_build(void)
+{
+    const float bias[3] = {0.005f, -0.003f, 0.008f};
+    const double dt = 1.0 / AHRS_TEST_RATE;
+    ahrs_test_truth_t truth = ahrs_test_euler(0, 0, 0);
+    for (uint32_t n = 0; n < AHRS_TEST_TRACE; n++)
+    {
+        double t = n * dt, wx = 0, wy = 0, wz = 0;
+        if (t >= 1 && t < 2)
+        {
+            wx = 60 / AHRS_TEST_DEG;
+        }
+        else if (t >= 2 && t < 3)
+        {
+            wy = -45 / AHRS_TEST_DEG;
+        }
+        else if (t >= 3 && t < 5)
+        {
+            wx = -30 / AHRS_TEST_DEG * sin(M_PI * (t - 3));
+            wz = 90 / AHRS_TEST_DEG;
+        }
+        ahrs_test_rotate(&truth, wx, wy, wz, dt);
+        s_ahrs_test_truth[n] = truth;
+        s_ahrs_test_trace[n] = ahrs_test_sample(&truth, wx, wy, wz, bias);
+    }
+}
+
+// 回放：逐点更新跟踪误差有界；FIFO 批量回放与逐点结果逐位相同
+static uint32_t ahrs_test_replay(uint8_t mode)
+{
+    ahrs_t ahrs, block;
+    uint32_t fail = 0;
+
+    ahrs_test_init(&ahrs, mode);
+    float tilt_max = 0;
+    for (uint32_t n = 0; n < AHRS_TEST_TRACE; n++)
+    {
+        ahrs_update(&ahrs, &s_ahrs_test_trace[n]);
+        tilt_max = CMP_MAX(tilt_max, ahrs_test_tilt_err(&ahrs, &s_ahrs_test_truth[n]));
+    }
+    float tilt_end = ahrs_test_tilt_err(&ahrs, &s_ahrs_test_truth[AHRS_TEST_TRACE - 1]);
+    float err_end = ahrs_test_err(&ahrs, &s_ahrs_test_truth[AHRS_TEST_TRACE - 1]);
+
+    ahrs_test_init(&block, mode);
+    for (uint32_t n = 0; n < AHRS_TEST_TRACE; n += AHRS_TEST_FIFO)
+    {
+        ahrs_update_block(&block, &s_ahrs_test_trace[n], CMP_MIN(AHRS_TEST_FIFO, AHRS_TEST_TRACE - n));
+    }
+    bool is_same = (block.q0 == ahrs.q0) && (block.q1 == ahrs.q1) && (block.q2 == ahrs.q2) && (block.q3 == ahrs.q3);
+
+    fail += !(tilt_max < 3.0f) || !(tilt_end < 0.5f) || !(err_end < 3.0f) || !is_same;
+    print("replay %s: tilt max %.3f deg, end tilt %.3f deg, end err %.3f deg, block %s\r\n",
+          mode == AHRS_MODE_MAHONY ? "mahony" : "madgwick", tilt_max, tilt_end, err_end, is_same ? "same" : "DIFF");
+    return fail;
+}
+
+// 每次更新耗时：回放轨迹样本，避免常量输入被优化
+static void ahrs_test_bench(uint8_t mode)
+{
+    ahrs_t ahrs;
+    ahrs_test_init(&ahrs, mode);
+
+    uint32_t cycles = TIMESTAMP_CYCLES;
+    for (uint32_t i = 0; i < AHRS_TEST_LOOP; i++)
+    {
+        ahrs_update(&ahrs, &s_ahrs_test_trace[i % AHRS_TEST_TRACE]);
+    }
+    cycles = TIMESTAMP_CYCLES - cycles;
+
+    volatile float roll, pitch, yaw;
+    uint32_t cycles_euler = TIMESTAMP_CYCLES;
+    for (uint32_t i = 0; i < AHRS_TEST_LOOP; i++)
+    {
+        ahrs_euler_get(&ahrs, (float *)&roll, (float *)&pitch, (float *)&yaw);
+    }
+    cycles_euler = TIMESTAMP_CYCLES - cycles_euler;
+
+    print("%s: update %llu ns, euler %llu ns\r\n", mode == AHRS_MODE_MAHONY ? "mahony" : "madgwick",
+          time_cycles_to_ns(&g_time_timer5, cycles) / AHRS_TEST_LOOP,
+          time_cycles_to_ns(&g_time_timer5, cycles_euler) / AHRS_TEST_LOOP);
+}
+
+static void ahrs_test(void)
+{
+    log_info("ahrs_test start");
+
+    srand(1);
+    ahrs_test_trace_build();
+    for (uint8_t mode = AHRS_MODE_MAHONY; mode <= AHRS_MODE_MADGWICK; mode++)
+    {
+        uint32_t fail = ahrs_test_static(mode);
+        fail += ahrs_test_rate(mode);
+        fail += ahrs_test_replay(mode);
+        print("%s %s, %u fail\r\n", mode == AHRS_MODE_MAHONY ? "mahony" : "madgwick", fail == 0 ? "ok" : "FAIL", fail);
+    }
+
+    ahrs_test_bench(AHRS_MODE_MAHONY);
+    ahrs_test_bench(AHRS_MODE_MADGWICK);
+
+    log_info("ahrs_test end");
+}
@@ -0,0 +1,112 @@
+/**
+ * @file fast_math_test.cc
+ * @author WittXie
+ * @brief 快速数学函数测试：对照双精度 libm 扫描最大误差，与 libm 单精度版本对比单次调用耗时
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define FAST_MATH_TEST_POINTS 100000 // 误差扫描点数
+#define FAST_MATH_TEST_BENCH 1000    // 耗时测试调用次数
+
+static double fast_math_test_rsqrt(double x)
+{
+    return 1.0 / sqrt(x);
+}
+static float fast_math_test_rsqrtf(float x)
+{
+    return 1.0f / sqrtf(x);
+}
+static float fast_math_test_atan(float x)
+{
+    return fast_atan2_hp(x, 1.0f);
+}
+static float fast_math_test_atanf(float x)
+{
+    return atan2f(x, 1.0f);
+}
+static double fast_math_test_atan_ref(double x)
+{
+    return atan2(x, 1.0);
+}
+
+typedef struct
+{
+    const char *name;      // 名称
+    float (*fast)(float);  // 快速版本
+    float (*libm)(float);  // libm 单精度
+    double (*ref)(double); // 双精度参考
+    float lo, hi;          // 扫描范围
+    bool is_rel;           // 相对误差
+} fast_math_test_case_t;
+
+static const fast_math_test_case_t fast_math_test_cases[] = {
+    {"sin_lp", fast_sin_lp, sinf, sin, -100.0f, 100.0f, false},
+    {"sin_mp", fast_sin_mp, sinf, sin, -100.0f, 100.0f, false},
+    {"sin_hp", fast_sin_hp, sinf, sin, -100.0f, 100.0f, false},
+    {"cos_hp", fast_cos_hp, cosf, cos, -100.0f, 100.0f, false},
+    {"atan_hp", fast_math_test_atan, fast_math_test_atanf, fast_math_test_atan_ref, -100.0f, 100.0f, false},
+    {"rsqrt_lp", fast_rsqrt_lp, fast_math_test_rsqrtf, fast_math_test_rsqrt, 1e-6f, 1e6f, true},
+    {"rsqrt_mp", fast_rsqrt_mp, fast_math_test_rsqrtf, fast_math_test_rsqrt, 1e-6f, 1e6f, true},
+    {"exp_mp", fast_exp_mp, expf, exp, -80.0f, 80.0f, true},
+    {"exp_hp", fast_exp_hp, expf, exp, -80.0f, 80.0f, true},
+    {"log_mp", fast_log_mp, logf, log, 1e-6f, 1e6f, false},
+    {"log_hp", fast_log_hp, logf, log, 1e-6f, 1e6f, false},
+    {"tanh_hp", fast_tanh_hp, tanhf, tanh, -10.0f, 10.0f, false},
+};
+
+static void fast_math_test(void)
+{
+    log_info("fast_math_test start");
+
+    for (uint8_t c = 0; c < countof(fast_math_test_cases); c++)
+    {
+        const fast_math_test_case_t *tc = &fast_math_test_cases[c];
+
+        // 最大误差
+        double max_error = 0;
+        float at = tc->lo;
+        for (uint32_t i = 0; i <= FAST_MATH_TEST_POINTS; i++)
+        {
+            float x = tc->lo + (tc->hi - tc->lo) * i / FAST_MATH_TEST_POINTS;
+            double ref = tc->ref(x);
+            double error = fabs(tc->fast(x) - ref);
+            if (tc->is_rel && ref != 0)
+            {
+                error /= fabs(ref);
+            }
+            if (error > max_error)
+            {
+                max_error = error;
+                at = x;
+            }
+        }
+
+        // 耗时
+        volatile float sink = 0;
+        float step = (tc->hi - tc->lo) / FAST_MATH_TEST_BENCH;
+        uint32_t cycles_fast = TIMESTAMP_CYCLES;
+        for (uint32_t i = 0; i < FAST_MATH_TEST_BENCH; i++)
+        {
+            sink += tc->fast(tc->lo + step * i);
+        }
+        cycles_fast = TIMESTAMP_CYCLES - cycles_fast;
+        uint32_t cycles_libm = TIMESTAMP_CYCLES;
+        for (uint32_t i = 0; i < FAST_MATH_TEST_BENCH; i++)
+        {
+            sink += tc->libm(tc->lo + step * i);
+        }
+        cycles_libm = TIMESTAMP_CYCLES - cycles_libm;
+        (void)sink;
+
+        print("%-9s %s %.2e at %-10g fast %4llu ns, libm %4llu ns\r\n", tc->name, tc->is_rel ? "rel" : "abs", max_error, at,
+              time_cycles_to_ns(&g_time_timer5, cycles_fast) / FAST_MATH_TEST_BENCH,
+              time_cycles_to_ns(&g_time_timer5, cycles_libm) / FAST_MATH_TEST_BENCH);
+    }
+
+    log_info("fast_math_test end");
+}
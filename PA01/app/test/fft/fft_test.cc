@@ -0,0 +1,167 @@
+/**
+ * @file fft_test.cc
+ * @author WittXie
+ * @brief FFT测试：与朴素DFT对比误差 + 64~4096点单次变换耗时
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define FFT_TEST_DFT_SIZE 256 // DFT对比点数（O(N^2)，不宜过大）
+#define FFT_TEST_BENCH_CNT 20 // 每个点数的测试次数
+
+// 测试信号
+static void fft_test_signal(complex_t *data, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++)
+    {
+        data[i].real = sinf(0.7f * i) + 0.1f * i / size;
+        data[i].imag = cosf(1.3f * i);
+    }
+}
+
+// 朴素DFT第k个频点
+static complex_t fft_test_dft(const complex_t *data, uint32_t size, uint32_t k)
+{
+    double real = 0, imag = 0;
+    for (uint32_t n = 0; n < size; n++)
+    {
+        double angle = -2.0 * M_PI * (double)((k * n) % size) / size;
+        double c = cos(angle), s = sin(angle);
+        real += data[n].real * c - data[n].imag * s;
+        imag += data[n].real * s + data[n].imag * c;
+    }
+    complex_t result = {(float)real, (float)imag};
+    return result;
+}
+
+static void fft_test(void)
+{
+    log_info("fft_test start");
+
+    // 精度：复数正变换、逆变换、实数正/逆变换
+    {
+        uint32_t N = FFT_TEST_DFT_SIZE;
+        complex_t *x = (complex_t *)MALLOC(N * sizeof(complex_t));
+        complex_t *y = (complex_t *)MALLOC((N + 1) * sizeof(complex_t));
+        float *r = (float *)MALLOC(N * sizeof(float));
+        fft_t fft = {0};
+        fft_real_t fft_real = {0};
+        if (x == NULL || y == NULL || r == NULL || !fft_init(&fft, N, false, x, y) || !fft_real_init(&fft_real, N))
+        {
+            log_error("fft_test init failed.");
+        }
+        else
+        {
+            fft_test_signal(x, N);
+            fft_execute(&fft);
+            float err = 0;
+            for (uint32_t k = 0; k < N; k++)
+            {
+                complex_t ref = fft_test_dft(x, N, k);
+                err = CMP_MAX(err, hypotf(ref.real - y[k].real, ref.imag - y[k].imag));
+            }
+            print("fft %u: max error %e vs dft.\r\n", N, err);
+            ASSERT(err < 1e-3f);
+
+            fft_transform(&fft, y, true);
+            err = 0;
+            for (uint32_t i = 0; i < N; i++)
+            {
+                err = CMP_MAX(err, hypotf(x[i].real - y[i].real, x[i].imag - y[i].imag));
+            }
+            print("ifft %u: max error %e.\r\n", N, err);
+            ASSERT(err < 1e-5f);
+
+            // 实数：只取实部
+            for (uint32_t i = 0; i < N; i++)
+            {
+                r[i] = x[i].real;
+                x[i].imag = 0;
+            }
+            fft_real_forward(&fft_real, r, y);
+            err = 0;
+            for (uint32_t k = 0; k <= N / 2; k++)
+            {
+                complex_t ref = fft_test_dft(x, N, k);
+                err = CMP_MAX(err, hypotf(ref.real - y[k].real, ref.imag - y[k].imag));
+            }
+            print("rfft %u: max error %e vs dft.\r\n", N, err);
+            ASSERT(err < 1e-3f);
+
+            fft_real_inverse(&fft_real, y, r);
+            err = 0;
+            for (uint32_t i = 0; i < N; i++)
+            {
+                err = CMP_MAX(err, fabsf(x[i].real - r[i]));
+            }
+            print("irfft %u: max error %e.\r\n", N, err);
+            ASSERT(err < 1e-5f);
+        }
+
+        fft_deinit(&fft);
+        fft_real_deinit(&fft_real);
+        if (x != NULL)
+        {
+            FREE(x);
+        }
+        if (y != NULL)
+        {
+            FREE(y);
+        }
+        if (r != NULL)
+        {
+            FREE(r);
+        }
+    }
+
+    // 耗时：64 ~ 4096 点
+    for (uint32_t N = 64; N <= 4096; N <<= 1)
+    {
+        complex_t *x = (complex_t *)MALLOC((N + 2) * sizeof(complex_t));
+        fft_t fft = {0};
+        fft_real_t fft_real = {0};
+        if (x == NULL || !fft_init(&fft, N, false, x, x) || !fft_real_init(&fft_real, N))
+        {
+            log_error("fft_test %u init failed.", N);
+            fft_deinit(&fft);
+            fft_real_deinit(&fft_real);
+            if (x != NULL)
+            {
+                FREE(x);
+            }
+            break;
+        }
+
+        fft_test_signal(x, N);
+        uint32_t cycles = TIMESTAMP_CYCLES;
+        for (uint32_t i = 0; i < FFT_TEST_BENCH_CNT; i++)
+        {
+            PROFILE_SCOPE("fft_transform");
+            fft_transform(&fft, x, false);
+        }
+        cycles = TIMESTAMP_CYCLES - cycles;
+        uint64_t complex_ns = time_cycles_to_ns(&g_time_timer5, cycles) / FFT_TEST_BENCH_CNT;
+
+        fft_test_signal(x, N);
+        cycles = TIMESTAMP_CYCLES;
+        for (uint32_t i = 0; i < FFT_TEST_BENCH_CNT; i++)
+        {
+            PROFILE_SCOPE("fft_real_forward");
+            fft_real_forward(&fft_real, (float *)x, x); // 原地
+        }
+        cycles = TIMESTAMP_CYCLES - cycles;
+        uint64_t real_ns = time_cycles_to_ns(&g_time_timer5, cycles) / FFT_TEST_BENCH_CNT;
+
+        print("N=%4u: complex %llu us, real %llu us.\r\n", N, complex_ns / 1000, real_ns / 1000);
+        fft_deinit(&fft);
+        fft_real_deinit(&fft_real);
+        FREE(x);
+        os_sleep(1);
+    }
+
+    log_info("fft_test end");
+}
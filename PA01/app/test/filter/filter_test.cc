@@ -0,0 +1,955 @@
+/**
+ * @file filter_test.cc
+ * @author WittXie
+ * @brief 滤波器测试：FIR/SOS 块处理与逐点直接计算比对，随机切块校验跨块状态连续，FIR 各阶数、SOS 各节数吞吐；IIR 设计的幅频响应；滤波器组各频带能量，一阶低通组与逐通道 lp_filter 逐位一致及耗时；定点与浮点的信噪比、Q15 累加饱和及吞吐；中值滤波对比排序参考及窗口 3~63 耗时，Hampel 替换野值
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define FILTER_TEST_LENGTH 1000 // 测试信号长度
+#define FILTER_TEST_TAPS 31     // FIR系数个数
+#define FILTER_TEST_DECIMATE 4  // 抽取倍数
+#define FILTER_TEST_INTERP 3    // 插值倍数
+#define FILTER_TEST_BLOCK 97    // 随机切块的最大长度
+#define FILTER_TEST_FS 1000.0f  // 设计用采样率
+#define FILTER_TEST_BANK_CH 4   // 滤波器组通道数
+#define FILTER_TEST_SETTLE 300  // 滤波器组过渡帧数
+#define FILTER_TEST_MEASURE 500 // 滤波器组统计帧数，各测试音都是整周期
+#define FILTER_TEST_MEDIAN 31   // 中值滤波最大窗口
+#define FILTER_TEST_HAMPEL 15   // Hampel 窗口
+#define FILTER_TEST_BANK_MAX 16 // 滤波器组逐位比对最大通道数
+#define FILTER_TEST_FRAMES 200  // 滤波器组逐位比对/计时帧数
+
+static float s_filter_test_x[FILTER_TEST_LENGTH];
+static float s_filter_test_y[FILTER_TEST_LENGTH * FILTER_TEST_INTERP];
+static float s_filter_test_ref[FILTER_TEST_LENGTH * FILTER_TEST_INTERP];
+
+// [-1, 1) 随机数
+static float filter_test_rand(void)
+{
+    return (float)rand() / ((float)RAND_MAX + 1.0f) * 2.0f - 1.0f;
+}
+
+// 随机切块长度 1 ~ FILTER_TEST_BLOCK，不超过剩余长度
+static uint32_t filter_test_block(uint32_t remain)
+{
+    uint32_t n = 1 + (uint32_t)rand() % FILTER_TEST_BLOCK;
+    return (n < remain) ? n : remain;
+}
+
+// 直接卷积 y[n] = Σ h[k]·x[n-k]
+static float filter_test_conv(const float *h, uint32_t taps, const float *x, uint32_t n)
+{
+    double acc = 0;
+    for (uint32_t k = 0; k < taps && k <= n; k++)
+    {
+        acc += (double)h[k] * x[n - k];
+    }
+    return (float)acc;
+}
+
+// 最大绝对误差
+static float filter_test_err(const float *a, const float *b, uint32_t length)
+{
+    float err = 0;
+    for (uint32_t i = 0; i < length; i++)
+    {
+        err = CMP_MAX(err, fabsf(a[i] - b[i]));
+    }
+    return err;
+}
+
+// FIR 吞吐：不同阶数下每样本、每抽头耗时
+static void filter_test_fir_bench(void)
+{
+    static const uint16_t taps[] = {8, 16, 32, 64, 128};
+    static float coeff[128];
+    static float buff[128 * 2];
+    fir_filter_t fir = {0};
+
+    for (uint32_t i = 0; i < countof(coeff); i++)
+    {
+        coeff[i] = filter_test_rand() / countof(coeff);
+    }
+    for (uint32_t k = 0; k < countof(taps); k++)
+    {
+        fir_filter_init(&fir, coeff, taps[k], buff, countof(buff));
+        uint32_t cycles = TIMESTAMP_CYCLES;
+        fir_filter_block(&fir, s_filter_test_x, s_filter_test_y, FILTER_TEST_LENGTH);
+        cycles = TIMESTAMP_CYCLES - cycles;
+        uint64_t ns = CMP_MAX(time_cycles_to_ns(&g_time_timer5, cycles), 1);
+        print("fir %3u taps: %llu ksamples/s, %.2f ns/tap\r\n", taps[k], (uint64_t)FILTER_TEST_LENGTH * 1000000 / ns,
+              (float)ns / FILTER_TEST_LENGTH / taps[k]);
+    }
+}
+
+// FIR：块处理、逐点、抽取、插值
+static uint32_t filter_test_fir(void)
+{
+    static float coeff[FILTER_TEST_TAPS];
+    static float buff[FILTER_TEST_TAPS * 2];
+    fir_filter_t fir = {0};
+    uint32_t fail = 0;
+    float err;
+
+    for (uint32_t i = 0; i < FILTER_TEST_TAPS; i++)
+    {
+        coeff[i] = filter_test_rand() / FILTER_TEST_TAPS;
+    }
+    for (uint32_t n = 0; n < FILTER_TEST_LENGTH; n++)
+    {
+        s_filter_test_ref[n] = filter_test_conv(coeff, FILTER_TEST_TAPS, s_filter_test_x, n);
+    }
+
+    // 块处理：随机切块，原地
+    fir_filter_init(&fir, coeff, FILTER_TEST_TAPS, buff, countof(buff));
+    memcpy(s_filter_test_y, s_filter_test_x, sizeof(s_filter_test_x));
+    for (uint32_t n = 0, block; n < FILTER_TEST_LENGTH; n += block)
+    {
+        block = filter_test_block(FILTER_TEST_LENGTH - n);
+        fir_filter_block(&fir, &s_filter_test_y[n], &s_filter_test_y[n], block);
+    }
+    err = filter_test_err(s_filter_test_y, s_filter_test_ref, FILTER_TEST_LENGTH);
+    fail += !(err < 1e-5f);
+    print("fir block: max err %.2e\r\n", err);
+
+    // 逐点：与块处理同一条延迟线逻辑
+    fir_filter_reset(&fir);
+    for (uint32_t n = 0; n < FILTER_TEST_LENGTH; n++)
+    {
+        s_filter_test_y[n] = fir_filter(&fir, s_filter_test_x[n]);
+    }
+    err = filter_test_err(s_filter_test_y, s_filter_test_ref, FILTER_TEST_LENGTH);
+    fail += !(err < 1e-5f);
+    print("fir sample: max err %.2e\r\n", err);
+
+    // 抽取：第 j 个输出是 y[j·M + M - 1]，相位跨块保持
+    fir_filter_reset(&fir);
+    uint32_t count = 0;
+    for (uint32_t n = 0, block; n < FILTER_TEST_LENGTH; n += block)
+    {
+        block = filter_test_block(FILTER_TEST_LENGTH - n);
+        count += fir_decimate_block(&fir, &s_filter_test_x[n], &s_filter_test_y[count], block, FILTER_TEST_DECIMATE);
+    }
+    err = 0;
+    for (uint32_t j = 0; j < count; j++)
+    {
+        err = CMP_MAX(err, fabsf(s_filter_test_y[j] - s_filter_test_ref[j * FILTER_TEST_DECIMATE + FILTER_TEST_DECIMATE - 1]));
+    }
+    fail += (count != FILTER_TEST_LENGTH / FILTER_TEST_DECIMATE) || !(err < 1e-5f);
+    print("fir decimate x%u: %u out, max err %.2e\r\n", FILTER_TEST_DECIMATE, count, err);
+
+    // 插值：等价于插零后以 L·h 卷积
+    uint32_t taps = FILTER_TEST_TAPS - FILTER_TEST_TAPS % FILTER_TEST_INTERP; // 取 L 的整数倍
+    fir_filter_init(&fir, coeff, taps, buff, countof(buff));
+    count = 0;
+    for (uint32_t n = 0, block; n < FILTER_TEST_LENGTH; n += block)
+    {
+        block = filter_test_block(FILTER_TEST_LENGTH - n);
+        count += fir_interpolate_block(&fir, &s_filter_test_x[n], &s_filter_test_y[count], block, FILTER_TEST_INTERP);
+    }
+    err = 0;
+    for (uint32_t m = 0; m < count; m++)
+    {
+        double acc = 0;
+        for (uint32_t k = m % FILTER_TEST_INTERP; k < taps && k <= m; k += FILTER_TEST_INTERP)
+        {
+            acc += (double)coeff[k] * s_filter_test_x[(m - k) / FILTER_TEST_INTERP];
+        }
+        err = CMP_MAX(err, fabsf(s_filter_test_y[m] - (float)(acc * FILTER_TEST_INTERP)));
+    }
+    fail += (count != FILTER_TEST_LENGTH * FILTER_TEST_INTERP) || !(err < 1e-5f);
+    print("fir interpolate x%u: %u out, max err %.2e\r\n", FILTER_TEST_INTERP, count, err);
+
+    filter_test_fir_bench();
+    return fail;
+}
+
+// 二阶低通节（RBJ），fc 为归一化频率
+static sos_coeff_t filter_test_biquad(float fc, float q)
+{
+    float w = 2.0f * 3.14159265f * fc;
+    float alpha = sinf(w) / (2.0f * q);
+    float a0 = 1.0f + alpha;
+    float cw = cosf(w);
+    sos_coeff_t c = {
+        .b0 = (1.0f - cw) / 2.0f / a0,
+        .b1 = (1.0f - cw) / a0,
+        .b2 = (1.0f - cw) / 2.0f / a0,
+        .a1 = -2.0f * cw / a0,
+        .a2 = (1.0f - alpha) / a0,
+    };
+    return c;
+}
+
+// SOS 吞吐：不同节数下每样本、每节耗时
+static void filter_test_sos_bench(void)
+{
+    static const uint16_t sections[] = {1, 2, 4, 8};
+    static sos_coeff_t coeff[8];
+    static float state[8 * 2];
+    sos_filter_t sos = {0};
+
+    for (uint32_t i = 0; i < countof(coeff); i++)
+    {
+        coeff[i] = filter_test_biquad(0.05f, 0.7071f);
+    }
+    for (uint32_t k = 0; k < countof(sections); k++)
+    {
+        sos_filter_init(&sos, coeff, sections[k], state, 1);
+        uint32_t cycles = TIMESTAMP_CYCLES;
+        sos_filter_block(&sos, 0, s_filter_test_x, s_filter_test_y, FILTER_TEST_LENGTH);
+        cycles = TIMESTAMP_CYCLES - cycles;
+        uint64_t ns = CMP_MAX(time_cycles_to_ns(&g_time_timer5, cycles), 1);
+        print("sos %u sections: %llu ksamples/s, %.2f ns/section\r\n", sections[k], (uint64_t)FILTER_TEST_LENGTH * 1000000 / ns,
+              (float)ns / FILTER_TEST_LENGTH / sections[k]);
+    }
+}
+
+// SOS：双精度直接 I 型逐节计算作参考；两通道交替随机切块，校验通道状态互不干扰
+static uint32_t filter_test_sos(void)
+{
+    static sos_coeff_t coeff[2];
+    static float state[2 * 2 * 2]; // 通道 × 节 × 2
+    sos_filter_t sos = {0};
+    uint32_t fail = 0;
+
+    coeff[0] = filter_test_biquad(0.05f, 0.5412f); // 4阶巴特沃斯的两节 Q
+    coeff[1] = filter_test_biquad(0.05f, 1.3066f);
+
+    // 参考
+    double w[2][4] = {0}; // 每节 x1 x2 y1 y2
+    for (uint32_t n = 0; n < FILTER_TEST_LENGTH; n++)
+    {
+        double x = s_filter_test_x[n];
+        for (uint32_t s = 0; s < 2; s++)
+        {
+            const sos_coeff_t *c = &coeff[s];
+            double y = c->b0 * x + c->b1 * w[s][0] + c->b2 * w[s][1] - c->a1 * w[s][2] - c->a2 * w[s][3];
+            w[s][1] = w[s][0];
+            w[s][0] = x;
+            w[s][3] = w[s][2];
+            w[s][2] = y;
+            x = y;
+        }
+        s_filter_test_ref[n] = (float)x;
+    }
+
+    // 通道0 与 通道1（输入取反）交替处理
+    static float y_ch1[FILTER_TEST_LENGTH];
+    sos_filter_init(&sos, coeff, 2, state, 2);
+    for (uint32_t n = 0, block; n < FILTER_TEST_LENGTH; n += block)
+    {
+        block = filter_test_block(FILTER_TEST_LENGTH - n);
+        sos_filter_block(&sos, 0, &s_filter_test_x[n], &s_filter_test_y[n], block);
+        for (uint32_t i = 0; i < block; i++)
+        {
+            y_ch1[n + i] = -sos_filter(&sos, 1, -s_filter_test_x[n + i]);
+        }
+    }
+    float err0 = filter_test_err(s_filter_test_y, s_filter_test_ref, FILTER_TEST_LENGTH);
+    float err1 = filter_test_err(y_ch1, s_filter_test_ref, FILTER_TEST_LENGTH);
+    fail += !(err0 < 1e-5f) || !(err1 < 1e-5f);
+    print("sos block: max err %.2e, channel 1 sample: max err %.2e\r\n", err0, err1);
+
+    filter_test_sos_bench();
+    return fail;
+}
+
+// 按设计参数生成 SOS，校验通带、截止点、阻带的幅值（dB），以及每节在通带参考频率 ref 处的增益接近 1
+static uint32_t filter_test_response(const char *name, const filter_design_t *design, float ref,
+                                     float pass_db, float cutoff_db, float stop, float stop_db)
+{
+    static sos_coeff_t sos[FILTER_DESIGN_ORDER_MAX];
+    uint16_t sections = filter_design(design, sos, countof(sos));
+    if (sections == 0)
+    {
+        print("%s: design failed\r\n", name);
+        return 1;
+    }
+
+    float pass = 20.0f * log10f(sos_filter_magnitude(sos, sections, ref, design->sample_rate));
+    float cutoff = 20.0f * log10f(sos_filter_magnitude(sos, sections, design->freq1, design->sample_rate));
+    float reject = 20.0f * log10f(sos_filter_magnitude(sos, sections, stop, design->sample_rate));
+    float section_min = 1e9f, section_max = 0.0f;
+    for (uint16_t s = 0; s < sections; s++)
+    {
+        float g = sos_filter_magnitude(&sos[s], 1, ref, design->sample_rate);
+        section_min = CMP_MIN(section_min, g);
+        section_max = CMP_MAX(section_max, g);
+    }
+
+    uint32_t fail = 0;
+    fail += !(fabsf(pass - pass_db) < 0.05f);
+    fail += !(fabsf(cutoff - cutoff_db) < 0.05f);
+    fail += !(reject < stop_db);
+    fail += !(section_min > 0.8f && section_max < 1.25f);
+    print("%s: %u sections, pass %.2f dB, cutoff %.2f dB, %.0f Hz %.1f dB, section gain %.3f~%.3f\r\n",
+          name, sections, pass, cutoff, stop, reject, section_min, section_max);
+    return fail;
+}
+
+// IIR 设计：幅频响应，总增益均分到各节
+static uint32_t filter_test_design(void)
+{
+    uint32_t fail = 0;
+    filter_design_t design = {
+        .proto = FILTER_DESIGN_BUTTERWORTH,
+        .band = FILTER_DESIGN_LOWPASS,
+        .order = 4,
+        .sample_rate = FILTER_TEST_FS,
+        .freq1 = 100.0f,
+    };
+
+    // 4阶巴特沃斯低通：直流 0 dB，截止 -3.01 dB，300Hz 理论 -50.5 dB
+    fail += filter_test_response("butter lp4", &design, 0.0f, 0.0f, -3.01f, 300.0f, -48.0f);
+
+    // 4阶切比雪夫I型低通，1dB 波纹：偶数阶直流在谷底 -1 dB，截止也是 -1 dB，300Hz 理论 -61.9 dB
+    design.proto = FILTER_DESIGN_CHEBY1;
+    design.ripple = 1.0f;
+    fail += filter_test_response("cheby1 lp4", &design, 0.0f, -1.0f, -1.0f, 300.0f, -60.0f);
+
+    // 8阶切比雪夫I型低通：节数多，校验中间级增益不再堆在第一节；150Hz 理论 -59.1 dB
+    design.order = 8;
+    fail += filter_test_response("cheby1 lp8", &design, 0.0f, -1.0f, -1.0f, 150.0f, -55.0f);
+
+    // 3阶巴特沃斯高通：奈奎斯特 0 dB
+    design.proto = FILTER_DESIGN_BUTTERWORTH;
+    design.band = FILTER_DESIGN_HIGHPASS;
+    design.order = 3;
+    fail += filter_test_response("butter hp3", &design, FILTER_TEST_FS / 2, 0.0f, -3.01f, 20.0f, -40.0f);
+
+    // 2阶巴特沃斯带通 100~200Hz：中心（预畸变后的几何中心）0 dB，下边缘 -3.01 dB
+    design.band = FILTER_DESIGN_BANDPASS;
+    design.order = 2;
+    design.freq2 = 200.0f;
+    float center = FILTER_TEST_FS / 3.14159265f * atanf(sqrtf(tanf(3.14159265f * 100.0f / FILTER_TEST_FS) * tanf(3.14159265f * 200.0f / FILTER_TEST_FS)));
+    fail += filter_test_response("butter bp2", &design, center, 0.0f, -3.01f, 20.0f, -25.0f);
+
+    return fail;
+}
+
+// 滤波器组：各通道一个已知单音，统计稳态输出能量（去直流后的方差），与 sos_filter_magnitude 预测比对
+static uint32_t filter_test_bank_band(const char *name, const sos_coeff_t *sos, uint16_t sections)
+{
+    static const float tone[FILTER_TEST_BANK_CH] = {30.0f, 150.0f, 300.0f, 450.0f}; // Hz
+    static const uint8_t index[FILTER_TEST_BANK_CH] = {3, 0, 4, 1};                 // 通道在帧内的位置，打乱顺序
+    static float state[FILTER_DESIGN_ORDER_MAX * 2 * FILTER_TEST_BANK_CH];
+    const float amplitude = 16000.0f / 65535.0f;
+    filter_bank_t bank;
+    uint16_t frame[FILTER_TEST_BANK_CH + 1]; // 多一个不属于任何通道的样本
+    float output[FILTER_TEST_BANK_CH];
+    double sum[FILTER_TEST_BANK_CH] = {0}, sum2[FILTER_TEST_BANK_CH] = {0};
+    uint32_t fail = 0;
+
+    filter_bank_biquad_init(&bank, FILTER_TEST_BANK_CH, state, sos, sections);
+    for (uint32_t n = 0; n < FILTER_TEST_SETTLE + FILTER_TEST_MEASURE; n++)
+    {
+        frame[2] = 0xFFFF;
+        for (uint16_t ch = 0; ch < FILTER_TEST_BANK_CH; ch++)
+        {
+            float x = sinf(2.0f * 3.14159265f * tone[ch] * n / FILTER_TEST_FS);
+            frame[index[ch]] = (uint16_t)lroundf(32768.0f + 16000.0f * x);
+        }
+        filter_bank_process(&bank, frame, 1, FILTER_TEST_BANK_CH + 1, index, 65535.0f, output);
+        if (n >= FILTER_TEST_SETTLE)
+        {
+            for (uint16_t ch = 0; ch < FILTER_TEST_BANK_CH; ch++)
+            {
+                sum[ch] += output[ch];
+                sum2[ch] += (double)output[ch] * output[ch];
+            }
+        }
+    }
+
+    print("%s:", name);
+    for (uint16_t ch = 0; ch < FILTER_TEST_BANK_CH; ch++)
+    {
+        double mean = sum[ch] / FILTER_TEST_MEASURE;
+        double energy = sum2[ch] / FILTER_TEST_MEASURE - mean * mean;
+        float measure = 10.0f * log10f((float)energy / (amplitude * amplitude / 2.0f));            // 相对输入能量
+        float expect = 20.0f * log10f(sos_filter_magnitude(sos, sections, tone[ch], FILTER_TEST_FS)); // 预测
+        if (expect > -40.0f)
+        {
+            fail += !(fabsf(measure - expect) < 0.2f); // 带内及过渡带：能量与幅频响应一致
+        }
+        else
+        {
+            fail += !(measure < -35.0f); // 阻带：只要求压住，余量留给 ADC 量化
+        }
+        print(" %.0fHz %.1f/%.1f dB", tone[ch], measure, expect);
+    }
+    print("\r\n");
+    return fail;
+}
+
+// 一阶低通组与逐通道 lp_filter：4/8/16 通道随机 ADC 帧逐位一致，并对比每帧耗时
+static uint32_t filter_test_bank_lp(void)
+{
+    static const uint16_t channels[] = {4, 8, 16};
+    static uint16_t frame[FILTER_TEST_FRAMES][FILTER_TEST_BANK_MAX];
+    static float state[2 * FILTER_TEST_BANK_MAX];
+    static lp_filter_t lp[FILTER_TEST_BANK_MAX];
+    uint8_t index[FILTER_TEST_BANK_MAX];
+    float output[FILTER_TEST_BANK_MAX];
+    filter_bank_t bank;
+    uint32_t fail = 0;
+
+    for (uint32_t n = 0; n < FILTER_TEST_FRAMES; n++)
+    {
+        for (uint16_t i = 0; i < FILTER_TEST_BANK_MAX; i++)
+        {
+            frame[n][i] = (uint16_t)(32768.0f + 30000.0f * filter_test_rand());
+        }
+    }
+
+    for (uint32_t k = 0; k < countof(channels); k++)
+    {
+        uint16_t count = channels[k];
+        uint32_t mismatch = 0;
+        for (uint16_t ch = 0; ch < count; ch++)
+        {
+            index[ch] = (uint8_t)(count - 1 - ch); // 通道在帧内倒序
+        }
+
+        // 逐位比对
+        filter_bank_lp_init(&bank, count, state, 50.0f, FILTER_TEST_FS, 2);
+        for (uint16_t ch = 0; ch < count; ch++)
+        {
+            lp_filter_init(&lp[ch], 50.0f, FILTER_TEST_FS, 2);
+        }
+        for (uint32_t n = 0; n < FILTER_TEST_FRAMES; n++)
+        {
+            filter_bank_process(&bank, frame[n], 1, FILTER_TEST_BANK_MAX, index, 65535.0f, output);
+            for (uint16_t ch = 0; ch < count; ch++)
+            {
+                float y = lp_filter(&lp[ch], frame[n][index[ch]] / 65535.0f);
+                mismatch += (memcmp(&y, &output[ch], sizeof(float)) != 0);
+            }
+        }
+
+        // 耗时：整段缓存一次处理 vs 逐帧逐通道调用
+        filter_bank_reset(&bank);
+        uint32_t cycles_bank = TIMESTAMP_CYCLES;
+        filter_bank_process(&bank, frame[0], FILTER_TEST_FRAMES, FILTER_TEST_BANK_MAX, index, 65535.0f, output);
+        cycles_bank = TIMESTAMP_CYCLES - cycles_bank;
+
+        for (uint16_t ch = 0; ch < count; ch++)
+        {
+            lp_filter_init(&lp[ch], 50.0f, FILTER_TEST_FS, 2);
+        }
+        float y[FILTER_TEST_BANK_MAX];
+        uint32_t cycles_loop = TIMESTAMP_CYCLES;
+        for (uint32_t n = 0; n < FILTER_TEST_FRAMES; n++)
+        {
+            for (uint16_t ch = 0; ch < count; ch++)
+            {
+                y[ch] = lp_filter(&lp[ch], frame[n][index[ch]] / 65535.0f);
+            }
+        }
+        cycles_loop = TIMESTAMP_CYCLES - cycles_loop;
+        mismatch += (memcmp(y, output, count * sizeof(float)) != 0); // 整段处理的最后一帧
+
+        fail += (mismatch != 0);
+        print("bank lp %2u ch: %u mismatch, bank %llu ns/frame, lp_filter loop %llu ns/frame\r\n", count, mismatch,
+              time_cycles_to_ns(&g_time_timer5, cycles_bank) / FILTER_TEST_FRAMES,
+              time_cycles_to_ns(&g_time_timer5, cycles_loop) / FILTER_TEST_FRAMES);
+    }
+    return fail;
+}
+
+// 滤波器组：低通、带通、高通三组频带，交错 ADC 缓存，每个频带只留下对应的测试音
+static uint32_t filter_test_bank(void)
+{
+    static sos_coeff_t sos[FILTER_DESIGN_ORDER_MAX];
+    uint32_t fail = 0;
+    filter_design_t design = {
+        .proto = FILTER_DESIGN_BUTTERWORTH,
+        .band = FILTER_DESIGN_LOWPASS,
+        .order = 4,
+        .sample_rate = FILTER_TEST_FS,
+        .freq1 = 80.0f,
+    };
+    uint16_t sections = filter_design(&design, sos, countof(sos));
+    fail += (sections == 0) || filter_test_bank_band("bank lp 80Hz", sos, sections);
+
+    design.band = FILTER_DESIGN_BANDPASS;
+    design.order = 3;
+    design.freq1 = 120.0f;
+    design.freq2 = 190.0f;
+    sections = filter_design(&design, sos, countof(sos));
+    fail += (sections == 0) || filter_test_bank_band("bank bp 120~190Hz", sos, sections);
+
+    design.band = FILTER_DESIGN_HIGHPASS;
+    design.order = 4;
+    design.freq1 = 380.0f;
+    sections = filter_design(&design, sos, countof(sos));
+    fail += (sections == 0) || filter_test_bank_band("bank hp 380Hz", sos, sections);
+
+    fail += filter_test_bank_lp();
+    return fail;
+}
+
+// 信噪比 dB，以浮点输出为参考
+static float filter_test_snr(const float *ref, const float *y, uint32_t length)
+{
+    double signal = 0, noise = 0;
+    for (uint32_t i = 0; i < length; i++)
+    {
+        signal += (double)ref[i] * ref[i];
+        noise += ((double)ref[i] - y[i]) * ((double)ref[i] - y[i]);
+    }
+    return (noise > 0) ? (float)(10.0 * log10(signal / noise)) : 200.0f;
+}
+
+// 定点双二阶 Q31/Q15 对浮点 sos_filter 的信噪比
+static uint32_t filter_test_q_biquad(const char *name, const sos_coeff_t *sos, uint16_t sections,
+                                     const q15_t *x15, const q31_t *x31, float snr31_min, float snr15_min)
+{
+    static sos_q31_t c31[FILTER_DESIGN_ORDER_MAX];
+    static sos_q15_t c15[FILTER_DESIGN_ORDER_MAX];
+    static q31_t state31[FILTER_DESIGN_ORDER_MAX * 5];
+    static int32_t state15[FILTER_DESIGN_ORDER_MAX * 5];
+    static float state[FILTER_DESIGN_ORDER_MAX * 2];
+    static q31_t y31[FILTER_TEST_LENGTH];
+    static q15_t y15[FILTER_TEST_LENGTH];
+    sos_filter_t filter;
+    biquad_q31_t q31;
+    biquad_q15_t q15;
+
+    sos_filter_init(&filter, sos, sections, state, 1);
+    sos_filter_block(&filter, 0, s_filter_test_x, s_filter_test_ref, FILTER_TEST_LENGTH);
+
+    uint32_t fail = !sos_to_q31(sos, sections, c31) || !sos_to_q15(sos, sections, c15);
+    biquad_q31_init(&q31, c31, sections, state31, true);
+    biquad_q15_init(&q15, c15, sections, state15, true);
+    biquad_q31_block(&q31, x31, y31, FILTER_TEST_LENGTH);
+    biquad_q15_block(&q15, x15, y15, FILTER_TEST_LENGTH);
+
+    for (uint32_t i = 0; i < FILTER_TEST_LENGTH; i++)
+    {
+        s_filter_test_y[i] = q31_to_float(y31[i]);
+    }
+    float snr31 = filter_test_snr(s_filter_test_ref, s_filter_test_y, FILTER_TEST_LENGTH);
+    for (uint32_t i = 0; i < FILTER_TEST_LENGTH; i++)
+    {
+        s_filter_test_y[i] = q15_to_float(y15[i]);
+    }
+    float snr15 = filter_test_snr(s_filter_test_ref, s_filter_test_y, FILTER_TEST_LENGTH);
+    fail += !(snr31 > snr31_min) || !(snr15 > snr15_min);
+    print("%s: q31 snr %.1f dB, q15 snr %.1f dB\r\n", name, snr31, snr15);
+    return fail;
+}
+
+// 定点与浮点吞吐：同一 FIR / 双二阶分别以 float、Q31、Q15 处理整段信号
+static void filter_test_q_bench(const sos_coeff_t *sos, uint16_t sections, const q15_t *x15, const q31_t *x31)
+{
+    static float coeff[FILTER_TEST_TAPS], buff[FILTER_TEST_TAPS * 2];
+    static q15_t fir15[FILTER_TEST_TAPS], buff15[FILTER_TEST_TAPS * 2], y15[FILTER_TEST_LENGTH];
+    static q31_t fir31[FILTER_TEST_TAPS], buff31[FILTER_TEST_TAPS * 2], y31[FILTER_TEST_LENGTH];
+    static sos_q31_t c31[FILTER_DESIGN_ORDER_MAX];
+    static sos_q15_t c15[FILTER_DESIGN_ORDER_MAX];
+    static q31_t state31[FILTER_DESIGN_ORDER_MAX * 5];
+    static int32_t state15[FILTER_DESIGN_ORDER_MAX * 5];
+    static float state[FILTER_DESIGN_ORDER_MAX * 2];
+    uint64_t ns[3];
+
+    for (uint32_t i = 0; i < FILTER_TEST_TAPS; i++)
+    {
+        coeff[i] = filter_test_rand() / FILTER_TEST_TAPS;
+        fir15[i] = float_to_q15(coeff[i]);
+        fir31[i] = float_to_q31(coeff[i]);
+    }
+    fir_filter_t fir;
+    fir_q31_t f31;
+    fir_q15_t f15;
+    fir_filter_init(&fir, coeff, FILTER_TEST_TAPS, buff, countof(buff));
+    fir_q31_init(&f31, fir31, FILTER_TEST_TAPS, buff31);
+    fir_q15_init(&f15, fir15, FILTER_TEST_TAPS, buff15);
+
+    uint32_t cycles = TIMESTAMP_CYCLES;
+    fir_filter_block(&fir, s_filter_test_x, s_filter_test_y, FILTER_TEST_LENGTH);
+    cycles = TIMESTAMP_CYCLES - cycles;
+    ns[0] = CMP_MAX(time_cycles_to_ns(&g_time_timer5, cycles), 1);
+    cycles = TIMESTAMP_CYCLES;
+    fir_q31_block(&f31, x31, y31, FILTER_TEST_LENGTH);
+    cycles = TIMESTAMP_CYCLES - cycles;
+    ns[1] = CMP_MAX(time_cycles_to_ns(&g_time_timer5, cycles), 1);
+    cycles = TIMESTAMP_CYCLES;
+    fir_q15_block(&f15, x15, y15, FILTER_TEST_LENGTH);
+    cycles = TIMESTAMP_CYCLES - cycles;
+    ns[2] = CMP_MAX(time_cycles_to_ns(&g_time_timer5, cycles), 1);
+    print("fir %u taps: float %llu, q31 %llu, q15 %llu ksamples/s\r\n", FILTER_TEST_TAPS,
+          (uint64_t)FILTER_TEST_LENGTH * 1000000 / ns[0], (uint64_t)FILTER_TEST_LENGTH * 1000000 / ns[1],
+          (uint64_t)FILTER_TEST_LENGTH * 1000000 / ns[2]);
+
+    sos_filter_t filter;
+    biquad_q31_t q31;
+    biquad_q15_t q15;
+    sos_to_q31(sos, sections, c31);
+    sos_to_q15(sos, sections, c15);
+    sos_filter_init(&filter, sos, sections, state, 1);
+    biquad_q31_init(&q31, c31, sections, state31, true);
+    biquad_q15_init(&q15, c15, sections, state15, true);
+
+    cycles = TIMESTAMP_CYCLES;
+    sos_filter_block(&filter, 0, s_filter_test_x, s_filter_test_y, FILTER_TEST_LENGTH);
+    cycles = TIMESTAMP_CYCLES - cycles;
+    ns[0] = CMP_MAX(time_cycles_to_ns(&g_time_timer5, cycles), 1);
+    cycles = TIMESTAMP_CYCLES;
+    biquad_q31_block(&q31, x31, y31, FILTER_TEST_LENGTH);
+    cycles = TIMESTAMP_CYCLES - cycles;
+    ns[1] = CMP_MAX(time_cycles_to_ns(&g_time_timer5, cycles), 1);
+    cycles = TIMESTAMP_CYCLES;
+    biquad_q15_block(&q15, x15, y15, FILTER_TEST_LENGTH);
+    cycles = TIMESTAMP_CYCLES - cycles;
+    ns[2] = CMP_MAX(time_cycles_to_ns(&g_time_timer5, cycles), 1);
+    print("biquad %u sections: float %llu, q31 %llu, q15 %llu ksamples/s\r\n", sections,
+          (uint64_t)FILTER_TEST_LENGTH * 1000000 / ns[0], (uint64_t)FILTER_TEST_LENGTH * 1000000 / ns[1],
+          (uint64_t)FILTER_TEST_LENGTH * 1000000 / ns[2]);
+}
+
+// 定点：FIR、双二阶、一阶低通/高通，输入取半幅随机信号的定点值，浮点参考用同一量化后的输入
+static uint32_t filter_test_q(void)
+{
+    static q15_t x15[FILTER_TEST_LENGTH], y15[FILTER_TEST_LENGTH], fir15[FILTER_TEST_TAPS], buff15[FILTER_TEST_TAPS * 2];
+    static q31_t x31[FILTER_TEST_LENGTH], y31[FILTER_TEST_LENGTH], fir31[FILTER_TEST_TAPS], buff31[FILTER_TEST_TAPS * 2];
+    static float coeff[FILTER_TEST_TAPS];
+    uint32_t fail = 0;
+
+    // 保存浮点输入，结束时还原
+    static float x[FILTER_TEST_LENGTH];
+    memcpy(x, s_filter_test_x, sizeof(x));
+    for (uint32_t i = 0; i < FILTER_TEST_LENGTH; i++)
+    {
+        x15[i] = float_to_q15(x[i] * 0.5f);
+        x31[i] = (q31_t)x15[i] * 65536;
+        s_filter_test_x[i] = q15_to_float(x15[i]);
+    }
+
+    // FIR：系数量化与累加截断
+    for (uint32_t i = 0; i < FILTER_TEST_TAPS; i++)
+    {
+        coeff[i] = filter_test_rand() / FILTER_TEST_TAPS;
+        fir15[i] = float_to_q15(coeff[i]);
+        fir31[i] = float_to_q31(coeff[i]);
+    }
+    for (uint32_t n = 0; n < FILTER_TEST_LENGTH; n++)
+    {
+        s_filter_test_ref[n] = filter_test_conv(coeff, FILTER_TEST_TAPS, s_filter_test_x, n);
+    }
+    fir_q15_t f15;
+    fir_q31_t f31;
+    fir_q15_init(&f15, fir15, FILTER_TEST_TAPS, buff15);
+    fir_q31_init(&f31, fir31, FILTER_TEST_TAPS, buff31);
+    fir_q15_block(&f15, x15, y15, FILTER_TEST_LENGTH);
+    fir_q31_block(&f31, x31, y31, FILTER_TEST_LENGTH);
+    for (uint32_t i = 0; i < FILTER_TEST_LENGTH; i++)
+    {
+        s_filter_test_y[i] = q31_to_float(y31[i]);
+    }
+    float snr31 = filter_test_snr(s_filter_test_ref, s_filter_test_y, FILTER_TEST_LENGTH);
+    for (uint32_t i = 0; i < FILTER_TEST_LENGTH; i++)
+    {
+        s_filter_test_y[i] = q15_to_float(y15[i]);
+    }
+    float snr15 = filter_test_snr(s_filter_test_ref, s_filter_test_y, FILTER_TEST_LENGTH);
+    fail += !(snr31 > 120.0f) || !(snr15 > 50.0f);
+    print("fir: q31 snr %.1f dB, q15 snr %.1f dB\r\n", snr31, snr15);
+
+    // 双二阶：4阶巴特沃斯低通 100Hz
+    static sos_coeff_t sos[2];
+    filter_design_t design = {
+        .proto = FILTER_DESIGN_BUTTERWORTH,
+        .band = FILTER_DESIGN_LOWPASS,
+        .order = 4,
+        .sample_rate = FILTER_TEST_FS,
+        .freq1 = 100.0f,
+    };
+    uint16_t sections = filter_design(&design, sos, countof(sos));
+    fail += (sections != 2) || filter_test_q_biquad("biquad", sos, sections, x15, x31, 120.0f, 60.0f);
+
+    // 同一滤波器，增益挪到最后一节：逐节 shift，第一节的小系数不再跟着大系数一起缩小
+    const float gain = 32.0f;
+    sos[0].b0 /= gain;
+    sos[0].b1 /= gain;
+    sos[0].b2 /= gain;
+    sos[1].b0 *= gain;
+    sos[1].b1 *= gain;
+    sos[1].b2 *= gain;
+    fail += filter_test_q_biquad("biquad gain in last section", sos, sections, x15, x31, 120.0f, 48.0f); // 统一 shift 时 q15 约 40 dB
+
+    // 双二阶 Q15 累加溢出：b0 = b1 = -1，输入满幅 -1，两项之和 2^31 超出 int32，应饱和到正满幅
+    static const sos_q15_t c_max = {.b0 = -32768, .b1 = -32768, .shift = 1};
+    static int32_t state_max[5];
+    static const q15_t x_max[4] = {-32768, -32768, -32768, -32768};
+    q15_t y_max[4];
+    biquad_q15_t q15_max;
+    biquad_q15_init(&q15_max, &c_max, 1, state_max, false);
+    biquad_q15_block(&q15_max, x_max, y_max, countof(y_max));
+    for (uint32_t i = 0; i < countof(y_max); i++)
+    {
+        fail += (y_max[i] != 32767);
+    }
+
+    // 一阶低通/高通：双精度参考，系数取定点化后的 alpha
+    onepole_q_t lp15, lp31, hp15;
+    onepole_q_init(&lp15, 50.0f, FILTER_TEST_FS, false);
+    onepole_q_init(&lp31, 50.0f, FILTER_TEST_FS, false);
+    onepole_q_init(&hp15, 50.0f, FILTER_TEST_FS, true);
+    onepole_q15_block(&lp15, x15, y15, FILTER_TEST_LENGTH);
+    onepole_q31_block(&lp31, x31, y31, FILTER_TEST_LENGTH);
+    double alpha = q31_to_float(lp15.alpha), state = s_filter_test_x[0];
+    for (uint32_t n = 0; n < FILTER_TEST_LENGTH; n++)
+    {
+        state += alpha * (s_filter_test_x[n] - state);
+        s_filter_test_ref[n] = (float)state;
+        s_filter_test_y[n] = q31_to_float(y31[n]);
+    }
+    snr31 = filter_test_snr(s_filter_test_ref, s_filter_test_y, FILTER_TEST_LENGTH);
+    for (uint32_t n = 0; n < FILTER_TEST_LENGTH; n++)
+    {
+        s_filter_test_y[n] = q15_to_float(y15[n]);
+    }
+    snr15 = filter_test_snr(s_filter_test_ref, s_filter_test_y, FILTER_TEST_LENGTH);
+    onepole_q15_block(&hp15, x15, y15, FILTER_TEST_LENGTH);
+    for (uint32_t n = 0; n < FILTER_TEST_LENGTH; n++)
+    {
+        s_filter_test_ref[n] = s_filter_test_x[n] - s_filter_test_ref[n];
+        s_filter_test_y[n] = q15_to_float(y15[n]);
+    }
+    float snr_hp = filter_test_snr(s_filter_test_ref, s_filter_test_y, FILTER_TEST_LENGTH);
+    fail += !(snr31 > 120.0f) || !(snr15 > 60.0f) || !(snr_hp > 60.0f);
+    print("onepole: lp q31 snr %.1f dB, lp q15 snr %.1f dB, hp q15 snr %.1f dB\r\n", snr31, snr15, snr_hp);
+
+    filter_test_q_bench(sos, sections, x15, x31);
+    memcpy(s_filter_test_x, x, sizeof(x));
+    return fail;
+}
+
+// 中值参考：对最近 min(n+1, window) 个样本插入排序取中间，偶数个取两中间值的均值（整数向下取整）
+static float filter_test_median_ref(const float *x, uint32_t n, uint16_t window, bool is_int)
+{
+    static float sorted[FILTER_TEST_MEDIAN];
+    uint32_t count = CMP_MIN(n + 1, (uint32_t)window);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        float v = x[n - i];
+        uint32_t j = i;
+        for (; j > 0 && sorted[j - 1] > v; j--)
+        {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = v;
+    }
+    if (count & 1)
+    {
+        return sorted[count / 2];
+    }
+    if (is_int)
+    {
+        return (float)(((int32_t)sorted[count / 2 - 1] + (int32_t)sorted[count / 2]) >> 1);
+    }
+    return (sorted[count / 2 - 1] + sorted[count / 2]) * 0.5f;
+}
+
+// 中值：双堆与有序窗口逐点/随机切块对比参考，含未填满阶段、重复值、整数极值与复位
+// 中值吞吐：窗口 3~63 下双堆、有序窗口、Hampel 每样本耗时
+static void filter_test_median_bench(void)
+{
+    static const uint16_t windows[] = {3, 7, 15, 31, 63};
+    static float data[63], buff[2 * 63];
+    static int16_t index[2 * 63];
+    median_f32_t median;
+    median_sorted_f32_t sorted;
+    hampel_f32_t hampel;
+
+    for (uint32_t w = 0; w < countof(windows); w++)
+    {
+        uint16_t window = windows[w];
+        median_f32_init(&median, window, data, index);
+        uint32_t cycles_heap = TIMESTAMP_CYCLES;
+        median_f32_block(&median, s_filter_test_x, s_filter_test_y, FILTER_TEST_LENGTH);
+        cycles_heap = TIMESTAMP_CYCLES - cycles_heap;
+
+        median_sorted_f32_init(&sorted, window, buff);
+        uint32_t cycles_sorted = TIMESTAMP_CYCLES;
+        median_sorted_f32_block(&sorted, s_filter_test_x, s_filter_test_y, FILTER_TEST_LENGTH);
+        cycles_sorted = TIMESTAMP_CYCLES - cycles_sorted;
+
+        hampel_f32_init(&hampel, window, buff, 3.0f);
+        uint32_t cycles_hampel = TIMESTAMP_CYCLES;
+        hampel_f32_block(&hampel, s_filter_test_x, s_filter_test_y, FILTER_TEST_LENGTH);
+        cycles_hampel = TIMESTAMP_CYCLES - cycles_hampel;
+
+        print("median bench window %2u: heap %llu, sorted %llu, hampel %llu ns/sample\r\n", window,
+              time_cycles_to_ns(&g_time_timer5, cycles_heap) / FILTER_TEST_LENGTH,
+              time_cycles_to_ns(&g_time_timer5, cycles_sorted) / FILTER_TEST_LENGTH,
+              time_cycles_to_ns(&g_time_timer5, cycles_hampel) / FILTER_TEST_LENGTH);
+    }
+}
+
+static uint32_t filter_test_median(void)
+{
+    static const uint16_t windows[] = {1, 2, 4, 5, 16, 31};
+    static float data[FILTER_TEST_MEDIAN], buff[2 * FILTER_TEST_MEDIAN];
+    static int16_t index[2 * FILTER_TEST_MEDIAN];
+    static int16_t data_s16[FILTER_TEST_MEDIAN], x_s16[FILTER_TEST_LENGTH], y_s16[FILTER_TEST_LENGTH];
+    static uint16_t buff_u16[2 * FILTER_TEST_MEDIAN], x_u16[FILTER_TEST_LENGTH], y_u16[FILTER_TEST_LENGTH];
+    static float x_dup[FILTER_TEST_LENGTH], xf_s16[FILTER_TEST_LENGTH], xf_u16[FILTER_TEST_LENGTH];
+    uint32_t fail = 0;
+
+    // 重复值：只取 8 个电平；整数：半数样本取满量程极值，检验均值不溢出
+    for (uint32_t n = 0; n < FILTER_TEST_LENGTH; n++)
+    {
+        x_dup[n] = (float)(rand() % 8);
+        x_s16[n] = (rand() & 1) ? (int16_t)(rand() - RAND_MAX / 2) : ((rand() & 1) ? INT16_MAX : INT16_MIN);
+        x_u16[n] = (rand() & 1) ? (uint16_t)rand() : UINT16_MAX;
+        xf_s16[n] = x_s16[n];
+        xf_u16[n] = x_u16[n];
+    }
+
+    for (uint32_t w = 0; w < countof(windows); w++)
+    {
+        uint16_t window = windows[w];
+        median_f32_t median;
+        median_sorted_f32_t sorted;
+        uint32_t err = 0;
+
+        // 浮点：双堆逐点、有序窗口随机切块，与参考逐点相等
+        for (uint32_t pass = 0; pass < 2; pass++)
+        {
+            const float *x = (pass == 0) ? s_filter_test_x : x_dup;
+            for (uint32_t n = 0; n < FILTER_TEST_LENGTH; n++)
+            {
+                s_filter_test_ref[n] = filter_test_median_ref(x, n, window, false);
+            }
+
+            median_f32_init(&median, window, data, index);
+            median_sorted_f32_init(&sorted, window, buff);
+            for (uint32_t n = 0, block; n < FILTER_TEST_LENGTH; n += block)
+            {
+                block = filter_test_block(FILTER_TEST_LENGTH - n);
+                median_sorted_f32_block(&sorted, &x[n], &s_filter_test_y[n], block);
+                for (uint32_t i = n; i < n + block; i++)
+                {
+                    err += (median_f32(&median, x[i]) != s_filter_test_ref[i]) || (s_filter_test_y[i] != s_filter_test_ref[i]);
+                }
+            }
+            err += !median_is_full(&median) || !median_is_full(&sorted);
+
+            // 复位后重新从空窗口开始
+            median_f32_reset(&median);
+            median_sorted_f32_reset(&sorted);
+            err += median_is_full(&median) || median_is_full(&sorted);
+            median_f32_block(&median, x, s_filter_test_y, window);
+            for (uint32_t n = 0; n < window; n++)
+            {
+                err += (s_filter_test_y[n] != s_filter_test_ref[n]) || (median_sorted_f32(&sorted, x[n]) != s_filter_test_ref[n]);
+            }
+        }
+
+        // 整数：s16 极值与 u16 满量程，双堆块处理与有序窗口逐点
+        median_s16_t median_s16;
+        median_sorted_u16_t sorted_u16;
+        median_s16_init(&median_s16, window, data_s16, index);
+        median_sorted_u16_init(&sorted_u16, window, buff_u16);
+        median_s16_block(&median_s16, x_s16, y_s16, FILTER_TEST_LENGTH);
+        for (uint32_t n = 0; n < FILTER_TEST_LENGTH; n++)
+        {
+            y_u16[n] = median_sorted_u16(&sorted_u16, x_u16[n]);
+            err += (y_s16[n] != filter_test_median_ref(xf_s16, n, window, true));
+            err += (y_u16[n] != filter_test_median_ref(xf_u16, n, window, true));
+        }
+
+        fail += (err != 0);
+        print("median window %u: %u mismatch\r\n", window, err);
+    }
+    filter_test_median_bench();
+    return fail;
+}
+
+// Hampel：斜坡 -5~5 上每 50 个样本注入一个 ±10 的野值，输出延迟 window/2；野值被替换为窗口中值（偏离原值不超过一个台阶），其余样本原样输出
+// 斜坡上窗口中心恰为中值，不会误判；随机噪声的窗口 MAD 起伏大，按 3 倍门限仍会偶发替换
+static uint32_t filter_test_hampel(void)
+{
+    static float buff[2 * FILTER_TEST_HAMPEL];
+    static int16_t buff_s16[2 * FILTER_TEST_HAMPEL], x_s16[FILTER_TEST_LENGTH], y_s16[FILTER_TEST_LENGTH];
+    hampel_f32_t hampel;
+    hampel_s16_t hampel_s16;
+    uint32_t fail = 0, spikes = 0;
+
+    // s_filter_test_x 作斜坡，s_filter_test_ref 作带野值的输入
+    for (uint32_t n = 0; n < FILTER_TEST_LENGTH; n++)
+    {
+        bool is_spike = (n % 50 == 40) && (n + FILTER_TEST_HAMPEL / 2 < FILTER_TEST_LENGTH);
+        s_filter_test_x[n] = n * 0.01f - 5.0f;
+        s_filter_test_ref[n] = s_filter_test_x[n] + (is_spike ? ((n / 50 & 1) ? 10.0f : -10.0f) : 0);
+        x_s16[n] = (int16_t)(s_filter_test_ref[n] * 1000.0f);
+        spikes += is_spike;
+    }
+
+    hampel_f32_init(&hampel, FILTER_TEST_HAMPEL, buff, 3.0f);
+    hampel_s16_init(&hampel_s16, FILTER_TEST_HAMPEL, buff_s16, 3.0f);
+    hampel_s16_block(&hampel_s16, x_s16, y_s16, FILTER_TEST_LENGTH);
+    for (uint32_t n = 0, block; n < FILTER_TEST_LENGTH; n += block)
+    {
+        block = filter_test_block(FILTER_TEST_LENGTH - n);
+        hampel_f32_block(&hampel, &s_filter_test_ref[n], &s_filter_test_y[n], block);
+    }
+
+    uint32_t err = 0;
+    for (uint32_t n = 0; n < FILTER_TEST_LENGTH; n++)
+    {
+        uint32_t center = n - CMP_MIN(n + 1, (uint32_t)FILTER_TEST_HAMPEL) / 2;
+        if (s_filter_test_ref[center] != s_filter_test_x[center])
+        {
+            err += !(fabsf(s_filter_test_y[n] - s_filter_test_x[center]) < 0.011f) || !(abs(y_s16[n] - (int16_t)(s_filter_test_x[center] * 1000.0f)) <= 11);
+        }
+        else
+        {
+            err += (s_filter_test_y[n] != s_filter_test_ref[center]) || (y_s16[n] != x_s16[center]);
+        }
+    }
+    fail += (err != 0) || (hampel.replaced != spikes) || (hampel_s16.replaced != spikes);
+    print("hampel: %u spikes, replaced f32 %u s16 %u, %u mismatch\r\n", spikes, hampel.replaced, hampel_s16.replaced, err);
+    return fail;
+}
+
+static void filter_test(void)
+{
+    log_info("filter_test start");
+
+    srand(1);
+    for (uint32_t i = 0; i < FILTER_TEST_LENGTH; i++)
+    {
+        s_filter_test_x[i] = filter_test_rand();
+    }
+
+    uint32_t fail = filter_test_fir();
+    print("fir %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    fail = filter_test_sos();
+    print("sos %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    fail = filter_test_design();
+    print("design %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    fail = filter_test_bank();
+    print("bank %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    fail = filter_test_q();
+    print("q %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    fail = filter_test_median();
+    print("median %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    fail = filter_test_hampel();
+    print("hampel %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    log_info("filter_test end");
+}
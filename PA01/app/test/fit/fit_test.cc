@@ -0,0 +1,271 @@
+/**
+ * @file fit_test.cc
+ * @author WittXie
+ * @brief 拟合测试：已知模型的直线/指数/多项式/递推最小二乘，校验参数、R²（批量在原始空间，流式在线性化空间）、遗忘因子跟踪与批量/流式一致；各更新/求解耗时
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define FIT_TEST_SIZE 200 // 样本数
+
+// [-1, 1) 随机数
+static float fit_test_rand(void)
+{
+    return (float)rand() / ((float)RAND_MAX + 1.0f) * 2.0f - 1.0f;
+}
+
+static float fit_test_exp(float x)
+{
+    return expf(x);
+}
+
+static float fit_test_log(float x)
+{
+    return logf(x);
+}
+
+// 流式直线：无噪声精确、有噪声 R² 下降、遗忘因子跟踪斜率突变
+static uint32_t fit_test_stream(void)
+{
+    fit_stream_t fit;
+    fit_params_t params;
+    uint32_t fail = 0;
+
+    // y = 2 + 0.5x
+    fit_stream_init(&fit, NULL, 1.0f);
+    for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+    {
+        fit_stream_update(&fit, (float)i, 2.0f + 0.5f * i);
+    }
+    params = fit_stream_result(&fit);
+    fail += !(fabsf(params.a - 2.0f) < 1e-4f) || !(fabsf(params.b - 0.5f) < 1e-6f) || !(params.r2 > 0.99999f);
+    fail += !(fabsf(fit_stream_predict(&fit, 1000.0f) - 502.0f) < 1e-2f);
+    print("line: a %.5f b %.6f r2 %.6f\r\n", params.a, params.b, params.r2);
+
+    // 加 ±1 均匀噪声，x 跨度 0~199：参数仍接近，R² 小于 1
+    fit_stream_init(&fit, NULL, 1.0f);
+    for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+    {
+        fit_stream_update(&fit, (float)i, 2.0f + 0.5f * i + fit_test_rand());
+    }
+    params = fit_stream_result(&fit);
+    fail += !(fabsf(params.a - 2.0f) < 0.3f) || !(fabsf(params.b - 0.5f) < 3e-3f) || !(params.r2 < 0.9999f && params.r2 > 0.999f);
+    print("line noisy: a %.4f b %.5f r2 %.6f\r\n", params.a, params.b, params.r2);
+
+    // 遗忘因子 0.9（窗口约 10 个样本）：斜率由 +1 变为 -1 后 100 个样本内跟上
+    fit_stream_init(&fit, NULL, 0.9f);
+    for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+    {
+        float y = (i < FIT_TEST_SIZE / 2) ? (float)i : (float)(FIT_TEST_SIZE - i);
+        fit_stream_update(&fit, (float)i, y);
+    }
+    params = fit_stream_result(&fit);
+    fail += !(fabsf(params.b + 1.0f) < 1e-3f) || !(fabsf(fit_stream_predict(&fit, FIT_TEST_SIZE) - 0.0f) < 0.05f);
+    print("line lambda 0.9: b %.5f\r\n", params.b);
+
+    return fail;
+}
+
+// 指数：y = 3 * exp(0.02x)，流式与批量 fit_training 结果相同
+static uint32_t fit_test_exp_model(void)
+{
+    static fit_data_t data[FIT_TEST_SIZE];
+    fit_cfg_t cfg = {.func = fit_test_exp, .defunc = fit_test_log, .enable_r2 = true};
+    fit_stream_t fit;
+    uint32_t fail = 0;
+
+    fit_stream_init(&fit, &cfg, 1.0f);
+    for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+    {
+        data[i].x = (float)i;
+        data[i].y = 3.0f * expf(0.02f * i);
+        fit_stream_update(&fit, data[i].x, data[i].y);
+    }
+    fit_params_t stream = fit_stream_result(&fit);
+    fit_params_t batch = fit_training(&cfg, data, FIT_TEST_SIZE);
+    fail += !(fabsf(stream.a - 3.0f) < 1e-3f) || !(fabsf(stream.b - 0.02f) < 1e-6f) || !(stream.r2 > 0.99999f);
+    fail += (stream.a != batch.a) || (stream.b != batch.b);
+    fail += !(fabsf(fit_predict(&cfg, batch, 250) / (3.0f * expf(5.0f)) - 1.0f) < 1e-3f);
+    print("exp: a %.5f b %.7f r2 %.6f, batch a %.5f b %.7f\r\n", stream.a, stream.b, stream.r2, batch.a, batch.b);
+
+    // 加 ±5% 乘性噪声：批量 R² 在原始空间 y 上，与按定义直接计算的一致；流式 R² 在 log(y) 上，两者不同
+    for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+    {
+        data[i].y = 3.0f * expf(0.02f * i) * (1.0f + 0.05f * fit_test_rand());
+    }
+    batch = fit_training(&cfg, data, FIT_TEST_SIZE);
+    double mean = 0, ss_res = 0, ss_tot = 0;
+    for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+    {
+        mean += data[i].y / FIT_TEST_SIZE;
+    }
+    for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+    {
+        double e = data[i].y - batch.a * exp((double)batch.b * data[i].x);
+        ss_res += e * e;
+        ss_tot += (data[i].y - mean) * (data[i].y - mean);
+    }
+    fit_stream_init(&fit, &cfg, 1.0f);
+    for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+    {
+        fit_stream_update(&fit, data[i].x, data[i].y);
+    }
+    stream = fit_stream_result(&fit);
+    fail += !(fabs(batch.r2 - (1.0 - ss_res / ss_tot)) < 1e-4) || !(fabsf(batch.r2 - stream.r2) > 1e-3f);
+    print("exp noisy: batch r2 %.5f (y), stream r2 %.5f (log y)\r\n", batch.r2, stream.r2);
+    return fail;
+}
+
+// 多项式：y = 1 - 2u + 0.5u² + 0.01u³，x 远离原点（1000~1020），检验以首样本为原点后的数值稳定性
+static uint32_t fit_test_poly(void)
+{
+    fit_poly_t fit;
+    uint32_t fail = 0;
+
+    fit_poly_init(&fit, 3, 1.0f);
+    fail += fit_poly_solve(&fit); // 无样本应失败
+    for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+    {
+        float u = i * 0.1f;
+        fit_poly_update(&fit, 1000.0f + u, 1.0f - 2.0f * u + 0.5f * u * u + 0.01f * u * u * u);
+    }
+    fail += !fit_poly_solve(&fit);
+
+    float err = 0;
+    for (float u = 0; u <= 25.0f; u += 0.5f) // 含 5 个单位的外推
+    {
+        float expect = 1.0f - 2.0f * u + 0.5f * u * u + 0.01f * u * u * u;
+        err = CMP_MAX(err, fabsf(fit_poly_predict(&fit, 1000.0f + u) - expect));
+    }
+    fail += !(err < 0.05f) || !(fit.r2 > 0.99999f);
+    fail += !(fabs(fit.coeff[2] - 0.5) < 1e-2) || !(fabs(fit.coeff[3] - 0.01) < 1e-3);
+    print("poly3: c %.4f %.4f %.4f %.5f, r2 %.6f, max err %.2e\r\n",
+          fit.coeff[0], fit.coeff[1], fit.coeff[2], fit.coeff[3], fit.r2, err);
+
+    // 样本的 x 只有两个取值时二次拟合奇异
+    fit_poly_init(&fit, 2, 1.0f);
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        fit_poly_update(&fit, (float)(i & 1), (float)i);
+    }
+    fail += fit_poly_solve(&fit);
+    return fail;
+}
+
+// 递推最小二乘：y = 1.5·φ0 - 0.7·φ1 + 0.2，参数收敛；遗忘因子下跟踪参数突变
+static uint32_t fit_test_rls(void)
+{
+    fit_rls_t fit;
+    uint32_t fail = 0;
+
+    fit_rls_init(&fit, 3, 1.0f, 1000.0f);
+    for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+    {
+        float phi[3] = {fit_test_rand(), fit_test_rand(), 1.0f};
+        fit_rls_update(&fit, phi, 1.5f * phi[0] - 0.7f * phi[1] + 0.2f);
+    }
+    fail += !(fabs(fit.theta[0] - 1.5) < 1e-3) || !(fabs(fit.theta[1] + 0.7) < 1e-3) || !(fabs(fit.theta[2] - 0.2) < 1e-3);
+    fail += !(fit_rls_r2(&fit) > 0.95f); // 先验残差含收敛前的样本
+    print("rls: theta %.5f %.5f %.5f, r2 %.5f\r\n", fit.theta[0], fit.theta[1], fit.theta[2], fit_rls_r2(&fit));
+
+    // 遗忘因子 0.9：增益由 2 变为 -1 后 100 个样本内跟上
+    fit_rls_init(&fit, 1, 0.9f, 1000.0f);
+    for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+    {
+        float phi = fit_test_rand();
+        fit_rls_update(&fit, &phi, ((i < FIT_TEST_SIZE / 2) ? 2.0f : -1.0f) * phi);
+    }
+    fail += !(fabs(fit.theta[0] + 1.0) < 1e-3);
+    print("rls lambda 0.9: theta %.5f\r\n", fit.theta[0]);
+    return fail;
+}
+
+// 耗时：每样本更新与一次求解
+static void fit_test_bench(void)
+{
+    static float phi[FIT_TEST_SIZE][FIT_RLS_SIZE_MAX];
+    fit_cfg_t cfg = {.func = fit_test_exp, .defunc = fit_test_log, .enable_r2 = true};
+    fit_stream_t stream;
+    fit_poly_t poly;
+    fit_rls_t rls;
+
+    for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+    {
+        for (uint32_t j = 0; j < FIT_RLS_SIZE_MAX; j++)
+        {
+            phi[i][j] = fit_test_rand();
+        }
+    }
+
+    fit_stream_init(&stream, NULL, 0.99f);
+    uint32_t cycles = TIMESTAMP_CYCLES;
+    for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+    {
+        fit_stream_update(&stream, (float)i, phi[i][0]);
+    }
+    cycles = TIMESTAMP_CYCLES - cycles;
+    print("fit_stream_update line: %llu ns\r\n", time_cycles_to_ns(&g_time_timer5, cycles) / FIT_TEST_SIZE);
+
+    fit_stream_init(&stream, &cfg, 0.99f);
+    cycles = TIMESTAMP_CYCLES;
+    for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+    {
+        fit_stream_update(&stream, (float)i, 2.0f + phi[i][0]);
+    }
+    cycles = TIMESTAMP_CYCLES - cycles;
+    print("fit_stream_update exp: %llu ns\r\n", time_cycles_to_ns(&g_time_timer5, cycles) / FIT_TEST_SIZE);
+
+    for (uint8_t degree = 1; degree <= FIT_DEGREE_MAX; degree++)
+    {
+        fit_poly_init(&poly, degree, 0.99f);
+        cycles = TIMESTAMP_CYCLES;
+        for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+        {
+            fit_poly_update(&poly, i * 0.1f, phi[i][0]);
+        }
+        cycles = TIMESTAMP_CYCLES - cycles;
+        uint32_t cycles_solve = TIMESTAMP_CYCLES;
+        fit_poly_solve(&poly);
+        cycles_solve = TIMESTAMP_CYCLES - cycles_solve;
+        print("fit_poly degree %u: update %llu ns, solve %llu ns\r\n", degree,
+              time_cycles_to_ns(&g_time_timer5, cycles) / FIT_TEST_SIZE, time_cycles_to_ns(&g_time_timer5, cycles_solve));
+    }
+
+    for (uint8_t size = 1; size <= FIT_RLS_SIZE_MAX; size++)
+    {
+        fit_rls_init(&rls, size, 0.99f, 1000.0f);
+        cycles = TIMESTAMP_CYCLES;
+        for (uint32_t i = 0; i < FIT_TEST_SIZE; i++)
+        {
+            fit_rls_update(&rls, phi[i], phi[i][0] - 0.5f * phi[i][size - 1]);
+        }
+        cycles = TIMESTAMP_CYCLES - cycles;
+        print("fit_rls_update size %u: %llu ns\r\n", size, time_cycles_to_ns(&g_time_timer5, cycles) / FIT_TEST_SIZE);
+    }
+}
+
+static void fit_test(void)
+{
+    log_info("fit_test start");
+
+    srand(1);
+    uint32_t fail = fit_test_stream();
+    print("stream %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    fail = fit_test_exp_model();
+    print("exp %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    fail = fit_test_poly();
+    print("poly %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    fail = fit_test_rls();
+    print("rls %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    fit_test_bench();
+
+    log_info("fit_test end");
+}
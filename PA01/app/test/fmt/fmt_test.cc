@@ -0,0 +1,151 @@
+/**
+ * @file fmt_test.cc
+ * @author WittXie
+ * @brief 格式化测试：fmt_snprintf 与 C 库 snprintf 逐字比对，常用格式单次耗时对比，构建器与整数转换
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define FMT_TEST_LOOP 1000   // 每种格式计时循环次数
+#define FMT_TEST_RANDOM 2000 // 随机比对次数
+
+static uint32_t fmt_test_fail = 0;
+static char fmt_test_a[96], fmt_test_b[96]; // 放在静态区，避免每个用例占用测试任务栈
+
+/**
+ * @brief 比对并计时，fmt 与 snprintf 结果（内容与返回值）必须一致
+ */
+#define FMT_TEST_CASE(_format, ...)                                                     \
+    {                                                                                   \
+        char *_a = fmt_test_a, *_b = fmt_test_b;                                        \
+        int _na = fmt_snprintf(_a, sizeof(fmt_test_a), _format, __VA_ARGS__);           \
+        int _nb = snprintf(_b, sizeof(fmt_test_b), _format, __VA_ARGS__);               \
+        if ((_na != _nb) || (strcmp(_a, _b) != 0))                                      \
+        {                                                                               \
+            fmt_test_fail++;                                                            \
+            print("FAIL %-12s fmt[%s] libc[%s]\r\n", _format, _a, _b);                  \
+        }                                                                               \
+        if (is_bench)                                                                   \
+        {                                                                               \
+            uint32_t _cycles_fmt = TIMESTAMP_CYCLES;                                    \
+            for (uint32_t _i = 0; _i < FMT_TEST_LOOP; _i++)                             \
+            {                                                                           \
+                fmt_snprintf(_a, sizeof(fmt_test_a), _format, __VA_ARGS__);             \
+            }                                                                           \
+            _cycles_fmt = TIMESTAMP_CYCLES - _cycles_fmt;                               \
+            uint32_t _cycles_libc = TIMESTAMP_CYCLES;                                   \
+            for (uint32_t _i = 0; _i < FMT_TEST_LOOP; _i++)                             \
+            {                                                                           \
+                snprintf(_b, sizeof(fmt_test_b), _format, __VA_ARGS__);                 \
+            }                                                                           \
+            _cycles_libc = TIMESTAMP_CYCLES - _cycles_libc;                             \
+            print("%-16s fmt %6llu ns, libc %6llu ns  [%s]\r\n", _format,               \
+                  time_cycles_to_ns(&g_time_timer5, _cycles_fmt) / FMT_TEST_LOOP,       \
+                  time_cycles_to_ns(&g_time_timer5, _cycles_libc) / FMT_TEST_LOOP, _a); \
+        }                                                                               \
+    }
+
+static void fmt_test(void)
+{
+    log_info("fmt_test start");
+    fmt_test_fail = 0;
+
+    // 工程中常用格式：比对 + 单次耗时
+    bool is_bench = true;
+    FMT_TEST_CASE("%d", -123456);
+    FMT_TEST_CASE("%u", 4000000000u);
+    FMT_TEST_CASE("%02d", 7);
+    FMT_TEST_CASE("%5u", 42u);
+    FMT_TEST_CASE("%08X", 0xDEADBEEFu);
+    FMT_TEST_CASE("%02X", 0x0Au);
+    FMT_TEST_CASE("%lu", 123456789ul);
+    FMT_TEST_CASE("%-9lu|", 2024ul);
+    FMT_TEST_CASE("%llu", 18446744073709551615ull);
+    FMT_TEST_CASE("%6llu", 1234ull);
+    FMT_TEST_CASE("%lld", -9000000000ll);
+    FMT_TEST_CASE("%s", "hello");
+    FMT_TEST_CASE("%-8s|", "sha256");
+    FMT_TEST_CASE("%10s", "right");
+    FMT_TEST_CASE("%.*s", 3, "abcdef");
+    FMT_TEST_CASE("%4.02f", 3.14159f);
+    FMT_TEST_CASE("%.3f", -0.0005f);
+    FMT_TEST_CASE("%5.02f", 99.995f);
+    FMT_TEST_CASE("%10.0f", 2.5f);
+    FMT_TEST_CASE("%-5.02f|", 1.0f);
+    FMT_TEST_CASE("%12.1f", 123456.78f);
+    FMT_TEST_CASE("%.4f", 0.1f);
+    FMT_TEST_CASE("%.2e", 12345.678f);
+    FMT_TEST_CASE("[%s] %d %08X %.3f %llu", "tag", 1234, 0xABCDu, 3.1416f, 99991ull);
+
+    // 随机比对：整数全范围、浮点随机位模式与精确半数（舍入）
+    is_bench = false;
+    for (uint32_t i = 0; i < FMT_TEST_RANDOM; i++)
+    {
+        int32_t value = (int32_t)(((uint32_t)rand() << 16) ^ (uint32_t)rand()) >> (i % 32);
+        uint64_t value64 = (((uint64_t)rand() << 40) ^ ((uint64_t)rand() << 20) ^ (uint64_t)rand()) >> (i % 64);
+        float f = (float)value / (float)(1u << (i % 24));
+        float half = (float)((int32_t)(i % 2000) - 1000) / 8.0f;
+        int precision = i % 10;
+        FMT_TEST_CASE("%d|%+6d|%-8d|%05d|%.3d", value, value, value, value, value);
+        FMT_TEST_CASE("%u|%x|%X|%#010x", (uint32_t)value, (uint32_t)value, (uint32_t)value, (uint32_t)value);
+        FMT_TEST_CASE("%llu|%llX|%20lld", value64, value64, (long long)value64);
+        FMT_TEST_CASE("%f|%.2f|%10.3f|%.*f", f, f, f, precision, f);
+        FMT_TEST_CASE("%.0f|%.1f|%.2f|%+08.3f", half, half, half, half);
+    }
+
+    // 截断与返回值
+    char buff[8];
+    int length = fmt_snprintf(buff, sizeof(buff), "%s-%d", "abcdef", 12345);
+    if ((length != 12) || (strcmp(buff, "abcdef-") != 0))
+    {
+        fmt_test_fail++;
+        print("FAIL truncate [%s] %d\r\n", buff, length);
+    }
+
+    // 构建器
+    char text[64];
+    fmt_t fmt;
+    fmt_init(&fmt, text, sizeof(text));
+    fmt_append(&fmt, "t=");
+    fmt_append(&fmt, (uint32_t)1234);
+    fmt_char(&fmt, ' ');
+    fmt_append(&fmt, -2.5f);
+    fmt_char(&fmt, ' ');
+    fmt_hex32(&fmt, 0xBEEF, 8, true);
+    if (strcmp(text, "t=1234 -2.50 0000BEEF") != 0)
+    {
+        fmt_test_fail++;
+        print("FAIL builder [%s]\r\n", text);
+    }
+
+    // 整数转换单次耗时
+    char num[FMT_U64_DIGITS_MAX + 2];
+    uint32_t cycles = TIMESTAMP_CYCLES;
+    for (uint32_t i = 0; i < FMT_TEST_LOOP; i++)
+    {
+        fmt_u32_to_dec(num, 4000000000u - i);
+    }
+    cycles = TIMESTAMP_CYCLES - cycles;
+    print("fmt_u32_to_dec   %6llu ns\r\n", time_cycles_to_ns(&g_time_timer5, cycles) / FMT_TEST_LOOP);
+    cycles = TIMESTAMP_CYCLES;
+    for (uint32_t i = 0; i < FMT_TEST_LOOP; i++)
+    {
+        fmt_u64_to_dec(num, 18000000000000000000ull - i);
+    }
+    cycles = TIMESTAMP_CYCLES - cycles;
+    print("fmt_u64_to_dec   %6llu ns\r\n", time_cycles_to_ns(&g_time_timer5, cycles) / FMT_TEST_LOOP);
+    cycles = TIMESTAMP_CYCLES;
+    for (uint32_t i = 0; i < FMT_TEST_LOOP; i++)
+    {
+        fmt_f32_to_str(num, 1234.5678f + (float)i, 3);
+    }
+    cycles = TIMESTAMP_CYCLES - cycles;
+    print("fmt_f32_to_str   %6llu ns\r\n", time_cycles_to_ns(&g_time_timer5, cycles) / FMT_TEST_LOOP);
+
+    print("fmt compare %s, %u fail\r\n", fmt_test_fail == 0 ? "ok" : "FAIL", fmt_test_fail);
+    log_info("fmt_test end");
+}
@@ -0,0 +1,149 @@
+/**
+ * @file foc_test.cc
+ * @author WittXie
+ * @brief FOC测试：查表正余弦误差，电机模型闭环下的堵转阶跃响应、自由转动解耦效果，SVPWM扇区，foc_step 耗时
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+#include "./../../../lib/controller/foc/foc_motor.c" // 电机模型，只用于仿真，只在测试中编译
+
+#define FOC_TEST_TS 50e-6f  // 控制周期 20kHz
+#define FOC_TEST_VBUS 12.0f // 母线电压
+#define FOC_TEST_LOOP 1000  // 计时循环次数
+
+// 云台电机量级参数
+static foc_t foc_test_foc = {
+    .cfg = {
+        .ts = FOC_TEST_TS,
+        .rs = 0.5f,
+        .ld = 200e-6f,
+        .lq = 240e-6f,
+        .flux = 0.005f,
+        .bandwidth = 1000,
+        .modulation_max = 0.95f,
+        .is_decouple = true,
+    },
+};
+static foc_motor_t foc_test_motor = {
+    .cfg = {
+        .rs = 0.5f,
+        .ld = 200e-6f,
+        .lq = 240e-6f,
+        .flux = 0.005f,
+        .pole_pairs = 7,
+        .inertia = 2e-5f,
+        .friction = 1e-5f,
+        .ts = FOC_TEST_TS,
+        .substeps = 8,
+    },
+};
+
+// 闭环推进一个周期
+static void foc_test_run(foc_t *foc, foc_motor_t *motor)
+{
+    foc_set_theta_speed(foc, motor->theta, motor->speed);
+    foc_step(foc, motor->ia, motor->ib);
+    foc_motor_step(motor, foc->duty, FOC_TEST_VBUS);
+}
+
+static void foc_test(void)
+{
+    log_info("foc_test start");
+
+    foc_t *foc = &foc_test_foc;
+    foc_motor_t *motor = &foc_test_motor;
+
+    // 查表误差
+    float error_max = 0;
+    for (uint32_t i = 0; i < 100000; i++)
+    {
+        float theta = -20.0f + 40.0f * i / 100000;
+        float s, c;
+        trig_lut_sincos(theta, &s, &c);
+        error_max = CMP_MAX(error_max, fabsf(s - sinf(theta)));
+        error_max = CMP_MAX(error_max, fabsf(c - cosf(theta)));
+    }
+    print("trig_lut max error %.2e %s\r\n", error_max, (error_max < 1e-5f) ? "ok" : "FAIL");
+
+    // 堵转阶跃：iq 0 -> 1A，一阶闭环理论上升时间 2.2/(2π·1000) ≈ 350us
+    foc_init(foc, FOC_TEST_VBUS);
+    motor->cfg.is_locked = true;
+    foc_motor_init(motor);
+    foc_set_current(foc, 0, 1.0f);
+    int32_t t10 = -1, t90 = -1;
+    float peak = 0;
+    for (int32_t k = 0; k < 400; k++)
+    {
+        foc_test_run(foc, motor);
+        peak = CMP_MAX(peak, motor->iq);
+        if (t10 < 0 && motor->iq >= 0.1f)
+        {
+            t10 = k;
+        }
+        if (t90 < 0 && motor->iq >= 0.9f)
+        {
+            t90 = k;
+        }
+    }
+    bool is_step_ok = (t90 > t10) && (peak < 1.05f) && (fabsf(motor->iq - 1.0f) < 0.01f) && (fabsf(motor->id) < 0.01f);
+    print("locked step: rise %u us, overshoot %.1f%%, iq %.3f, id %.3f %s\r\n",
+          (uint32_t)((t90 - t10) * FOC_TEST_TS * 1e6f), (peak - 1.0f) * 100.0f, motor->iq, motor->id, is_step_ok ? "ok" : "FAIL");
+
+    // 自由转动：加速到反电动势使电压饱和，比较有无解耦时的 d 轴电流偏差
+    for (uint8_t is_decouple = 0; is_decouple < 2; is_decouple++)
+    {
+        foc->cfg.is_decouple = is_decouple;
+        foc_init(foc, FOC_TEST_VBUS);
+        motor->cfg.is_locked = false;
+        foc_motor_init(motor);
+        foc_set_current(foc, 0, 2.0f);
+        float id_max = 0;
+        for (int32_t k = 0; k < 4000; k++)
+        {
+            foc_test_run(foc, motor);
+            if (k > 100)
+            {
+                id_max = CMP_MAX(id_max, fabsf(motor->id));
+            }
+        }
+        print("free run decouple %u: speed %.0f rad/s, |id| max %.4f A, saturated %u\r\n",
+              is_decouple, motor->speed, id_max, foc->flag.is_saturated);
+    }
+
+    // SVPWM 扇区
+    bool is_sector_ok = true;
+    for (uint8_t sector = 1; sector <= 6; sector++)
+    {
+        float angle = (sector * 60 - 30) * (M_PI / 180.0f);
+        foc_init(foc, FOC_TEST_VBUS);
+        foc->id_pi.kp = foc->iq_pi.kp = 0;
+        foc->id_pi.ki = foc->iq_pi.ki = 0;
+        foc->id_pi.integral = 3.0f * cosf(angle);
+        foc->iq_pi.integral = 3.0f * sinf(angle);
+        foc->cfg.is_decouple = false;
+        foc_step(foc, 0, 0);
+        is_sector_ok &= (foc->sector == sector);
+    }
+    print("svpwm sector %s\r\n", is_sector_ok ? "ok" : "FAIL");
+
+    // 耗时：20kHz 下每周期预算 50us
+    foc->cfg.is_decouple = true;
+    foc_init(foc, FOC_TEST_VBUS);
+    foc_set_current(foc, 0, 1.0f);
+    uint32_t cycles = TIMESTAMP_CYCLES;
+    for (uint32_t i = 0; i < FOC_TEST_LOOP; i++)
+    {
+        foc_set_theta_speed(foc, i * 0.01f, 100.0f);
+        foc_step(foc, 0.3f, -0.1f);
+    }
+    cycles = TIMESTAMP_CYCLES - cycles;
+    uint64_t ns = time_cycles_to_ns(&g_time_timer5, cycles) / FOC_TEST_LOOP;
+    print("foc_step %llu ns, %u cycles, %.2f%% of 20kHz budget\r\n",
+          ns, cycles / FOC_TEST_LOOP, ns * 100.0f / (FOC_TEST_TS * 1e9f));
+
+    log_info("foc_test end");
+}
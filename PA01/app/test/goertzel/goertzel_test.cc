@@ -0,0 +1,187 @@
+/**
+ * @file goertzel_test.cc
+ * @author WittXie
+ * @brief Goertzel测试：噪声中的DTMF双音检测（浮点/定点/滑动）+ 定点满量程最坏输入 + 与FFT的单次检测耗时对比
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define GOERTZEL_TEST_RATE 16000.0f // 采样率
+#define GOERTZEL_TEST_SIZE 512      // 块长
+#define GOERTZEL_TEST_LONG 4096     // 满量程测试块长
+
+static const float goertzel_test_freqs[] = {697, 770, 852, 941, 1209, 1336, 1477}; // DTMF
+
+// 合成 PCM：697Hz 0.3 + 1336Hz 0.2 + 均匀噪声
+static void goertzel_test_signal(int16_t *buff, uint32_t length)
+{
+    for (uint32_t i = 0; i < length; i++)
+    {
+        float t = i / GOERTZEL_TEST_RATE;
+        float noise = ((float)rand() / RAND_MAX - 0.5f) * 0.1f;
+        buff[i] = (int16_t)(32767 * (0.3f * sinf(2 * M_PI * 697 * t) + 0.2f * sinf(2 * M_PI * 1336 * t) + noise));
+    }
+}
+
+// 定点满量程：x[k] = ±满量程，符号取 sin((N-k)w)，使块末状态达到上界；与双精度 DFT 比对，返回错误次数
+static uint32_t goertzel_test_full_scale(void)
+{
+    static const float freqs[] = {1, 5, 1000, 7990, 7999.5f}; // 近直流、中段、近奈奎斯特
+    int16_t *pcm = (int16_t *)MALLOC(GOERTZEL_TEST_LONG * sizeof(int16_t));
+    if (pcm == NULL)
+    {
+        return 1;
+    }
+
+    uint32_t fail = 0;
+    for (uint8_t f = 0; f < countof(freqs); f++)
+    {
+        double w = 2.0 * M_PI * freqs[f] / GOERTZEL_TEST_RATE;
+        double real = 0, imag = 0;
+        for (uint32_t k = 0; k < GOERTZEL_TEST_LONG; k++)
+        {
+            pcm[k] = (sin((GOERTZEL_TEST_LONG - k) * w) >= 0) ? INT16_MAX : INT16_MIN;
+            real += pcm[k] / 32768.0 * cos(w * k);
+            imag -= pcm[k] / 32768.0 * sin(w * k);
+        }
+        float expect = (float)(2.0 * sqrt(real * real + imag * imag) / GOERTZEL_TEST_LONG);
+
+        goertzel_t goertzel = {
+            .cfg = {
+                .name = "goertzel_full_scale",
+                .sample_rate = GOERTZEL_TEST_RATE,
+                .block_size = GOERTZEL_TEST_LONG,
+                .size = 1,
+                .freqs = &freqs[f],
+                .is_fixed = true,
+            },
+        };
+        if (!goertzel_init(&goertzel))
+        {
+            fail++;
+            continue;
+        }
+        goertzel_feed_s16(&goertzel, pcm, GOERTZEL_TEST_LONG, 1);
+        float amplitude = goertzel_amplitude(&goertzel, 0);
+        goertzel_deinit(&goertzel);
+
+        float err = fabsf(amplitude - expect) / expect;
+        fail += !(err < 0.005f);
+        print("full scale %.1fHz: fixed %.4f, dft %.4f, err %.3f%%\r\n", freqs[f], amplitude, expect, err * 100.0f);
+    }
+    FREE(pcm);
+    return fail;
+}
+
+static void goertzel_test(void)
+{
+    log_info("goertzel_test start");
+
+    int16_t *pcm = (int16_t *)MALLOC(GOERTZEL_TEST_SIZE * sizeof(int16_t));
+    complex_t *spectrum = (complex_t *)MALLOC(GOERTZEL_TEST_SIZE * sizeof(complex_t));
+    if (pcm == NULL || spectrum == NULL)
+    {
+        log_error("goertzel_test malloc failed.");
+        if (pcm != NULL)
+        {
+            FREE(pcm);
+        }
+        if (spectrum != NULL)
+        {
+            FREE(spectrum);
+        }
+        return;
+    }
+    goertzel_test_signal(pcm, GOERTZEL_TEST_SIZE);
+
+    // 浮点/定点块检测
+    for (uint8_t is_fixed = 0; is_fixed < 2; is_fixed++)
+    {
+        goertzel_t goertzel = {
+            .cfg = {
+                .name = "goertzel_test",
+                .sample_rate = GOERTZEL_TEST_RATE,
+                .block_size = GOERTZEL_TEST_SIZE,
+                .size = countof(goertzel_test_freqs),
+                .freqs = goertzel_test_freqs,
+                .is_fixed = is_fixed,
+            },
+        };
+        if (!goertzel_init(&goertzel))
+        {
+            log_error("goertzel_test init failed.");
+            break;
+        }
+
+        uint32_t cycles = TIMESTAMP_CYCLES;
+        goertzel_feed_s16(&goertzel, pcm, GOERTZEL_TEST_SIZE, 1);
+        cycles = TIMESTAMP_CYCLES - cycles;
+
+        print("%s:", is_fixed ? "fixed" : "float");
+        for (uint8_t i = 0; i < countof(goertzel_test_freqs); i++)
+        {
+            print(" %.0f=%.3f", goertzel_test_freqs[i], goertzel_amplitude(&goertzel, i));
+        }
+        print(", %llu us.\r\n", time_cycles_to_ns(&g_time_timer5, cycles) / 1000);
+        ASSERT(fabsf(goertzel_amplitude(&goertzel, 0) - 0.3f) < 0.02f);
+        ASSERT(fabsf(goertzel_amplitude(&goertzel, 5) - 0.2f) < 0.02f);
+        ASSERT(goertzel_amplitude(&goertzel, 2) < 0.02f);
+        goertzel_deinit(&goertzel);
+    }
+
+    // 定点满量程
+    {
+        uint32_t fail = goertzel_test_full_scale();
+        print("full scale %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+    }
+
+    // 同一块数据做整段复数FFT
+    {
+        fft_t fft = {0};
+        if (fft_init(&fft, GOERTZEL_TEST_SIZE, false, spectrum, spectrum))
+        {
+            uint32_t cycles = TIMESTAMP_CYCLES;
+            for (uint32_t i = 0; i < GOERTZEL_TEST_SIZE; i++)
+            {
+                spectrum[i].real = pcm[i] * (1.0f / 32768.0f);
+                spectrum[i].imag = 0;
+            }
+            fft_execute(&fft);
+            cycles = TIMESTAMP_CYCLES - cycles;
+            print("fft_execute %u: %llu us.\r\n", GOERTZEL_TEST_SIZE, time_cycles_to_ns(&g_time_timer5, cycles) / 1000);
+        }
+        fft_deinit(&fft);
+    }
+
+    // 滑动检测：1000Hz 音从第 200 个样本开始
+    {
+        goertzel_sliding_t sliding = {
+            .cfg = {
+                .name = "goertzel_test",
+                .sample_rate = GOERTZEL_TEST_RATE,
+                .size = 160,
+                .freq = 1000,
+            },
+        };
+        if (goertzel_sliding_init(&sliding))
+        {
+            float *buff = (float *)spectrum;
+            for (uint32_t i = 0; i < GOERTZEL_TEST_SIZE * 2; i++)
+            {
+                buff[i] = (i >= 200) ? 0.5f * sinf(2 * M_PI * 1000 * i / GOERTZEL_TEST_RATE) : 0.0f;
+            }
+            float amplitude = goertzel_sliding_feed(&sliding, buff, GOERTZEL_TEST_SIZE * 2, NULL);
+            print("sliding: %.3f.\r\n", amplitude);
+            ASSERT(fabsf(amplitude - 0.5f) < 0.01f);
+        }
+        goertzel_sliding_deinit(&sliding);
+    }
+
+    FREE(pcm);
+    FREE(spectrum);
+    log_info("goertzel_test end");
+}
@@ -0,0 +1,117 @@
+/**
+ * @file hash_test.cc
+ * @author WittXie
+ * @brief 哈希测试：NIST 测试向量校验，对齐/非对齐/分段输入一致性，各算法吞吐量与 flash 镜像哈希
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define HASH_TEST_SIZE 8192        // 吞吐量测试数据长度
+#define HASH_TEST_FLASH_SIZE 65536 // flash 镜像哈希长度
+
+// NIST 测试向量
+static const struct
+{
+    const char *message;
+    const char *digest[HASH_TYPE_MAX];
+} hash_test_vectors[] = {
+    {"abc", {"900150983cd24fb0d6963f7d28e17f72", "a9993e364706816aba3e25717850c26c9cd0d89d", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"}},
+    {"", {"d41d8cd98f00b204e9800998ecf8427e", "da39a3ee5e6b4b0d3255bfef95601890afd80709", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"}},
+    {"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", {"8215ef0796a20bcaaae116d3876c664a", "84983e441c3bd26ebaae4aa1f95129e5e54670f1", "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"}},
+};
+
+// 摘要与十六进制字符串比较
+static bool hash_test_match(const uint8_t *digest, uint8_t size, const char *hex)
+{
+    char text[HASH_DIGEST_SIZE_MAX * 2 + 1];
+    for (uint8_t i = 0; i < size; i++)
+    {
+        snprintf(&text[i * 2], 3, "%02x", digest[i]);
+    }
+    return strcmp(text, hex) == 0;
+}
+
+static void hash_test(void)
+{
+    log_info("hash_test start");
+
+    uint8_t digest[HASH_DIGEST_SIZE_MAX], expect[HASH_DIGEST_SIZE_MAX];
+
+    // 测试向量
+    for (uint8_t type = 0; type < HASH_TYPE_MAX; type++)
+    {
+        bool is_ok = true;
+        for (uint8_t i = 0; i < countof(hash_test_vectors); i++)
+        {
+            const char *message = hash_test_vectors[i].message;
+            uint8_t size = hash_calculate((enum hash_type)type, (const uint8_t *)message, strlen(message), digest);
+            is_ok &= hash_test_match(digest, size, hash_test_vectors[i].digest[type]);
+        }
+        print("%-8s vectors %s\r\n", hash_name((enum hash_type)type), is_ok ? "ok" : "FAIL");
+    }
+
+    uint8_t *buff = (uint8_t *)MALLOC(HASH_TEST_SIZE + 4);
+    if (buff == NULL)
+    {
+        log_error("hash_test malloc failed.");
+        return;
+    }
+    for (uint32_t i = 0; i < HASH_TEST_SIZE + 4; i++)
+    {
+        buff[i] = (uint8_t)rand();
+    }
+
+    // 对齐/非对齐/分段输入结果一致，并统计吞吐量
+    for (uint8_t type = 0; type < HASH_TYPE_MAX; type++)
+    {
+        uint32_t cycles_aligned = TIMESTAMP_CYCLES;
+        uint8_t size = hash_calculate((enum hash_type)type, buff, HASH_TEST_SIZE, expect);
+        cycles_aligned = TIMESTAMP_CYCLES - cycles_aligned;
+
+        memmove(buff + 1, buff, HASH_TEST_SIZE);
+        uint32_t cycles_unaligned = TIMESTAMP_CYCLES;
+        hash_calculate((enum hash_type)type, buff + 1, HASH_TEST_SIZE, digest);
+        cycles_unaligned = TIMESTAMP_CYCLES - cycles_unaligned;
+        bool is_unaligned_ok = (memcmp(digest, expect, size) == 0);
+        memmove(buff, buff + 1, HASH_TEST_SIZE);
+
+        hash_t hash;
+        hash_init(&hash, (enum hash_type)type);
+        for (uint32_t offset = 0, step = 1; offset < HASH_TEST_SIZE; offset += step, step = step * 3 % 97 + 1)
+        {
+            hash_update(&hash, buff + offset, CMP_MIN(step, HASH_TEST_SIZE - offset));
+        }
+        hash_final(&hash, digest);
+        bool is_split_ok = (memcmp(digest, expect, size) == 0);
+
+        uint64_t ns_aligned = time_cycles_to_ns(&g_time_timer5, cycles_aligned);
+        uint64_t ns_unaligned = time_cycles_to_ns(&g_time_timer5, cycles_unaligned);
+        print("%-8s aligned %5u KB/s, unaligned %5u KB/s %s, split %s\r\n",
+              hash_name((enum hash_type)type),
+              (uint32_t)(HASH_TEST_SIZE * 1000000ull / (ns_aligned + 1)),
+              (uint32_t)(HASH_TEST_SIZE * 1000000ull / (ns_unaligned + 1)), is_unaligned_ok ? "ok" : "FAIL",
+              is_split_ok ? "ok" : "FAIL");
+    }
+
+    // flash 镜像哈希，分块长度对比
+    static const uint32_t chunk_sizes[] = {64, 256, 1024, 4096};
+    for (uint8_t i = 0; i < countof(chunk_sizes); i++)
+    {
+        hash_t hash;
+        hash_init(&hash, HASH_SHA256);
+        uint32_t cycles = TIMESTAMP_CYCLES;
+        bool is_ok = hash_flash(&hash, &g_flash_mx25, 0, HASH_TEST_FLASH_SIZE, (chunk_sizes[i] <= HASH_TEST_SIZE) ? buff : NULL, chunk_sizes[i]);
+        cycles = TIMESTAMP_CYCLES - cycles;
+        hash_final(&hash, i == 0 ? expect : digest);
+        print("flash sha256 chunk %4u: %6llu us %s\r\n", chunk_sizes[i],
+              time_cycles_to_ns(&g_time_timer5, cycles) / 1000,
+              (is_ok && (i == 0 || memcmp(digest, expect, SHA256_DIGEST_SIZE) == 0)) ? "ok" : "FAIL");
+    }
+
+    FREE(buff);
+    log_info("hash_test end");
+}
@@ -0,0 +1,126 @@
+/**
+ * @file hex_test.cc
+ * @author WittXie
+ * @brief 十六进制/Base64 测试：往返随机测试、非法输入拒绝、RFC 4648 向量、hexdump，与逐字节 snprintf 的吞吐量对比
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define HEX_TEST_SIZE 1024   // 吞吐量测试数据长度
+#define HEX_TEST_RANDOM 2000 // 随机往返次数
+
+static uint8_t hex_test_data[HEX_TEST_SIZE + 4];
+static uint8_t hex_test_back[HEX_TEST_SIZE + 4];
+static char hex_test_text[HEX_ENCODE_SEP_SIZE(HEX_TEST_SIZE) + 4];
+
+// 吞吐量 KB/s
+static uint32_t hex_test_kbps(uint32_t length, uint32_t cycles)
+{
+    return (uint32_t)(length * 1000000ull / (time_cycles_to_ns(&g_time_timer5, cycles) + 1));
+}
+
+static void hex_test(void)
+{
+    log_info("hex_test start");
+
+    // 随机往返：长度、对齐、大小写随机
+    uint32_t fail = 0;
+    for (uint32_t k = 0; k < HEX_TEST_RANDOM; k++)
+    {
+        uint32_t length = (uint32_t)rand() % 256;
+        uint8_t *data = &hex_test_data[k & 3];
+        for (uint32_t i = 0; i < length; i++)
+        {
+            data[i] = (uint8_t)rand();
+        }
+
+        uint32_t size = hex_encode(hex_test_text, data, length, k & 1);
+        fail += !hex_decode(hex_test_back, hex_test_text, size) || (memcmp(hex_test_back, data, length) != 0);
+        if (length > 0)
+        {
+            hex_test_text[rand() % size] = 'g'; // 非法字符必须被拒绝
+            fail += hex_decode(hex_test_back, hex_test_text, size);
+        }
+
+        uint32_t decoded = 0;
+        size = base64_encode(hex_test_text, data, length);
+        fail += !base64_decode(hex_test_back, length, hex_test_text, size, &decoded) || (decoded != length) ||
+                (memcmp(hex_test_back, data, length) != 0);
+        if (length > 0)
+        {
+            fail += base64_decode(hex_test_back, length - 1, hex_test_text, size, NULL); // 缓存不足
+            hex_test_text[rand() % size] = '*';
+            fail += base64_decode(hex_test_back, length, hex_test_text, size, NULL);
+        }
+    }
+    print("hex/base64 round trip %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    // RFC 4648 向量与非规范输入
+    static const char *vectors[][2] = {{"f", "Zg=="}, {"fo", "Zm8="}, {"foo", "Zm9v"}, {"foobar", "Zm9vYmFy"}};
+    static const char *invalids[] = {"Zg=", "Zg=a", "Z===", "Zh==", "Zm9=", "Zm 9v", "=Zm9", "Zm9v\n"};
+    fail = 0;
+    for (uint32_t i = 0; i < countof(vectors); i++)
+    {
+        base64_encode(hex_test_text, vectors[i][0], strlen(vectors[i][0]));
+        fail += (strcmp(hex_test_text, vectors[i][1]) != 0);
+    }
+    for (uint32_t i = 0; i < countof(invalids); i++)
+    {
+        fail += base64_decode(hex_test_back, sizeof(hex_test_back), invalids[i], strlen(invalids[i]), NULL);
+    }
+    print("base64 vectors %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    // hexdump：每次只给一行的缓存，流式输出
+    hexdump_t dump = {.cfg = {.address = 0x24000000, .width = 16, .is_ascii = true, .is_upper = true}};
+    char line[HEXDUMP_LINE_SIZE(16) + 1];
+    hexdump_init(&dump);
+    while (hexdump_format(&dump, line, sizeof(line), "hexdump: streaming into caller buffers\x01\x7F", 40) > 0)
+    {
+        print("%s", line);
+    }
+
+    // 吞吐量：逐字节 snprintf("%02X ") 对比
+    for (uint32_t i = 0; i < HEX_TEST_SIZE; i++)
+    {
+        hex_test_data[i] = (uint8_t)rand();
+    }
+    uint32_t cycles_old = TIMESTAMP_CYCLES;
+    for (uint32_t i = 0; i < HEX_TEST_SIZE; i++)
+    {
+        snprintf(&hex_test_text[i * 3], 4, "%02X ", hex_test_data[i]);
+    }
+    cycles_old = TIMESTAMP_CYCLES - cycles_old;
+
+    uint32_t cycles_sep = TIMESTAMP_CYCLES;
+    hex_encode_sep(hex_test_text, hex_test_data, HEX_TEST_SIZE, ' ', true);
+    cycles_sep = TIMESTAMP_CYCLES - cycles_sep;
+
+    uint32_t cycles_encode = TIMESTAMP_CYCLES;
+    uint32_t size = hex_encode(hex_test_text, hex_test_data, HEX_TEST_SIZE, true);
+    cycles_encode = TIMESTAMP_CYCLES - cycles_encode;
+
+    uint32_t cycles_decode = TIMESTAMP_CYCLES;
+    hex_decode(hex_test_back, hex_test_text, size);
+    cycles_decode = TIMESTAMP_CYCLES - cycles_decode;
+
+    uint32_t cycles_b64_encode = TIMESTAMP_CYCLES;
+    size = base64_encode(hex_test_text, hex_test_data, HEX_TEST_SIZE);
+    cycles_b64_encode = TIMESTAMP_CYCLES - cycles_b64_encode;
+
+    uint32_t cycles_b64_decode = TIMESTAMP_CYCLES;
+    base64_decode(hex_test_back, sizeof(hex_test_back), hex_test_text, size, NULL);
+    cycles_b64_decode = TIMESTAMP_CYCLES - cycles_b64_decode;
+
+    print("snprintf %%02X  %6u KB/s\r\n", hex_test_kbps(HEX_TEST_SIZE, cycles_old));
+    print("hex_encode_sep %6u KB/s\r\n", hex_test_kbps(HEX_TEST_SIZE, cycles_sep));
+    print("hex_encode     %6u KB/s\r\n", hex_test_kbps(HEX_TEST_SIZE, cycles_encode));
+    print("hex_decode     %6u KB/s\r\n", hex_test_kbps(HEX_TEST_SIZE, cycles_decode));
+    print("base64_encode  %6u KB/s\r\n", hex_test_kbps(HEX_TEST_SIZE, cycles_b64_encode));
+    print("base64_decode  %6u KB/s\r\n", hex_test_kbps(HEX_TEST_SIZE, cycles_b64_decode));
+
+    log_info("hex_test end");
+}
@@ -0,0 +1,151 @@
+/**
+ * @file kalman_test.cc
+ * @author WittXie
+ * @brief 卡尔曼测试：匀速运动目标跟踪（位置观测估计位置和速度）、Cholesky/LDLT 求解残差、各维度 predict/update 耗时
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define KALMAN_TEST_STEPS 5000 // 跟踪步数
+#define KALMAN_TEST_LOOP 1000  // 计时循环次数
+
+// 标准正态随机数（Box-Muller）
+static float kalman_test_gauss(void)
+{
+    float u1 = (rand() + 0.5f) / ((float)RAND_MAX + 1.0f);
+    float u2 = (rand() + 0.5f) / ((float)RAND_MAX + 1.0f);
+    return sqrtf(-2.0f * logf(u1)) * cosf(2.0f * M_PI * u2);
+}
+
+// 各维度 predict/update 耗时
+#define KALMAN_TEST_BENCH(_n)                                                       \
+    {                                                                               \
+        static kalman##_n##_t kf;                                                   \
+        kalman##_n##_init(&kf, NULL, NULL);                                         \
+        vec##_n##_t h;                                                              \
+        for (uint8_t i = 0; i < _n; i++)                                            \
+        {                                                                           \
+            kf.q.m[i][i] = 1e-3f;                                                   \
+            kf.f.m[i][(i + 1) % _n] += 0.01f;                                       \
+            h.v[i] = 1.0f / (i + 1);                                                \
+        }                                                                           \
+        uint32_t cycles_predict = TIMESTAMP_CYCLES;                                 \
+        for (uint32_t k = 0; k < KALMAN_TEST_LOOP; k++)                             \
+        {                                                                           \
+            kalman##_n##_predict(&kf, NULL);                                        \
+        }                                                                           \
+        cycles_predict = TIMESTAMP_CYCLES - cycles_predict;                         \
+        uint32_t cycles_update = TIMESTAMP_CYCLES;                                  \
+        for (uint32_t k = 0; k < KALMAN_TEST_LOOP; k++)                             \
+        {                                                                           \
+            kalman##_n##_update(&kf, &h, (float)(k & 7), 0.1f);                     \
+        }                                                                           \
+        cycles_update = TIMESTAMP_CYCLES - cycles_update;                           \
+        print("kalman%u predict %5llu ns, update %5llu ns\r\n", _n,                 \
+              time_cycles_to_ns(&g_time_timer5, cycles_predict) / KALMAN_TEST_LOOP, \
+              time_cycles_to_ns(&g_time_timer5, cycles_update) / KALMAN_TEST_LOOP); \
+    }
+
+static void kalman_test(void)
+{
+    log_info("kalman_test start");
+
+    // 匀速目标：加速度白噪声 qa，位置观测噪声方差 r
+    const float dt = 0.01f, qa = 1.0f, r = 0.25f;
+    static kalman2_t kf;
+    const float p0[2] = {10.0f, 10.0f};
+    kalman2_init(&kf, NULL, p0);
+    kf.f.m[0][1] = dt;
+    kf.q.m[0][0] = qa * dt * dt * dt * dt / 4;
+    kf.q.m[0][1] = kf.q.m[1][0] = qa * dt * dt * dt / 2;
+    kf.q.m[1][1] = qa * dt * dt;
+
+    float pos = 0, vel = 2.0f;
+    float se_meas = 0, se_pos = 0, se_vel = 0;
+    uint32_t count = 0, outliers = 0;
+    for (uint32_t k = 0; k < KALMAN_TEST_STEPS; k++)
+    {
+        float a = kalman_test_gauss() * sqrtf(qa);
+        pos += vel * dt + 0.5f * a * dt * dt;
+        vel += a * dt;
+        float z = pos + kalman_test_gauss() * sqrtf(r);
+
+        kalman2_predict(&kf, NULL);
+        if (kalman2_update_state(&kf, 0, z, r) > 6.63f)
+        {
+            outliers++; // 99% 门限外的新息
+        }
+        if (k > KALMAN_TEST_STEPS / 10)
+        {
+            se_meas += (z - pos) * (z - pos);
+            se_pos += (kf.x.v[0] - pos) * (kf.x.v[0] - pos);
+            se_vel += (kf.x.v[1] - vel) * (kf.x.v[1] - vel);
+            count++;
+        }
+    }
+    bool is_track_ok = (se_pos < se_meas * 0.1f) && (kf.p.m[0][1] == kf.p.m[1][0]) && (kf.p.m[0][0] > 0);
+    print("cv track: meas rms %.3f, pos rms %.3f, vel rms %.3f, nis>6.63 %u/%u %s\r\n",
+          sqrtf(se_meas / count), sqrtf(se_pos / count), sqrtf(se_vel / count), outliers, KALMAN_TEST_STEPS,
+          is_track_ok ? "ok" : "FAIL");
+
+    // 随机对称正定矩阵求解残差
+    float residual_chol = 0, residual_ldlt = 0;
+    for (uint8_t t = 0; t < 20; t++)
+    {
+        mat6_t g, a, l;
+        vec6_t b, x, y;
+        for (uint8_t i = 0; i < 6; i++)
+        {
+            b.v[i] = (float)rand() / RAND_MAX;
+            for (uint8_t j = 0; j < 6; j++)
+            {
+                g.m[i][j] = 2.0f * rand() / RAND_MAX - 1.0f;
+            }
+        }
+        mat6_mul_abt(&a, &g, &g);
+        for (uint8_t i = 0; i < 6; i++)
+        {
+            a.m[i][i] += 0.5f;
+        }
+        if (mat6_cholesky(&l, &a))
+        {
+            mat6_cholesky_solve(&x, &l, &b);
+            mat6_mul_vec(&y, &a, &x);
+            for (uint8_t i = 0; i < 6; i++)
+            {
+                residual_chol = CMP_MAX(residual_chol, fabsf(y.v[i] - b.v[i]));
+            }
+        }
+        else
+        {
+            residual_chol = INFINITY;
+        }
+        if (mat6_ldlt(&l, &a))
+        {
+            mat6_ldlt_solve(&x, &l, &b);
+            mat6_mul_vec(&y, &a, &x);
+            for (uint8_t i = 0; i < 6; i++)
+            {
+                residual_ldlt = CMP_MAX(residual_ldlt, fabsf(y.v[i] - b.v[i]));
+            }
+        }
+        else
+        {
+            residual_ldlt = INFINITY;
+        }
+    }
+    print("solve 6x6: cholesky residual %.2e, ldlt residual %.2e %s\r\n", residual_chol, residual_ldlt,
+          (residual_chol < 1e-4f && residual_ldlt < 1e-4f) ? "ok" : "FAIL");
+
+    KALMAN_TEST_BENCH(2);
+    KALMAN_TEST_BENCH(3);
+    KALMAN_TEST_BENCH(4);
+    KALMAN_TEST_BENCH(6);
+    KALMAN_TEST_BENCH(9);
+
+    log_info("kalman_test end");
+}
@@ -17,6 +17,7 @@ static void lsm6dsdtr_entry(void *args)
         os_sleep(100);
         if (gpio_read(&g_btn_slw_left) == true && g_adc_sw_right < 0.25)
         {
+            lsm6dsdtr_angle_update(&g_lsm6dsdtr_imu);
             print(COLOR_H_CYAN "\rx = %6.02f, y = %6.02f, z = %6.02f" COLOR_H_WHITE ASCII_CLEAR_TAIL,
                   g_lsm6dsdtr_imu.data.angle.x, g_lsm6dsdtr_imu.data.angle.y, g_lsm6dsdtr_imu.data.angle.z);
         }
@@ -0,0 +1,102 @@
+/**
+ * @file lut_test.cc
+ * @author WittXie
+ * @brief 常量查找表测试：生成表与运行时计算逐项比对，统计 FFT 改用常量表后省下的 RAM 与上电计算耗时
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define LUT_TEST_FFT_SIZE 1024 // 上电耗时对比用的FFT点数
+
+static void lut_test(void)
+{
+    log_info("lut_test start");
+
+    // CRC：与 crc_table_create 现算结果比对（原先就是 FLASH 常量表，只是去掉手抄的重复副本，不省 RAM）
+    uint32_t fail = 0;
+    crc_t crc = {CRC_CFG_CCITT_FALSE, .table = NULL};
+    crc_table_create(&crc);
+    fail += (memcmp(crc.table, g_lut_crc_ccitt, sizeof(g_lut_crc_ccitt)) != 0);
+    crc_table_free(&crc);
+    print("crc_ccitt %s\r\n", fail == 0 ? "ok" : "FAIL");
+
+    // FFT旋转因子：与双精度现算逐位相同
+    fail = 0;
+    uint32_t twiddle_bytes = LUT_TEST_FFT_SIZE * 3 / 4 * sizeof(complex_t);
+    complex_t *twiddle = (complex_t *)MALLOC(twiddle_bytes);
+    uint32_t cycles_twiddle = 0;
+    if (twiddle != NULL)
+    {
+        cycles_twiddle = TIMESTAMP_CYCLES;
+        for (uint32_t k = 0; k < LUT_TEST_FFT_SIZE * 3 / 4; k++)
+        {
+            double angle = -2.0 * 3.14159265358979323846 * k / LUT_TEST_FFT_SIZE;
+            twiddle[k].real = (float)cos(angle);
+            twiddle[k].imag = (float)sin(angle);
+        }
+        cycles_twiddle = TIMESTAMP_CYCLES - cycles_twiddle;
+        uint32_t stride = LUT_FFT_TWIDDLE_SIZE / LUT_TEST_FFT_SIZE;
+        for (uint32_t k = 0; k < LUT_TEST_FFT_SIZE * 3 / 4; k++)
+        {
+            fail += (twiddle[k].real != g_lut_fft_twiddle[2 * k * stride]) || (twiddle[k].imag != g_lut_fft_twiddle[2 * k * stride + 1]);
+        }
+        FREE(twiddle);
+    }
+    print("fft_twiddle %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    // 正弦：整周 float 与 sinf，Q15 与 sinf * 32768
+    float err_sin = 0.0f, err_q15 = 0.0f;
+    for (uint32_t i = 0; i < LUT_SIN_SIZE; i++)
+    {
+        float e = fabsf(g_lut_sin[i] - sinf(TRIG_LUT_2PI * i / LUT_SIN_SIZE));
+        err_sin = (e > err_sin) ? e : err_sin;
+    }
+    for (uint32_t phase = 0; phase < 65536; phase += 7)
+    {
+        float e = fabsf(lut_sin_q15((uint16_t)phase) - 32768.0f * sinf(TRIG_LUT_2PI * phase / 65536.0f));
+        err_q15 = (e > err_q15) ? e : err_q15;
+    }
+    print("sin max err %.2e, sin_q15 max err %.2f LSB\r\n", err_sin, err_q15);
+
+    // gamma、分贝
+    fail = 0;
+    for (uint32_t i = 0; i < LUT_GAMMA8_SIZE; i++)
+    {
+        int32_t expect = (int32_t)(255.0f * powf(i / 255.0f, LUT_GAMMA8_GAMMA) + 0.5f);
+        int32_t diff = (int32_t)lut_gamma8(i) - expect;
+        fail += (diff > 1) || (diff < -1); // 单精度 powf 与主机双精度舍入可差 1
+    }
+    float err_db = 0.0f;
+    for (float db = LUT_DB_GAIN_MIN; db <= LUT_DB_GAIN_MAX; db += 0.1f)
+    {
+        float e = fabsf(lut_db_to_gain(db) / powf(10.0f, db / 20.0f) - 1.0f);
+        err_db = (e > err_db) ? e : err_db;
+    }
+    print("gamma8 %s, db_gain max rel err %.3f%%\r\n", fail == 0 ? "ok" : "FAIL", err_db * 100.0f);
+
+    // 上电：FFT 初始化现在只生成位反转表
+    fft_real_t fft_real = {0};
+    uint32_t cycles_init = TIMESTAMP_CYCLES;
+    bool is_ok = fft_real_init(&fft_real, LUT_TEST_FFT_SIZE);
+    cycles_init = TIMESTAMP_CYCLES - cycles_init;
+    if (is_ok)
+    {
+        fft_real_deinit(&fft_real);
+    }
+
+    // 省下的 RAM：只有 fft/fft_real 原先在堆上生成旋转因子表
+    uint32_t ram_fft_real = (LUT_TEST_FFT_SIZE / 2 * 3 / 4 + LUT_TEST_FFT_SIZE / 4) * sizeof(complex_t);
+    print("ram saved: fft(%u) %u B, fft_real(%u) %u B\r\n", LUT_TEST_FFT_SIZE, twiddle_bytes, LUT_TEST_FFT_SIZE, ram_fft_real);
+    print("startup saved: fft twiddle %llu ns; fft_real_init now %llu ns\r\n",
+          time_cycles_to_ns(&g_time_timer5, cycles_twiddle),
+          time_cycles_to_ns(&g_time_timer5, cycles_init));
+    print("flash: crc %u B, fft_twiddle %u B, sin %u B, sin_q15 %u B, gamma8 %u B, db_gain %u B\r\n",
+          (uint32_t)sizeof(g_lut_crc_ccitt), (uint32_t)sizeof(g_lut_fft_twiddle), (uint32_t)sizeof(g_lut_sin),
+          (uint32_t)sizeof(g_lut_sin_q15), (uint32_t)sizeof(g_lut_gamma8), (uint32_t)sizeof(g_lut_db_gain));
+
+    log_info("lut_test end");
+}
@@ -0,0 +1,192 @@
+/**
+ * @file rsa_test.cc
+ * @author WittXie
+ * @brief RSA验签测试：OpenSSL 生成的 2048/3072 位密钥对 "abc" 的 PKCS#1 v1.5 与 PSS 签名，篡改检测与单次验签耗时
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 验签栈峰值约3KB，测试任务栈不足时先调大 test_app_init 中的栈大小
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define RSA_TEST_E 65537   // 公钥指数
+#define RSA_TEST_LOOP 20    // 计时循环次数
+
+static const uint8_t rsa_test_n2048[] = {
+    0xac, 0x12, 0x18, 0xc8, 0x60, 0x03, 0xa8, 0x70, 0x74, 0x72, 0x89, 0x4d, 0xf5, 0xab, 0xa8, 0x6f,
+    0x46, 0x2e, 0x91, 0x63, 0x18, 0x0a, 0x46, 0xa1, 0xa0, 0x14, 0x97, 0x0d, 0x35, 0xc1, 0xec, 0x2d,
+    0x1f, 0x6c, 0x6d, 0xec, 0xe7, 0x5e, 0x03, 0x39, 0x30, 0xae, 0xcb, 0x3c, 0x1e, 0x4f, 0x24, 0x54,
+    0x7a, 0x24, 0x17, 0xe0, 0x01, 0xe3, 0x24, 0xf9, 0xf4, 0xcb, 0x7a, 0xed, 0x4e, 0x18, 0x85, 0x3b,
+    0x69, 0x23, 0x19, 0x3a, 0xbc, 0x63, 0x42, 0x6b, 0xeb, 0x24, 0xff, 0x70, 0x1f, 0x0e, 0x2b, 0x56,
+    0x38, 0x1f, 0xa3, 0xce, 0xec, 0x87, 0xc0, 0x5d, 0x71, 0x74, 0xe2, 0x70, 0x28, 0x15, 0xb9, 0xed,
+    0xf7, 0x60, 0x9a, 0x46, 0x19, 0xf9, 0x0d, 0x78, 0x50, 0xea, 0xe4, 0x61, 0xc0, 0x6b, 0x98, 0x88,
+    0x99, 0x35, 0xb1, 0x9f, 0xa4, 0xef, 0xca, 0x42, 0x6f, 0x7d, 0x1d, 0x0e, 0x90, 0x84, 0xac, 0xed,
+    0x6c, 0x0c, 0x16, 0xca, 0xdf, 0x61, 0xb0, 0x31, 0x23, 0x51, 0xa0, 0x17, 0x85, 0x7e, 0x1b, 0x97,
+    0x87, 0xc1, 0xd4, 0x6d, 0xb7, 0x36, 0x20, 0x2c, 0xd6, 0x08, 0xc5, 0xcd, 0x6c, 0xd4, 0xa5, 0x3f,
+    0x0c, 0xac, 0x47, 0x77, 0xdf, 0x8d, 0xe9, 0xb9, 0xc1, 0xce, 0x83, 0xd5, 0x41, 0x79, 0x4f, 0x1e,
+    0x20, 0x03, 0x8e, 0xc8, 0x26, 0x1f, 0x08, 0x28, 0xfd, 0xa2, 0xe0, 0x94, 0x49, 0xaa, 0xce, 0x7a,
+    0xc4, 0xf6, 0x5e, 0xc4, 0xb7, 0xd9, 0x8f, 0x5f, 0xc9, 0x18, 0xeb, 0xd5, 0xb4, 0x5c, 0x61, 0x65,
+    0xf3, 0xae, 0x5a, 0xaa, 0xca, 0xab, 0xac, 0xfe, 0xdb, 0xd6, 0xae, 0x6e, 0xd9, 0x12, 0x95, 0xed,
+    0x53, 0xfb, 0x8e, 0xc8, 0x21, 0xbb, 0x64, 0xa9, 0x4c, 0xa0, 0x15, 0x4b, 0xb0, 0x11, 0x40, 0xcd,
+    0xdf, 0xdf, 0x84, 0x54, 0x70, 0x80, 0x6c, 0x4d, 0xc9, 0x3a, 0xee, 0x02, 0xda, 0xf2, 0x9e, 0x79};
+
+static const uint8_t rsa_test_n3072[] = {
+    0x95, 0xfd, 0xb8, 0x7e, 0x3f, 0x8a, 0x70, 0x7b, 0x76, 0x98, 0x2d, 0x87, 0x92, 0x63, 0x82, 0x38,
+    0x0d, 0xa8, 0x3e, 0xf5, 0x8d, 0xb0, 0x36, 0x20, 0xc3, 0x92, 0x2b, 0x73, 0x70, 0x5c, 0x1c, 0x76,
+    0x3f, 0x3a, 0x8d, 0x12, 0xf3, 0x2b, 0x60, 0xfd, 0xd0, 0xd2, 0x9b, 0xeb, 0xf3, 0xbe, 0x2a, 0xe9,
+    0xcf, 0x75, 0x56, 0x47, 0xc5, 0xf4, 0xe8, 0x39, 0xb8, 0x9b, 0x5b, 0xf5, 0xa9, 0x9e, 0xb4, 0x31,
+    0x7d, 0x41, 0x9a, 0x8e, 0x4c, 0x3f, 0x33, 0xf6, 0x7d, 0x5b, 0x53, 0x92, 0xa4, 0x2f, 0x98, 0xf4,
+    0x8a, 0x42, 0x9c, 0x6a, 0x0d, 0xe2, 0x11, 0xc7, 0x36, 0xd7, 0x6e, 0xb5, 0x0e, 0x15, 0xa3, 0x09,
+    0xdc, 0xd3, 0xd0, 0x14, 0x6e, 0x74, 0x1d, 0xf0, 0x32, 0x7a, 0x04, 0x0e, 0x00, 0x6b, 0x84, 0x4f,
+    0x19, 0x91, 0x26, 0x29, 0x16, 0x56, 0x0d, 0x20, 0x03, 0x86, 0x14, 0x0e, 0x3e, 0xb5, 0x01, 0x36,
+    0x09, 0x41, 0x63, 0x63, 0x9d, 0x6d, 0x36, 0x08, 0xad, 0xc8, 0x56, 0xd6, 0x86, 0x55, 0xe4, 0xdf,
+    0x69, 0xa4, 0xbc, 0x4b, 0x89, 0xf7, 0x8d, 0x07, 0x7a, 0x38, 0xbe, 0x4b, 0x68, 0x27, 0xa4, 0x47,
+    0x6d, 0x16, 0x22, 0x67, 0x6c, 0xdd, 0xf4, 0xfa, 0x0c, 0x6c, 0xa0, 0x3f, 0xc0, 0x1d, 0x6d, 0x8a,
+    0x75, 0x5c, 0xa8, 0x1f, 0x15, 0xed, 0xef, 0xfa, 0x0e, 0x09, 0xf3, 0x14, 0x60, 0x27, 0x3a, 0x19,
+    0x68, 0x94, 0x1f, 0x44, 0x1c, 0x17, 0x77, 0x00, 0x65, 0x5a, 0x24, 0xe2, 0x01, 0x03, 0xae, 0x21,
+    0xb5, 0xd4, 0x46, 0xa0, 0x90, 0x05, 0x06, 0x12, 0x93, 0xf2, 0x41, 0xf1, 0xef, 0xd7, 0x09, 0x1b,
+    0x1c, 0x1e, 0x17, 0x16, 0x38, 0xf6, 0xbf, 0x62, 0xdb, 0x52, 0x83, 0x7e, 0x28, 0x47, 0x85, 0x09,
+    0x84, 0x11, 0x66, 0x0e, 0x3b, 0x79, 0x48, 0xbf, 0x29, 0x02, 0xd2, 0x05, 0x25, 0x1f, 0xf3, 0xdd,
+    0x1b, 0x28, 0x52, 0xa6, 0xc2, 0x46, 0x06, 0x1f, 0x58, 0x26, 0xec, 0xd5, 0x50, 0x47, 0x97, 0x87,
+    0xa5, 0x4b, 0x02, 0xc4, 0x33, 0x50, 0xfc, 0x3b, 0x02, 0x25, 0xdc, 0x67, 0xb6, 0x3d, 0xc6, 0x7b,
+    0x6d, 0x5f, 0xe4, 0x1d, 0x62, 0x32, 0x6c, 0xee, 0xe4, 0x87, 0xfe, 0x95, 0xf7, 0x0b, 0xf2, 0xab,
+    0x1a, 0xcd, 0xdc, 0x6d, 0x68, 0xdb, 0xc9, 0xdc, 0x01, 0x32, 0x85, 0x28, 0x7c, 0x85, 0x25, 0x9c,
+    0x5a, 0xe0, 0x32, 0xb6, 0xff, 0xdd, 0x72, 0xf7, 0x4d, 0x77, 0x82, 0xcb, 0x8d, 0x74, 0x99, 0xee,
+    0xd2, 0x76, 0x8b, 0x65, 0x6f, 0x5c, 0x18, 0x6c, 0xa6, 0xe2, 0xd2, 0x29, 0xfe, 0x22, 0xdb, 0x17,
+    0xb8, 0x59, 0x33, 0x8a, 0x16, 0xc4, 0x27, 0xa6, 0x84, 0x41, 0xec, 0x2c, 0xb7, 0xb5, 0x59, 0xce,
+    0x8c, 0xe3, 0xb3, 0x2b, 0xc4, 0x02, 0x8f, 0xb2, 0xf4, 0x84, 0xc0, 0xb2, 0x07, 0x29, 0xa4, 0xe5};
+
+static const uint8_t rsa_test_sig2048_pkcs1[] = {
+    0x08, 0x8a, 0x26, 0xa2, 0x5b, 0x64, 0x6e, 0x65, 0x44, 0x8a, 0x16, 0x13, 0xd2, 0x55, 0x29, 0xae,
+    0xb9, 0x10, 0x70, 0xf8, 0xd0, 0x50, 0x47, 0xa0, 0x33, 0x5a, 0xe4, 0x84, 0x93, 0x25, 0x04, 0x6e,
+    0x0b, 0xc0, 0x2f, 0x95, 0x5f, 0xe6, 0xa3, 0x23, 0x1b, 0x52, 0x47, 0x9e, 0x6a, 0x7a, 0xb3, 0x26,
+    0xb2, 0x6d, 0x59, 0x30, 0xa1, 0x7f, 0x89, 0x3f, 0x82, 0x91, 0x7c, 0x30, 0x66, 0x62, 0x08, 0x40,
+    0xff, 0xb5, 0xbb, 0x9e, 0x6b, 0xcb, 0x15, 0x81, 0x63, 0xde, 0x12, 0x8a, 0x7f, 0xc6, 0xfd, 0x8b,
+    0xd7, 0x6d, 0x8f, 0x34, 0x6e, 0x87, 0x93, 0xeb, 0x50, 0x05, 0xe3, 0x59, 0x38, 0x45, 0x44, 0xbb,
+    0xa3, 0xc2, 0xca, 0xfd, 0x26, 0x84, 0x13, 0x56, 0x31, 0x0b, 0x09, 0x45, 0x35, 0xd2, 0x71, 0xcd,
+    0x45, 0x3e, 0x8f, 0xf9, 0x80, 0xb1, 0xb6, 0x51, 0xbd, 0x99, 0x83, 0xa2, 0xb7, 0x3d, 0xa7, 0x28,
+    0x2c, 0x3a, 0x6e, 0xe5, 0xd4, 0xf3, 0x2a, 0xac, 0x24, 0x75, 0xad, 0x82, 0xf7, 0xbf, 0x4f, 0x1f,
+    0xec, 0xf2, 0x68, 0x61, 0xb7, 0x1a, 0xce, 0xc3, 0xfd, 0x8d, 0xa9, 0xd0, 0x4a, 0x4a, 0x31, 0xce,
+    0x1b, 0x3b, 0x31, 0x65, 0xae, 0xc8, 0xf4, 0x2c, 0x28, 0xfd, 0x13, 0xfd, 0xe7, 0x4e, 0x0e, 0xa6,
+    0x07, 0x09, 0x7e, 0x9f, 0xb3, 0xbb, 0x24, 0x99, 0x81, 0x69, 0x11, 0xd3, 0xec, 0x0d, 0x2f, 0xec,
+    0x8a, 0x8c, 0xec, 0xcd, 0x5c, 0x97, 0x6f, 0x8b, 0x4a, 0xea, 0x1d, 0xc8, 0x88, 0x03, 0x3c, 0x15,
+    0x77, 0x40, 0x5c, 0xf0, 0x63, 0x5f, 0x2c, 0x47, 0x3b, 0x28, 0x00, 0x7b, 0xdf, 0xb9, 0xe3, 0x86,
+    0xb1, 0x1d, 0x63, 0xe7, 0x07, 0x86, 0x70, 0x65, 0x45, 0x9d, 0x35, 0x49, 0x6c, 0xd0, 0x24, 0x81,
+    0x67, 0x31, 0x3f, 0x2d, 0xec, 0xe0, 0xd3, 0x91, 0x80, 0xbf, 0x96, 0x5f, 0x1a, 0x33, 0x31, 0x11};
+
+static const uint8_t rsa_test_sig2048_pss[] = {
+    0x9b, 0x15, 0x54, 0xda, 0x1a, 0xe1, 0x85, 0xa0, 0x2f, 0xf4, 0x50, 0x43, 0x1c, 0xb9, 0xe0, 0x1a,
+    0x69, 0xc4, 0x9a, 0xb4, 0xf0, 0xa1, 0xd8, 0xdd, 0x51, 0x7c, 0x09, 0x74, 0x98, 0xf0, 0x6c, 0xd6,
+    0xee, 0x60, 0xf7, 0xb1, 0x34, 0xb9, 0xc0, 0x2b, 0x9d, 0x2f, 0x48, 0x1d, 0x64, 0x34, 0x05, 0xbc,
+    0x52, 0xd3, 0x2a, 0x6e, 0x78, 0x5e, 0xa4, 0x05, 0x8d, 0x1f, 0xe4, 0xe2, 0x65, 0x4d, 0x3d, 0xb0,
+    0xa0, 0xe8, 0x82, 0x9b, 0xc0, 0x1c, 0x67, 0xd3, 0xc9, 0x3c, 0x80, 0xec, 0xc1, 0x4b, 0x73, 0x1c,
+    0xba, 0x98, 0x20, 0x75, 0x13, 0x0f, 0x1f, 0xe7, 0x6e, 0x42, 0x2b, 0x04, 0x71, 0xa0, 0xb9, 0xee,
+    0x48, 0xb7, 0x29, 0x96, 0x54, 0xb4, 0x17, 0x5d, 0x10, 0xc1, 0xa4, 0x4d, 0xe7, 0x2e, 0xe6, 0xb2,
+    0xbb, 0x9c, 0xf2, 0x73, 0x49, 0x34, 0x16, 0x79, 0x0a, 0x28, 0xc7, 0x2c, 0xc9, 0x0b, 0xf9, 0x7f,
+    0x79, 0x93, 0xd5, 0xb7, 0x2e, 0x49, 0x7f, 0x75, 0x7b, 0xc3, 0x1d, 0xd3, 0x11, 0xe4, 0xb5, 0xae,
+    0x68, 0x8d, 0xa8, 0x06, 0x06, 0xd4, 0x1d, 0x82, 0x05, 0xba, 0x05, 0x24, 0x9b, 0xbc, 0xbf, 0x16,
+    0x1d, 0x75, 0xe7, 0x86, 0x99, 0x7f, 0xa2, 0xe8, 0x9d, 0x9e, 0xb9, 0x26, 0x24, 0x2d, 0x6e, 0x11,
+    0xf1, 0x74, 0x08, 0x48, 0x8c, 0x87, 0xf4, 0xc0, 0x75, 0x9e, 0xe9, 0xbb, 0xc1, 0x31, 0x3b, 0xdb,
+    0xf0, 0x1d, 0x46, 0xdf, 0x2f, 0x20, 0xfb, 0xd0, 0x6f, 0x00, 0xc5, 0x81, 0x6b, 0x17, 0x32, 0x64,
+    0x6a, 0xbd, 0x9a, 0x63, 0x5d, 0x5e, 0x6c, 0x6f, 0xa0, 0xf0, 0x94, 0x77, 0xfa, 0x0c, 0x2f, 0xce,
+    0x6e, 0x1b, 0x06, 0xe0, 0x10, 0x78, 0x25, 0x57, 0xda, 0xf1, 0xba, 0x31, 0x13, 0x31, 0x78, 0xef,
+    0x06, 0x08, 0x78, 0x0d, 0xde, 0x0c, 0xd1, 0xa3, 0xad, 0x99, 0x57, 0x09, 0xb2, 0x2b, 0x3d, 0x59};
+
+static const uint8_t rsa_test_sig3072_pkcs1[] = {
+    0x92, 0xdc, 0x35, 0x34, 0x15, 0xe7, 0x93, 0x18, 0xab, 0x14, 0xa2, 0x9c, 0x12, 0xd8, 0x65, 0x7e,
+    0x51, 0xc3, 0xda, 0x58, 0x20, 0x78, 0x93, 0xcd, 0xfa, 0xc0, 0x59, 0xcc, 0xa9, 0x03, 0x31, 0xc4,
+    0x7a, 0x54, 0x6c, 0x2a, 0x88, 0x7d, 0xa2, 0xfa, 0xb7, 0x79, 0xea, 0x2f, 0xfc, 0xab, 0x7a, 0x2a,
+    0x3b, 0x52, 0xd5, 0x6e, 0x91, 0xff, 0xc5, 0x4e, 0x06, 0x57, 0x86, 0x3d, 0xa9, 0x0c, 0x99, 0xe9,
+    0xac, 0xa3, 0x21, 0x1c, 0x29, 0xf9, 0xa6, 0x1e, 0xc3, 0x8a, 0x74, 0x6b, 0xa0, 0x70, 0x55, 0x43,
+    0xa5, 0xb6, 0xe6, 0xdf, 0xb8, 0x43, 0xc9, 0x2c, 0x8e, 0x5b, 0x66, 0x99, 0x73, 0x3c, 0x3f, 0xef,
+    0x0d, 0xbb, 0x51, 0x4b, 0x7c, 0x03, 0xe7, 0x4d, 0x31, 0x96, 0x51, 0x5e, 0x6d, 0x49, 0xff, 0xc5,
+    0x99, 0xed, 0xc5, 0xed, 0xb3, 0x21, 0xc4, 0x9d, 0x80, 0xb7, 0x61, 0xb2, 0x18, 0x29, 0x15, 0x76,
+    0x43, 0x9a, 0x41, 0x86, 0x6a, 0x4f, 0x8b, 0xbf, 0x8c, 0x75, 0xf4, 0x1b, 0x89, 0x4f, 0xe9, 0x0e,
+    0x7f, 0x9f, 0xc7, 0x6b, 0x1c, 0x1b, 0xc2, 0x53, 0x42, 0x95, 0x2a, 0x99, 0x46, 0x85, 0x8e, 0x0c,
+    0x72, 0x6a, 0x14, 0xa9, 0xbb, 0xc9, 0x0b, 0xc1, 0xb2, 0xe4, 0x72, 0x6b, 0xb2, 0x74, 0x98, 0x8b,
+    0xe5, 0xd2, 0x8c, 0x80, 0xb7, 0x7d, 0xb9, 0xf9, 0xa8, 0x16, 0x77, 0x4d, 0xa9, 0xfe, 0xdf, 0x7b,
+    0x00, 0xa5, 0x8b, 0x63, 0xff, 0x44, 0x5f, 0xfa, 0x8f, 0x14, 0x75, 0x5a, 0x2c, 0xb7, 0x72, 0x25,
+    0x71, 0x8c, 0x1d, 0x48, 0x1a, 0xe3, 0x1c, 0xf3, 0x8d, 0x01, 0x1a, 0x40, 0xa7, 0x98, 0x70, 0xa8,
+    0x84, 0x91, 0x88, 0x88, 0xb7, 0x35, 0xc0, 0x8f, 0xe0, 0x01, 0xc6, 0x07, 0x7d, 0xf4, 0x9a, 0x4b,
+    0x19, 0x93, 0xd3, 0x63, 0x28, 0x25, 0x67, 0xd6, 0xeb, 0xd6, 0x98, 0x06, 0xb3, 0x58, 0xa5, 0x6f,
+    0xb3, 0x49, 0x85, 0x2e, 0xa3, 0x87, 0x0f, 0xfe, 0x6a, 0x43, 0x08, 0x79, 0x69, 0xfd, 0xc0, 0x80,
+    0xba, 0x72, 0x3d, 0x09, 0x78, 0xfb, 0x7b, 0x6b, 0x66, 0x40, 0x9b, 0x05, 0x09, 0xbf, 0x3f, 0xad,
+    0x2f, 0x8a, 0x13, 0xe8, 0x4e, 0xcc, 0xa4, 0xb2, 0x2f, 0x9e, 0xd8, 0xaf, 0x19, 0x79, 0xc4, 0x7b,
+    0x27, 0x82, 0xa2, 0xa9, 0x3b, 0x09, 0x6e, 0xd9, 0xca, 0xe5, 0xd2, 0x4e, 0xff, 0xe4, 0x9d, 0x98,
+    0xc9, 0x95, 0x2c, 0x7e, 0xc9, 0xe2, 0xcb, 0x0d, 0x60, 0x08, 0x0a, 0x34, 0x5b, 0xc9, 0xed, 0x8a,
+    0x78, 0xb8, 0x45, 0xc6, 0xcb, 0x49, 0x5f, 0x7c, 0x61, 0xed, 0x76, 0xeb, 0xa4, 0x40, 0xf3, 0xbe,
+    0x92, 0x5c, 0xbb, 0x37, 0xf8, 0xc5, 0x32, 0xad, 0xa4, 0xb5, 0xc6, 0x3f, 0x7d, 0xca, 0xf7, 0xd5,
+    0x62, 0x11, 0xcb, 0xf5, 0xc7, 0x04, 0x34, 0xfd, 0x67, 0xb0, 0x04, 0xa1, 0xc3, 0xc6, 0x64, 0xe6};
+
+typedef bool (*rsa_test_verify_t)(const rsa_public_key_t *key, const uint8_t *digest, const uint8_t *signature, uint32_t length);
+
+static bool rsa_test_pkcs1(const rsa_public_key_t *key, const uint8_t *digest, const uint8_t *signature, uint32_t length)
+{
+    return rsa_verify_pkcs1_sha256(key, digest, signature, length);
+}
+
+static bool rsa_test_pss(const rsa_public_key_t *key, const uint8_t *digest, const uint8_t *signature, uint32_t length)
+{
+    return rsa_verify_pss_sha256(key, digest, signature, length, RSA_PSS_SALT_AUTO);
+}
+
+// 验签、篡改签名、篡改摘要，并统计耗时
+static void rsa_test_case(const char *name, const rsa_public_key_t *key, rsa_test_verify_t verify,
+                          const uint8_t *signature, uint32_t length, uint8_t *digest)
+{
+    static uint8_t tampered[RSA_BITS_MAX / 8];
+
+    uint32_t cycles = TIMESTAMP_CYCLES;
+    bool is_ok = true;
+    for (uint8_t i = 0; i < RSA_TEST_LOOP; i++)
+    {
+        is_ok &= verify(key, digest, signature, length);
+    }
+    cycles = TIMESTAMP_CYCLES - cycles;
+
+    memcpy(tampered, signature, length);
+    tampered[length / 2] ^= 0x01;
+    bool is_sig_rejected = !verify(key, digest, tampered, length);
+
+    digest[0] ^= 0x80;
+    bool is_digest_rejected = !verify(key, digest, signature, length);
+    digest[0] ^= 0x80;
+
+    print("%-12s verify %s, bad signature %s, bad digest %s, %4u us/verify\r\n", name,
+          is_ok ? "ok" : "FAIL", is_sig_rejected ? "ok" : "FAIL", is_digest_rejected ? "ok" : "FAIL",
+          (uint32_t)(time_cycles_to_ns(&g_time_timer5, cycles) / 1000 / RSA_TEST_LOOP));
+}
+
+static void rsa_test(void)
+{
+    log_info("rsa_test start");
+
+    static rsa_public_key_t key;
+    uint8_t digest[SHA256_DIGEST_SIZE];
+    sha256_calculate((const uint8_t *)"abc", 3, digest);
+
+    // 2048 位
+    uint32_t cycles = TIMESTAMP_CYCLES;
+    bool is_inited = rsa_public_key_init(&key, rsa_test_n2048, sizeof(rsa_test_n2048), RSA_TEST_E);
+    cycles = TIMESTAMP_CYCLES - cycles;
+    print("rsa2048 key init %s, %6llu us\r\n", is_inited ? "ok" : "FAIL", time_cycles_to_ns(&g_time_timer5, cycles) / 1000);
+    if (is_inited)
+    {
+        rsa_test_case("rsa2048 pkcs1", &key, rsa_test_pkcs1, rsa_test_sig2048_pkcs1, sizeof(rsa_test_sig2048_pkcs1), digest);
+        rsa_test_case("rsa2048 pss", &key, rsa_test_pss, rsa_test_sig2048_pss, sizeof(rsa_test_sig2048_pss), digest);
+    }
+
+    // 3072 位
+    cycles = TIMESTAMP_CYCLES;
+    is_inited = rsa_public_key_init(&key, rsa_test_n3072, sizeof(rsa_test_n3072), RSA_TEST_E);
+    cycles = TIMESTAMP_CYCLES - cycles;
+    print("rsa3072 key init %s, %6llu us\r\n", is_inited ? "ok" : "FAIL", time_cycles_to_ns(&g_time_timer5, cycles) / 1000);
+    if (is_inited)
+    {
+        rsa_test_case("rsa3072 pkcs1", &key, rsa_test_pkcs1, rsa_test_sig3072_pkcs1, sizeof(rsa_test_sig3072_pkcs1), digest);
+    }
+
+    log_info("rsa_test end");
+}
@@ -0,0 +1,203 @@
+/**
+ * @file soft_timer_test.cc
+ * @author WittXie
+ * @brief 软件定时器测试：虚拟时钟下取消、重排、周期第N次落在 起点+N·周期、错过周期的 overrun；真实服务周期漂移 + 1000个定时器启动/到期耗时
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define SOFT_TIMER_TEST_SIZE 1000
+
+// 虚拟时钟
+static uint64_t soft_timer_test_clock = 0;
+static uint64_t soft_timer_test_now(void)
+{
+    return soft_timer_test_clock;
+}
+
+static uint32_t soft_timer_test_hits = 0;
+static void soft_timer_test_callback(soft_timer_t *timer, void *userdata)
+{
+    soft_timer_test_hits++;
+}
+
+// 周期回调：记录第N次执行与理想节拍 起点+N·周期 的偏差
+static volatile uint64_t soft_timer_test_start = 0;
+static volatile uint32_t soft_timer_test_count = 0;
+static volatile int64_t soft_timer_test_drift = 0;
+static volatile int64_t soft_timer_test_drift_max = 0;
+static void soft_timer_test_period_callback(soft_timer_t *timer, void *userdata)
+{
+    uint64_t now = TIMESTAMP_US;
+    soft_timer_test_count++;
+    soft_timer_test_drift = (int64_t)(now - soft_timer_test_start) - (int64_t)soft_timer_test_count * 10000;
+    soft_timer_test_drift_max = CMP_MAX(soft_timer_test_drift_max, soft_timer_test_drift);
+    os_sleep(3); // 回调耗时不应累积到周期上
+}
+
+// 断言用回调：记录次数和本次对应的排程时刻（周期定时器回调前截止时间已推进一个周期）
+static uint32_t soft_timer_test_fired = 0;
+static uint64_t soft_timer_test_tick = 0;
+static void soft_timer_test_record_callback(soft_timer_t *timer, void *userdata)
+{
+    soft_timer_test_fired++;
+    soft_timer_test_tick = timer->deadline - timer->period;
+}
+
+// 虚拟时钟：取消、重排、周期漂移、错过周期
+static uint32_t soft_timer_test_assert(void)
+{
+    soft_timer_service_t service = {
+        .cfg = {
+            .name = "soft_timer_test",
+            .size = 4,
+        },
+        .ops = {
+            .now = soft_timer_test_now,
+        },
+    };
+    soft_timer_t timer = {
+        .name = "soft_timer_test",
+        .callback = soft_timer_test_record_callback,
+    };
+    uint32_t fail = 0;
+
+    soft_timer_test_clock = 0;
+    soft_timer_service_init(&service);
+    if (!soft_timer_service_is_inited(&service))
+    {
+        return 1;
+    }
+
+    // 到期前取消：不执行，不再排程
+    soft_timer_test_fired = 0;
+    soft_timer_start(&service, &timer, 1000, 0);
+    soft_timer_test_clock = 500;
+    fail += (soft_timer_service_poll(&service) != 500);
+    soft_timer_stop(&service, &timer);
+    soft_timer_test_clock = 2000;
+    fail += (soft_timer_service_poll(&service) != SOFT_TIMER_WAIT_FOREVER);
+    fail += (soft_timer_test_fired != 0) || soft_timer_is_active(&timer) || (service.count != 0);
+    soft_timer_stop(&service, &timer); // 未启动时无操作
+    fail += (service.count != 0);
+
+    // 重排：原截止时间过后不执行，只在新截止时间执行一次
+    soft_timer_start(&service, &timer, 1000, 0); // 3000
+    soft_timer_test_clock = 2500;
+    soft_timer_reschedule(&service, &timer, 3000); // 5500
+    soft_timer_test_clock = 3100;
+    fail += (soft_timer_service_poll(&service) != 2400) || (soft_timer_test_fired != 0);
+    soft_timer_test_clock = 5500;
+    soft_timer_service_poll(&service);
+    soft_timer_test_clock = 20000;
+    soft_timer_service_poll(&service);
+    fail += (soft_timer_test_fired != 1) || (soft_timer_test_tick != 5500) || soft_timer_is_active(&timer);
+
+    // 周期：轮询时刻抖动，第N次仍落在 起点+N·周期，次数不多不少
+    const uint64_t start = soft_timer_test_clock, period = 1000;
+    uint32_t seed = 1;
+    soft_timer_test_fired = 0;
+    soft_timer_start(&service, &timer, period, period);
+    while (soft_timer_test_clock < start + 100 * period)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        soft_timer_test_clock += 1 + (seed >> 16) % 700; // 小于一个周期，不触发 overrun
+        uint32_t fired = soft_timer_test_fired;
+        soft_timer_service_poll(&service);
+        fail += (soft_timer_test_fired != fired) && (soft_timer_test_tick != start + soft_timer_test_fired * period);
+    }
+    fail += (soft_timer_test_fired != (soft_timer_test_clock - start) / period) || (timer.overrun != 0);
+    fail += (timer.deadline != start + (soft_timer_test_fired + 1) * period);
+
+    // 重排周期定时器保留周期，新相位从重排时刻算起
+    soft_timer_reschedule(&service, &timer, 250);
+    uint64_t phase = soft_timer_test_clock + 250;
+    fail += (timer.period != period) || (timer.deadline != phase);
+
+    // 错过 3 个多周期：只执行一次，overrun 计 3，下一次仍在网格上
+    soft_timer_test_fired = 0;
+    soft_timer_test_clock = phase + 3 * period + 500;
+    soft_timer_service_poll(&service);
+    fail += (soft_timer_test_fired != 1) || (timer.overrun != 3) || (timer.deadline != phase + 4 * period);
+
+    soft_timer_stop(&service, &timer);
+    fail += soft_timer_is_active(&timer) || (service.count != 0);
+    FREE(service.heap);
+    return fail;
+}
+
+static void soft_timer_test(void)
+{
+    log_info("soft_timer_test start");
+
+    uint32_t fail = soft_timer_test_assert();
+    print("virtual clock %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    // 真实服务：10ms 周期跑1s，第N次落在 起点+N·周期 附近，偏差不随次数增长
+    {
+        soft_timer_t timer = {
+            .name = "soft_timer_test",
+            .callback = soft_timer_test_period_callback,
+        };
+        soft_timer_test_start = TIMESTAMP_US;
+        soft_timer_start(&g_soft_timer, &timer, 10000, 10000);
+        os_sleep(1005);
+        soft_timer_stop(&g_soft_timer, &timer);
+        fail = (soft_timer_test_count < 99) || (soft_timer_test_count > 101) || (timer.overrun != 0);
+        fail += !(soft_timer_test_drift < 1000 && soft_timer_test_drift > -1000) || !(soft_timer_test_drift_max < 1000);
+        print("period: %u calls, drift %lld us, max %lld us, overrun %u.\r\n", soft_timer_test_count,
+              soft_timer_test_drift, soft_timer_test_drift_max, timer.overrun);
+        print("period %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+    }
+
+    // 虚拟时钟：1000个定时器启动/到期耗时
+    {
+        soft_timer_service_t service = {
+            .cfg = {
+                .name = "soft_timer_test",
+                .size = SOFT_TIMER_TEST_SIZE,
+            },
+            .ops = {
+                .now = soft_timer_test_now,
+            },
+        };
+        soft_timer_t *timers = (soft_timer_t *)MALLOC(SOFT_TIMER_TEST_SIZE * sizeof(soft_timer_t));
+        if (timers == NULL)
+        {
+            log_error("soft_timer_test malloc failed.");
+            return;
+        }
+        memset(timers, 0, SOFT_TIMER_TEST_SIZE * sizeof(soft_timer_t));
+        soft_timer_service_init(&service);
+
+        uint32_t seed = 1;
+        uint32_t cycles = TIMESTAMP_CYCLES;
+        for (uint32_t i = 0; i < SOFT_TIMER_TEST_SIZE; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            timers[i].callback = soft_timer_test_callback;
+            soft_timer_start(&service, &timers[i], 1 + (seed >> 16) % 100000, 0);
+        }
+        uint32_t insert_cycles = TIMESTAMP_CYCLES - cycles;
+
+        soft_timer_test_clock = 100000;
+        cycles = TIMESTAMP_CYCLES;
+        soft_timer_service_poll(&service);
+        uint32_t expire_cycles = TIMESTAMP_CYCLES - cycles;
+
+        print("insert: %llu ns/timer, expire: %llu ns/timer, hits %u.\r\n",
+              time_cycles_to_ns(&g_time_timer5, insert_cycles) / SOFT_TIMER_TEST_SIZE,
+              time_cycles_to_ns(&g_time_timer5, expire_cycles) / SOFT_TIMER_TEST_SIZE,
+              soft_timer_test_hits);
+        ASSERT(soft_timer_test_hits == SOFT_TIMER_TEST_SIZE);
+
+        FREE(service.heap);
+        FREE(timers);
+    }
+
+    log_info("soft_timer_test end");
+}
@@ -0,0 +1,158 @@
+/**
+ * @file sort_test.cc
+ * @author WittXie
+ * @brief 排序测试：随机/有序/逆序/全等/山峰输入下内省排序、基数排序与 qsort 的结果和耗时对比，第k小与结构体排序
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define SORT_TEST_SIZE 4096 // 元素个数
+
+static const char *sort_test_names[] = {"random", "sorted", "reversed", "equal", "organ"};
+
+static int sort_test_compare(const void *a, const void *b)
+{
+    int32_t x = *(const int32_t *)a, y = *(const int32_t *)b;
+    return (x > y) - (x < y);
+}
+
+// 生成不同分布的输入
+static void sort_test_fill(int32_t *buff, uint32_t length, uint8_t mode)
+{
+    for (uint32_t i = 0; i < length; i++)
+    {
+        switch (mode)
+        {
+        case 0:
+            buff[i] = rand() - RAND_MAX / 2;
+            break;
+        case 1:
+            buff[i] = i;
+            break;
+        case 2:
+            buff[i] = length - i;
+            break;
+        case 3:
+            buff[i] = 7;
+            break;
+        default:
+            buff[i] = (i < length / 2) ? i : length - i;
+            break;
+        }
+    }
+}
+
+typedef struct
+{
+    char name[6];
+    int32_t key;
+    uint8_t order;
+} sort_test_item_t;
+
+static void sort_test(void)
+{
+    log_info("sort_test start");
+
+    int32_t *source = (int32_t *)MALLOC(SORT_TEST_SIZE * sizeof(int32_t));
+    int32_t *expect = (int32_t *)MALLOC(SORT_TEST_SIZE * sizeof(int32_t));
+    int32_t *work = (int32_t *)MALLOC(SORT_TEST_SIZE * sizeof(int32_t));
+    int32_t *buff = (int32_t *)MALLOC(SORT_TEST_SIZE * sizeof(int32_t));
+    if (source == NULL || expect == NULL || work == NULL || buff == NULL)
+    {
+        log_error("sort_test malloc failed.");
+        if (source != NULL)
+        {
+            FREE(source);
+        }
+        if (expect != NULL)
+        {
+            FREE(expect);
+        }
+        if (work != NULL)
+        {
+            FREE(work);
+        }
+        if (buff != NULL)
+        {
+            FREE(buff);
+        }
+        return;
+    }
+
+    for (uint8_t mode = 0; mode < countof(sort_test_names); mode++)
+    {
+        sort_test_fill(source, SORT_TEST_SIZE, mode);
+
+        memcpy(expect, source, SORT_TEST_SIZE * sizeof(int32_t));
+        uint32_t cycles_qsort = TIMESTAMP_CYCLES;
+        qsort(expect, SORT_TEST_SIZE, sizeof(int32_t), sort_test_compare);
+        cycles_qsort = TIMESTAMP_CYCLES - cycles_qsort;
+
+        memcpy(work, source, SORT_TEST_SIZE * sizeof(int32_t));
+        uint32_t cycles_intro = TIMESTAMP_CYCLES;
+        sort_i32(work, SORT_TEST_SIZE);
+        cycles_intro = TIMESTAMP_CYCLES - cycles_intro;
+        bool is_intro_ok = (memcmp(work, expect, SORT_TEST_SIZE * sizeof(int32_t)) == 0);
+
+        memcpy(work, source, SORT_TEST_SIZE * sizeof(int32_t));
+        uint32_t cycles_radix = TIMESTAMP_CYCLES;
+        sort_radix_i32(work, SORT_TEST_SIZE, buff);
+        cycles_radix = TIMESTAMP_CYCLES - cycles_radix;
+        bool is_radix_ok = (memcmp(work, expect, SORT_TEST_SIZE * sizeof(int32_t)) == 0);
+
+        memcpy(work, source, SORT_TEST_SIZE * sizeof(int32_t));
+        uint32_t cycles_nth = TIMESTAMP_CYCLES;
+        int32_t median = sort_nth_i32(work, SORT_TEST_SIZE, SORT_TEST_SIZE / 2);
+        cycles_nth = TIMESTAMP_CYCLES - cycles_nth;
+        bool is_nth_ok = (median == expect[SORT_TEST_SIZE / 2]);
+
+        print("%-8s qsort %6llu us, intro %6llu us %s, radix %6llu us %s, median %6llu us %s\r\n",
+              sort_test_names[mode],
+              time_cycles_to_ns(&g_time_timer5, cycles_qsort) / 1000,
+              time_cycles_to_ns(&g_time_timer5, cycles_intro) / 1000, is_intro_ok ? "ok" : "FAIL",
+              time_cycles_to_ns(&g_time_timer5, cycles_radix) / 1000, is_radix_ok ? "ok" : "FAIL",
+              time_cycles_to_ns(&g_time_timer5, cycles_nth) / 1000, is_nth_ok ? "ok" : "FAIL");
+    }
+
+    // 结构体按字段排序，相同键保持原顺序
+    sort_test_item_t items[32];
+    for (uint8_t i = 0; i < countof(items); i++)
+    {
+        snprintf(items[i].name, sizeof(items[i].name), "it%02u", i);
+        items[i].key = rand() % 8 - 4;
+        items[i].order = i;
+    }
+    bool is_key_ok = sort_by_key(SORT_INT32, items, countof(items), sizeof(sort_test_item_t), offsetof(sort_test_item_t, key));
+    for (uint8_t i = 1; i < countof(items) && is_key_ok; i++)
+    {
+        if (items[i - 1].key > items[i].key || (items[i - 1].key == items[i].key && items[i - 1].order > items[i].order))
+        {
+            is_key_ok = false;
+        }
+    }
+    print("sort_by_key %s\r\n", is_key_ok ? "ok" : "FAIL");
+
+    // 调用者提供工作区：按 order 倒序键重排，应恢复为 order 降序；工作区为 NULL 时失败
+    static uint64_t key_buff[(SORT_BY_KEY_BUFF_SIZE(countof(items), sizeof(sort_test_item_t)) + 7) / 8];
+    for (uint8_t i = 0; i < countof(items); i++)
+    {
+        items[i].key = -(int32_t)items[i].order;
+    }
+    is_key_ok = sort_by_key_buff(SORT_INT32, items, countof(items), sizeof(sort_test_item_t), offsetof(sort_test_item_t, key), key_buff);
+    for (uint8_t i = 0; i < countof(items) && is_key_ok; i++)
+    {
+        is_key_ok = (items[i].order == countof(items) - 1 - i);
+    }
+    is_key_ok = is_key_ok && !sort_by_key_buff(SORT_INT32, items, countof(items), sizeof(sort_test_item_t), offsetof(sort_test_item_t, key), NULL);
+    print("sort_by_key_buff %s\r\n", is_key_ok ? "ok" : "FAIL");
+
+    FREE(source);
+    FREE(expect);
+    FREE(work);
+    FREE(buff);
+    log_info("sort_test end");
+}
@@ -0,0 +1,78 @@
+/**
+ * @file spectrum_test.cc
+ * @author WittXie
+ * @brief 频谱分析测试：合成正弦+谐波+噪声校验峰值/THD/频带能量，统计吞吐
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define SPECTRUM_TEST_RATE 6660.0f // 模拟IMU最高ODR
+#define SPECTRUM_TEST_BLOCK 128    // 每次送入样本数
+
+// 合成信号：直流 + 0.8 基波 + 0.08 二次 + 0.04 三次谐波 + 均匀噪声(有效值0.01)
+static void spectrum_test_signal(float *buff, uint32_t length, uint32_t *n)
+{
+    for (uint32_t i = 0; i < length; i++, (*n)++)
+    {
+        float t = *n / SPECTRUM_TEST_RATE;
+        float noise = ((float)rand() / RAND_MAX - 0.5f) * 0.03464f;
+        buff[i] = 1.0f + 0.8f * sinf(2 * M_PI * 200.3f * t) + 0.08f * sinf(2 * M_PI * 400.6f * t) + 0.04f * sinf(2 * M_PI * 600.9f * t) + noise;
+    }
+}
+
+static void spectrum_test(void)
+{
+    log_info("spectrum_test start");
+
+    static float buff[SPECTRUM_TEST_BLOCK];
+    spectrum_t spectrum = {
+        .cfg = {
+            .name = "spectrum_test",
+            .size = 1024,
+            .sample_rate = SPECTRUM_TEST_RATE,
+            .window = SPECTRUM_WINDOW_HANN,
+            .average = 8,
+            .is_remove_dc = true,
+        },
+    };
+    if (!spectrum_init(&spectrum))
+    {
+        log_error("spectrum_test init failed.");
+        return;
+    }
+
+    // 精度
+    uint32_t n = 0;
+    while (!spectrum_is_ready(&spectrum))
+    {
+        spectrum_test_signal(buff, SPECTRUM_TEST_BLOCK, &n);
+        spectrum_feed(&spectrum, buff, SPECTRUM_TEST_BLOCK, 1);
+    }
+    float freq = 0;
+    float amplitude = spectrum_peak(&spectrum, 50, 3000, &freq);
+    float thd = spectrum_thd(&spectrum, freq, 5);
+    float noise = spectrum_band_energy(&spectrum, 1000, 3000);
+    print("peak %.4f @ %.2f Hz, thd %.2f%%, noise %.3e.\r\n", amplitude, freq, thd * 100, noise);
+    ASSERT(fabsf(amplitude - 0.8f) < 0.01f);
+    ASSERT(fabsf(freq - 200.3f) < 0.5f);
+    ASSERT(fabsf(thd - 0.1118f) < 0.005f);
+
+    // 吞吐：1秒数据的处理耗时
+    uint32_t blocks = (uint32_t)SPECTRUM_TEST_RATE / SPECTRUM_TEST_BLOCK;
+    uint32_t cycles = TIMESTAMP_CYCLES;
+    for (uint32_t i = 0; i < blocks; i++)
+    {
+        PROFILE_SCOPE("spectrum_feed");
+        spectrum_feed(&spectrum, buff, SPECTRUM_TEST_BLOCK, 1);
+    }
+    cycles = TIMESTAMP_CYCLES - cycles;
+    uint64_t us = time_cycles_to_ns(&g_time_timer5, cycles) / 1000;
+    print("throughput: %u samples in %llu us, %.1f%% of realtime.\r\n", blocks * SPECTRUM_TEST_BLOCK, us, us / 10000.0f);
+
+    spectrum_deinit(&spectrum);
+    log_info("spectrum_test end");
+}
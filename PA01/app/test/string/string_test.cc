@@ -0,0 +1,168 @@
+/**
+ * @file string_test.cc
+ * @author WittXie
+ * @brief 字符串测试：memfind/strnstr、strlen_common 与朴素实现随机比对，分割函数用例，日志行长度输入耗时对比
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define STRING_TEST_RANDOM 20000  // 随机比对次数
+#define STRING_TEST_LOOP 1000     // 计时循环次数
+#define STRING_TEST_HAY_MAX 512   // 随机被查找串最大长度
+#define STRING_TEST_NEEDLE_MAX 64 // 随机查找串最大长度
+
+static uint8_t string_test_hay[STRING_TEST_HAY_MAX];
+static uint8_t string_test_needle[STRING_TEST_NEEDLE_MAX];
+
+// 朴素查找，作为参考
+static void *string_test_naive(const uint8_t *h, uint32_t hay_len, const uint8_t *n, uint32_t needle_len)
+{
+    if (needle_len == 0)
+        return (void *)h;
+    for (uint32_t i = 0; i + needle_len <= hay_len; i++)
+    {
+        uint32_t k = 0;
+        while ((k < needle_len) && (h[i + k] == n[k]))
+        {
+            k++;
+        }
+        if (k == needle_len)
+        {
+            return (void *)(h + i);
+        }
+    }
+    return NULL;
+}
+
+static void string_test(void)
+{
+    log_info("string_test start");
+
+    // memfind 随机比对：小字母表制造大量部分匹配，一半 needle 取自被查找串
+    uint32_t fail = 0, found = 0;
+    for (uint32_t k = 0; k < STRING_TEST_RANDOM; k++)
+    {
+        uint32_t alpha = (k & 1) ? 2 : 26;
+        uint32_t hay_len = (uint32_t)rand() % STRING_TEST_HAY_MAX;
+        uint32_t needle_len = (uint32_t)rand() % STRING_TEST_NEEDLE_MAX;
+        for (uint32_t i = 0; i < hay_len; i++)
+        {
+            string_test_hay[i] = (uint8_t)('a' + rand() % alpha);
+        }
+        if ((rand() & 1) && (hay_len >= needle_len) && (needle_len > 0))
+        {
+            memcpy(string_test_needle, &string_test_hay[rand() % (hay_len - needle_len + 1)], needle_len);
+            string_test_needle[rand() % needle_len] ^= (uint8_t)(rand() & 1);
+        }
+        else
+        {
+            for (uint32_t i = 0; i < needle_len; i++)
+            {
+                string_test_needle[i] = (uint8_t)('a' + rand() % alpha);
+            }
+        }
+        void *expect = string_test_naive(string_test_hay, hay_len, string_test_needle, needle_len);
+        fail += (memfind(string_test_hay, hay_len, string_test_needle, needle_len) != expect);
+        found += (expect != NULL);
+    }
+    print("memfind random %s, %u fail, %u found\r\n", fail == 0 ? "ok" : "FAIL", fail, found);
+
+    // strlen_common 随机比对：不同对齐
+    fail = 0;
+    for (uint32_t k = 0; k < STRING_TEST_RANDOM; k++)
+    {
+        char *s1 = (char *)string_test_hay + (k & 3);
+        char *s2 = (char *)string_test_hay + STRING_TEST_HAY_MAX / 2 + ((k >> 2) & 3);
+        uint32_t length = (uint32_t)rand() % (STRING_TEST_HAY_MAX / 2 - 8);
+        for (uint32_t i = 0; i < length; i++)
+        {
+            s1[i] = s2[i] = (char)('a' + rand() % 26);
+        }
+        s1[length] = '\0';
+        uint32_t cut = (uint32_t)rand() % (length + 1);
+        s2[cut] = (rand() & 1) ? '\0' : '#';
+        s2[length] = '\0';
+        uint32_t expect = 0;
+        while ((s1[expect] != '\0') && (s1[expect] == s2[expect]))
+        {
+            expect++;
+        }
+        fail += (strlen_common(s1, s2) != expect);
+    }
+    print("strlen_common random %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    // 分割
+    static const struct
+    {
+        const char *str;
+        const char *expect; // 参数以 '|' 连接
+    } split_cases[] = {
+        {"ls -l  /tmp", "ls|-l|/tmp"},
+        {"  a\tb ,c,, d  ", "a|b|c|d"},
+        {"cmd arg#comment", "cmd|arg"},
+        {"#comment", ""},
+        {"", ""},
+    };
+    char buff[64], joined[64];
+    char *argv[8];
+    uint32_t argc;
+    fail = 0;
+    for (uint32_t i = 0; i < countof(split_cases); i++)
+    {
+        split_string_to_buff(buff, split_cases[i].str, " ", ",\t", "#", argv, &argc);
+        joined[0] = '\0';
+        for (uint32_t j = 0; j < argc; j++)
+        {
+            strcat(joined, (j == 0) ? "" : "|");
+            strcat(joined, argv[j]);
+        }
+        fail += (strcmp(joined, split_cases[i].expect) != 0);
+    }
+    print("split_string_to_buff %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    // 日志行长度输入耗时
+    static const char line[] = "[12:34:56.789] [INFO ] motor.c:123 foc_step: id=0.012 iq=1.234 vbus=24.00 speed=1500rpm temp=45C state=RUN";
+    static const char *needles[] = {"RUN", "state", "speed=1500", "notfound", "vbus=24.00 speed=1500rpm temp=45C state=RUN"};
+    for (uint32_t i = 0; i < countof(needles); i++)
+    {
+        uint32_t needle_len = strlen(needles[i]);
+        volatile uintptr_t sink = 0;
+        uint32_t cycles_fast = TIMESTAMP_CYCLES;
+        for (uint32_t k = 0; k < STRING_TEST_LOOP; k++)
+        {
+            sink += (uintptr_t)strnstr(line, needles[i], sizeof(line) - 1, needle_len);
+        }
+        cycles_fast = TIMESTAMP_CYCLES - cycles_fast;
+        uint32_t cycles_naive = TIMESTAMP_CYCLES;
+        for (uint32_t k = 0; k < STRING_TEST_LOOP; k++)
+        {
+            sink += (uintptr_t)string_test_naive((const uint8_t *)line, sizeof(line) - 1, (const uint8_t *)needles[i], needle_len);
+        }
+        cycles_naive = TIMESTAMP_CYCLES - cycles_naive;
+        uint32_t cycles_libc = TIMESTAMP_CYCLES;
+        for (uint32_t k = 0; k < STRING_TEST_LOOP; k++)
+        {
+            sink += (uintptr_t)strstr(line, needles[i]);
+        }
+        cycles_libc = TIMESTAMP_CYCLES - cycles_libc;
+        print("needle %2u: strnstr %5llu ns, naive %5llu ns, strstr %5llu ns\r\n", needle_len,
+              time_cycles_to_ns(&g_time_timer5, cycles_fast) / STRING_TEST_LOOP,
+              time_cycles_to_ns(&g_time_timer5, cycles_naive) / STRING_TEST_LOOP,
+              time_cycles_to_ns(&g_time_timer5, cycles_libc) / STRING_TEST_LOOP);
+    }
+
+    // 分割耗时
+    uint32_t cycles = TIMESTAMP_CYCLES;
+    for (uint32_t k = 0; k < STRING_TEST_LOOP; k++)
+    {
+        split_string_to_buff((char *)string_test_hay, "set motor.speed 1500 rpm, ramp 200 # comment", " ", ",", "#", argv, &argc);
+    }
+    cycles = TIMESTAMP_CYCLES - cycles;
+    print("split_string_to_buff %llu ns, argc %u\r\n", time_cycles_to_ns(&g_time_timer5, cycles) / STRING_TEST_LOOP, argc);
+
+    log_info("string_test end");
+}
@@ -2,12 +2,24 @@
 
 // 加载测试
 #include "./adc/adc_test.cc"
+#include "./ahrs/ahrs_test.cc"
 #include "./aw9523b/aw9523b_test.cc"
 #include "./button/button_test.cc"
+#include "./fast_math/fast_math_test.cc"
+#include "./fft/fft_test.cc"
+#include "./fit/fit_test.cc"
+#include "./filter/filter_test.cc"
+#include "./fmt/fmt_test.cc"
+#include "./foc/foc_test.cc"
+#include "./goertzel/goertzel_test.cc"
+#include "./hash/hash_test.cc"
+#include "./hex/hex_test.cc"
+#include "./kalman/kalman_test.cc"
 #include "./lcd/lcd_test.cc"
 #include "./led/led_test.cc"
 #include "./list/list_test.cc"
 #include "./lsm6dsdtr/lsm6dsdtr_test.cc"
+#include "./lut/lut_test.cc"
 #include "./lvgl/lvgl_test.cc"
 #include "./nop/nop_test.cc"
 #include "./ppm/ppm_test.cc"
@@ -16,9 +28,17 @@
 #include "./ram/ram_test.cc"
 #include "./rf_power/rf_power_test.cc"
 #include "./roller/roller_test.cc"
+#include "./rsa/rsa_test.cc"
 #include "./sdcard/sdcard_test.cc"
 #include "./sdram/sdram_test.cc"
+#include "./soft_timer/soft_timer_test.cc"
+#include "./sort/sort_test.cc"
+#include "./spectrum/spectrum_test.cc"
 #include "./stick/stick_test.cc"
+#include "./string/string_test.cc"
+#include "./time/time_test.cc"
+#include "./trace/trace_test.cc"
+#include "./usb_cdc/usb_cdc_test.cc"
 
 // 测试任务
 static void test_entry(void *args)
@@ -63,6 +83,26 @@ static void test_entry(void *args)
     // protocol_test();
     // list_test();
     // rf_power_test();
+    // usb_cdc_test();
+    // time_test();
+    // trace_test();
+    // soft_timer_test();
+    // fft_test();
+    // spectrum_test();
+    // goertzel_test();
+    // sort_test();
+    // fast_math_test();
+    // hash_test();
+    // rsa_test();
+    // foc_test();
+    // kalman_test();
+    // fmt_test();
+    // string_test();
+    // hex_test();
+    // lut_test();
+    // filter_test();
+    // fit_test();
+    // ahrs_test();
 
     // 循环
     for (;;)
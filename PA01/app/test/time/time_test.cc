@@ -0,0 +1,202 @@
+/**
+ * @file time_test.cc
+ * @author WittXie
+ * @brief 时间戳测试：16/32位定时器回绕仿真 + 单调性 + 每次调用耗时 + 性能统计校验
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define TIME_TEST_CNT 100000
+#define TIME_TEST_SIM_FREQ 100000000u // 仿真周期计数器频率，约43s回绕
+#define TIME_TEST_SIM_STEPS 200000    // 仿真步数
+#define TIME_TEST_SIM_STEP_US 997     // 每步推进的微秒数，与回绕周期互质
+
+// 回绕仿真：软件模拟的定时器、溢出中断和周期计数器
+static struct
+{
+    uint64_t us;      // 真实时间
+    uint8_t bits;     // 定时器位数
+    uint32_t pending; // 挂起未处理的溢出中断
+} s_time_sim;
+
+static void time_sim_init(void)
+{
+}
+static uint32_t time_sim_read(void)
+{
+    return (uint32_t)(s_time_sim.us & ((1ull << s_time_sim.bits) - 1));
+}
+static void time_sim_write(uint32_t timer_cnt)
+{
+}
+static bool time_sim_is_overflow(void)
+{
+    return s_time_sim.pending != 0;
+}
+static uint32_t time_sim_cycles(void)
+{
+    return (uint32_t)(s_time_sim.us * (TIME_TEST_SIM_FREQ / 1000000u));
+}
+
+// 按 bits 位定时器仿真200s：16位定时器溢出约3000次，32位定时器溢出1次，周期计数器回绕4次；返回错误次数
+static uint32_t time_wrap_sim(uint8_t bits)
+{
+    vtime_t time = {
+        .cfg = {
+            .timer_bits = bits,
+            .cycles_freq = TIME_TEST_SIM_FREQ,
+        },
+        .ops = {
+            .init = time_sim_init,
+            .read = time_sim_read,
+            .write = time_sim_write,
+            .is_overflow = time_sim_is_overflow,
+            .cycles = time_sim_cycles,
+        },
+    };
+    s_time_sim.bits = bits;
+    s_time_sim.pending = 0;
+    s_time_sim.us = (1ull << 32) - 10 * 1000 * 1000; // 32位定时器10s后溢出
+    time_init(&time);
+    time.timestamp_letf = s_time_sim.us >> bits; // 相当于 current_date_set
+    time_fast_sync(&time);
+
+    uint32_t fail = 0;
+    uint64_t last_fast = 0;
+    for (uint32_t i = 0; i < TIME_TEST_SIM_STEPS; i++)
+    {
+        uint64_t old = s_time_sim.us;
+        s_time_sim.us += TIME_TEST_SIM_STEP_US;
+        s_time_sim.pending += (uint32_t)((s_time_sim.us >> bits) - (old >> bits));
+
+        // 一半的步数在溢出中断执行前读取（关中断或高优先级中断中调用的情形）
+        if ((i & 1u) == 0)
+        {
+            for (; s_time_sim.pending != 0; s_time_sim.pending--)
+            {
+                time_hook(&time);
+            }
+        }
+
+        // 每仿真1s同步一次锚点；中段停 30s 不同步（超过锚点有效跨度 21s），锚点过期时应退回慢路径
+        bool is_sync_stop = (i > TIME_TEST_SIM_STEPS / 2) && (i < TIME_TEST_SIM_STEPS / 2 + 30000);
+        if (!is_sync_stop && i % 1000 == 0)
+        {
+            time_fast_sync(&time);
+        }
+
+        uint64_t us = timestamp_us_get(&time);
+        uint64_t fast = timestamp_us_fast_get(&time);
+        int64_t err = (int64_t)(fast - s_time_sim.us);
+        if (us != s_time_sim.us || err > 2 || err < -2 || fast < last_fast)
+        {
+            fail++;
+        }
+        last_fast = fast;
+
+        for (; s_time_sim.pending != 0; s_time_sim.pending--)
+        {
+            time_hook(&time);
+        }
+    }
+    return fail;
+}
+
+static void time_test(void)
+{
+    log_info("time_test start");
+
+    // 回绕：慢路径与真实时间逐微秒一致，快路径误差不超过2us且不回退
+    {
+        uint32_t fail16 = time_wrap_sim(16);
+        uint32_t fail32 = time_wrap_sim(32);
+        print("wrap sim: 16bit %s, %u fail; 32bit %s, %u fail\r\n",
+              fail16 == 0 ? "ok" : "FAIL", fail16, fail32 == 0 ? "ok" : "FAIL", fail32);
+    }
+
+    // 单调性：连续读取，快慢两条路径都不允许回退
+    {
+        uint32_t error_cnt = 0;
+        uint64_t last = TIMESTAMP_US;
+        uint64_t last_fast = TIMESTAMP_US_FAST;
+        for (uint32_t i = 0; i < TIME_TEST_CNT * 10; i++)
+        {
+            uint64_t now = TIMESTAMP_US;
+            uint64_t now_fast = TIMESTAMP_US_FAST;
+            if (now < last || now_fast < last_fast)
+            {
+                error_cnt++;
+            }
+            last = now;
+            last_fast = now_fast;
+        }
+        ASSERT(error_cnt == 0, "timestamp goes back %u times.\r\n", error_cnt);
+        print("monotonic: error %u times.\r\n", error_cnt);
+    }
+
+    // 每次调用耗时
+    {
+        volatile uint64_t sink = 0;
+        uint32_t cycles;
+
+        cycles = TIMESTAMP_CYCLES;
+        for (uint32_t i = 0; i < TIME_TEST_CNT; i++)
+        {
+            sink += TIMESTAMP_US;
+        }
+        cycles = TIMESTAMP_CYCLES - cycles;
+        print("timestamp_us_get: %llu ns/call\r\n", time_cycles_to_ns(&g_time_timer5, cycles) / TIME_TEST_CNT);
+
+        cycles = TIMESTAMP_CYCLES;
+        for (uint32_t i = 0; i < TIME_TEST_CNT; i++)
+        {
+            sink += TIMESTAMP_US_FAST;
+        }
+        cycles = TIMESTAMP_CYCLES - cycles;
+        print("timestamp_us_fast_get: %llu ns/call\r\n", time_cycles_to_ns(&g_time_timer5, cycles) / TIME_TEST_CNT);
+
+        cycles = TIMESTAMP_CYCLES;
+        for (uint32_t i = 0; i < TIME_TEST_CNT; i++)
+        {
+            sink += TIMESTAMP_CYCLES;
+        }
+        cycles = TIMESTAMP_CYCLES - cycles;
+        print("timestamp_cycles_get: %llu ns/call\r\n", time_cycles_to_ns(&g_time_timer5, cycles) / TIME_TEST_CNT);
+    }
+
+    // 性能统计：已知耗时序列 1~100 周期，校验计数、最值、均值、标准差、直方图与清空
+    {
+        static profile_t profile = {.name = "time_test_known"}; // 挂入全局链表，须为静态
+        for (uint32_t cycles = 1; cycles <= 100; cycles++)
+        {
+            profile_record(&profile, cycles);
+        }
+        uint32_t fail = 0;
+        float avg = (float)profile.sum / profile.count;
+        fail += (profile.count != 100) || (profile.min != 1) || (profile.max != 100) || (profile.sum != 5050);
+        fail += !(profile.min <= avg && avg <= profile.max) || (fabsf(profile.mean - 50.5f) > 1e-3f);
+        fail += (fabsf(profile_stddev(&profile) - 29.0115f) > 1e-2f);
+        fail += (profile.hist[0] != 1) || (profile.hist[1] != 2) || (profile.hist[6] != 37); // [1,2) [2,4) [64,128)
+        profile_reset();
+        fail += (profile.count != 0) || (profile.min != UINT32_MAX) || (profile.max != 0) || (profile.sum != 0) || (profile.hist[6] != 0);
+        profile_record(&profile, 7);
+        fail += (profile.count != 1) || (profile.min != 7) || (profile.max != 7); // 清空后重新统计
+        print("profile %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+    }
+
+    // 性能统计：PROFILE_ENABLE 打开时，打印系统运行以来各统计点的数据
+    {
+        for (uint32_t i = 0; i < TIME_TEST_CNT; i++)
+        {
+            PROFILE_SCOPE("time_test_empty"); // 统计本身的开销
+        }
+        os_sleep(1000);
+        profile_dump(false);
+    }
+
+    log_info("time_test end");
+}
@@ -0,0 +1,163 @@
+/**
+ * @file trace_test.cc
+ * @author WittXie
+ * @brief 事件追踪测试：小容量环形缓存回绕后的计数、丢失数与由旧到新的导出顺序 + 记录开销 + 经USB导出
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define TRACE_TEST_CNT 1000
+#define TRACE_TEST_RING 8     // 环形测试的缓存事件数
+#define TRACE_TEST_DUMP 512   // 导出捕获缓存字节数
+
+static uint32_t s_trace_test_cycles;                // 仿真周期计数器
+static uint8_t s_trace_test_dump[TRACE_TEST_DUMP]; // 导出捕获
+static uint32_t s_trace_test_dump_length;
+
+static uint32_t trace_test_cycles(void)
+{
+    return s_trace_test_cycles += 10;
+}
+
+static void trace_test_capture(uint8_t *buff, uint32_t length)
+{
+    uint32_t size = CMP_MIN(length, TRACE_TEST_DUMP - s_trace_test_dump_length);
+    memcpy(&s_trace_test_dump[s_trace_test_dump_length], buff, size);
+    s_trace_test_dump_length += size;
+}
+
+// 导出并校验：头部计数与丢失数、名称表、事件按时间由旧到新且参数为 first ~ first+count-1
+static uint32_t trace_test_ring_check(trace_t *trace, uint32_t count, uint32_t lost, uint32_t first)
+{
+    uint32_t fail = 0, value;
+    uint16_t name_count, task_count;
+
+    s_trace_test_dump_length = 0;
+    fail += (trace_dump(trace, trace_test_capture) != count);
+    fail += (memcmp(s_trace_test_dump, "VTRC", 4) != 0);
+    memcpy(&value, &s_trace_test_dump[12], 4);
+    fail += (value != count);
+    memcpy(&value, &s_trace_test_dump[16], 4);
+    fail += (value != lost);
+    memcpy(&name_count, &s_trace_test_dump[20], 2);
+    memcpy(&task_count, &s_trace_test_dump[22], 2);
+    fail += (name_count != 1) || (task_count != 1);
+
+    // 跳过名称表：{id(u16) length(u8) char[length]}
+    uint32_t offset = 24;
+    for (uint16_t i = 0; i < name_count + task_count && offset + 3 <= s_trace_test_dump_length; i++)
+    {
+        offset += 3 + s_trace_test_dump[offset + 2];
+    }
+    fail += (offset + count * sizeof(trace_event_t) != s_trace_test_dump_length);
+
+    uint32_t last_cycles = 0;
+    for (uint32_t i = 0; i < count && offset + sizeof(trace_event_t) <= s_trace_test_dump_length; i++)
+    {
+        trace_event_t event;
+        memcpy(&event, &s_trace_test_dump[offset + i * sizeof(trace_event_t)], sizeof(event));
+        fail += (event.type != TRACE_TYPE_COUNTER) || (event.arg != first + i) || (i > 0 && event.cycles <= last_cycles);
+        last_cycles = event.cycles;
+    }
+    return fail;
+}
+
+// 环形缓存：写入少于容量时全部导出；写入超过容量后只留最新 TRACE_TEST_RING 个，丢失数为其余
+static uint32_t trace_test_ring(void)
+{
+    static trace_t trace = {
+        .cfg = {
+            .name = "trace_test",
+            .buff_size = TRACE_TEST_RING,
+            .name_size = 4,
+            .task_size = 4,
+            .cycles_freq = 1000000,
+        },
+        .ops = {
+            .cycles = trace_test_cycles,
+        },
+    };
+    uint32_t fail = 0;
+
+    if (!trace_is_inited(&trace)) // 没有反初始化接口，只初始化一次
+    {
+        trace_init(&trace);
+    }
+    if (!trace_is_inited(&trace))
+    {
+        return 1;
+    }
+    trace_task_name_set(&trace, 1, "trace_test_task");
+    uint16_t id = trace_name_register(&trace, "trace_test_ring");
+    fail += (id == TRACE_ID_NONE) || (trace_name_register(&trace, "trace_test_ring") != id); // 同名复用
+
+    // 未回绕
+    trace_clear(&trace);
+    trace_enable(&trace, true);
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        trace_record(&trace, TRACE_TYPE_COUNTER, id, i);
+    }
+    fail += trace_test_ring_check(&trace, 5, 0, 0);
+
+    // 回绕：20 + 5 个事件写入 8 个槽位，保留 17 ~ 24
+    for (uint32_t i = 5; i < 25; i++)
+    {
+        trace_record(&trace, TRACE_TYPE_COUNTER, id, i);
+    }
+    fail += trace_test_ring_check(&trace, TRACE_TEST_RING, 25 - TRACE_TEST_RING, 25 - TRACE_TEST_RING);
+
+    // 停止记录时不写入；导出后保持原记录状态
+    fail += !trace_is_running(&trace);
+    trace_enable(&trace, false);
+    trace_record(&trace, TRACE_TYPE_COUNTER, id, 100);
+    fail += (trace.head != 25);
+    return fail;
+}
+
+// 按帧长分段发送
+static void trace_test_write(uint8_t *buff, uint32_t length)
+{
+    while (length > 0)
+    {
+        uint32_t size = CMP_MIN(length, 1000u);
+        usb_cdc_channel_send(USB_CDC_CHANNEL_TELEMETRY, buff, size);
+        buff += size;
+        length -= size;
+    }
+}
+
+static void trace_test(void)
+{
+    log_info("trace_test start");
+
+    uint32_t fail = trace_test_ring();
+    print("ring %s, %u fail\r\n", fail == 0 ? "ok" : "FAIL", fail);
+
+    // 每次记录耗时
+    {
+        uint32_t cycles = TIMESTAMP_CYCLES;
+        for (uint32_t i = 0; i < TRACE_TEST_CNT; i++)
+        {
+            TRACE_COUNTER("trace_test", i);
+        }
+        cycles = TIMESTAMP_CYCLES - cycles;
+        print("trace_record: %llu ns/call\r\n", time_cycles_to_ns(&g_time_timer5, cycles) / TRACE_TEST_CNT);
+    }
+
+    // 采集一段系统运行，导出后用 tools/trace/trace2json.py 转换
+    trace_clear(&g_trace);
+    for (uint32_t i = 0; i < 10; i++)
+    {
+        TRACE_BEGIN("trace_test_sleep");
+        os_sleep(10);
+        TRACE_END("trace_test_sleep");
+    }
+    print("trace dump: %u events.\r\n", trace_bsp_dump(trace_test_write));
+
+    log_info("trace_test end");
+}
@@ -0,0 +1,261 @@
+/**
+ * @file usb_cdc_test.cc
+ * @author WittXie
+ * @brief USB CDC 传输测试：回环仿真 + 通道回环 + 吞吐量（目标 > 800KB/s）
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ *  回环仿真：IN传输由仿真端点接管（高优先级任务在临界区内调用 CDC_TransmitCplt_Callback，模拟传输完成中断），
+ *            发出的字节流直接按帧解包，多个任务并发写入，校验CRC、帧不交错、每个任务的序号连续；不需要连接主机。
+ *  实测：主机端打开虚拟串口持续读取即可；通道回环需主机把收到的帧原样发回。
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../test_app.h"
+
+#define USB_CDC_TEST_TOTAL (1024 * 1024) // 吞吐量测试总字节
+#define USB_CDC_TEST_CHUNK 200           // 模拟日志的非对齐小包
+#define USB_CDC_SIM_WRITERS 3            // 仿真并发写入任务数
+#define USB_CDC_SIM_FRAMES 2000          // 每个写入任务的帧数
+#define USB_CDC_SIM_MAGIC 0x5A           // 仿真帧标记，区分同时在发的日志帧
+#define USB_CDC_SIM_HEAD 6               // 仿真帧数据头：标记、任务号、序号
+
+void CDC_TransmitCplt_Callback(uint8_t *buff, uint32_t length);
+
+// 回环仿真
+static struct
+{
+    TaskHandle_t handle;                   // 仿真端点任务
+    uint8_t *volatile pending_buff;        // 正在“传输”的包缓存
+    volatile uint16_t pending_length;      // 正在“传输”的长度，0 表示端点空闲
+    volatile bool is_stop;                 // 结束仿真
+    volatile uint32_t done;                // 已结束的写入任务数
+    uint8_t rx[2048];                      // 解包缓存
+    uint32_t rx_length;                    // 解包缓存有效长度
+    uint8_t data[1024];                    // 解出的帧数据
+    uint32_t seq[USB_CDC_SIM_WRITERS];     // 每个写入任务期望的下一个序号
+    uint32_t frames;                       // 收到的仿真帧
+    uint32_t bytes;                        // 收到的字节
+    uint32_t fail;                         // 错误计数
+} s_sim;
+
+// 仿真IN传输：记下包缓存，唤醒端点任务
+static uint8_t usb_cdc_sim_transmit(uint8_t *buff, uint16_t length)
+{
+    if (s_sim.pending_length != 0)
+    {
+        return USBD_BUSY;
+    }
+    s_sim.pending_buff = buff;
+    s_sim.pending_length = length;
+
+    if (is_in_interrupt())
+    {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(s_sim.handle, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+    else
+    {
+        xTaskNotifyGive(s_sim.handle);
+    }
+    return USBD_OK;
+}
+
+// 校验一帧
+static void usb_cdc_sim_check(protocol_frame_t *frame)
+{
+    if (frame->cmd != USB_CDC_CHANNEL_TELEMETRY || frame->data_length < USB_CDC_SIM_HEAD || frame->data[0] != USB_CDC_SIM_MAGIC)
+    {
+        return; // 日志等其它帧
+    }
+
+    uint8_t id = frame->data[1];
+    uint32_t seq = 0;
+    memcpy(&seq, &frame->data[2], sizeof(seq));
+    if (id >= USB_CDC_SIM_WRITERS || seq != s_sim.seq[id])
+    {
+        s_sim.fail++; // 丢帧或乱序
+    }
+    else
+    {
+        for (uint32_t i = USB_CDC_SIM_HEAD; i < frame->data_length; i++)
+        {
+            if (frame->data[i] != (uint8_t)(seq + i))
+            {
+                s_sim.fail++;
+                break;
+            }
+        }
+    }
+    if (id < USB_CDC_SIM_WRITERS)
+    {
+        s_sim.seq[id] = seq + 1;
+    }
+    s_sim.frames++;
+}
+
+// 回环：IN字节流按帧解包
+static void usb_cdc_sim_receive(const uint8_t *buff, uint32_t length)
+{
+    s_sim.bytes += length;
+    while (length > 0)
+    {
+        uint32_t n = CMP_MIN(length, sizeof(s_sim.rx) - s_sim.rx_length);
+        memcpy(&s_sim.rx[s_sim.rx_length], buff, n);
+        s_sim.rx_length += n;
+        buff += n;
+        length -= n;
+
+        while (s_sim.rx_length >= g_protocol_usb_cdc.cfg.frame_min)
+        {
+            uint32_t used = 1;
+            if (s_sim.rx[0] == g_protocol_usb_cdc.cfg.head_code)
+            {
+                protocol_frame_t frame = {.data = s_sim.data};
+                used = g_protocol_usb_cdc.ops.unpack(&frame, s_sim.rx, s_sim.rx_length);
+                if (used == 0)
+                {
+                    break; // 半帧，等下一包
+                }
+                if (used > 1)
+                {
+                    usb_cdc_sim_check(&frame);
+                }
+            }
+            if (used == 1)
+            {
+                s_sim.fail++; // 帧头错位或CRC错误：字节丢失或帧交错
+            }
+            s_sim.rx_length -= used;
+            memmove(s_sim.rx, &s_sim.rx[used], s_sim.rx_length);
+        }
+    }
+}
+
+// 仿真端点：完成传输并回调，优先级高于发送任务，相当于中断
+static void usb_cdc_sim_endpoint_entry(void *args)
+{
+    s_sim.handle = xTaskGetCurrentTaskHandle();
+    while (!s_sim.is_stop || s_sim.pending_length != 0)
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+        while (s_sim.pending_length != 0)
+        {
+            uint8_t *buff = s_sim.pending_buff;
+            uint16_t length = s_sim.pending_length;
+            usb_cdc_sim_receive(buff, length);
+
+            CRITICAL_ENTER();
+            s_sim.pending_length = 0;
+            CDC_TransmitCplt_Callback(buff, length);
+            CRITICAL_EXIT();
+        }
+    }
+    s_sim.handle = NULL;
+    os_return;
+}
+
+// 仿真写入：每帧带任务号和序号，长度随机
+static void usb_cdc_sim_writer_entry(void *args)
+{
+    uint8_t id = (uint8_t)(uintptr_t)args;
+    uint8_t data[USB_CDC_SIM_HEAD + USB_CDC_TEST_CHUNK];
+    uint32_t lcg = 12345u + id;
+    for (uint32_t seq = 0; seq < USB_CDC_SIM_FRAMES; seq++)
+    {
+        lcg = lcg * 1664525u + 1013904223u;
+        uint32_t length = USB_CDC_SIM_HEAD + (lcg >> 16) % USB_CDC_TEST_CHUNK;
+        data[0] = USB_CDC_SIM_MAGIC;
+        data[1] = id;
+        memcpy(&data[2], &seq, sizeof(seq));
+        for (uint32_t i = USB_CDC_SIM_HEAD; i < length; i++)
+        {
+            data[i] = (uint8_t)(seq + i);
+        }
+        usb_cdc_channel_send(USB_CDC_CHANNEL_TELEMETRY, data, length);
+    }
+    __atomic_fetch_add(&s_sim.done, 1u, __ATOMIC_RELAXED);
+    os_return;
+}
+
+// 回环仿真：并发写入 -> 双缓冲发送 -> 仿真完成中断 -> 解包校验
+static void usb_cdc_loopback_test(void)
+{
+    memset(&s_sim, 0, sizeof(s_sim));
+    os_task_create(usb_cdc_sim_endpoint_entry, "usb_cdc_sim", NULL, OS_PRIORITY_BSP + 2, OS_TASK_STACK_MIN);
+    os_sleep_until(s_sim.handle != NULL, 100);
+    usb_cdc_loopback_set(usb_cdc_sim_transmit);
+
+    uint32_t drop = usb_cdc_tx_drop_get();
+    uint64_t timestamp = TIMESTAMP_US;
+    for (uint32_t i = 0; i < USB_CDC_SIM_WRITERS; i++)
+    {
+        os_task_create(usb_cdc_sim_writer_entry, "usb_cdc_sim_writer", (void *)(uintptr_t)i, OS_PRIORITY_APP, OS_TASK_STACK_MIN + 512);
+    }
+
+    // 等所有仿真帧收齐
+    uint32_t expect = USB_CDC_SIM_WRITERS * USB_CDC_SIM_FRAMES;
+    os_sleep_until(s_sim.done == USB_CDC_SIM_WRITERS && s_sim.frames >= expect, 10000);
+    uint64_t time = TIMESTAMP_US - timestamp;
+    uint32_t received = s_sim.frames;
+    drop = usb_cdc_tx_drop_get() - drop;
+
+    usb_cdc_loopback_set(NULL);
+    s_sim.is_stop = true;
+    os_sleep_until(s_sim.handle == NULL, 100);
+
+    uint32_t fail = s_sim.fail + (received != expect) + (drop != 0);
+    print("[usb_cdc]loopback %s: %u/%u frames, %u bytes in %llu us, %llu KB/s, drop %u bytes, %u fail.\r\n",
+          fail == 0 ? "ok" : "FAIL", received, expect, s_sim.bytes, time,
+          (uint64_t)s_sim.bytes * 1000000ull / 1024ull / (time + 1), drop, fail);
+}
+
+static void usb_cdc_test_callback(void *device, dds_topic_t *topic, void *arg, void *userdata)
+{
+    protocol_frame_t *frame = (protocol_frame_t *)arg;
+    print("\r[usb_cdc]recv: channel[%u], data_length[%u]." ASCII_CLEAR_TAIL "\r\n", frame->cmd, frame->data_length);
+
+    // 遥测通道回环
+    if (frame->cmd == USB_CDC_CHANNEL_TELEMETRY)
+    {
+        usb_cdc_channel_send(USB_CDC_CHANNEL_TELEMETRY, frame->data, frame->data_length);
+    }
+}
+
+static void usb_cdc_test_entry(void *args)
+{
+    static uint8_t buff[USB_CDC_TEST_CHUNK];
+    for (uint32_t i = 0; i < sizeof(buff); i++)
+    {
+        buff[i] = '0' + i % 64;
+    }
+
+    usb_cdc_loopback_test();
+
+    for (;;)
+    {
+        os_sleep(5000);
+
+        uint32_t drop = usb_cdc_tx_drop_get();
+        uint32_t bytes = usb_cdc_tx_bytes_get();
+        uint64_t time = time_spent({
+            for (uint32_t sent = 0; sent < USB_CDC_TEST_TOTAL; sent += sizeof(buff))
+            {
+                usb_cdc_write(buff, sizeof(buff));
+            }
+        });
+        bytes = usb_cdc_tx_bytes_get() - bytes;
+        drop = usb_cdc_tx_drop_get() - drop;
+
+        print("[usb_cdc]throughput: %u bytes in %llu us, %llu KB/s, drop %u bytes.\r\n",
+              bytes, time, (uint64_t)bytes * 1000000ull / 1024ull / (time + 1), drop);
+    }
+}
+
+static void usb_cdc_test(void)
+{
+    dds_subcribe(&g_protocol_usb_cdc.RECEIVE, DDS_PRIORITY_NORMAL, &usb_cdc_test_callback, NULL);
+    os_task_create(usb_cdc_test_entry, "usb_cdc_test", NULL, OS_PRIORITY_APP, OS_TASK_STACK_MIN + 1024);
+}
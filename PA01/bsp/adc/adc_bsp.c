@@ -1,51 +1,50 @@
 #include "./adc_bsp.h"
 
 float g_adc_usb = 0.0f;
-lp_filter_t g_filter_usb = {0};
 float g_adc_battery = 0.0f;
-lp_filter_t g_filter_battery = {0};
 float g_adc_pot_left = 0.0f;
-lp_filter_t g_filter_pot_left = {0};
 float g_adc_pot_right = 0.0f;
-lp_filter_t g_filter_pot_right = {0};
 float g_adc_sw_left = 0.0f;
-lp_filter_t g_filter_sw_left = {0};
 float g_adc_sw_right = 0.0f;
-lp_filter_t g_filter_sw_right = {0};
 float g_adc_hw_version = 0.0f;
-lp_filter_t g_filter_hw_version = {0};
 
 static bool s_adc_is_inited = false;
 static bool s_adc_is_running = false;
 static const uint16_t ADC_PERIOD_MS = 20; // 周期20ms
 
-static float *adc1_ptr[] = {
-    &g_adc_usb,
-    &g_adc_battery,
-    &g_adc_pot_left,
-    &g_adc_pot_right,
-    &g_adc_sw_left,
-    &g_adc_hw_version,
-};
-static const uint16_t ADC1_NUM = countof(adc1_ptr);
-static uint16_t adc1_buff[countof(adc1_ptr)] __section_sdram;
-static lp_filter_t *g_filter1_group[countof(adc1_ptr)] = {
-    &g_filter_usb,
-    &g_filter_battery,
-    &g_filter_pot_left,
-    &g_filter_pot_right,
-    &g_filter_sw_left,
-    &g_filter_hw_version,
-};
-
-static float *adc3_ptr[] = {
-    &g_adc_sw_right,
-};
-static const uint16_t ADC3_NUM = countof(adc3_ptr);
-static uint16_t adc3_buff[countof(adc3_ptr)] __section_sdram;
-static lp_filter_t *g_filter3_group[countof(adc3_ptr)] = {
-    &g_filter_sw_right,
-};
+// ADC1 扫描顺序: usb, battery, pot_left, pot_right, sw_left, hw_version
+#define ADC1_NUM 6
+static uint16_t adc1_buff[ADC1_NUM] __section_sdram;
+
+// ADC3 扫描顺序: sw_right
+#define ADC3_NUM 1
+static uint16_t adc3_buff[ADC3_NUM] __section_sdram;
+
+// 中值预滤波：先去掉开关噪声的单点尖峰，再做低通
+#define ADC_MEDIAN_WINDOW 5
+static median_sorted_u16_t adc1_median[ADC1_NUM], adc3_median[ADC3_NUM];
+static uint16_t adc1_median_buff[ADC1_NUM][2 * ADC_MEDIAN_WINDOW], adc3_median_buff[ADC3_NUM][2 * ADC_MEDIAN_WINDOW];
+static uint16_t adc1_frame[ADC1_NUM], adc3_frame[ADC3_NUM]; // 中值输出帧
+
+// 电压类：0.5Hz 3阶
+static float *const adc_slow_ptr[] = {&g_adc_usb, &g_adc_battery, &g_adc_hw_version};
+static const uint8_t adc_slow_index[] = {0, 1, 5}; // 在ADC1帧内的位置
+static float adc_slow_state[2 * countof(adc_slow_ptr)];
+static float adc_slow_output[countof(adc_slow_ptr)];
+static filter_bank_t adc_slow_bank = {0};
+
+// 操作类：2Hz 1阶
+static float *const adc_fast1_ptr[] = {&g_adc_pot_left, &g_adc_pot_right, &g_adc_sw_left};
+static const uint8_t adc_fast1_index[] = {2, 3, 4}; // 在ADC1帧内的位置
+static float adc_fast1_state[2 * countof(adc_fast1_ptr)];
+static float adc_fast1_output[countof(adc_fast1_ptr)];
+static filter_bank_t adc_fast1_bank = {0};
+
+static float *const adc_fast3_ptr[] = {&g_adc_sw_right};
+static const uint8_t adc_fast3_index[] = {0}; // 在ADC3帧内的位置
+static float adc_fast3_state[2 * countof(adc_fast3_ptr)];
+static float adc_fast3_output[countof(adc_fast3_ptr)];
+static filter_bank_t adc_fast3_bank = {0};
 
 static void adc_init_entry(void *args)
 {
@@ -60,13 +59,17 @@ static void adc_init_entry(void *args)
     HAL_ADC_Start_DMA(&hadc3, (uint32_t *)adc3_buff, ADC3_NUM);
     os_sleep(ADC_PERIOD_MS);
 
-    lp_filter_init(&g_filter_usb, 0.5f, 1000.0f / ADC_PERIOD_MS, 3);
-    lp_filter_init(&g_filter_battery, 0.5f, 1000.0f / ADC_PERIOD_MS, 3);
-    lp_filter_init(&g_filter_hw_version, 0.5f, 1000.0f / ADC_PERIOD_MS, 3);
-    lp_filter_init(&g_filter_pot_left, 2.0f, 1000.0f / ADC_PERIOD_MS, 1);
-    lp_filter_init(&g_filter_pot_right, 2.0f, 1000.0f / ADC_PERIOD_MS, 1);
-    lp_filter_init(&g_filter_sw_left, 2.0f, 1000.0f / ADC_PERIOD_MS, 1);
-    lp_filter_init(&g_filter_sw_right, 2.0f, 1000.0f / ADC_PERIOD_MS, 1);
+    for (int i = 0; i < ADC1_NUM; i++)
+    {
+        median_sorted_u16_init(&adc1_median[i], ADC_MEDIAN_WINDOW, adc1_median_buff[i]);
+    }
+    for (int i = 0; i < ADC3_NUM; i++)
+    {
+        median_sorted_u16_init(&adc3_median[i], ADC_MEDIAN_WINDOW, adc3_median_buff[i]);
+    }
+    filter_bank_lp_init(&adc_slow_bank, countof(adc_slow_ptr), adc_slow_state, 0.5f, 1000.0f / ADC_PERIOD_MS, 3);
+    filter_bank_lp_init(&adc_fast1_bank, countof(adc_fast1_ptr), adc_fast1_state, 2.0f, 1000.0f / ADC_PERIOD_MS, 1);
+    filter_bank_lp_init(&adc_fast3_bank, countof(adc_fast3_ptr), adc_fast3_state, 2.0f, 1000.0f / ADC_PERIOD_MS, 1);
 
     s_adc_is_inited = true;
     log_info("adc init done.");
@@ -86,17 +89,39 @@ static void adc_entry(void *args)
     for (;;)
     {
         os_sleep(ADC_PERIOD_MS); // 20ms 50hz
-        // ADC1
+        PROFILE_BEGIN(adc_filter);
+
+        // 中值
         for (int i = 0; i < ADC1_NUM; i++)
         {
-            *(adc1_ptr[i]) = lp_filter(g_filter1_group[i], adc1_buff[i] / 65535.0f);
+            adc1_frame[i] = median_sorted_u16(&adc1_median[i], adc1_buff[i]);
+        }
+        for (int i = 0; i < ADC3_NUM; i++)
+        {
+            adc3_frame[i] = median_sorted_u16(&adc3_median[i], adc3_buff[i]);
         }
 
+        // ADC1
+        filter_bank_process(&adc_slow_bank, adc1_frame, 1, ADC1_NUM, adc_slow_index, 65535.0f, adc_slow_output);
+        filter_bank_process(&adc_fast1_bank, adc1_frame, 1, ADC1_NUM, adc_fast1_index, 65535.0f, adc_fast1_output);
+
         // ADC3
-        for (int i = 0; i < ADC3_NUM; i++)
+        filter_bank_process(&adc_fast3_bank, adc3_frame, 1, ADC3_NUM, adc_fast3_index, 65535.0f, adc_fast3_output);
+
+        // 输出
+        for (int i = 0; i < countof(adc_slow_ptr); i++)
+        {
+            *(adc_slow_ptr[i]) = adc_slow_output[i];
+        }
+        for (int i = 0; i < countof(adc_fast1_ptr); i++)
+        {
+            *(adc_fast1_ptr[i]) = adc_fast1_output[i];
+        }
+        for (int i = 0; i < countof(adc_fast3_ptr); i++)
         {
-            *(adc3_ptr[i]) = lp_filter(g_filter3_group[i], adc3_buff[i] / 65535.0f);
+            *(adc_fast3_ptr[i]) = adc_fast3_output[i];
         }
+        PROFILE_END(adc_filter);
     }
 }
 void adc_bsp_init(void)
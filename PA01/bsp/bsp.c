@@ -13,6 +13,7 @@ static void init_entry(void *args)
 {
     // 注册模块
     dds_init_create((dds_task_fn_t)time_bsp_init, NULL, DDS_PRIORITY_SUPER);        // 初始化时间戳
+    dds_init_create((dds_task_fn_t)trace_bsp_init, NULL, DDS_PRIORITY_SUPER);       // 事件追踪
     dds_init_create((dds_task_fn_t)log_bsp_init, NULL, DDS_PRIORITY_SUPER);         // 日志
     dds_init_create((dds_task_fn_t)os_monitor_init, NULL, DDS_PRIORITY_SUPER);      // RTOS
     dds_init_create((dds_task_fn_t)reset_reason_check, NULL, DDS_PRIORITY_NORMAL);  // 检查复位原因
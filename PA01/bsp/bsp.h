@@ -30,4 +30,5 @@
 #include "./roller/roller_bsp.h"
 #include "./serial_led/serial_led_bsp.h"
 #include "./time/time_bsp.h"
+#include "./trace/trace_bsp.h"
 #include "./wdg/wdg_bsp.h"
\ No newline at end of file
@@ -1,15 +1,32 @@
 #include "./bsp_base.h"
 
 // 基础库
-#include "./../lib/algorithm/fit/fit.c"   // 拟合
-#include "./../lib/algorithm/sort/sort.c" // 排序
-#include "./../lib/dds/dds.c"             // 数据分发
-#include "./../lib/list/list.c"           // 链表
-#include "./../lib/ring/ring.c"           // 环形队列
-#include "./../lib/string/string.c"       // 字符串
+#include "./../lib/algorithm/fft/fft.c"           // 快速傅里叶变换
+#include "./../lib/algorithm/fit/fit.c"           // 拟合
+#include "./../lib/algorithm/goertzel/goertzel.c" // 单频点检测
+#include "./../lib/algorithm/sort/sort.c"         // 排序
+#include "./../lib/algorithm/spectrum/spectrum.c" // 频谱分析
+#include "./../lib/dds/dds.c"                     // 数据分发
+#include "./../lib/list/list.c"                   // 链表
+#include "./../lib/lut/lut_table.c"               // 常量查找表
+#include "./../lib/ring/ring.c"                   // 环形队列
+#include "./../lib/string/base64.c"               // Base64编解码
+#include "./../lib/string/fmt.c"                  // 快速格式化
+#include "./../lib/string/hex.c"                  // 十六进制编解码
+#include "./../lib/string/string.c"               // 字符串
 
 // 滤波器
-#include "./../lib/filter/lp_filter.c" // 低通滤波器
+#include "./../lib/filter/filter_bank.c"   // 多通道滤波器组
+#include "./../lib/filter/filter_design.c" // IIR滤波器设计
+#include "./../lib/filter/fir_filter.c"    // FIR滤波器
+#include "./../lib/filter/kalman_filter.c" // 卡尔曼滤波器
+#include "./../lib/filter/lp_filter.c"     // 低通滤波器
+#include "./../lib/filter/median_filter.c" // 中值/Hampel滤波器
+#include "./../lib/filter/q_filter.c"      // Q15/Q31定点滤波器
+#include "./../lib/filter/sos_filter.c"    // SOS二阶节级联
+
+// 控制器
+#include "./../lib/controller/foc/foc.c" // FOC电流环
 
 void bsp_reboot(void)
 {
@@ -21,15 +21,32 @@
 
 // 基础控件
 #include "./../lib/algorithm/compare/compare.h"
+#include "./../lib/algorithm/fft/fft.h"
 #include "./../lib/algorithm/fit/fit.h"
+#include "./../lib/algorithm/goertzel/goertzel.h"
 #include "./../lib/algorithm/sort/sort.h"
+#include "./../lib/algorithm/spectrum/spectrum.h"
 #include "./../lib/dds/dds.h"
 #include "./../lib/list/list.h"
+#include "./../lib/lut/lut.h"
+#include "./../lib/math/fast_math.h"
+#include "./../lib/math/matrix.h"
+#include "./../lib/math/trig_lut.h"
 #include "./../lib/ring/ring.h"
 #include "./../lib/string/string.h"
 
 // 滤波器
-#include "./../lib/filter/lp_filter.h" // 低通滤波器
+#include "./../lib/filter/filter_bank.h"   // 多通道滤波器组
+#include "./../lib/filter/filter_design.h" // IIR滤波器设计
+#include "./../lib/filter/fir_filter.h"    // FIR滤波器
+#include "./../lib/filter/kalman_filter.h" // 卡尔曼滤波器
+#include "./../lib/filter/lp_filter.h"     // 低通滤波器
+#include "./../lib/filter/median_filter.h" // 中值/Hampel滤波器
+#include "./../lib/filter/q_filter.h"      // Q15/Q31定点滤波器
+#include "./../lib/filter/sos_filter.h"    // SOS二阶节级联
+
+// 控制器
+#include "./../lib/controller/foc/foc.h" // FOC电流环
 
 // 圆周率
 #ifndef M_PI
@@ -28,6 +28,8 @@
 #define TIMESTAMP_US timestamp_us_get(&g_time_timer5)
 #define TIMESTAMP_US_GET() TIMESTAMP_US
 #define TIMESTAMP_US_STARTUP (g_time_timer5.timestamp_startup)
+#define TIMESTAMP_US_FAST timestamp_us_fast_get(&g_time_timer5)
+#define TIMESTAMP_CYCLES timestamp_cycles_get(&g_time_timer5)
 #define SLEEP_MS(_ms) os_sleep(_ms)
 
 // 堆：动态内存
@@ -45,6 +47,31 @@
 #define CRITICAL_ENTER() os_critical_enter()
 #define CRITICAL_EXIT() os_critical_exit()
 
+// 事件追踪：关闭后标记宏为空，钩子不再记录
+#define TRACE_ENABLE 1
+#if TRACE_ENABLE == 1
+#define TRACE_BEGIN(_name) trace_begin(&g_trace, _name)
+#define TRACE_END(_name) trace_end(&g_trace, _name)
+#define TRACE_COUNTER(_name, _value) trace_counter(&g_trace, _name, _value)
+#define TRACE_INSTANT(_name, _arg) trace_instant(&g_trace, _name, _arg)
+#define TRACE_ISR_ENTER(_irq) trace_record(&g_trace, TRACE_TYPE_ISR_ENTER, _irq, 0)
+#define TRACE_ISR_EXIT(_irq) trace_record(&g_trace, TRACE_TYPE_ISR_EXIT, _irq, 0)
+#define DDS_TRACE_PUBLISH_BEGIN(_topic) trace_record(&g_trace, TRACE_TYPE_DDS_BEGIN, 0, (uint32_t)(_topic))
+#define DDS_TRACE_PUBLISH_END(_topic) trace_record(&g_trace, TRACE_TYPE_DDS_END, 0, (uint32_t)(_topic))
+#else
+#define TRACE_BEGIN(_name) ((void)0)
+#define TRACE_END(_name) ((void)0)
+#define TRACE_COUNTER(_name, _value) ((void)0)
+#define TRACE_INSTANT(_name, _arg) ((void)0)
+#define TRACE_ISR_ENTER(_irq) ((void)0)
+#define TRACE_ISR_EXIT(_irq) ((void)0)
+#endif
+
+// 性能统计：关闭后 PROFILE_* 宏为空
+#define PROFILE_ENABLE DEBUG
+#define PROFILE_CYCLES() TIMESTAMP_CYCLES
+#define PROFILE_CYCLES_FREQ() (g_time_timer5.cfg.cycles_freq)
+
 // 配置log默认通道
 #define log_trace(_format, ...)                          \
     {                                                    \
@@ -20,7 +20,9 @@ void TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
     switch ((uint32_t)(htim->Instance))
     {
     case (uint32_t)TIM5:
+        TRACE_ISR_ENTER(TIM5_IRQn);
         time_hook(&g_time_timer5);
+        TRACE_ISR_EXIT(TIM5_IRQn);
         break;
     default:
         break;
@@ -32,6 +34,7 @@ extern int32_t step;
 void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 {
     // 处理外部中断
+    TRACE_ISR_ENTER(EXTI15_10_IRQn);
     switch (GPIO_Pin)
     {
     case GPIO_PIN_10: // PPM_INPUT
@@ -43,6 +46,7 @@ void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
     default:
         break;
     }
+    TRACE_ISR_EXIT(EXTI15_10_IRQn);
 }
 // 串口回调
 void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t size)
@@ -1,7 +1,13 @@
 #include "./crc_bsp.h"
 
 // 驱动加载
+#include "./../../lib/encryptor/bignum/bignum.c"
 #include "./../../lib/encryptor/crc/crc.c"
+#include "./../../lib/encryptor/hash/hash.c"
+#include "./../../lib/encryptor/md5/md5.c"
+#include "./../../lib/encryptor/rsa/rsa.c"
+#include "./../../lib/encryptor/sha1/sha1.c"
+#include "./../../lib/encryptor/sha256/sha256.c"
 
 // 校验表
 #include "./table/ccitt.cc" // CCITT校验表
@@ -20,6 +20,8 @@
 
 // 驱动
 #include "./../../lib/encryptor/crc/crc.h"
+#include "./../../lib/encryptor/hash/hash.h"
+#include "./../../lib/encryptor/rsa/rsa.h"
 
 /**
  * @brief BSP驱动初始化
@@ -10,41 +10,8 @@
  */
 #include "./../crc_bsp.h"
 
-static const uint32_t ccitt_table[256] = {
-    0x00000000, 0x00001021, 0x00002042, 0x00003063, 0x00004084, 0x000050A5, 0x000060C6, 0x000070E7,
-    0x00008108, 0x00009129, 0x0000A14A, 0x0000B16B, 0x0000C18C, 0x0000D1AD, 0x0000E1CE, 0x0000F1EF,
-    0x00001231, 0x00000210, 0x00003273, 0x00002252, 0x000052B5, 0x00004294, 0x000072F7, 0x000062D6,
-    0x00009339, 0x00008318, 0x0000B37B, 0x0000A35A, 0x0000D3BD, 0x0000C39C, 0x0000F3FF, 0x0000E3DE,
-    0x00002462, 0x00003443, 0x00000420, 0x00001401, 0x000064E6, 0x000074C7, 0x000044A4, 0x00005485,
-    0x0000A56A, 0x0000B54B, 0x00008528, 0x00009509, 0x0000E5EE, 0x0000F5CF, 0x0000C5AC, 0x0000D58D,
-    0x00003653, 0x00002672, 0x00001611, 0x00000630, 0x000076D7, 0x000066F6, 0x00005695, 0x000046B4,
-    0x0000B75B, 0x0000A77A, 0x00009719, 0x00008738, 0x0000F7DF, 0x0000E7FE, 0x0000D79D, 0x0000C7BC,
-    0x000048C4, 0x000058E5, 0x00006886, 0x000078A7, 0x00000840, 0x00001861, 0x00002802, 0x00003823,
-    0x0000C9CC, 0x0000D9ED, 0x0000E98E, 0x0000F9AF, 0x00008948, 0x00009969, 0x0000A90A, 0x0000B92B,
-    0x00005AF5, 0x00004AD4, 0x00007AB7, 0x00006A96, 0x00001A71, 0x00000A50, 0x00003A33, 0x00002A12,
-    0x0000DBFD, 0x0000CBDC, 0x0000FBBF, 0x0000EB9E, 0x00009B79, 0x00008B58, 0x0000BB3B, 0x0000AB1A,
-    0x00006CA6, 0x00007C87, 0x00004CE4, 0x00005CC5, 0x00002C22, 0x00003C03, 0x00000C60, 0x00001C41,
-    0x0000EDAE, 0x0000FD8F, 0x0000CDEC, 0x0000DDCD, 0x0000AD2A, 0x0000BD0B, 0x00008D68, 0x00009D49,
-    0x00007E97, 0x00006EB6, 0x00005ED5, 0x00004EF4, 0x00003E13, 0x00002E32, 0x00001E51, 0x00000E70,
-    0x0000FF9F, 0x0000EFBE, 0x0000DFDD, 0x0000CFFC, 0x0000BF1B, 0x0000AF3A, 0x00009F59, 0x00008F78,
-    0x00009188, 0x000081A9, 0x0000B1CA, 0x0000A1EB, 0x0000D10C, 0x0000C12D, 0x0000F14E, 0x0000E16F,
-    0x00001080, 0x000000A1, 0x000030C2, 0x000020E3, 0x00005004, 0x00004025, 0x00007046, 0x00006067,
-    0x000083B9, 0x00009398, 0x0000A3FB, 0x0000B3DA, 0x0000C33D, 0x0000D31C, 0x0000E37F, 0x0000F35E,
-    0x000002B1, 0x00001290, 0x000022F3, 0x000032D2, 0x00004235, 0x00005214, 0x00006277, 0x00007256,
-    0x0000B5EA, 0x0000A5CB, 0x000095A8, 0x00008589, 0x0000F56E, 0x0000E54F, 0x0000D52C, 0x0000C50D,
-    0x000034E2, 0x000024C3, 0x000014A0, 0x00000481, 0x00007466, 0x00006447, 0x00005424, 0x00004405,
-    0x0000A7DB, 0x0000B7FA, 0x00008799, 0x000097B8, 0x0000E75F, 0x0000F77E, 0x0000C71D, 0x0000D73C,
-    0x000026D3, 0x000036F2, 0x00000691, 0x000016B0, 0x00006657, 0x00007676, 0x00004615, 0x00005634,
-    0x0000D94C, 0x0000C96D, 0x0000F90E, 0x0000E92F, 0x000099C8, 0x000089E9, 0x0000B98A, 0x0000A9AB,
-    0x00005844, 0x00004865, 0x00007806, 0x00006827, 0x000018C0, 0x000008E1, 0x00003882, 0x000028A3,
-    0x0000CB7D, 0x0000DB5C, 0x0000EB3F, 0x0000FB1E, 0x00008BF9, 0x00009BD8, 0x0000ABBB, 0x0000BB9A,
-    0x00004A75, 0x00005A54, 0x00006A37, 0x00007A16, 0x00000AF1, 0x00001AD0, 0x00002AB3, 0x00003A92,
-    0x0000FD2E, 0x0000ED0F, 0x0000DD6C, 0x0000CD4D, 0x0000BDAA, 0x0000AD8B, 0x00009DE8, 0x00008DC9,
-    0x00007C26, 0x00006C07, 0x00005C64, 0x00004C45, 0x00003CA2, 0x00002C83, 0x00001CE0, 0x00000CC1,
-    0x0000EF1F, 0x0000FF3E, 0x0000CF5D, 0x0000DF7C, 0x0000AF9B, 0x0000BFBA, 0x00008FD9, 0x00009FF8,
-    0x00006E17, 0x00007E36, 0x00004E55, 0x00005E74, 0x00002E93, 0x00003EB2, 0x00000ED1, 0x00001EF0};
-
+// 校验表由 tools/lut 生成，见 lib/lut/lut_table.c
 crc_t g_crc_ccitt = {
     CRC_CFG_CCITT_FALSE,
-    .table = (uint32_t *)ccitt_table,
+    .table = (uint32_t *)g_lut_crc_ccitt,
 };
@@ -8,9 +8,11 @@
 
 // 端口加载
 #include "./port/uart.cc"
+#include "./port/usb.cc"
 
 log_t *const g_log_group[] = {
     &g_log_uart,
+    &g_log_usb,
 };
 const uint32_t LOG_GROUP_SIZE = countof(g_log_group);
 
@@ -73,6 +73,7 @@ void log_bsp_init(void);
 
 // 日志声明
 extern log_t g_log_uart;
+extern log_t g_log_usb;
 
 // 日志组声明
 extern log_t *const g_log_group[];
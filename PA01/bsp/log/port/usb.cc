@@ -0,0 +1,50 @@
+/**
+ * @file usb.cc
+ * @author WittXie
+ * @brief USB CDC 日志端口（复用 g_protocol_usb_cdc 的日志通道）
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../log_bsp.h"
+
+// 依赖
+#include "./../../protocol/protocol_bsp.h"
+
+static void g_log_usb_init()
+{
+}
+
+static void g_log_usb_write(uint8_t *buff, uint32_t length)
+{
+    // USB协议未运行时直接丢弃，避免协议层报错再次写日志
+    if (!protocol_is_running(&g_protocol_usb_cdc))
+    {
+        return;
+    }
+
+    // 按单帧最大负载分包，长行和 hexdump 不会被 usb_cdc_pack 拒收
+    uint32_t chunk = g_protocol_usb_cdc.cfg.frame_max - g_protocol_usb_cdc.cfg.frame_min;
+    while (length > 0)
+    {
+        uint32_t n = (length < chunk) ? length : chunk;
+        usb_cdc_channel_send(USB_CDC_CHANNEL_LOG, buff, n);
+        buff += n;
+        length -= n;
+    }
+}
+
+log_t g_log_usb = {
+    .cfg = {
+        .name = "g_log_usb",
+        .level = LOG_LEVEL,
+        .buff_size = LOG_BUFF_SIZE,
+        .filter = NULL,
+    },
+    .ops = {
+        .init = g_log_usb_init,
+        .write = g_log_usb_write,
+    },
+};
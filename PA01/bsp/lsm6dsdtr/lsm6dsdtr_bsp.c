@@ -1,6 +1,7 @@
 #include "./lsm6dsdtr_bsp.h"
 
 // 驱动加载
+#include "./../../lib/imu/ahrs/ahrs.c"
 #include "./../../lib/imu/lsm6dsdtr/lsm6dsdtr.c"
 
 // 端口加载
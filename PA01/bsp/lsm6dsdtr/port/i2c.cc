@@ -30,8 +30,9 @@ static void lsm6dsdtr_i2c_write(uint8_t addr, uint8_t *buff, uint32_t length)
 lsm6dsdtr_t g_lsm6dsdtr_imu = {
     .cfg = {
         .name = "g_lsm6dsdtr_imu",
-        .filter_alpha = 0.65, // 滤波系数
-        .bias = 9,            // 零漂，可通过静置校准获得
+        .ahrs_mode = AHRS_MODE_MAHONY, // 姿态算法
+        .ahrs_gain = 2.0f,             // Mahony kp
+        .bias = 9,                     // 零漂初值，静置时自动估计
         .config = LSM6DSDTR_DEFAULT_CONFIG,
         .try_cnt = 20,
     },
@@ -1,8 +1,19 @@
 #include "./lvgl_bsp.h"
 
 static bool lvgl_running_flag = false;
+static volatile bool lvgl_reg_refresh_flag = false; // lcd寄存器重刷请求
 void *lvgl_mutex = NULL;
 
+// 每2秒给lcd重新刷一次寄存器，防止静电导致的屏幕异常；定时器只置标志，在 lvgl 任务中持锁重刷
+static void lvgl_reg_refresh_callback(soft_timer_t *timer, void *userdata)
+{
+    lvgl_reg_refresh_flag = true;
+}
+static soft_timer_t lvgl_reg_refresh_timer = {
+    .name = "lvgl_reg_refresh",
+    .callback = lvgl_reg_refresh_callback,
+};
+
 // 屏幕刷新
 void lvgl_bsp_flush(void)
 {
@@ -63,6 +74,7 @@ static void lvgl_entry(void *args)
     lvgl_running_flag = true;
 
     os_sleep(200);
+    soft_timer_start(&g_soft_timer, &lvgl_reg_refresh_timer, 2000000, 2000000);
 
     for (;;)
     {
@@ -71,13 +83,15 @@ static void lvgl_entry(void *args)
 
         // 刷新屏幕
         lvgl_lock();
-        time_invoke(2000000, { // 每2秒给lcd重新刷一次寄存器，防止静电导致的屏幕异常
+        if (lvgl_reg_refresh_flag)
+        {
+            lvgl_reg_refresh_flag = false;
             // HAL_GPIO_WritePin(GPIOD, GPIO_PIN_7, GPIO_PIN_RESET); // 拉低复位引脚
             // os_sleep(5);
             // HAL_GPIO_WritePin(GPIOD, GPIO_PIN_7, GPIO_PIN_SET); // 拉高复位引脚
             // os_sleep(5);
             gc9307c_reg_init(&g_gc9307c_lcd);
-        });
+        }
         lvgl_bsp_flush();
         lvgl_unlock();
     }
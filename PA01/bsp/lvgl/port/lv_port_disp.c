@@ -113,6 +113,8 @@ void disp_disable_update(void)
  *'lv_disp_flush_ready()' has to be called when finished.*/
 static void disp_flush(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p)
 {
+    PROFILE_SCOPE("disp_flush");
+
     // if (HAL_GPIO_ReadPin(GPIOB, GPIO_PIN_7) == GPIO_PIN_RESET)
     // {
     /*The most simple case (but also the slowest) to put all pixels to the screen one-by-one*/
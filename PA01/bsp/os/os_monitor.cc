@@ -44,27 +44,12 @@ static struct __s_monitor
     .is_error = false,
 };
 
-static void task_bubble_sort(TaskStatus_t *tasks, uint32_t num_tasks)
-{
-    for (uint32_t i = 0; i < num_tasks - 1; ++i)
-    {
-        for (uint32_t j = 0; j < num_tasks - i - 1; ++j)
-        {
-            if (tasks[j].xTaskNumber > tasks[j + 1].xTaskNumber)
-            {
-                TaskStatus_t temp = tasks[j];
-                tasks[j] = tasks[j + 1];
-                tasks[j + 1] = temp;
-            }
-        }
-    }
-}
-
 static void os_monitor_entry(void *args)
 {
     TaskStatus_t *task_status_buff = NULL; // 任务状态
     uint32_t *last_timespent_buff = NULL;  // 任务耗时
     uint64_t *time_alltotal_buff = NULL;   // 任务耗时
+    void *sort_buff = NULL;                // 排序工作区
     bool is_first = false;
     uint32_t task_size = 0;
     uint32_t idle_task_num = 3;
@@ -98,6 +83,11 @@ static void os_monitor_entry(void *args)
                 os_free(time_alltotal_buff);
                 time_alltotal_buff = NULL;
             }
+            if (sort_buff != NULL)
+            {
+                os_free(sort_buff);
+                sort_buff = NULL;
+            }
 
             // 分配新的内存
             task_status_buff = (TaskStatus_t *)os_malloc(task_size * sizeof(TaskStatus_t));
@@ -109,6 +99,10 @@ static void os_monitor_entry(void *args)
             time_alltotal_buff = (uint64_t *)os_malloc(task_size * sizeof(uint64_t));
             ASSERT(time_alltotal_buff != NULL);
 
+            // 排序工作区随任务数一起分配，刷新时不再申请
+            sort_buff = os_malloc(SORT_BY_KEY_BUFF_SIZE(task_size, sizeof(TaskStatus_t)));
+            ASSERT(sort_buff != NULL);
+
             memset(task_status_buff, 0, task_size * sizeof(TaskStatus_t));
             memset(last_timespent_buff, 0, task_size * sizeof(uint32_t));
             memset(time_alltotal_buff, 0, task_size * sizeof(uint64_t));
@@ -147,8 +141,13 @@ static void os_monitor_entry(void *args)
         // 获取系统状态
         uxTaskGetSystemState(task_status_buff, task_size, &total_time);
 
-        // 排序任务
-        task_bubble_sort(task_status_buff, task_size);
+        // 按任务号排序：耗时按下标与上一次对应，排序失败时本次不统计，下次重新取基准
+        if (!sort_by_key_buff(SORT_UINT32, task_status_buff, task_size, sizeof(TaskStatus_t), offsetof(TaskStatus_t, xTaskNumber), sort_buff))
+        {
+            is_first = false;
+            os_sleep(s_monitor.fresh_timegap);
+            continue;
+        }
         if (end_index > task_size)
         {
             end_index = task_size;
@@ -21,31 +21,22 @@ player_t *g_player_group[] = {
 };
 const uint32_t PLAYER_GROUP_SIZE = countof(g_player_group);
 
-// 生成按键音效的函数
+// 生成按键音效的函数，打印成数组供 res/ 使用
 static void generate_voice(float freq, uint32_t sample_rate, size_t buffer_length)
 {
-    uint16_t *buffer = (uint16_t *)os_malloc(buffer_length * sizeof(uint16_t));
-    // 计算每个样本的时间间隔
-    float time_per_sample = 1.0 / sample_rate;
+    // 16位整周角相位累加，查 1/4 周 Q15 正弦表，不需要缓存也不做浮点三角运算
+    uint32_t step = (uint32_t)(freq * 65536.0f * 65536.0f / sample_rate); // Q32 相位步进
+    uint32_t phase = 0;
 
-    // 12位数据宽度，最大值为4095
-    uint16_t max_value = 4095;
-    for (size_t i = 0; i < buffer_length; i++)
-    {
-        float t = i * time_per_sample;
-        float sample = (max_value / 2.0) * (1.0 + sin(2.0 * M_PI * freq * t));
-        buffer[i] = (uint16_t)sample;
-    }
-
-    // 打印成数组
+    // 12位数据宽度，中值2048，幅值2047
     print("{\r\n");
-    for (int i = 0; i < buffer_length; i++)
+    for (size_t i = 0; i < buffer_length; i++)
     {
-        print("%d, ", buffer[i]);
+        int32_t sample = 2048 + ((lut_sin_q15((uint16_t)(phase >> 16)) * 2047) >> 15);
+        print("%d, ", sample);
+        phase += step;
     }
     print("};\r\n");
-
-    os_free(buffer);
 }
 
 // player轮询任务
@@ -176,6 +176,7 @@ fs_stick_t g_fs_stick = {
         .name = "g_fs_stick",
         .threshold = 0.1,
         .try_cnt = 100,
+        .median_window = 3,
     },
     .ops = {
         .init = stick_init,
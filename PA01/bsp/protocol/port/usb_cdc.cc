@@ -0,0 +1,386 @@
+/**
+ * @file usb_cdc.cc
+ * @author WittXie
+ * @brief USB CDC 虚拟串口传输层（双缓冲IN传输、环形缓存合包、通道复用）
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ *  发送: usb_cdc_write 只入队到发送FIFO，IN端点使用两块包缓存轮流发送；
+ *        一块在USB上传输时，另一块由发送任务预先填满，传输完成中断里直接切换，不在中断里拷贝。
+ *        FIFO为单生产者单消费者无锁队列：写入方持 mutex 串行（整帧一次入队，多任务写入不会交错），
+ *        只有发送任务出队；中断只切换包缓存并通知发送任务，不碰FIFO。中断里的写入直接丢弃。
+ *        每次IN传输尽量装满 USB_CDC_TX_PACKET_SIZE（64字节整数倍），小包被合并；
+ *        长度恰为64整数倍时，由CDC类在 USBD_CDC_DataIn 中补发ZLP。
+ *  接收: CDC_Receive_FS -> protocol_read_hook，由 protocol_poll 解包，按通道号(cmd)分发。
+ *
+ *  帧格式:
+ *  HEAD CHANNEL LENGTH(L) LENGTH(H) DATA...  CRC(L) CRC(H)
+ *  A5   00      05        00        ...      xx     xx
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#include "./../../bsp.h"
+#include "./../protocol_bsp.h"
+
+#define USB_CDC_PACKET_SIZE CDC_DATA_FS_MAX_PACKET_SIZE   // FS 端点包长
+#define USB_CDC_TX_PACKET_SIZE (USB_CDC_PACKET_SIZE * 16) // 单次IN传输长度
+#define USB_CDC_TX_FIFO_SIZE (USB_CDC_TX_PACKET_SIZE * 8) // 发送FIFO，须为2的幂
+#define USB_CDC_RX_BUFF_SIZE 4096                         // 接收环形缓存
+#define USB_CDC_WRITE_TIMEOUT_MS 100                      // 发送FIFO满时最长等待
+#define USB_CDC_TX_POLL_MS 10                             // 发送任务兜底轮询周期
+
+// 包缓存状态
+enum usb_cdc_tx_state
+{
+    USB_CDC_TX_EMPTY = 0, // 空闲
+    USB_CDC_TX_FILLING,   // 任务正在填充
+    USB_CDC_TX_READY,     // 已填充，等待发送
+    USB_CDC_TX_BUSY,      // 正在USB上传输
+};
+
+static uint8_t usb_cdc_tx_buff[2][USB_CDC_TX_PACKET_SIZE] __ALIGNED(4) = {0};
+static uint8_t usb_cdc_tx_fifo[USB_CDC_TX_FIFO_SIZE] __ALIGNED(4) = {0};
+static TaskHandle_t usb_cdc_tx_task_handle = NULL;
+static struct
+{
+    volatile uint32_t head;                              // FIFO读下标，自由增长，只由发送任务修改
+    volatile uint32_t tail;                              // FIFO写下标，自由增长，只由持锁的写入方修改
+    void *mutex;                                         // 写入锁
+    uint8_t (*transmit)(uint8_t *buff, uint16_t length); // 回环仿真的IN传输，NULL 时走 CDC_Transmit_FS
+    volatile uint16_t length[2];                         // 包缓存有效长度
+    volatile enum usb_cdc_tx_state state[2];             // 包缓存状态
+    volatile uint8_t active;                             // 当前传输（或下一次传输）的包缓存
+    volatile uint32_t tx_bytes;                          // 累计发送字节
+    volatile uint32_t tx_drop;                           // 累计丢弃字节
+} s_usb_cdc = {0};
+
+extern USBD_HandleTypeDef hUsbDeviceFS;
+
+// USB是否已枚举（回环仿真时视为已枚举）
+#define usb_cdc_is_configured() (s_usb_cdc.transmit != NULL || (hUsbDeviceFS.dev_state == USBD_STATE_CONFIGURED && hUsbDeviceFS.pClassData != NULL))
+
+// FIFO已用字节
+#define usb_cdc_fifo_used() (s_usb_cdc.tail - s_usb_cdc.head)
+
+// 写入方入队，调用前确认空间足够
+static void usb_cdc_fifo_put(const uint8_t *buff, uint32_t length)
+{
+    uint32_t offset = s_usb_cdc.tail & (USB_CDC_TX_FIFO_SIZE - 1);
+    uint32_t first = CMP_MIN(length, USB_CDC_TX_FIFO_SIZE - offset);
+    memcpy(&usb_cdc_tx_fifo[offset], buff, first);
+    memcpy(usb_cdc_tx_fifo, buff + first, length - first);
+    __DMB(); // 数据先于写下标可见
+    s_usb_cdc.tail += length;
+}
+
+// 发送任务出队
+static uint32_t usb_cdc_fifo_get(uint8_t *buff, uint32_t length)
+{
+    uint32_t used = usb_cdc_fifo_used();
+    __DMB(); // 先读写下标，再读数据
+    length = CMP_MIN(length, used);
+    uint32_t offset = s_usb_cdc.head & (USB_CDC_TX_FIFO_SIZE - 1);
+    uint32_t first = CMP_MIN(length, USB_CDC_TX_FIFO_SIZE - offset);
+    memcpy(buff, &usb_cdc_tx_fifo[offset], first);
+    memcpy(buff + first, usb_cdc_tx_fifo, length - first);
+    __DMB(); // 数据读完再释放空间
+    s_usb_cdc.head += length;
+    return length;
+}
+
+// 唤醒发送任务
+static void usb_cdc_tx_notify(void)
+{
+    if (usb_cdc_tx_task_handle == NULL)
+    {
+        return;
+    }
+
+    if (is_in_interrupt())
+    {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(usb_cdc_tx_task_handle, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+    else
+    {
+        xTaskNotifyGive(usb_cdc_tx_task_handle);
+    }
+}
+
+// 启动一次IN传输（中断或临界区内调用）
+static bool usb_cdc_tx_start(uint8_t index)
+{
+    uint8_t ret = (s_usb_cdc.transmit != NULL) ? s_usb_cdc.transmit(usb_cdc_tx_buff[index], s_usb_cdc.length[index])
+                                               : CDC_Transmit_FS(usb_cdc_tx_buff[index], s_usb_cdc.length[index]);
+    if (ret != USBD_OK)
+    {
+        return false;
+    }
+    s_usb_cdc.state[index] = USB_CDC_TX_BUSY;
+    s_usb_cdc.active = index;
+    s_usb_cdc.tx_bytes += s_usb_cdc.length[index];
+    return true;
+}
+
+// 没有传输进行时，启动已填充的包缓存（中断或临界区内调用）
+static void usb_cdc_tx_resume(void)
+{
+    uint8_t active = s_usb_cdc.active;
+    if (s_usb_cdc.state[active] == USB_CDC_TX_BUSY || s_usb_cdc.state[active ^ 1] == USB_CDC_TX_BUSY)
+    {
+        return;
+    }
+    if (s_usb_cdc.state[active] == USB_CDC_TX_READY)
+    {
+        usb_cdc_tx_start(active);
+    }
+    else if (s_usb_cdc.state[active ^ 1] == USB_CDC_TX_READY)
+    {
+        usb_cdc_tx_start(active ^ 1);
+    }
+}
+
+// 发送任务：启动空闲的发送，并预填下一块包缓存
+static void usb_cdc_tx_kick(void)
+{
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        uint8_t index = 0xFF;
+
+        // 认领一块空闲的包缓存
+        CRITICAL_ENTER();
+        if (s_usb_cdc.state[s_usb_cdc.active] == USB_CDC_TX_EMPTY)
+        {
+            index = s_usb_cdc.active;
+        }
+        else if (s_usb_cdc.state[s_usb_cdc.active ^ 1] == USB_CDC_TX_EMPTY)
+        {
+            index = s_usb_cdc.active ^ 1;
+        }
+        if (index != 0xFF)
+        {
+            s_usb_cdc.state[index] = USB_CDC_TX_FILLING;
+        }
+        CRITICAL_EXIT();
+
+        if (index == 0xFF)
+        {
+            return; // 两块都在用
+        }
+
+        // 临界区外拷贝
+        uint16_t length = usb_cdc_fifo_get(usb_cdc_tx_buff[index], USB_CDC_TX_PACKET_SIZE);
+
+        CRITICAL_ENTER();
+        s_usb_cdc.length[index] = length;
+        s_usb_cdc.state[index] = (length != 0) ? USB_CDC_TX_READY : USB_CDC_TX_EMPTY;
+        usb_cdc_tx_resume();
+        CRITICAL_EXIT();
+
+        if (length == 0)
+        {
+            return;
+        }
+    }
+}
+
+// 发送任务：FIFO唯一的消费者，由写入方和传输完成中断通知
+static void usb_cdc_tx_entry(void *args)
+{
+    usb_cdc_tx_task_handle = xTaskGetCurrentTaskHandle();
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(USB_CDC_TX_POLL_MS));
+        usb_cdc_tx_kick();
+    }
+}
+
+// 中断侧：IN传输完成回调，由 CDC_TransmitCplt_FS 调用
+void CDC_TransmitCplt_Callback(uint8_t *buff, uint32_t length)
+{
+    uint8_t done = s_usb_cdc.active;
+    uint8_t next = done ^ 1;
+
+    s_usb_cdc.state[done] = USB_CDC_TX_EMPTY;
+    s_usb_cdc.length[done] = 0;
+
+    // 已预填的包缓存直接切换发送；任务正在填充的，由任务在填充结束后启动
+    if (s_usb_cdc.state[next] == USB_CDC_TX_READY)
+    {
+        usb_cdc_tx_start(next);
+    }
+    else
+    {
+        s_usb_cdc.active = next;
+    }
+
+    // 空出的包缓存交给发送任务续填
+    usb_cdc_tx_notify();
+}
+
+// 中断侧：OUT数据回调，由 CDC_Receive_FS 调用
+void CDC_Receive_Callback(uint8_t *buff, uint32_t length)
+{
+    protocol_read_hook(&g_protocol_usb_cdc, buff, length);
+}
+
+// 原始数据写入，不打包
+uint32_t usb_cdc_write(const uint8_t *buff, uint32_t length)
+{
+    // 中断里不能持锁，丢弃以保证FIFO只有一个生产者
+    if (!usb_cdc_is_configured() || is_in_interrupt())
+    {
+        s_usb_cdc.tx_drop += length;
+        return 0;
+    }
+    if (!MUTEX_LOCK(&s_usb_cdc.mutex))
+    {
+        s_usb_cdc.tx_drop += length;
+        return 0;
+    }
+
+    uint32_t written = 0;
+    uint64_t timestamp = TIMESTAMP_US;
+    while (written < length)
+    {
+        // 不超过FIFO的数据整块入队，超时也整块丢弃，接收端不会收到半帧
+        uint32_t chunk = CMP_MIN(length - written, USB_CDC_TX_FIFO_SIZE);
+        if (USB_CDC_TX_FIFO_SIZE - usb_cdc_fifo_used() >= chunk)
+        {
+            usb_cdc_fifo_put(buff + written, chunk);
+            written += chunk;
+            usb_cdc_tx_notify();
+            continue;
+        }
+
+        usb_cdc_tx_notify();
+        if (is_timeout(timestamp, USB_CDC_WRITE_TIMEOUT_MS * 1000u))
+        {
+            s_usb_cdc.tx_drop += length - written;
+            break;
+        }
+        os_sleep(1);
+    }
+
+    MUTEX_UNLOCK(&s_usb_cdc.mutex);
+    return written;
+}
+
+// 通道发送
+void usb_cdc_channel_send(enum usb_cdc_channel channel, const uint8_t *buff, uint32_t length)
+{
+    protocol_frame_t frame = {
+        .cmd = channel,
+        .data = (uint8_t *)buff,
+        .data_length = length,
+    };
+    protocol_send(&g_protocol_usb_cdc, &frame);
+}
+
+// 统计
+uint32_t usb_cdc_tx_bytes_get(void)
+{
+    return s_usb_cdc.tx_bytes;
+}
+uint32_t usb_cdc_tx_drop_get(void)
+{
+    return s_usb_cdc.tx_drop;
+}
+
+// 回环仿真
+void usb_cdc_loopback_set(uint8_t (*transmit)(uint8_t *buff, uint16_t length))
+{
+    CRITICAL_ENTER();
+    s_usb_cdc.transmit = transmit;
+    CRITICAL_EXIT();
+}
+
+static uint32_t usb_cdc_pack(protocol_frame_t *frame, uint8_t *send_buff)
+{
+    if (frame->data_length + g_protocol_usb_cdc.cfg.frame_min > g_protocol_usb_cdc.cfg.frame_max)
+    {
+        ERROR("[%s] frame too long: %u.", g_protocol_usb_cdc.cfg.name, frame->data_length);
+        return 0;
+    }
+    uint32_t send_length = frame->data_length + g_protocol_usb_cdc.cfg.frame_min;
+
+    // 填装数据
+    send_buff[0] = g_protocol_usb_cdc.cfg.head_code;
+    send_buff[1] = frame->cmd;
+    send_buff[2] = frame->data_length & 0xFF;
+    send_buff[3] = (frame->data_length >> 8) & 0xFF;
+    memcpy(&send_buff[4], frame->data, frame->data_length);
+
+    // CRC 校验
+    uint32_t ret_crc = crc_calculate(&g_crc_ccitt, send_buff, send_length - 2);
+    send_buff[send_length - 2] = ret_crc & 0xFF;
+    send_buff[send_length - 1] = (ret_crc >> 8) & 0xFF;
+    return send_length;
+}
+
+static uint32_t usb_cdc_unpack(protocol_frame_t *frame, uint8_t *recv_buff, uint32_t recv_length)
+{
+    uint32_t data_length = recv_buff[2] | (recv_buff[3] << 8);
+    if (data_length + g_protocol_usb_cdc.cfg.frame_min > g_protocol_usb_cdc.cfg.frame_max)
+    {
+        return 1; // 长度非法，跳过帧头
+    }
+    if (recv_length < data_length + g_protocol_usb_cdc.cfg.frame_min)
+    {
+        return 0; // 等待更多数据
+    }
+    recv_length = data_length + g_protocol_usb_cdc.cfg.frame_min;
+
+    // CRC 校验
+    uint32_t ret_crc = crc_calculate(&g_crc_ccitt, recv_buff, recv_length - 2);
+    if (ret_crc != (recv_buff[recv_length - 1] << 8 | recv_buff[recv_length - 2]))
+    {
+        return 1;
+    }
+
+    // 解包
+    frame->cmd = recv_buff[1];
+    frame->data_length = data_length;
+    memcpy(frame->data, &recv_buff[4], data_length);
+    return recv_length;
+}
+
+// 命令行通道转交日志的shell输入
+static void usb_cdc_receive_callback(void *device, dds_topic_t *topic, void *arg, void *userdata)
+{
+    protocol_frame_t *frame = (protocol_frame_t *)arg;
+    if (frame->cmd == USB_CDC_CHANNEL_SHELL)
+    {
+        void log_read_hook(log_t * log, uint8_t * buff, uint32_t length);
+        log_read_hook(&g_log_usb, frame->data, frame->data_length);
+    }
+}
+
+static void usb_cdc_init(void)
+{
+    dds_subcribe(&g_protocol_usb_cdc.RECEIVE, DDS_PRIORITY_NORMAL, usb_cdc_receive_callback, NULL);
+    os_task_create(usb_cdc_tx_entry, "usb_cdc_tx", NULL, OS_PRIORITY_BSP + 1, OS_TASK_STACK_MIN);
+}
+
+static void usb_cdc_protocol_write(uint8_t *buff, uint32_t length)
+{
+    usb_cdc_write(buff, length);
+}
+
+protocol_t g_protocol_usb_cdc = {
+    .cfg = {
+        .name = "g_protocol_usb_cdc",
+        .buff_size = USB_CDC_RX_BUFF_SIZE,
+        .frame_min = 6,
+        .frame_max = 1024,
+        .head_code = 0xA5,
+    },
+    .ops = {
+        .init = usb_cdc_init,
+        .write = usb_cdc_protocol_write,
+        .pack = usb_cdc_pack,
+        .unpack = usb_cdc_unpack,
+    },
+};
@@ -17,6 +17,7 @@
 #include "./port/uart_sport.cc"
 #include "./port/uart_stick.cc"
 #include "./port/uart_transparent.cc"
+#include "./port/usb_cdc.cc"
 
 #undef LOG_LEVEL
 #define LOG_LEVEL LOG_LEVEL_TRACE
@@ -27,6 +28,7 @@ protocol_t *const g_protocol_group[] = {
     &g_protocol_uart_rf,
     &g_protocol_uart_head,
     &g_protocol_uart_sport,
+    &g_protocol_usb_cdc,
 };
 const uint32_t PROTOCOL_GROUP_SIZE = countof(g_protocol_group);
 
@@ -45,10 +47,12 @@ static void protocol_entry(void *args)
     // 监听
     for (;;)
     {
+        PROFILE_BEGIN(protocol_poll);
         for (int i = 0; i < PROTOCOL_GROUP_SIZE; i++)
         {
             protocol_poll(g_protocol_group[i]);
         }
+        PROFILE_END(protocol_poll);
         os_sleep(10);
     }
 }
@@ -36,6 +36,50 @@ extern protocol_t g_protocol_uart_stick;
 extern protocol_t g_protocol_uart_rf;
 extern protocol_t g_protocol_uart_head;
 extern protocol_t g_protocol_uart_sport;
+extern protocol_t g_protocol_usb_cdc;
+
+// USB CDC 复用通道
+enum usb_cdc_channel
+{
+    USB_CDC_CHANNEL_LOG = 0,   // 日志
+    USB_CDC_CHANNEL_SHELL,     // 命令行
+    USB_CDC_CHANNEL_TELEMETRY, // 二进制遥测
+};
+
+/**
+ * @brief USB CDC 原始数据写入（不打包），数据先进入发送FIFO，由双缓冲IN传输发出
+ * @note 多任务写入串行，单次写入不会与其它写入交错；中断内调用直接丢弃
+ *
+ * @param buff 数据
+ * @param length 长度
+ * @return uint32_t 实际写入长度；USB未枚举或FIFO满超时的部分被丢弃
+ */
+uint32_t usb_cdc_write(const uint8_t *buff, uint32_t length);
+
+/**
+ * @brief USB CDC 按通道打包发送
+ *
+ * @param channel 通道
+ * @param buff 数据
+ * @param length 长度
+ */
+void usb_cdc_channel_send(enum usb_cdc_channel channel, const uint8_t *buff, uint32_t length);
+
+/**
+ * @brief USB CDC 发送统计
+ *
+ * @return uint32_t 累计发送/丢弃字节数
+ */
+uint32_t usb_cdc_tx_bytes_get(void);
+uint32_t usb_cdc_tx_drop_get(void);
+
+/**
+ * @brief USB CDC 回环仿真：IN传输改由 transmit 接管，不经USB
+ * @note 仅测试用，在发送空闲时切换；transmit 返回 USBD_OK 后，须在中断或临界区内调用 CDC_TransmitCplt_Callback 表示传输完成
+ *
+ * @param transmit 仿真的IN传输，NULL 恢复 CDC_Transmit_FS
+ */
+void usb_cdc_loopback_set(uint8_t (*transmit)(uint8_t *buff, uint16_t length));
 
 /**
  * @brief 设置RF模式
@@ -0,0 +1,73 @@
+/**
+ * @file soft_timer.cc
+ * @author WittXie
+ * @brief 软件定时器服务：FreeRTOS任务通知阻塞等待
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "./../time_bsp.h"
+
+#define SOFT_TIMER_SIZE 64 // 最多同时运行的定时器个数
+
+static TaskHandle_t soft_timer_task_handle = NULL;
+
+static uint64_t soft_timer_now(void)
+{
+    return TIMESTAMP_US;
+}
+
+// 阻塞到下一次到期，tick为1ms，向上取整，回调最多滞后1个tick
+static void soft_timer_wait(uint64_t timeout_us)
+{
+    TickType_t ticks = portMAX_DELAY;
+    if (timeout_us != SOFT_TIMER_WAIT_FOREVER)
+    {
+        uint64_t ms = (timeout_us + 999u) / 1000u;
+        ticks = (ms < portMAX_DELAY) ? pdMS_TO_TICKS((uint32_t)ms) : portMAX_DELAY - 1;
+    }
+    ulTaskNotifyTake(pdTRUE, ticks);
+}
+
+// 堆顶变化时唤醒服务任务重新计算等待时长
+static void soft_timer_notify(void)
+{
+    if (soft_timer_task_handle == NULL || soft_timer_task_handle == xTaskGetCurrentTaskHandle())
+    {
+        return;
+    }
+
+    if (is_in_interrupt())
+    {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(soft_timer_task_handle, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+    else
+    {
+        xTaskNotifyGive(soft_timer_task_handle);
+    }
+}
+
+// 服务任务
+static void soft_timer_entry(void *args)
+{
+    soft_timer_task_handle = xTaskGetCurrentTaskHandle();
+    soft_timer_service_run(&g_soft_timer);
+    os_return;
+}
+
+soft_timer_service_t g_soft_timer = {
+    .cfg = {
+        .name = "g_soft_timer",
+        .size = SOFT_TIMER_SIZE,
+    },
+    .ops = {
+        .now = soft_timer_now,
+        .wait = soft_timer_wait,
+        .notify = soft_timer_notify,
+    },
+};
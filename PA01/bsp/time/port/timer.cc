@@ -95,6 +95,13 @@ static void time_auto_set(void)
 
 static void timer5_init(void)
 {
+    // 周期计数器 DWT->CYCCNT，快速路径和性能分析使用
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    g_time_timer5.cfg.cycles_freq = SystemCoreClock;
+
     time_auto_set();
 
     // 启用定时器
@@ -112,6 +119,16 @@ static void timer5_write(uint32_t timer_cnt)
     TIM5->CNT = timer_cnt;
 }
 
+static bool timer5_is_overflow(void)
+{
+    return __HAL_TIM_GET_FLAG(&htim5, TIM_FLAG_UPDATE) != RESET;
+}
+
+static uint32_t timer5_cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
 vtime_t g_time_timer5 = {
     .cfg = {
         .timer_bits = 32, // 32位定时器
@@ -120,5 +137,7 @@ vtime_t g_time_timer5 = {
         .init = timer5_init,
         .read = timer5_read,
         .write = timer5_write,
+        .is_overflow = timer5_is_overflow,
+        .cycles = timer5_cycles,
     },
 };
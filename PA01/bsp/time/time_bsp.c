@@ -1,9 +1,12 @@
 #include "./time_bsp.h"
 
 // 驱动加载
+#include "./../../lib/time/profile.c"
+#include "./../../lib/time/soft_timer.c"
 #include "./../../lib/time/time.c"
 
 // 端口加载
+#include "./port/soft_timer.cc"
 #include "./port/timer.cc"
 
 // time组
@@ -12,6 +15,21 @@ vtime_t *const g_time_group[] = {
 };
 const uint32_t TIME_GROUP_SIZE = countof(g_time_group);
 
+// 快速路径锚点同步
+static void time_bsp_fast_sync(void *userdata)
+{
+    for (int i = 0; i < TIME_GROUP_SIZE; i++)
+    {
+        time_fast_sync(g_time_group[i]);
+    }
+}
+
+// 定时器到期后在服务任务中发布主题，userdata 为 dds_topic_t*
+void time_bsp_timer_publish(soft_timer_t *timer, void *userdata)
+{
+    dds_publish(timer, (dds_topic_t *)userdata, NULL);
+}
+
 // BSP初始化
 void time_bsp_init(void)
 {
@@ -19,4 +37,11 @@ void time_bsp_init(void)
     {
         time_init(g_time_group[i]);
     }
+
+    // 快速时间戳锚点同步，DWT 480MHz 约8.9s回绕
+    dds_idle_create((dds_task_fn_t)time_bsp_fast_sync, NULL, DDS_PRIORITY_SUPER, 1000 * 1000);
+
+    // 软件定时器服务
+    soft_timer_service_init(&g_soft_timer);
+    os_task_create(soft_timer_entry, "soft_timer", NULL, OS_PRIORITY_BSP, OS_TASK_STACK_MIN + 1024);
 }
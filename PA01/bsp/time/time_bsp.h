@@ -14,6 +14,7 @@
 #include "../bsp_env.h"
 
 // 驱动
+#include "../../lib/time/soft_timer.h"
 #include "../../lib/time/time.h"
 
 /**
@@ -22,9 +23,19 @@
  */
 void time_bsp_init(void);
 
+/**
+ * @brief 定时器回调：在服务任务中发布主题
+ * @note dds 同步调用订阅者，订阅回调同样运行在服务任务中，须遵守 soft_timer.h 的短回调约定
+ *
+ * @param timer 定时器
+ * @param userdata 主题 dds_topic_t*
+ */
+void time_bsp_timer_publish(soft_timer_t *timer, void *userdata);
+
 // time组
 extern vtime_t *const g_time_group[];
 extern const uint32_t TIME_GROUP_SIZE;
 
 // 声明
 extern vtime_t g_time_timer5;
+extern soft_timer_service_t g_soft_timer; // 软件定时器服务
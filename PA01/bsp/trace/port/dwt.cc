@@ -0,0 +1,33 @@
+/**
+ * @file dwt.cc
+ * @author WittXie
+ * @brief 以DWT周期计数器为时基的事件追踪
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "./../trace_bsp.h"
+
+#define TRACE_DWT_BUFF_SIZE 4096 // 事件个数，48KB
+
+static uint32_t trace_dwt_cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+trace_t g_trace = {
+    .cfg = {
+        .name = "g_trace",
+        .buff_size = TRACE_DWT_BUFF_SIZE,
+        .name_size = 64,
+        .task_size = 32,
+        .core = 0,
+        .cycles_freq = 0, // 初始化时读取 SystemCoreClock
+    },
+    .ops = {
+        .cycles = trace_dwt_cycles,
+    },
+};
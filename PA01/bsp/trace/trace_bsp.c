@@ -0,0 +1,57 @@
+#include "./trace_bsp.h"
+
+// 驱动加载
+#include "./../../lib/trace/trace.c"
+
+// 端口加载
+#include "./port/dwt.cc"
+
+// trace组
+trace_t *const g_trace_group[] = {
+    &g_trace,
+};
+const uint32_t TRACE_GROUP_SIZE = countof(g_trace_group);
+
+// 任务切换钩子：调度器内调用，只记录不做其它事
+void trace_task_switched_in_hook(uint32_t number)
+{
+    trace_record(&g_trace, TRACE_TYPE_TASK_IN, number, 0);
+}
+void trace_task_switched_out_hook(uint32_t number)
+{
+    trace_record(&g_trace, TRACE_TYPE_TASK_OUT, number, 0);
+}
+
+// 导出
+uint32_t trace_bsp_dump(void (*write)(uint8_t *buff, uint32_t length))
+{
+    // 任务名称：TaskStatus_t.pcTaskName 指向TCB内的名称，任务存在期间有效
+    uint32_t task_size = uxTaskGetNumberOfTasks();
+    TaskStatus_t *tasks = (TaskStatus_t *)MALLOC(task_size * sizeof(TaskStatus_t));
+    if (tasks != NULL)
+    {
+        task_size = uxTaskGetSystemState(tasks, task_size, NULL);
+        for (uint32_t i = 0; i < task_size; i++)
+        {
+            trace_task_name_set(&g_trace, tasks[i].xTaskNumber, tasks[i].pcTaskName);
+        }
+        FREE(tasks);
+    }
+
+    return trace_dump(&g_trace, write);
+}
+
+// BSP初始化
+void trace_bsp_init(void)
+{
+    // DWT周期计数器由时间模块打开，此处不能清零，否则快速时间戳锚点失效
+    for (int i = 0; i < TRACE_GROUP_SIZE; i++)
+    {
+        if (g_trace_group[i]->cfg.cycles_freq == 0)
+        {
+            g_trace_group[i]->cfg.cycles_freq = SystemCoreClock;
+        }
+        trace_init(g_trace_group[i]);
+        trace_enable(g_trace_group[i], TRACE_ENABLE);
+    }
+}
@@ -0,0 +1,50 @@
+/**
+ * @file trace_bsp.h
+ * @author WittXie
+ * @brief bsp层事件追踪
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+// 环境
+#include "../bsp_env.h"
+
+// 依赖
+#include "./../log/log_bsp.h"
+#include "./../os/os_bsp.h"
+
+// 驱动
+#include "./../../lib/trace/trace.h"
+
+/**
+ * @brief bsp初始化
+ *
+ */
+void trace_bsp_init(void);
+
+/**
+ * @brief 填充任务名称并导出
+ *
+ * @param write 输出接口
+ * @return uint32_t 导出的事件数
+ */
+uint32_t trace_bsp_dump(void (*write)(uint8_t *buff, uint32_t length));
+
+/**
+ * @brief RTOS任务切换钩子，由 FreeRTOSConfig.h 的 traceTASK_SWITCHED_IN/OUT 调用
+ *
+ * @param number 任务号 uxTCBNumber
+ */
+void trace_task_switched_in_hook(uint32_t number);
+void trace_task_switched_out_hook(uint32_t number);
+
+// trace组
+extern trace_t *const g_trace_group[];
+extern const uint32_t TRACE_GROUP_SIZE;
+
+// 声明
+extern trace_t g_trace; // 主核
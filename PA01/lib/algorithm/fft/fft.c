@@ -1,102 +1,388 @@
 #include "./fft.h"
+#include <string.h>
 
-// 辅助函数：计算旋转因子
-static complex_t twiddle_factor(uint16_t k, uint16_t N, bool inverse)
+// 旋转因子表 W_N^k，k < count：点数不超过常量表时按步长共用常量表，否则在堆上生成
+static bool fft_twiddle_init(const complex_t **twiddle, uint32_t *stride, uint32_t size, uint32_t count)
 {
-    float angle = (inverse ? 2.0 : -2.0) * M_PI * k / N;
-    complex_t result = {cosf(angle), sinf(angle)};
-    return result;
+    if (size <= LUT_FFT_TWIDDLE_SIZE)
+    {
+        // W_N^k = W_M^(k*M/N)，M/N 为2的幂，角度换算无舍入，与现算逐位相同
+        *twiddle = (const complex_t *)g_lut_fft_twiddle;
+        *stride = LUT_FFT_TWIDDLE_SIZE / size;
+        return true;
+    }
+
+    complex_t *table = (complex_t *)MALLOC(count * sizeof(complex_t));
+    if (table == NULL)
+    {
+        return false;
+    }
+    // 旋转因子 W_N^k = exp(-2πik/N)，双精度计算
+    for (uint32_t k = 0; k < count; k++)
+    {
+        double angle = -2.0 * 3.14159265358979323846 * k / size;
+        table[k].real = (float)cos(angle);
+        table[k].imag = (float)sin(angle);
+    }
+    *twiddle = table;
+    *stride = 1;
+    return true;
 }
 
-// 辅助函数：位反转重排序
-static uint16_t bit_reverse(uint16_t num, uint16_t bits)
+// 释放旋转因子表，常量表不释放
+static void fft_twiddle_deinit(const complex_t **twiddle)
 {
-    uint16_t reversed = 0;
-    for (uint16_t i = 0; i < bits; i++)
+    if ((*twiddle != NULL) && (*twiddle != (const complex_t *)g_lut_fft_twiddle))
     {
-        reversed <<= 1;
-        reversed |= (num & 1);
-        num >>= 1;
+        FREE((void *)*twiddle);
+    }
+    *twiddle = NULL;
+}
+
+// 生成旋转因子表和位反转表
+static bool fft_table_init(fft_t *fft, uint32_t size)
+{
+    memset(fft, 0, sizeof(fft_t));
+    if (size < 2 || size > FFT_SIZE_MAX || (size & (size - 1)) != 0)
+    {
+        ASSERT(false, "fft size %u must be a power of 2.\r\n", size);
+        return false;
+    }
+    fft->size = size;
+
+    uint32_t bits = 0;
+    while ((1u << bits) < size)
+    {
+        bits++;
+    }
+
+    // 交换对数 = (N - 自反下标数) / 2，自反下标数 = 2^ceil(bits/2)
+    uint32_t swap_count = (size - (1u << ((bits + 1) / 2))) / 2;
+    uint32_t twiddle_count = size * 3 / 4;
+    if (twiddle_count == 0)
+    {
+        twiddle_count = 1;
+    }
+
+    bool is_ok = fft_twiddle_init(&fft->twiddle, &fft->twiddle_stride, size, twiddle_count);
+    fft->swap = (swap_count > 0) ? (uint16_t *)MALLOC(swap_count * 2 * sizeof(uint16_t)) : NULL;
+    if (!is_ok || (swap_count > 0 && fft->swap == NULL))
+    {
+        fft_deinit(fft);
+        return false;
+    }
+
+    // 位反转交换表
+    for (uint32_t i = 0, j = 0; i < size; i++)
+    {
+        if (i < j)
+        {
+            fft->swap[fft->swap_count * 2] = (uint16_t)i;
+            fft->swap[fft->swap_count * 2 + 1] = (uint16_t)j;
+            fft->swap_count++;
+        }
+        // j 做反向进位加一
+        uint32_t bit = size >> 1;
+        while (j & bit)
+        {
+            j ^= bit;
+            bit >>= 1;
+        }
+        j |= bit;
     }
-    return reversed;
+    ASSERT(fft->swap_count == swap_count);
+    return true;
 }
 
 // 初始化FFT
-void fft_init(fft_t *fft, uint16_t size, bool inverse, complex_t *input_buffer, complex_t *output_buffer)
+bool fft_init(fft_t *fft, uint32_t size, bool inverse, complex_t *input_buffer, complex_t *output_buffer)
 {
     ASSERT(fft != NULL);
-    ASSERT(size > 0);
     ASSERT(input_buffer != NULL);
     ASSERT(output_buffer != NULL);
 
-    fft->size = size;
+    if (!fft_table_init(fft, size))
+    {
+        return false;
+    }
     fft->inverse = inverse;
     fft->input = input_buffer;
     fft->output = output_buffer;
+    return true;
 }
 
-// 执行FFT计算
-void fft_execute(fft_t *fft)
+// 释放FFT表
+void fft_deinit(fft_t *fft)
 {
     ASSERT(fft != NULL);
 
-    uint16_t N = fft->size;
-    uint16_t bits = 0;
-    while ((N >> bits) > 0)
+    fft_twiddle_deinit(&fft->twiddle);
+    if (fft->swap != NULL)
     {
-        bits++;
+        FREE(fft->swap);
+        fft->swap = NULL;
     }
-    bits--;
+    fft->swap_count = 0;
+}
+
+// 复数乘法
+static inline complex_t complex_mul(complex_t a, complex_t b)
+{
+    complex_t result = {a.real * b.real - a.imag * b.imag, a.real * b.imag + a.imag * b.real};
+    return result;
+}
+
+// 原地正变换
+static void fft_forward(const fft_t *fft, complex_t *data)
+{
+    uint32_t N = fft->size;
 
-    // 位反转重排序
-    for (uint16_t i = 0; i < N; i++)
+    // 位反转重排
+    const uint16_t *swap = fft->swap;
+    for (uint32_t i = 0; i < fft->swap_count; i++, swap += 2)
     {
-        uint16_t j = bit_reverse(i, bits);
-        if (j > i)
-        {
-            fft->output[j] = fft->input[i];
-            fft->output[i] = fft->input[j];
-        }
-        else
+        complex_t temp = data[swap[0]];
+        data[swap[0]] = data[swap[1]];
+        data[swap[1]] = temp;
+    }
+
+    // log2(N) 为奇数：先做一级 radix-2，旋转因子恒为1
+    uint32_t q = 1;
+    uint32_t bits = 0;
+    while ((1u << bits) < N)
+    {
+        bits++;
+    }
+    if (bits & 1)
+    {
+        for (uint32_t k = 0; k < N; k += 2)
         {
-            fft->output[i] = fft->input[i];
+            complex_t a = data[k];
+            complex_t b = data[k + 1];
+            data[k].real = a.real + b.real;
+            data[k].imag = a.imag + b.imag;
+            data[k + 1].real = a.real - b.real;
+            data[k + 1].imag = a.imag - b.imag;
         }
+        q = 2;
     }
 
-    // 迭代FFT计算
-    for (uint16_t s = 1; s <= bits; s++)
+    // radix-4 蝶形：4个 q 点子变换合并为 4q 点
+    // 位反转顺序下4个子块依次为 x[4n], x[4n+2], x[4n+1], x[4n+3] 的变换
+    for (; q < N; q <<= 2)
     {
-        uint16_t m = 1 << s;
-        uint16_t m2 = m >> 1;
-        complex_t w = {1.0, 0.0};
-        complex_t wm = twiddle_factor(1, m, fft->inverse);
-
-        for (uint16_t j = 0; j < m2; j++)
+        uint32_t m = q << 2;
+        uint32_t stride = (N / m) * fft->twiddle_stride;
+        for (uint32_t base = 0; base < N; base += m)
         {
-            for (uint16_t k = j; k < N; k += m)
+            complex_t *p = &data[base];
+            for (uint32_t k = 0; k < q; k++)
             {
-                uint16_t t1 = k + m2;
-                complex_t t = {w.real * fft->output[t1].real - w.imag * fft->output[t1].imag,
-                               w.real * fft->output[t1].imag + w.imag * fft->output[t1].real};
-                complex_t u = fft->output[k];
-                fft->output[k].real = u.real + t.real;
-                fft->output[k].imag = u.imag + t.imag;
-                fft->output[t1].real = u.real - t.real;
-                fft->output[t1].imag = u.imag - t.imag;
+                complex_t a = p[k];
+                complex_t t2 = p[k + q];
+                complex_t t1 = p[k + 2 * q];
+                complex_t t3 = p[k + 3 * q];
+                if (k != 0)
+                {
+                    t1 = complex_mul(t1, fft->twiddle[k * stride]);
+                    t2 = complex_mul(t2, fft->twiddle[2 * k * stride]);
+                    t3 = complex_mul(t3, fft->twiddle[3 * k * stride]);
+                }
+
+                float s0r = a.real + t2.real, s0i = a.imag + t2.imag;
+                float d0r = a.real - t2.real, d0i = a.imag - t2.imag;
+                float s1r = t1.real + t3.real, s1i = t1.imag + t3.imag;
+                float d1r = t1.real - t3.real, d1i = t1.imag - t3.imag;
+
+                p[k].real = s0r + s1r;
+                p[k].imag = s0i + s1i;
+                p[k + 2 * q].real = s0r - s1r;
+                p[k + 2 * q].imag = s0i - s1i;
+                // -i * (t1 - t3) = (d1i, -d1r)
+                p[k + q].real = d0r + d1i;
+                p[k + q].imag = d0i - d1r;
+                p[k + 3 * q].real = d0r - d1i;
+                p[k + 3 * q].imag = d0i + d1r;
             }
-            complex_t temp = {w.real * wm.real - w.imag * wm.imag,
-                              w.real * wm.imag + w.imag * wm.real};
-            w = temp;
         }
     }
+}
+
+// 对任意缓冲区原地做FFT
+void fft_transform(fft_t *fft, complex_t *data, bool inverse)
+{
+    ASSERT(fft != NULL);
+    ASSERT(fft->twiddle != NULL);
+    ASSERT(data != NULL);
+
+    uint32_t N = fft->size;
+    if (!inverse)
+    {
+        fft_forward(fft, data);
+        return;
+    }
 
-    // 如果是逆FFT，结果需要除以N
-    if (fft->inverse)
+    // 逆变换：conj(FFT(conj(x))) / N
+    for (uint32_t i = 0; i < N; i++)
     {
-        for (uint16_t i = 0; i < N; i++)
+        data[i].imag = -data[i].imag;
+    }
+    fft_forward(fft, data);
+    float scale = 1.0f / N;
+    for (uint32_t i = 0; i < N; i++)
+    {
+        data[i].real *= scale;
+        data[i].imag *= -scale;
+    }
+}
+
+// 执行FFT计算
+void fft_execute(fft_t *fft)
+{
+    ASSERT(fft != NULL);
+
+    if (fft->output != fft->input)
+    {
+        memcpy(fft->output, fft->input, fft->size * sizeof(complex_t));
+    }
+    fft_transform(fft, fft->output, fft->inverse);
+}
+
+// 初始化实数FFT
+bool fft_real_init(fft_real_t *fft, uint32_t size)
+{
+    ASSERT(fft != NULL);
+
+    memset(fft, 0, sizeof(fft_real_t));
+    if (size < 4 || size > 2 * FFT_SIZE_MAX || (size & (size - 1)) != 0)
+    {
+        ASSERT(false, "fft real size %u must be a power of 2.\r\n", size);
+        return false;
+    }
+
+    // 子FFT只用表，不绑定缓冲区
+    if (!fft_table_init(&fft->half, size / 2))
+    {
+        return false;
+    }
+
+    if (!fft_twiddle_init(&fft->twiddle, &fft->twiddle_stride, size, size / 4))
+    {
+        fft_deinit(&fft->half);
+        return false;
+    }
+    fft->size = size;
+    return true;
+}
+
+// 释放实数FFT表
+void fft_real_deinit(fft_real_t *fft)
+{
+    ASSERT(fft != NULL);
+
+    fft_deinit(&fft->half);
+    fft_twiddle_deinit(&fft->twiddle);
+}
+
+// W_N^k，k <= N/2，后半段由 W_N^(N/2-k) = -conj(W_N^k) 对称得到
+static inline complex_t fft_real_twiddle(const fft_real_t *fft, uint32_t k)
+{
+    uint32_t quarter = fft->size / 4;
+    if (k < quarter)
+    {
+        return fft->twiddle[k * fft->twiddle_stride];
+    }
+    if (k == quarter)
+    {
+        complex_t result = {0.0f, -1.0f};
+        return result;
+    }
+    complex_t w = fft->twiddle[(fft->size / 2 - k) * fft->twiddle_stride];
+    complex_t result = {-w.real, w.imag};
+    return result;
+}
+
+// 实数正变换
+void fft_real_forward(fft_real_t *fft, const float *input, complex_t *output)
+{
+    ASSERT(fft != NULL);
+    ASSERT(fft->twiddle != NULL);
+    ASSERT(input != NULL);
+    ASSERT(output != NULL);
+
+    uint32_t half = fft->size / 2;
+
+    // z[n] = x[2n] + i*x[2n+1]，内存布局相同，直接搬移
+    if ((const void *)output != (const void *)input)
+    {
+        memmove(output, input, fft->size * sizeof(float));
+    }
+    fft_forward(&fft->half, output);
+
+    // X[k] = (Z[k] + conj(Z[h-k]))/2 - i/2 * W^k * (Z[k] - conj(Z[h-k]))
+    complex_t z0 = output[0];
+    output[0].real = z0.real + z0.imag;
+    output[0].imag = 0.0f;
+    output[half].real = z0.real - z0.imag;
+    output[half].imag = 0.0f;
+    for (uint32_t k = 1; k <= half / 2; k++)
+    {
+        complex_t a = output[k];
+        complex_t b = output[half - k];
+
+        // k 侧
+        float er = 0.5f * (a.real + b.real), ei = 0.5f * (a.imag - b.imag);
+        float or_ = 0.5f * (a.imag + b.imag), oi = -0.5f * (a.real - b.real);
+        complex_t w = fft_real_twiddle(fft, k);
+        complex_t o = {or_, oi};
+        o = complex_mul(o, w);
+        output[k].real = er + o.real;
+        output[k].imag = ei + o.imag;
+
+        // h-k 侧：E、O 取共轭，W^(h-k) = -conj(W^k)
+        if (k != half - k)
         {
-            fft->output[i].real /= N;
-            fft->output[i].imag /= N;
+            complex_t w2 = {-w.real, w.imag};
+            complex_t o2 = {or_, -oi};
+            o2 = complex_mul(o2, w2);
+            output[half - k].real = er + o2.real;
+            output[half - k].imag = -ei + o2.imag;
         }
     }
 }
+
+// 实数逆变换
+void fft_real_inverse(fft_real_t *fft, const complex_t *input, float *output)
+{
+    ASSERT(fft != NULL);
+    ASSERT(fft->twiddle != NULL);
+    ASSERT(input != NULL);
+    ASSERT(output != NULL);
+
+    uint32_t half = fft->size / 2;
+    complex_t *z = (complex_t *)output; // N 个实数恰好是 N/2 个复数
+
+    // Z[k] = E[k] + i*O[k]，E = (X[k] + conj(X[h-k]))/2，O = (X[k] - conj(X[h-k]))/2 * W^-k
+    // 直接构造 conj(Z)，省去逆变换前的共轭
+    for (uint32_t k = 0; k < half; k++)
+    {
+        complex_t a = input[k];
+        complex_t b = input[half - k];
+        float er = 0.5f * (a.real + b.real), ei = 0.5f * (a.imag - b.imag);
+        float dr = 0.5f * (a.real - b.real), di = 0.5f * (a.imag + b.imag);
+        complex_t w = fft_real_twiddle(fft, k);
+        // O = (dr + i*di) * conj(w)
+        float or_ = dr * w.real + di * w.imag;
+        float oi = di * w.real - dr * w.imag;
+        z[k].real = er - oi;
+        z[k].imag = -(ei + or_);
+    }
+    fft_forward(&fft->half, z);
+
+    float scale = 1.0f / half;
+    for (uint32_t k = 0; k < half; k++)
+    {
+        z[k].real *= scale;
+        z[k].imag *= -scale;
+    }
+}
@@ -1,9 +1,17 @@
 /**
  * @file fft.h
  * @author WittXie
- * @brief 通用FFT算法模块（浮点数版本，静态内存分配，迭代方法）
- * @version 0.1
+ * @brief 通用FFT算法模块（浮点数版本，radix-4/radix-2 混合基，查表旋转因子）
+ * @version 0.2
  * @date 2024-08-29
+ * @note
+ * 初始化时按点数一次性生成旋转因子表（双精度计算后存为单精度）和位反转交换表，
+ * 运算过程不再调用 cosf/sinf，也没有旋转因子连乘带来的误差累积。
+ * 点数不超过 LUT_FFT_TWIDDLE_SIZE 时旋转因子直接按步长取 FLASH 中的常量表（lib/lut，与现算结果逐位相同），
+ * 不占 RAM，初始化也不算三角函数；更大的点数才在堆上生成。
+ * 位反转后先做一级 radix-2（log2(N) 为奇数时），其余每两级合并为一级 radix-4 蝶形。
+ * 逆变换通过共轭输入/输出复用正变换，结果已除以 N。
+ * 实数FFT把 N 点实序列看作 N/2 点复序列，做 N/2 点复数FFT后拆分，输出 N/2+1 个频点。
  *
  * @copyright Copyright (c) 2024
  */
@@ -12,15 +20,25 @@
 #include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
+
+#include "./../../lut/lut.h"
 
 #ifndef ASSERT
 #define ASSERT(_bool, ...) ((void)0)
 #endif
 
+#ifndef MALLOC
+#define MALLOC(_size) malloc(_size)
+#define FREE(_pv) free(_pv)
+#endif
+
 #ifndef M_PI
 #define M_PI 3.14159265359f
 #endif
 
+#define FFT_SIZE_MAX 65536 // 位反转表用16位下标
+
 /**
  * @brief 复数结构体
  */
@@ -35,30 +53,86 @@ typedef struct
  */
 typedef struct
 {
-    uint16_t size;     // FFT点数
-    complex_t *input;  // 输入数据
-    complex_t *output; // 输出数据
-    bool inverse;      // 是否为逆FFT
+    uint32_t size;            // FFT点数，2的幂
+    complex_t *input;         // 输入数据
+    complex_t *output;        // 输出数据，可与输入相同（原地）
+    bool inverse;             // 是否为逆FFT
+    const complex_t *twiddle; // 旋转因子表 W_N^k = twiddle[k * twiddle_stride]，k < 3N/4
+    uint32_t twiddle_stride;  // 旋转因子步长，共用常量表时 > 1
+    uint16_t *swap;           // 位反转交换表，成对存放 (i, j)，i < j
+    uint32_t swap_count;      // 交换对数
 } fft_t;
 
 /**
- * @brief 初始化FFT
+ * @brief 实数FFT结构体
+ */
+typedef struct
+{
+    uint32_t size;            // 实序列点数，2的幂且不小于4
+    fft_t half;               // N/2 点复数FFT
+    const complex_t *twiddle; // 拆分用旋转因子 W_N^k = twiddle[k * twiddle_stride]，k < N/4
+    uint32_t twiddle_stride;  // 旋转因子步长
+} fft_real_t;
+
+/**
+ * @brief 初始化FFT，生成旋转因子表和位反转表
  * @param fft FFT结构体指针
- * @param size FFT点数
+ * @param size FFT点数，2的幂，不超过 FFT_SIZE_MAX
  * @param inverse 是否为逆FFT
  * @param input_buffer 输入数据缓冲区
- * @param output_buffer 输出数据缓冲区
+ * @param output_buffer 输出数据缓冲区，可与输入相同
+ * @return true 成功
+ * @return false 点数非法或内存不足
  */
-void fft_init(fft_t *fft, uint16_t size, bool inverse, complex_t *input_buffer, complex_t *output_buffer);
+bool fft_init(fft_t *fft, uint32_t size, bool inverse, complex_t *input_buffer, complex_t *output_buffer);
 
 /**
- * @brief 执行FFT计算
+ * @brief 执行FFT计算：input -> output
  * @param fft FFT结构体指针
  */
 void fft_execute(fft_t *fft);
 
 /**
- * @brief 释放FFT结构体内存（静态内存分配，无需释放）
+ * @brief 对任意缓冲区原地做FFT，共用同一组表
+ * @param fft FFT结构体指针
+ * @param data 数据，size 个复数
+ * @param inverse 是否为逆FFT
+ */
+void fft_transform(fft_t *fft, complex_t *data, bool inverse);
+
+/**
+ * @brief 释放FFT表
  * @param fft FFT结构体指针
  */
-static inline void fft_deinit(fft_t *fft) { (void)fft; }
\ No newline at end of file
+void fft_deinit(fft_t *fft);
+
+/**
+ * @brief 初始化实数FFT
+ * @param fft 实数FFT结构体指针
+ * @param size 实序列点数，2的幂，4 ~ 2*FFT_SIZE_MAX
+ * @return true 成功
+ * @return false 点数非法或内存不足
+ */
+bool fft_real_init(fft_real_t *fft, uint32_t size);
+
+/**
+ * @brief 实数正变换
+ * @param fft 实数FFT结构体指针
+ * @param input 实序列，size 个
+ * @param output 频谱，size/2+1 个复数（0 ~ fs/2），可与输入共用内存
+ */
+void fft_real_forward(fft_real_t *fft, const float *input, complex_t *output);
+
+/**
+ * @brief 实数逆变换，结果已除以 N
+ * @param fft 实数FFT结构体指针
+ * @param input 频谱，size/2+1 个复数（不修改）
+ * @param output 实序列，size 个，不可与输入重叠
+ */
+void fft_real_inverse(fft_real_t *fft, const complex_t *input, float *output);
+
+/**
+ * @brief 释放实数FFT表
+ * @param fft 实数FFT结构体指针
+ */
+void fft_real_deinit(fft_real_t *fft);
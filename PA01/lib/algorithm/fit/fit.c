@@ -1,5 +1,5 @@
-
 #include "./fit.h"
+#include <string.h>
 
 // 预测函数实现
 float fit_predict(fit_cfg_t *cfg, fit_params_t params, int x)
@@ -7,52 +7,310 @@ float fit_predict(fit_cfg_t *cfg, fit_params_t params, int x)
     return params.a * cfg->func(params.b * x);
 }
 
-// 拟合函数实现
+// 拟合函数实现：一次遍历双精度累加求参数；R² 再遍历一次，在原始空间 y 上计算
 fit_params_t fit_training(fit_cfg_t *cfg, fit_data_t *data, uint32_t n)
 {
-    // 初始化参数
-    float sum_x = 0, sum_y = 0, sum_xy = 0, sum_x2 = 0, sum_log_y = 0, sum_x_log_y = 0;
+    fit_stream_t stream;
+    fit_stream_init(&stream, cfg, 1.0f);
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        fit_stream_update(&stream, data[i].x, data[i].y);
+    }
+
+    fit_params_t params = fit_stream_result(&stream);
+    if (!cfg->enable_r2)
+    {
+        params.r2 = 0;
+        return params;
+    }
 
-    // 计算各项和
-    for (int i = 0; i < n; ++i)
+    double mean_y = 0;
+    for (uint32_t i = 0; i < n; ++i)
     {
-        float log_y = cfg->defunc(data[i].y);
-        sum_x += data[i].x;
-        sum_x2 += data[i].x * data[i].x;
-        sum_log_y += log_y;
-        sum_x_log_y += data[i].x * log_y;
+        mean_y += data[i].y;
     }
+    mean_y /= (n > 0) ? n : 1;
 
-    // 计算参数 a 和 b
-    float denominator = n * sum_x2 - sum_x * sum_x;
-    float a = (sum_log_y * sum_x2 - sum_x * sum_x_log_y) / denominator;
-    float b = (n * sum_x_log_y - sum_x * sum_log_y) / denominator;
+    double ss_res = 0; // 残差平方和，模型未能解释的方差
+    double ss_tot = 0; // 总平方和，观测数据的方差
+    for (uint32_t i = 0; i < n; ++i)
+    {
+        double predicted_y = params.a * cfg->func(params.b * data[i].x);
+        ss_res += (data[i].y - predicted_y) * (data[i].y - predicted_y);
+        ss_tot += (data[i].y - mean_y) * (data[i].y - mean_y);
+    }
+    params.r2 = (ss_tot > 0) ? 1.0 - ss_res / ss_tot : 1.0f;
+    return params;
+}
+
+// ---------------------------------------------------------------- 流式线性拟合
+
+void fit_stream_init(fit_stream_t *fit, const fit_cfg_t *cfg, float lambda)
+{
+    ASSERT(fit != NULL);
+    ASSERT(lambda > 0 && lambda <= 1);
 
-    fit_params_t params;
-    params.a = cfg->func(a);
+    fit->cfg = cfg;
+    fit->lambda = lambda;
+    fit->weight = 0;
+    fit->mean_x = 0;
+    fit->mean_y = 0;
+    fit->m2_x = 0;
+    fit->m2_y = 0;
+    fit->c_xy = 0;
+}
+
+void fit_stream_update(fit_stream_t *fit, float x, float y)
+{
+    ASSERT(fit != NULL);
+
+    double yv = (fit->cfg != NULL) ? fit->cfg->defunc(y) : y;
+    double lambda = fit->lambda;
+
+    // 加权 Welford：旧样本权重整体乘 lambda，新样本权重为1
+    fit->weight = lambda * fit->weight + 1.0;
+    double dx = x - fit->mean_x;
+    double dy = yv - fit->mean_y;
+    fit->mean_x += dx / fit->weight;
+    fit->mean_y += dy / fit->weight;
+    fit->m2_x = lambda * fit->m2_x + dx * (x - fit->mean_x);
+    fit->m2_y = lambda * fit->m2_y + dy * (yv - fit->mean_y);
+    fit->c_xy = lambda * fit->c_xy + dx * (yv - fit->mean_y);
+}
+
+fit_params_t fit_stream_result(const fit_stream_t *fit)
+{
+    ASSERT(fit != NULL);
+
+    fit_params_t params = {0};
+    if (fit->m2_x <= 0)
+    {
+        params.a = (fit->cfg != NULL) ? fit->cfg->func(fit->mean_y) : fit->mean_y;
+        return params;
+    }
+
+    double b = fit->c_xy / fit->m2_x;
+    double a = fit->mean_y - b * fit->mean_x;
+    params.a = (fit->cfg != NULL) ? fit->cfg->func(a) : a;
     params.b = b;
+    params.r2 = (fit->m2_y > 0) ? (fit->c_xy * fit->c_xy) / (fit->m2_x * fit->m2_y) : 1.0f;
+    return params;
+}
+
+float fit_stream_predict(const fit_stream_t *fit, float x)
+{
+    ASSERT(fit != NULL);
+
+    fit_params_t params = fit_stream_result(fit);
+    if (fit->cfg != NULL)
+    {
+        return params.a * fit->cfg->func(params.b * x);
+    }
+    return params.a + params.b * x;
+}
+
+// ---------------------------------------------------------------- 流式多项式拟合
+
+void fit_poly_init(fit_poly_t *fit, uint8_t degree, float lambda)
+{
+    ASSERT(fit != NULL);
+    ASSERT(degree <= FIT_DEGREE_MAX);
+    ASSERT(lambda > 0 && lambda <= 1);
+
+    memset(fit, 0, sizeof(fit_poly_t));
+    fit->degree = degree;
+    fit->lambda = lambda;
+}
+
+void fit_poly_update(fit_poly_t *fit, float x, float y)
+{
+    ASSERT(fit != NULL);
+
+    // 以首个样本为原点，避免 x 较大（如时间戳）时高次矩丢失精度
+    if (!fit->has_origin)
+    {
+        fit->origin = x;
+        fit->has_origin = true;
+    }
+
+    double u = x - fit->origin;
+    double lambda = fit->lambda;
+    double power = 1.0;
+    uint8_t degree = fit->degree;
+    for (uint8_t k = 0; k <= 2 * degree; k++)
+    {
+        fit->sum_u[k] = lambda * fit->sum_u[k] + power;
+        if (k <= degree)
+        {
+            fit->sum_uy[k] = lambda * fit->sum_uy[k] + power * y;
+        }
+        power *= u;
+    }
+    fit->sum_y2 = lambda * fit->sum_y2 + (double)y * y;
+}
+
+// 对称正定方程 A*x = b 的 Cholesky 求解，A 为 n*n，原地分解
+static bool fit_cholesky_solve(double *a, const double *b, double *x, uint8_t n)
+{
+    for (uint8_t j = 0; j < n; j++)
+    {
+        double sum = a[j * n + j];
+        for (uint8_t k = 0; k < j; k++)
+        {
+            sum -= a[j * n + k] * a[j * n + k];
+        }
+        if (sum <= a[j * n + j] * 1e-12 || sum <= 0)
+        {
+            return false; // 样本不足或 x 取值过少
+        }
+        a[j * n + j] = sqrt(sum);
+        for (uint8_t i = j + 1; i < n; i++)
+        {
+            double value = a[i * n + j];
+            for (uint8_t k = 0; k < j; k++)
+            {
+                value -= a[i * n + k] * a[j * n + k];
+            }
+            a[i * n + j] = value / a[j * n + j];
+        }
+    }
 
-    if (cfg->enable_r2)
+    // L*z = b，L^T*x = z
+    for (uint8_t i = 0; i < n; i++)
+    {
+        double value = b[i];
+        for (uint8_t k = 0; k < i; k++)
+        {
+            value -= a[i * n + k] * x[k];
+        }
+        x[i] = value / a[i * n + i];
+    }
+    for (int8_t i = n - 1; i >= 0; i--)
     {
-        float mean_y = sum_log_y / n;
-        float ss_res = 0; // 残差平方和（Sum of Squares Residuals），表示模型未能解释的方差
-        float ss_tot = 0; // 总平方和（Total Sum of Squares），表示观测数据的方差
+        double value = x[i];
+        for (uint8_t k = i + 1; k < n; k++)
+        {
+            value -= a[k * n + i] * x[k];
+        }
+        x[i] = value / a[i * n + i];
+    }
+    return true;
+}
 
-        // 计算 ss_res，ss_tot
-        for (int i = 0; i < n; ++i)
+bool fit_poly_solve(fit_poly_t *fit)
+{
+    ASSERT(fit != NULL);
+
+    uint8_t n = fit->degree + 1;
+    double a[(FIT_DEGREE_MAX + 1) * (FIT_DEGREE_MAX + 1)];
+    double coeff[FIT_DEGREE_MAX + 1];
+    for (uint8_t i = 0; i < n; i++)
+    {
+        for (uint8_t j = 0; j < n; j++)
         {
-            float predicted_y = fit_predict(cfg, params, data[i].x);
-            ss_res += powf(data[i].y - predicted_y, 2);
-            ss_tot += powf(data[i].y - mean_y, 2);
+            a[i * n + j] = fit->sum_u[i + j]; // Hankel 矩阵
         }
+    }
+    if (!fit_cholesky_solve(a, fit->sum_uy, coeff, n))
+    {
+        return false;
+    }
 
-        // 计算R^2
-        params.r2 = 1 - (ss_res / ss_tot);
+    // SS_res = Σy² - c^T*(X^T*y)，SS_tot = Σy² - (Σy)²/Σw
+    double explained = 0;
+    for (uint8_t i = 0; i < n; i++)
+    {
+        fit->coeff[i] = coeff[i];
+        explained += coeff[i] * fit->sum_uy[i];
     }
-    else
+    double ss_res = fit->sum_y2 - explained;
+    double ss_tot = fit->sum_y2 - fit->sum_uy[0] * fit->sum_uy[0] / fit->sum_u[0];
+    fit->r2 = (ss_tot > 0) ? 1.0 - ((ss_res > 0) ? ss_res : 0) / ss_tot : 1.0f;
+    return true;
+}
+
+float fit_poly_predict(const fit_poly_t *fit, float x)
+{
+    ASSERT(fit != NULL);
+
+    // 秦九韶
+    double u = x - fit->origin;
+    double y = 0;
+    for (int8_t k = fit->degree; k >= 0; k--)
     {
-        params.r2 = 0;
+        y = y * u + fit->coeff[k];
+    }
+    return y;
+}
+
+// ---------------------------------------------------------------- 递推最小二乘
+
+void fit_rls_init(fit_rls_t *fit, uint8_t size, float lambda, float delta)
+{
+    ASSERT(fit != NULL);
+    ASSERT(size > 0 && size <= FIT_RLS_SIZE_MAX);
+    ASSERT(lambda > 0 && lambda <= 1);
+
+    memset(fit, 0, sizeof(fit_rls_t));
+    fit->size = size;
+    fit->lambda = lambda;
+    for (uint8_t i = 0; i < size; i++)
+    {
+        fit->p[i * size + i] = delta;
     }
+}
 
-    return params;
+float fit_rls_update(fit_rls_t *fit, const float *phi, float y)
+{
+    ASSERT(fit != NULL);
+    ASSERT(phi != NULL);
+
+    uint8_t n = fit->size;
+    double lambda = fit->lambda;
+    double pphi[FIT_RLS_SIZE_MAX];
+
+    // 先验误差 e = y - phi^T*theta，P*phi，phi^T*P*phi
+    double error = y;
+    double denominator = lambda;
+    for (uint8_t i = 0; i < n; i++)
+    {
+        error -= phi[i] * fit->theta[i];
+        double value = 0;
+        for (uint8_t j = 0; j < n; j++)
+        {
+            value += fit->p[i * n + j] * phi[j];
+        }
+        pphi[i] = value;
+        denominator += phi[i] * value;
+    }
+
+    // 增益 k = P*phi / (lambda + phi^T*P*phi)，theta += k*e，P = (P - k*phi^T*P) / lambda
+    for (uint8_t i = 0; i < n; i++)
+    {
+        fit->theta[i] += pphi[i] / denominator * error;
+    }
+    for (uint8_t i = 0; i < n; i++)
+    {
+        for (uint8_t j = i; j < n; j++)
+        {
+            double value = (fit->p[i * n + j] - pphi[i] * pphi[j] / denominator) / lambda;
+            fit->p[i * n + j] = value;
+            fit->p[j * n + i] = value; // 保持对称
+        }
+    }
+
+    // R² 累加量
+    fit->weight = lambda * fit->weight + 1.0;
+    double dy = y - fit->mean_y;
+    fit->mean_y += dy / fit->weight;
+    fit->ss_tot = lambda * fit->ss_tot + dy * (y - fit->mean_y);
+    fit->ss_res = lambda * fit->ss_res + error * error;
+    return error;
+}
+
+float fit_rls_r2(const fit_rls_t *fit)
+{
+    ASSERT(fit != NULL);
+
+    return (fit->ss_tot > 0) ? 1.0 - fit->ss_res / fit->ss_tot : 1.0f;
 }
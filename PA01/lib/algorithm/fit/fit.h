@@ -1,9 +1,17 @@
 /**
  * @file fit.h
  * @author WittXie
- * @brief 拟合算法（最小二乘法）
- * @version 0.1
+ * @brief 拟合算法（最小二乘法）：批量指数拟合、流式线性/指数拟合、流式多项式拟合、递推最小二乘
+ * @version 0.2
  * @date 2024-08-26
+ * @note
+ * 流式拟合每个样本 O(1)（多项式为 O(阶数)），不保存数据点，全部用双精度累加：
+ * - fit_stream_t：加权 Welford 均值/协方差，拟合 y = a + b*x；给 cfg 时拟合 defunc(y) = A + b*x，a = func(A)
+ * - fit_poly_t：以首个样本为原点的加权矩累加，求解时构造正规方程并 Cholesky 分解，阶数 <= FIT_DEGREE_MAX
+ * - fit_rls_t：递推最小二乘，参数随样本即时更新，适合模型参数缓慢变化的场合
+ * lambda 为遗忘因子（0~1，1 表示不遗忘），有效窗口约 1/(1-lambda) 个样本。
+ * 流式 R² 由累加量直接计算，随时可取；给 cfg 时是线性化空间 defunc(y) 上的 R²，与原始空间 y 上的不同。
+ * 批量 fit_training 保存了数据，R² 在原始空间 y 上计算：1 - Σ(y - a*func(b*x))² / Σ(y - mean(y))²。
  *
  * @copyright Copyright (c) 2024
  *
@@ -43,6 +51,49 @@ typedef struct
     float y;
 } fit_data_t;
 
+#define FIT_DEGREE_MAX 4                      // 多项式最高阶数
+#define FIT_RLS_SIZE_MAX (FIT_DEGREE_MAX + 1) // 递推最小二乘最多参数个数
+
+// 流式线性拟合（加权 Welford）
+typedef struct
+{
+    const fit_cfg_t *cfg; // 线性化函数对，NULL 为直线
+    float lambda;         // 遗忘因子
+    double weight;        // 有效样本数
+    double mean_x;        // x 加权均值
+    double mean_y;        // y 加权均值
+    double m2_x;          // x 离差平方和
+    double m2_y;          // y 离差平方和
+    double c_xy;          // 协方差和
+} fit_stream_t;
+
+// 流式多项式拟合
+typedef struct
+{
+    uint8_t degree;                       // 阶数 0 ~ FIT_DEGREE_MAX
+    float lambda;                         // 遗忘因子
+    bool has_origin;                      // 原点是否已确定
+    double origin;                        // 原点（首个样本的 x），u = x - origin
+    double sum_u[2 * FIT_DEGREE_MAX + 1]; // Σw*u^k
+    double sum_uy[FIT_DEGREE_MAX + 1];    // Σw*u^k*y
+    double sum_y2;                        // Σw*y²
+    double coeff[FIT_DEGREE_MAX + 1];     // 求解结果，u 的升幂系数
+    float r2;                             // 求解结果的 R²
+} fit_poly_t;
+
+// 递推最小二乘
+typedef struct
+{
+    uint8_t size;                                  // 参数个数 1 ~ FIT_RLS_SIZE_MAX
+    float lambda;                                  // 遗忘因子
+    double theta[FIT_RLS_SIZE_MAX];                // 参数估计
+    double p[FIT_RLS_SIZE_MAX * FIT_RLS_SIZE_MAX]; // 协方差矩阵
+    double weight;                                 // 有效样本数
+    double mean_y;                                 // y 加权均值（R²用）
+    double ss_tot;                                 // 总平方和
+    double ss_res;                                 // 先验残差平方和
+} fit_rls_t;
+
 /**
  * @brief 预测函数
  *
@@ -59,6 +110,105 @@ float fit_predict(fit_cfg_t *cfg, fit_params_t params, int x);
  * @param cfg 含互逆函数对；例如 expf与logf
  * @param data 数据点数组
  * @param n 数据点数量
- * @return 拟合参数
+ * @return 拟合参数，r2 为原始空间 y 上的 R²
  */
 fit_params_t fit_training(fit_cfg_t *cfg, fit_data_t *data, uint32_t n);
+
+/**
+ * @brief 流式线性拟合初始化
+ *
+ * @param fit 拟合器指针
+ * @param cfg 线性化函数对（例如 expf 与 logf 拟合指数），NULL 为直线
+ * @param lambda 遗忘因子 0~1，1 不遗忘
+ */
+void fit_stream_init(fit_stream_t *fit, const fit_cfg_t *cfg, float lambda);
+
+/**
+ * @brief 流式线性拟合加入一个样本
+ *
+ * @param fit 拟合器指针
+ * @param x 自变量
+ * @param y 因变量（指数模型要求 y > 0）
+ */
+void fit_stream_update(fit_stream_t *fit, float x, float y);
+
+/**
+ * @brief 流式线性拟合当前结果
+ *
+ * @param fit 拟合器指针
+ * @return fit_params_t 直线：y = a + b*x；给 cfg 时：y = a * func(b*x)，r2 为 defunc(y) 上的 R²
+ */
+fit_params_t fit_stream_result(const fit_stream_t *fit);
+
+/**
+ * @brief 流式线性拟合预测
+ *
+ * @param fit 拟合器指针
+ * @param x 预测位置
+ * @return float 预测值
+ */
+float fit_stream_predict(const fit_stream_t *fit, float x);
+
+/**
+ * @brief 流式多项式拟合初始化
+ *
+ * @param fit 拟合器指针
+ * @param degree 阶数 0 ~ FIT_DEGREE_MAX
+ * @param lambda 遗忘因子 0~1，1 不遗忘
+ */
+void fit_poly_init(fit_poly_t *fit, uint8_t degree, float lambda);
+
+/**
+ * @brief 流式多项式拟合加入一个样本
+ *
+ * @param fit 拟合器指针
+ * @param x 自变量
+ * @param y 因变量
+ */
+void fit_poly_update(fit_poly_t *fit, float x, float y);
+
+/**
+ * @brief 求解正规方程，结果存入 fit->coeff 和 fit->r2
+ *
+ * @param fit 拟合器指针
+ * @return true 成功
+ * @return false 样本不足或矩阵奇异
+ */
+bool fit_poly_solve(fit_poly_t *fit);
+
+/**
+ * @brief 多项式预测（使用最近一次求解的结果）
+ *
+ * @param fit 拟合器指针
+ * @param x 预测位置
+ * @return float 预测值
+ */
+float fit_poly_predict(const fit_poly_t *fit, float x);
+
+/**
+ * @brief 递推最小二乘初始化
+ *
+ * @param fit 拟合器指针
+ * @param size 参数个数 1 ~ FIT_RLS_SIZE_MAX
+ * @param lambda 遗忘因子 0~1，1 不遗忘
+ * @param delta 协方差初值（越大初始收敛越快），常用 100 ~ 10000
+ */
+void fit_rls_init(fit_rls_t *fit, uint8_t size, float lambda, float delta);
+
+/**
+ * @brief 递推最小二乘加入一个样本 y = Σ theta[i] * phi[i]
+ *
+ * @param fit 拟合器指针
+ * @param phi 回归向量，size 个
+ * @param y 观测值
+ * @return float 先验预测误差
+ */
+float fit_rls_update(fit_rls_t *fit, const float *phi, float y);
+
+/**
+ * @brief 递推最小二乘的 R²（基于先验残差）
+ *
+ * @param fit 拟合器指针
+ * @return float R²
+ */
+float fit_rls_r2(const fit_rls_t *fit);
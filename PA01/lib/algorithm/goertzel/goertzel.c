@@ -0,0 +1,324 @@
+#include "./goertzel.h"
+#include <string.h>
+
+#define GOERTZEL_PI 3.14159265358979323846
+#define GOERTZEL_DAMPING 0.99999f // 滑动检测阻尼，抑制浮点误差累积
+
+bool goertzel_init(goertzel_t *goertzel)
+{
+    ASSERT(goertzel != NULL);
+
+    uint8_t size = goertzel->cfg.size;
+    if (size == 0 || goertzel->cfg.freqs == NULL || goertzel->cfg.block_size == 0 || goertzel->cfg.sample_rate <= 0)
+    {
+        ERROR("[%s] invalid config.", goertzel->cfg.name);
+        return false;
+    }
+
+    goertzel->flag.value = 0;
+    goertzel->coeff = (float *)MALLOC(size * sizeof(float));
+    goertzel->sinw = (float *)MALLOC(size * sizeof(float));
+    goertzel->cosw = (float *)MALLOC(size * sizeof(float));
+    goertzel->s1 = (float *)MALLOC(size * sizeof(float));
+    goertzel->s2 = (float *)MALLOC(size * sizeof(float));
+    goertzel->coeff_q = (int32_t *)MALLOC(size * sizeof(int32_t));
+    goertzel->s1_q = (int32_t *)MALLOC(size * sizeof(int32_t));
+    goertzel->s2_q = (int32_t *)MALLOC(size * sizeof(int32_t));
+    goertzel->shift_q = (uint8_t *)MALLOC(size * sizeof(uint8_t));
+    goertzel->amplitude = (float *)MALLOC(size * sizeof(float));
+    goertzel->phase = (float *)MALLOC(size * sizeof(float));
+    if (goertzel->coeff == NULL || goertzel->sinw == NULL || goertzel->cosw == NULL || goertzel->s1 == NULL ||
+        goertzel->s2 == NULL || goertzel->coeff_q == NULL || goertzel->s1_q == NULL || goertzel->s2_q == NULL ||
+        goertzel->shift_q == NULL || goertzel->amplitude == NULL || goertzel->phase == NULL)
+    {
+        ERROR("[%s] malloc failed.", goertzel->cfg.name);
+        goertzel_deinit(goertzel);
+        return false;
+    }
+
+    for (uint8_t i = 0; i < size; i++)
+    {
+        double w = 2.0 * GOERTZEL_PI * goertzel->cfg.freqs[i] / goertzel->cfg.sample_rate;
+        goertzel->coeff[i] = (float)(2.0 * cos(w));
+        goertzel->cosw[i] = (float)cos(w);
+        goertzel->sinw[i] = (float)sin(w);
+        goertzel->coeff_q[i] = (int32_t)llround(2.0 * cos(w) * (1 << 29)); // 2cos(w) ∈ [-2, 2]，Q29 不溢出
+
+        // 状态上界：|s[n]| <= 32768 * Σ min(j, 1/|sin w|)
+        double limit = (fabs(sin(w)) > 1e-9) ? 1.0 / fabs(sin(w)) : 1e18;
+        double bound = 0;
+        for (uint32_t j = 1; j <= goertzel->cfg.block_size; j++)
+        {
+            bound += (j < limit) ? j : limit;
+        }
+        bound *= 32768.0;
+        uint8_t shift = 0;
+        while (bound >= (double)(1u << 30) && shift < 15)
+        {
+            bound /= 2;
+            shift++;
+        }
+        goertzel->shift_q[i] = shift;
+        if (goertzel->cfg.is_fixed && bound >= (double)(1u << 30))
+        {
+            ERROR("[%s] block size %u too long for fixed point at %.1f Hz.", goertzel->cfg.name, goertzel->cfg.block_size, goertzel->cfg.freqs[i]);
+            goertzel_deinit(goertzel);
+            return false;
+        }
+    }
+
+    goertzel_reset(goertzel);
+    goertzel->flag.is_inited = true;
+    return true;
+}
+
+void goertzel_deinit(goertzel_t *goertzel)
+{
+    ASSERT(goertzel != NULL);
+
+    void **buffs[] = {
+        (void **)&goertzel->coeff, (void **)&goertzel->sinw, (void **)&goertzel->cosw, (void **)&goertzel->s1,
+        (void **)&goertzel->s2, (void **)&goertzel->coeff_q, (void **)&goertzel->s1_q, (void **)&goertzel->s2_q,
+        (void **)&goertzel->shift_q, (void **)&goertzel->amplitude, (void **)&goertzel->phase,
+    };
+    for (uint8_t i = 0; i < sizeof(buffs) / sizeof(buffs[0]); i++)
+    {
+        if (*buffs[i] != NULL)
+        {
+            FREE(*buffs[i]);
+            *buffs[i] = NULL;
+        }
+    }
+    goertzel->flag.value = 0;
+}
+
+void goertzel_reset(goertzel_t *goertzel)
+{
+    ASSERT(goertzel != NULL);
+
+    uint8_t size = goertzel->cfg.size;
+    memset(goertzel->s1, 0, size * sizeof(float));
+    memset(goertzel->s2, 0, size * sizeof(float));
+    memset(goertzel->s1_q, 0, size * sizeof(int32_t));
+    memset(goertzel->s2_q, 0, size * sizeof(int32_t));
+    memset(goertzel->amplitude, 0, size * sizeof(float));
+    memset(goertzel->phase, 0, size * sizeof(float));
+    goertzel->count = 0;
+    goertzel->blocks = 0;
+    goertzel->flag.is_ready = false;
+}
+
+// 块结束：由 s1、s2 求幅值和相位，清状态
+static void goertzel_block_finish(goertzel_t *goertzel)
+{
+    float N = goertzel->cfg.block_size;
+    for (uint8_t i = 0; i < goertzel->cfg.size; i++)
+    {
+        float s1, s2;
+        if (goertzel->cfg.is_fixed)
+        {
+            float scale = (float)(1u << goertzel->shift_q[i]) / 32768.0f;
+            s1 = goertzel->s1_q[i] * scale;
+            s2 = goertzel->s2_q[i] * scale;
+            goertzel->s1_q[i] = 0;
+            goertzel->s2_q[i] = 0;
+        }
+        else
+        {
+            s1 = goertzel->s1[i];
+            s2 = goertzel->s2[i];
+            goertzel->s1[i] = 0;
+            goertzel->s2[i] = 0;
+        }
+
+        // y = s1 - e^(-jw) * s2 = e^(jw(N-1)) * X(w)，相位换算到块起点
+        float real = s1 - goertzel->cosw[i] * s2;
+        float imag = goertzel->sinw[i] * s2;
+        float w = atan2f(goertzel->sinw[i], goertzel->cosw[i]);
+        float phase = fmodf(atan2f(imag, real) - w * (N - 1), 2.0f * (float)GOERTZEL_PI);
+        phase += (phase > (float)GOERTZEL_PI) ? -2.0f * (float)GOERTZEL_PI : ((phase < -(float)GOERTZEL_PI) ? 2.0f * (float)GOERTZEL_PI : 0.0f);
+        goertzel->amplitude[i] = 2.0f * sqrtf(real * real + imag * imag) / N;
+        goertzel->phase[i] = phase;
+    }
+    goertzel->count = 0;
+    goertzel->blocks++;
+    goertzel->flag.is_ready = true;
+}
+
+bool goertzel_feed(goertzel_t *goertzel, const float *input, uint32_t length, uint32_t stride)
+{
+    ASSERT(goertzel != NULL);
+    ASSERT(input != NULL);
+    ASSERT(!goertzel->cfg.is_fixed);
+
+    if (!goertzel->flag.is_inited)
+    {
+        return false;
+    }
+    stride = (stride == 0) ? 1 : stride;
+
+    bool is_updated = false;
+    uint8_t size = goertzel->cfg.size;
+    float *coeff = goertzel->coeff, *s1 = goertzel->s1, *s2 = goertzel->s2;
+    while (length > 0)
+    {
+        uint32_t n = goertzel->cfg.block_size - goertzel->count;
+        n = (n > length) ? length : n;
+        for (uint32_t k = 0; k < n; k++, input += stride)
+        {
+            float x = *input;
+            for (uint8_t i = 0; i < size; i++)
+            {
+                float s0 = x + coeff[i] * s1[i] - s2[i];
+                s2[i] = s1[i];
+                s1[i] = s0;
+            }
+        }
+        goertzel->count += n;
+        length -= n;
+
+        if (goertzel->count == goertzel->cfg.block_size)
+        {
+            goertzel_block_finish(goertzel);
+            is_updated = true;
+        }
+    }
+    return is_updated;
+}
+
+bool goertzel_feed_s16(goertzel_t *goertzel, const int16_t *input, uint32_t length, uint32_t stride)
+{
+    ASSERT(goertzel != NULL);
+    ASSERT(input != NULL);
+
+    if (!goertzel->flag.is_inited)
+    {
+        return false;
+    }
+    stride = (stride == 0) ? 1 : stride;
+
+    bool is_updated = false;
+    uint8_t size = goertzel->cfg.size;
+    while (length > 0)
+    {
+        uint32_t n = goertzel->cfg.block_size - goertzel->count;
+        n = (n > length) ? length : n;
+        if (goertzel->cfg.is_fixed)
+        {
+            int32_t *coeff = goertzel->coeff_q, *s1 = goertzel->s1_q, *s2 = goertzel->s2_q;
+            uint8_t *shift = goertzel->shift_q;
+            for (uint32_t k = 0; k < n; k++, input += stride)
+            {
+                int32_t x = *input;
+                for (uint8_t i = 0; i < size; i++)
+                {
+                    // 整式在 64 位中求和：coeff * s1 可达 2^31，与输入相加会越过 int32；
+                    // 乘积与输入都四舍五入，向下取整的 -0.5 LSB 偏置在近直流频点会被谐振放大
+                    int64_t acc = (((int64_t)coeff[i] * s1[i] + (1 << 28)) >> 29) - s2[i];
+                    acc += (shift[i] == 0) ? x : ((x + (1 << (shift[i] - 1))) >> shift[i]);
+                    s2[i] = s1[i];
+                    s1[i] = (int32_t)acc; // 由 shift 保证 |s| < 2^30
+                }
+            }
+        }
+        else
+        {
+            float *coeff = goertzel->coeff, *s1 = goertzel->s1, *s2 = goertzel->s2;
+            for (uint32_t k = 0; k < n; k++, input += stride)
+            {
+                float x = *input * (1.0f / 32768.0f);
+                for (uint8_t i = 0; i < size; i++)
+                {
+                    float s0 = x + coeff[i] * s1[i] - s2[i];
+                    s2[i] = s1[i];
+                    s1[i] = s0;
+                }
+            }
+        }
+        goertzel->count += n;
+        length -= n;
+
+        if (goertzel->count == goertzel->cfg.block_size)
+        {
+            goertzel_block_finish(goertzel);
+            is_updated = true;
+        }
+    }
+    return is_updated;
+}
+
+bool goertzel_sliding_init(goertzel_sliding_t *sliding)
+{
+    ASSERT(sliding != NULL);
+
+    uint16_t N = sliding->cfg.size;
+    if (N == 0 || sliding->cfg.sample_rate <= 0)
+    {
+        ERROR("[%s] invalid config.", sliding->cfg.name);
+        return false;
+    }
+    sliding->history = (float *)MALLOC(N * sizeof(float));
+    if (sliding->history == NULL)
+    {
+        ERROR("[%s] malloc failed.", sliding->cfg.name);
+        return false;
+    }
+    memset(sliding->history, 0, N * sizeof(float));
+
+    // 滑动DFT要求整数 bin：S[n] = r*e^(jw) * (S[n-1] + x[n] - r^N * x[n-N])
+    double k = round(sliding->cfg.freq * N / sliding->cfg.sample_rate);
+    double w = 2.0 * GOERTZEL_PI * k / N;
+    sliding->rotate_real = GOERTZEL_DAMPING * (float)cos(w);
+    sliding->rotate_imag = GOERTZEL_DAMPING * (float)sin(w);
+    sliding->damping_n = powf(GOERTZEL_DAMPING, N);
+    sliding->real = 0;
+    sliding->imag = 0;
+    sliding->idx = 0;
+    sliding->is_inited = true;
+    return true;
+}
+
+void goertzel_sliding_deinit(goertzel_sliding_t *sliding)
+{
+    ASSERT(sliding != NULL);
+
+    if (sliding->history != NULL)
+    {
+        FREE(sliding->history);
+        sliding->history = NULL;
+    }
+    sliding->is_inited = false;
+}
+
+float goertzel_sliding_feed(goertzel_sliding_t *sliding, const float *input, uint32_t length, float *amplitude)
+{
+    ASSERT(sliding != NULL);
+    ASSERT(input != NULL);
+
+    if (!sliding->is_inited)
+    {
+        return 0;
+    }
+
+    float scale = 2.0f / sliding->cfg.size;
+    float real = sliding->real, imag = sliding->imag;
+    for (uint32_t n = 0; n < length; n++)
+    {
+        float x = input[n];
+        float delta = x - sliding->damping_n * sliding->history[sliding->idx];
+        sliding->history[sliding->idx] = x;
+        sliding->idx = (sliding->idx + 1 == sliding->cfg.size) ? 0 : sliding->idx + 1;
+
+        real += delta;
+        float temp = real * sliding->rotate_real - imag * sliding->rotate_imag;
+        imag = real * sliding->rotate_imag + imag * sliding->rotate_real;
+        real = temp;
+        if (amplitude != NULL)
+        {
+            amplitude[n] = scale * sqrtf(real * real + imag * imag);
+        }
+    }
+    sliding->real = real;
+    sliding->imag = imag;
+    return scale * sqrtf(real * real + imag * imag);
+}
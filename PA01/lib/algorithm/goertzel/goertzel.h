@@ -0,0 +1,184 @@
+/**
+ * @file goertzel.h
+ * @author WittXie
+ * @brief Goertzel 多频点检测：块处理、多频点一次遍历、滑动检测、定点版本
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 只关心少数已知频率时比整段FFT省：每个频点每个样本一次乘加。
+ * 块检测：每凑满 block_size 个样本输出一次各频点幅值，频点不要求落在整数 bin 上。
+ * 多频点状态按数组连续存放，外层遍历样本、内层遍历频点，样本只读一次。
+ * 定点版本：int16 PCM 输入，Q29 系数，int32 状态 + 64 位乘加，乘积与输入四舍五入；
+ * 按频点估算状态上界，必要时输入先右移，保证 block_size 内不溢出；右移 15 位仍不够时初始化失败。
+ * 滑动检测：单频点滑动DFT，每个样本更新一次幅值，用于测量频点出现/消失的时刻。
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifndef ASSERT
+#define ASSERT(_bool, ...) ((void)0)
+#endif
+
+#ifndef MALLOC
+#define MALLOC(_size) malloc(_size)
+#define FREE(_pv) free(_pv)
+#endif
+
+#ifndef ERROR
+#define ERROR(_format, ...) ((void)0)
+#endif
+
+typedef struct __goertzel
+{
+    // 参数
+    struct
+    {
+        const char *name;    // 名称
+        float sample_rate;   // 采样率（Hz）
+        uint16_t block_size; // 块长（样本数），决定频率分辨率 fs/block_size
+        uint8_t size;        // 频点数
+        const float *freqs;  // 目标频率表（Hz），size 个
+        bool is_fixed;       // 使用定点版本（int16 输入）
+    } cfg;
+
+    // 标志
+    union
+    {
+        uint8_t value;
+        struct
+        {
+            bool is_inited : 1; // 是否已初始化
+            bool is_ready : 1;  // 是否已有结果
+        };
+    } flag;
+
+    float *coeff;     // 2cos(w)，size
+    float *sinw;      // sin(w)，size
+    float *cosw;      // cos(w)，size
+    float *s1;        // 状态 s[n-1]，size
+    float *s2;        // 状态 s[n-2]，size
+    int32_t *coeff_q; // 定点系数 Q29，size
+    int32_t *s1_q;    // 定点状态，size
+    int32_t *s2_q;    // 定点状态，size
+    uint8_t *shift_q; // 定点输入右移位数，防止状态溢出，size
+    float *amplitude; // 上一块各频点幅值（与输入同单位，int16 输入按满量程1.0），size
+    float *phase;     // 上一块各频点相位（弧度，相对块起点的余弦相位），size
+    uint16_t count;   // 当前块已有样本数
+    uint32_t blocks;  // 累计完成块数
+} goertzel_t;
+
+typedef struct __goertzel_sliding
+{
+    // 参数
+    struct
+    {
+        const char *name;  // 名称
+        float sample_rate; // 采样率（Hz）
+        uint16_t size;     // 窗长（样本数）
+        float freq;        // 目标频率（Hz），取最近的整数 bin
+    } cfg;
+
+    float *history;    // 最近 size 个样本
+    uint16_t idx;      // 最旧样本位置
+    float real, imag;  // 当前频点复数值
+    float rotate_real; // 每样本旋转因子 r*e^(jw) 实部
+    float rotate_imag; // 每样本旋转因子 r*e^(jw) 虚部
+    float damping_n;   // r^size
+    bool is_inited;    // 是否已初始化
+} goertzel_sliding_t;
+
+/**
+ * @brief 初始化，分配状态数组
+ *
+ * @param goertzel 检测器指针
+ * @return true 成功
+ * @return false 参数非法或内存不足
+ */
+bool goertzel_init(goertzel_t *goertzel);
+
+/**
+ * @brief 释放
+ *
+ * @param goertzel 检测器指针
+ */
+void goertzel_deinit(goertzel_t *goertzel);
+
+/**
+ * @brief 清空状态和结果
+ *
+ * @param goertzel 检测器指针
+ */
+void goertzel_reset(goertzel_t *goertzel);
+
+/**
+ * @brief 送入浮点样本
+ *
+ * @param goertzel 检测器指针
+ * @param input 样本
+ * @param length 样本个数
+ * @param stride 相邻样本间隔
+ * @return true 本次调用完成了至少一个块，amplitude 已更新
+ */
+bool goertzel_feed(goertzel_t *goertzel, const float *input, uint32_t length, uint32_t stride);
+
+/**
+ * @brief 送入 int16 PCM 样本（voice_t 的16位数据），定点版本走整数运算
+ *
+ * @param goertzel 检测器指针
+ * @param input 样本
+ * @param length 样本个数
+ * @param stride 相邻样本间隔（立体声交错取单声道）
+ * @return true 本次调用完成了至少一个块，amplitude 已更新
+ */
+bool goertzel_feed_s16(goertzel_t *goertzel, const int16_t *input, uint32_t length, uint32_t stride);
+
+/**
+ * @brief 频点幅值/相位/功率(dBFS)
+ *
+ * @param _goertzel 检测器指针
+ * @param _index 频点序号
+ */
+#define goertzel_amplitude(_goertzel, _index) ((_goertzel)->amplitude[_index])
+#define goertzel_phase(_goertzel, _index) ((_goertzel)->phase[_index])
+#define goertzel_dbfs(_goertzel, _index) (20.0f * log10f((_goertzel)->amplitude[_index] + 1e-9f))
+
+/**
+ * @brief 是否初始化/已有结果
+ *
+ * @param _goertzel 检测器指针
+ */
+#define goertzel_is_inited(_goertzel) ((_goertzel)->flag.is_inited)
+#define goertzel_is_ready(_goertzel) ((_goertzel)->flag.is_ready)
+
+/**
+ * @brief 初始化滑动检测
+ *
+ * @param sliding 滑动检测器指针
+ * @return true 成功
+ * @return false 参数非法或内存不足
+ */
+bool goertzel_sliding_init(goertzel_sliding_t *sliding);
+
+/**
+ * @brief 释放滑动检测
+ *
+ * @param sliding 滑动检测器指针
+ */
+void goertzel_sliding_deinit(goertzel_sliding_t *sliding);
+
+/**
+ * @brief 滑动检测送入样本
+ *
+ * @param sliding 滑动检测器指针
+ * @param input 样本
+ * @param length 样本个数
+ * @param amplitude 每个样本之后的幅值输出，length 个，可为NULL
+ * @return float 最后一个样本之后的幅值
+ */
+float goertzel_sliding_feed(goertzel_sliding_t *sliding, const float *input, uint32_t length, float *amplitude);
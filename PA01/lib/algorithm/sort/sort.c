@@ -1,107 +1,447 @@
-/**
- * @file sort.c
- * @author WittXie
- * @brief 堆排序（Heap Sort）实现
- * @version 0.1
- * @date 2024-08-27
- *
- * @copyright Copyright (c) 2024
- */
-
-#include "sort.h"
-#include <stdlib.h>
+#include "./sort.h"
 #include <string.h>
 
-// 数据类型对应的比较函数
-static int compare_uint8(const void *a, const void *b)
-{
-    return *(uint8_t *)a - *(uint8_t *)b;
-}
+#define SORT_INSERTION_SIZE 16 // 小于此长度用插入排序
 
-static int compare_int8(const void *a, const void *b)
-{
-    return *(int8_t *)a - *(int8_t *)b;
-}
+// 按类型展开：插入排序、堆排序、Hoare分区、内省排序、内省选择
+#define SORT_KERNEL_DEFINE_LINKAGE(_linkage, _name, _type, _less)                 \
+    static void sort_insertion_##_name(_type *a, uint32_t n)                      \
+    {                                                                             \
+        for (uint32_t i = 1; i < n; i++)                                          \
+        {                                                                         \
+            _type value = a[i];                                                   \
+            uint32_t j = i;                                                       \
+            while (j > 0 && _less(value, a[j - 1]))                               \
+            {                                                                     \
+                a[j] = a[j - 1];                                                  \
+                j--;                                                              \
+            }                                                                     \
+            a[j] = value;                                                         \
+        }                                                                         \
+    }                                                                             \
+    static void sort_sift_##_name(_type *a, uint32_t root, uint32_t n)            \
+    {                                                                             \
+        _type value = a[root];                                                    \
+        for (uint32_t child = 2 * root + 1; child < n; child = 2 * root + 1)      \
+        {                                                                         \
+            if (child + 1 < n && _less(a[child], a[child + 1]))                   \
+            {                                                                     \
+                child++;                                                          \
+            }                                                                     \
+            if (!_less(value, a[child]))                                          \
+            {                                                                     \
+                break;                                                            \
+            }                                                                     \
+            a[root] = a[child];                                                   \
+            root = child;                                                         \
+        }                                                                         \
+        a[root] = value;                                                          \
+    }                                                                             \
+    static void sort_heap_##_name(_type *a, uint32_t n)                           \
+    {                                                                             \
+        for (uint32_t i = n / 2; i > 0; i--)                                      \
+        {                                                                         \
+            sort_sift_##_name(a, i - 1, n);                                       \
+        }                                                                         \
+        for (uint32_t i = n - 1; i > 0; i--)                                      \
+        {                                                                         \
+            _type temp = a[0];                                                    \
+            a[0] = a[i];                                                          \
+            a[i] = temp;                                                          \
+            sort_sift_##_name(a, 0, i);                                           \
+        }                                                                         \
+    }                                                                             \
+    /* 三数取中后 Hoare 分区，返回 j：[0, j] <= pivot <= [j+1, n) */                         \
+    static uint32_t sort_partition_##_name(_type *a, uint32_t n)                  \
+    {                                                                             \
+        uint32_t mid = (n - 1) / 2;                                               \
+        _type temp;                                                               \
+        if (_less(a[mid], a[0]))                                                  \
+        {                                                                         \
+            temp = a[mid], a[mid] = a[0], a[0] = temp;                            \
+        }                                                                         \
+        if (_less(a[n - 1], a[mid]))                                              \
+        {                                                                         \
+            temp = a[mid], a[mid] = a[n - 1], a[n - 1] = temp;                    \
+            if (_less(a[mid], a[0]))                                              \
+            {                                                                     \
+                temp = a[mid], a[mid] = a[0], a[0] = temp;                        \
+            }                                                                     \
+        }                                                                         \
+        _type pivot = a[mid];                                                     \
+        int32_t i = -1, j = n;                                                    \
+        for (;;)                                                                  \
+        {                                                                         \
+            do                                                                    \
+            {                                                                     \
+                i++;                                                              \
+            } while (_less(a[i], pivot));                                         \
+            do                                                                    \
+            {                                                                     \
+                j--;                                                              \
+            } while (_less(pivot, a[j]));                                         \
+            if (i >= j)                                                           \
+            {                                                                     \
+                return j;                                                         \
+            }                                                                     \
+            temp = a[i], a[i] = a[j], a[j] = temp;                                \
+        }                                                                         \
+    }                                                                             \
+    static void sort_intro_##_name(_type *a, uint32_t n, uint32_t depth)          \
+    {                                                                             \
+        while (n > SORT_INSERTION_SIZE)                                           \
+        {                                                                         \
+            if (depth == 0)                                                       \
+            {                                                                     \
+                sort_heap_##_name(a, n);                                          \
+                return;                                                           \
+            }                                                                     \
+            depth--;                                                              \
+            uint32_t left = sort_partition_##_name(a, n) + 1;                     \
+            /* 递归短的一侧，循环长的一侧，栈深不超过 log2(n) */                                     \
+            if (left < n - left)                                                  \
+            {                                                                     \
+                sort_intro_##_name(a, left, depth);                               \
+                a += left;                                                        \
+                n -= left;                                                        \
+            }                                                                     \
+            else                                                                  \
+            {                                                                     \
+                sort_intro_##_name(a + left, n - left, depth);                    \
+                n = left;                                                         \
+            }                                                                     \
+        }                                                                         \
+        sort_insertion_##_name(a, n);                                             \
+    }                                                                             \
+    _linkage void sort_##_name(_type *array, uint32_t length)                     \
+    {                                                                             \
+        ASSERT(array != NULL || length == 0);                                     \
+        uint32_t depth = 0;                                                       \
+        for (uint32_t n = length; n > 1; n >>= 1)                                 \
+        {                                                                         \
+            depth += 2;                                                           \
+        }                                                                         \
+        sort_intro_##_name(array, length, depth);                                 \
+    }                                                                             \
+    _linkage _type sort_nth_##_name(_type *array, uint32_t length, uint32_t nth)  \
+    {                                                                             \
+        ASSERT(array != NULL);                                                    \
+        ASSERT(nth < length);                                                     \
+        _type *a = array;                                                         \
+        uint32_t n = length, k = nth, depth = 0;                                  \
+        for (uint32_t i = length; i > 1; i >>= 1)                                 \
+        {                                                                         \
+            depth += 2;                                                           \
+        }                                                                         \
+        while (n > SORT_INSERTION_SIZE)                                           \
+        {                                                                         \
+            if (depth == 0)                                                       \
+            {                                                                     \
+                sort_heap_##_name(a, n);                                          \
+                return array[nth];                                                \
+            }                                                                     \
+            depth--;                                                              \
+            uint32_t left = sort_partition_##_name(a, n) + 1;                     \
+            if (k < left)                                                         \
+            {                                                                     \
+                n = left;                                                         \
+            }                                                                     \
+            else                                                                  \
+            {                                                                     \
+                a += left;                                                        \
+                n -= left;                                                        \
+                k -= left;                                                        \
+            }                                                                     \
+        }                                                                         \
+        sort_insertion_##_name(a, n);                                             \
+        return array[nth];                                                        \
+    }                                                                             \
+    _linkage void sort_partial_##_name(_type *array, uint32_t length, uint32_t k) \
+    {                                                                             \
+        ASSERT(array != NULL);                                                    \
+        if (k == 0)                                                               \
+        {                                                                         \
+            return;                                                               \
+        }                                                                         \
+        if (k < length)                                                           \
+        {                                                                         \
+            sort_nth_##_name(array, length, k - 1);                               \
+        }                                                                         \
+        sort_##_name(array, (k < length) ? k - 1 : length);                       \
+    }
 
-static int compare_uint16(const void *a, const void *b)
-{
-    return *(uint16_t *)a - *(uint16_t *)b;
-}
+// 对外内核，声明见 sort.h 的 SORT_KERNEL_DECLARE
+#define SORT_KERNEL_DEFINE(_name, _type, _less) SORT_KERNEL_DEFINE_LINKAGE(, _name, _type, _less)
 
-static int compare_int16(const void *a, const void *b)
-{
-    return *(int16_t *)a - *(int16_t *)b;
-}
+// 本文件内部用的内核：static inline，不导出符号，没用到的 nth/partial 不产生未使用警告
+#define SORT_KERNEL_DEFINE_STATIC(_name, _type, _less) SORT_KERNEL_DEFINE_LINKAGE(static inline, _name, _type, _less)
 
-static int compare_uint32(const void *a, const void *b)
-{
-    return (*(uint32_t *)a > *(uint32_t *)b) - (*(uint32_t *)a < *(uint32_t *)b);
-}
+#define SORT_LESS(_a, _b) ((_a) < (_b))
 
-static int compare_int32(const void *a, const void *b)
-{
-    return (*(int32_t *)a > *(int32_t *)b) - (*(int32_t *)a < *(int32_t *)b);
-}
+SORT_KERNEL_DEFINE(u8, uint8_t, SORT_LESS)
+SORT_KERNEL_DEFINE(u16, uint16_t, SORT_LESS)
+SORT_KERNEL_DEFINE(u32, uint32_t, SORT_LESS)
+SORT_KERNEL_DEFINE(u64, uint64_t, SORT_LESS)
+SORT_KERNEL_DEFINE(i8, int8_t, SORT_LESS)
+SORT_KERNEL_DEFINE(i16, int16_t, SORT_LESS)
+SORT_KERNEL_DEFINE(i32, int32_t, SORT_LESS)
+SORT_KERNEL_DEFINE(i64, int64_t, SORT_LESS)
+SORT_KERNEL_DEFINE(f32, float, SORT_LESS)
+SORT_KERNEL_DEFINE(f64, double, SORT_LESS)
 
-static int compare_uint64(const void *a, const void *b)
-{
-    return (*(uint64_t *)a > *(uint64_t *)b) - (*(uint64_t *)a < *(uint64_t *)b);
-}
+// ---------------------------------------------------------------- 基数排序
 
-static int compare_int64(const void *a, const void *b)
-{
-    return (*(int64_t *)a > *(int64_t *)b) - (*(int64_t *)a < *(int64_t *)b);
-}
+// 计数排序，_bias 把有符号数映射到 0~255
+#define SORT_COUNTING_DEFINE(_name, _type, _bias)          \
+    void sort_radix_##_name(_type *array, uint32_t length) \
+    {                                                      \
+        ASSERT(array != NULL || length == 0);              \
+        uint32_t count[256] = {0};                         \
+        for (uint32_t i = 0; i < length; i++)              \
+        {                                                  \
+            count[(uint8_t)(array[i] + (_bias))]++;        \
+        }                                                  \
+        uint32_t index = 0;                                \
+        for (uint32_t v = 0; v < 256; v++)                 \
+        {                                                  \
+            for (uint32_t c = count[v]; c > 0; c--)        \
+            {                                              \
+                array[index++] = (_type)(v - (_bias));     \
+            }                                              \
+        }                                                  \
+    }
 
-static int compare_float(const void *a, const void *b)
-{
-    return (*(float *)a > *(float *)b) - (*(float *)a < *(float *)b);
-}
+SORT_COUNTING_DEFINE(u8, uint8_t, 0)
+SORT_COUNTING_DEFINE(i8, int8_t, 128)
 
-static int compare_double(const void *a, const void *b)
+// LSD 基数排序，每趟8位；_key 把元素映射为无符号有序键；全部落在同一个桶的趟跳过
+#define SORT_RADIX_DEFINE(_name, _type, _key)                                     \
+    void sort_radix_##_name(_type *array, uint32_t length, _type *buff)           \
+    {                                                                             \
+        ASSERT(array != NULL || length == 0);                                     \
+        ASSERT(buff != NULL || length == 0);                                      \
+        _type *src = array, *dst = buff;                                          \
+        for (uint8_t shift = 0; shift < sizeof(_type) * 8; shift += 8)            \
+        {                                                                         \
+            uint32_t count[256] = {0};                                            \
+            for (uint32_t i = 0; i < length; i++)                                 \
+            {                                                                     \
+                count[(uint8_t)(_key(src[i]) >> shift)]++;                        \
+            }                                                                     \
+            if (length == 0 || count[(uint8_t)(_key(src[0]) >> shift)] == length) \
+            {                                                                     \
+                continue;                                                         \
+            }                                                                     \
+            uint32_t offset = 0;                                                  \
+            for (uint32_t v = 0; v < 256; v++)                                    \
+            {                                                                     \
+                uint32_t c = count[v];                                            \
+                count[v] = offset;                                                \
+                offset += c;                                                      \
+            }                                                                     \
+            for (uint32_t i = 0; i < length; i++)                                 \
+            {                                                                     \
+                dst[count[(uint8_t)(_key(src[i]) >> shift)]++] = src[i];          \
+            }                                                                     \
+            _type *temp = src;                                                    \
+            src = dst;                                                            \
+            dst = temp;                                                           \
+        }                                                                         \
+        if (src != array)                                                         \
+        {                                                                         \
+            memcpy(array, src, length * sizeof(_type));                           \
+        }                                                                         \
+    }
+
+// 有序键：无符号原值；有符号翻转符号位；浮点正数翻转符号位、负数全部取反
+static inline uint32_t sort_key_f32(float value)
 {
-    return (*(double *)a > *(double *)b) - (*(double *)a < *(double *)b);
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
 }
+#define SORT_KEY_U16(_v) ((uint16_t)(_v))
+#define SORT_KEY_I16(_v) ((uint16_t)((uint16_t)(_v) ^ 0x8000u))
+#define SORT_KEY_U32(_v) ((uint32_t)(_v))
+#define SORT_KEY_I32(_v) ((uint32_t)(_v) ^ 0x80000000u)
+#define SORT_KEY_F32(_v) sort_key_f32(_v)
+
+SORT_RADIX_DEFINE(u16, uint16_t, SORT_KEY_U16)
+SORT_RADIX_DEFINE(i16, int16_t, SORT_KEY_I16)
+SORT_RADIX_DEFINE(u32, uint32_t, SORT_KEY_U32)
+SORT_RADIX_DEFINE(i32, int32_t, SORT_KEY_I32)
+SORT_RADIX_DEFINE(f32, float, SORT_KEY_F32)
+
+// ---------------------------------------------------------------- 分发
 
-// 堆排序主函数
 void sort(sort_data_type sdt, void *array, uint32_t length)
 {
-    ASSERT(length >= 2, "length = %u", length);
+    ASSERT(array != NULL || length == 0);
 
     switch (sdt)
     {
     case SORT_UINT8:
-        qsort(array, length, sizeof(uint8_t), compare_uint8); // 使用 qsort 对数组进行排序
+        sort_u8((uint8_t *)array, length);
         break;
     case SORT_UINT16:
-        qsort(array, length, sizeof(uint16_t), compare_uint16); // 使用 qsort 对数组进行排序
+        sort_u16((uint16_t *)array, length);
         break;
     case SORT_UINT32:
-        qsort(array, length, sizeof(uint32_t), compare_uint32); // 使用 qsort 对数组进行排序
+        sort_u32((uint32_t *)array, length);
         break;
     case SORT_UINT64:
-        qsort(array, length, sizeof(uint64_t), compare_uint64); // 使用 qsort 对数组进行排序
+        sort_u64((uint64_t *)array, length);
         break;
     case SORT_INT8:
-        qsort(array, length, sizeof(int8_t), compare_int8); // 使用 qsort 对数组进行排序
+        sort_i8((int8_t *)array, length);
         break;
     case SORT_INT16:
-        qsort(array, length, sizeof(int16_t), compare_int16); // 使用 qsort 对数组进行排序
+        sort_i16((int16_t *)array, length);
         break;
     case SORT_INT32:
-        qsort(array, length, sizeof(int32_t), compare_int32); // 使用 qsort 对数组进行排序
+        sort_i32((int32_t *)array, length);
         break;
     case SORT_INT64:
-        qsort(array, length, sizeof(int64_t), compare_int64); // 使用 qsort 对数组进行排序
+        sort_i64((int64_t *)array, length);
         break;
     case SORT_FLOAT:
-        qsort(array, length, sizeof(float), compare_float); // 使用 qsort 对数组进行排序
+        sort_f32((float *)array, length);
         break;
     case SORT_DOUBLE:
-        qsort(array, length, sizeof(double), compare_double); // 使用 qsort 对数组进行排序
+        sort_f64((double *)array, length);
         break;
     default:
         ASSERT(false);
         return;
     }
 }
+
+// ---------------------------------------------------------------- 结构体按字段排序
+
+// (有序键, 原下标)，比较键后比下标，保证稳定
+typedef struct
+{
+    uint64_t key;
+    uint32_t index;
+} sort_pair_t;
+
+// SORT_BY_KEY_BUFF_SIZE 按每对 16 字节计算
+typedef char sort_pair_size_check[(sizeof(sort_pair_t) == 2 * sizeof(uint64_t)) ? 1 : -1];
+
+#define SORT_PAIR_LESS(_a, _b) ((_a).key < (_b).key || ((_a).key == (_b).key && (_a).index < (_b).index))
+SORT_KERNEL_DEFINE_STATIC(pair, sort_pair_t, SORT_PAIR_LESS)
+
+// 字段映射为 uint64 有序键
+static uint64_t sort_field_key(sort_data_type sdt, const uint8_t *field)
+{
+    union
+    {
+        uint8_t u8;
+        uint16_t u16;
+        uint32_t u32;
+        uint64_t u64;
+        int8_t i8;
+        int16_t i16;
+        int32_t i32;
+        int64_t i64;
+        float f32;
+        double f64;
+    } value;
+    static const uint8_t sizes[] = {1, 2, 4, 8, 1, 2, 4, 8, 4, 8};
+    memcpy(&value, field, sizes[sdt]);
+
+    switch (sdt)
+    {
+    case SORT_UINT8:
+        return value.u8;
+    case SORT_UINT16:
+        return value.u16;
+    case SORT_UINT32:
+        return value.u32;
+    case SORT_UINT64:
+        return value.u64;
+    case SORT_INT8:
+        return (uint64_t)(int64_t)value.i8 ^ 0x8000000000000000ull;
+    case SORT_INT16:
+        return (uint64_t)(int64_t)value.i16 ^ 0x8000000000000000ull;
+    case SORT_INT32:
+        return (uint64_t)(int64_t)value.i32 ^ 0x8000000000000000ull;
+    case SORT_INT64:
+        return (uint64_t)value.i64 ^ 0x8000000000000000ull;
+    case SORT_FLOAT:
+        return sort_key_f32(value.f32);
+    case SORT_DOUBLE:
+        return (value.u64 & 0x8000000000000000ull) ? ~value.u64 : (value.u64 | 0x8000000000000000ull);
+    default:
+        ASSERT(false);
+        return 0;
+    }
+}
+
+bool sort_by_key_buff(sort_data_type sdt, void *array, uint32_t length, uint32_t size, uint32_t offset, void *buff)
+{
+    ASSERT(array != NULL || length == 0);
+    ASSERT(sdt <= SORT_DOUBLE);
+    ASSERT(size > 0);
+
+    if (length < 2)
+    {
+        return true;
+    }
+    if (buff == NULL)
+    {
+        return false;
+    }
+
+    sort_pair_t *pairs = (sort_pair_t *)buff;
+    uint8_t *temp = (uint8_t *)(pairs + length);
+    uint8_t *base = (uint8_t *)array;
+    for (uint32_t i = 0; i < length; i++)
+    {
+        pairs[i].key = sort_field_key(sdt, base + i * size + offset);
+        pairs[i].index = i;
+    }
+    sort_pair(pairs, length);
+
+    // 按置换环搬移：位置 i 应放原来的 pairs[i].index，每个环只用一个临时元素
+    for (uint32_t i = 0; i < length; i++)
+    {
+        if (pairs[i].index == i)
+        {
+            continue;
+        }
+        memcpy(temp, base + i * size, size);
+        uint32_t dst = i;
+        for (;;)
+        {
+            uint32_t src = pairs[dst].index;
+            pairs[dst].index = dst; // 标记已就位
+            if (src == i)
+            {
+                memcpy(base + dst * size, temp, size);
+                break;
+            }
+            memcpy(base + dst * size, base + src * size, size);
+            dst = src;
+        }
+    }
+
+    return true;
+}
+
+bool sort_by_key(sort_data_type sdt, void *array, uint32_t length, uint32_t size, uint32_t offset)
+{
+    if (length < 2)
+    {
+        return true;
+    }
+
+    void *buff = MALLOC(SORT_BY_KEY_BUFF_SIZE(length, size));
+    if (buff == NULL)
+    {
+        return false;
+    }
+    bool is_ok = sort_by_key_buff(sdt, array, length, size, offset, buff);
+    FREE(buff);
+    return is_ok;
+}
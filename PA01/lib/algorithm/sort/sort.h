@@ -1,9 +1,16 @@
 /**
  * @file sort.h
  * @author WittXie
- * @brief 快速排序
- * @version 0.1
+ * @brief 排序与选择：按类型展开的内省排序、LSD基数排序、第k小/部分排序、结构体按字段排序
+ * @version 0.2
  * @date 2024-08-27
+ * @note
+ * 每种元素类型由 SORT_KERNEL_DECLARE 展开一组函数，比较直接内联为 <，没有函数指针和减法溢出：
+ * - sort_<t>         : 内省排序，快排(三数取中) + 深度超限转堆排序 + 16个以内插入排序，O(n log n) 最坏
+ * - sort_nth_<t>     : 第 nth 小元素就位，左侧不大于、右侧不小于，平均 O(n)，用于中位数/百分位
+ * - sort_partial_<t> : 前 k 个最小元素升序排好，其余顺序不定
+ * 基数排序 sort_radix_<t> 适用于 8/16/32 位键，稳定，需要与数组等长的缓存（8位为计数排序，不需要）。
+ * 浮点的 NaN 不参与比较，位置不定。
  *
  * @copyright Copyright (c) 2024
  */
@@ -12,11 +19,17 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdlib.h>
 
 #ifndef ASSERT
 #define ASSERT(_bool, ...) ((void)0)
 #endif
 
+#ifndef MALLOC
+#define MALLOC(_size) malloc(_size)
+#define FREE(_pv) free(_pv)
+#endif
+
 typedef enum
 {
     SORT_UINT8 = 0,
@@ -31,5 +44,73 @@ typedef enum
     SORT_DOUBLE,
 } sort_data_type;
 
-// 快速排序函数
+// 按类型声明排序/选择函数
+#define SORT_KERNEL_DECLARE(_name, _type)                                 \
+    void sort_##_name(_type *array, uint32_t length);                     \
+    _type sort_nth_##_name(_type *array, uint32_t length, uint32_t nth);  \
+    void sort_partial_##_name(_type *array, uint32_t length, uint32_t k);
+
+SORT_KERNEL_DECLARE(u8, uint8_t)
+SORT_KERNEL_DECLARE(u16, uint16_t)
+SORT_KERNEL_DECLARE(u32, uint32_t)
+SORT_KERNEL_DECLARE(u64, uint64_t)
+SORT_KERNEL_DECLARE(i8, int8_t)
+SORT_KERNEL_DECLARE(i16, int16_t)
+SORT_KERNEL_DECLARE(i32, int32_t)
+SORT_KERNEL_DECLARE(i64, int64_t)
+SORT_KERNEL_DECLARE(f32, float)
+SORT_KERNEL_DECLARE(f64, double)
+
+/**
+ * @brief 基数排序（LSD，稳定）
+ *
+ * @param array 数组
+ * @param length 长度
+ * @param buff 缓存，length 个元素（8位版本不需要）
+ */
+void sort_radix_u8(uint8_t *array, uint32_t length);
+void sort_radix_i8(int8_t *array, uint32_t length);
+void sort_radix_u16(uint16_t *array, uint32_t length, uint16_t *buff);
+void sort_radix_i16(int16_t *array, uint32_t length, int16_t *buff);
+void sort_radix_u32(uint32_t *array, uint32_t length, uint32_t *buff);
+void sort_radix_i32(int32_t *array, uint32_t length, int32_t *buff);
+void sort_radix_f32(float *array, uint32_t length, float *buff);
+
+/**
+ * @brief 按类型排序
+ *
+ * @param sdt 数据类型
+ * @param array 数组
+ * @param length 长度
+ */
 void sort(sort_data_type sdt, void *array, uint32_t length);
+
+/**
+ * @brief 结构体数组按字段升序排序（稳定），先对 (键, 下标) 排序再按置换环原地搬移结构体
+ *
+ * @param sdt 字段类型
+ * @param array 结构体数组
+ * @param length 元素个数
+ * @param size 结构体大小 sizeof
+ * @param offset 字段偏移 offsetof
+ * @return true 成功
+ * @return false 内存不足
+ */
+bool sort_by_key(sort_data_type sdt, void *array, uint32_t length, uint32_t size, uint32_t offset);
+
+// sort_by_key_buff 的工作区：每个元素一个 (有序键, 原下标) 对 + 一个暂存结构体
+#define SORT_BY_KEY_BUFF_SIZE(_length, _size) ((_length) * 2u * sizeof(uint64_t) + (_size))
+
+/**
+ * @brief 同 sort_by_key，工作区由调用者提供，周期调用时避免反复申请释放
+ *
+ * @param sdt 字段类型
+ * @param array 结构体数组
+ * @param length 元素个数
+ * @param size 结构体大小 sizeof
+ * @param offset 字段偏移 offsetof
+ * @param buff 工作区，至少 SORT_BY_KEY_BUFF_SIZE(length, size) 字节，8 字节对齐（malloc 返回值即可）
+ * @return true 成功
+ * @return false 工作区为 NULL
+ */
+bool sort_by_key_buff(sort_data_type sdt, void *array, uint32_t length, uint32_t size, uint32_t offset, void *buff);
@@ -0,0 +1,320 @@
+#include "./spectrum.h"
+#include <string.h>
+
+// 主瓣半宽（频点数）
+static uint16_t spectrum_lobe_get(spectrum_t *spectrum)
+{
+    switch (spectrum->cfg.window)
+    {
+    case SPECTRUM_WINDOW_HANN:
+        return 2;
+    case SPECTRUM_WINDOW_BLACKMAN:
+        return 3;
+    default:
+        return 1;
+    }
+}
+
+// 释放缓存，未分配的为 NULL
+static void spectrum_buff_free(spectrum_t *spectrum)
+{
+    float **buffs[] = {&spectrum->window, &spectrum->frame, (float **)&spectrum->work, &spectrum->sum, &spectrum->psd};
+    for (uint8_t i = 0; i < sizeof(buffs) / sizeof(buffs[0]); i++)
+    {
+        if (*buffs[i] != NULL)
+        {
+            FREE(*buffs[i]);
+            *buffs[i] = NULL;
+        }
+    }
+}
+
+bool spectrum_init(spectrum_t *spectrum)
+{
+    ASSERT(spectrum != NULL);
+
+    uint16_t N = spectrum->cfg.size;
+    if (N < 8 || (N & (N - 1)) != 0 || spectrum->cfg.sample_rate <= 0)
+    {
+        ERROR("[%s] invalid size %u.", spectrum->cfg.name, N);
+        return false;
+    }
+    if (spectrum->cfg.average == 0)
+    {
+        spectrum->cfg.average = 1;
+    }
+
+    spectrum->flag.value = 0;
+    spectrum->window = (float *)MALLOC(N * sizeof(float));
+    spectrum->frame = (float *)MALLOC(N * sizeof(float));
+    spectrum->work = (complex_t *)MALLOC((N / 2 + 1) * sizeof(complex_t));
+    spectrum->sum = (float *)MALLOC((N / 2 + 1) * sizeof(float));
+    spectrum->psd = (float *)MALLOC((N / 2 + 1) * sizeof(float));
+    if (spectrum->window == NULL || spectrum->frame == NULL || spectrum->work == NULL ||
+        spectrum->sum == NULL || spectrum->psd == NULL)
+    {
+        ERROR("[%s] malloc failed.", spectrum->cfg.name);
+        spectrum_buff_free(spectrum);
+        return false;
+    }
+    if (!fft_real_init(&spectrum->fft, N)) // 失败时自行释放已生成的表
+    {
+        ERROR("[%s] fft init failed.", spectrum->cfg.name);
+        spectrum_buff_free(spectrum);
+        return false;
+    }
+
+    // 周期窗：重叠50%时相邻段窗和为常数
+    double power = 0;
+    for (uint16_t i = 0; i < N; i++)
+    {
+        double phase = 2.0 * 3.14159265358979323846 * i / N;
+        double w;
+        switch (spectrum->cfg.window)
+        {
+        case SPECTRUM_WINDOW_HANN:
+            w = 0.5 - 0.5 * cos(phase);
+            break;
+        case SPECTRUM_WINDOW_BLACKMAN:
+            w = 0.42 - 0.5 * cos(phase) + 0.08 * cos(2.0 * phase);
+            break;
+        default:
+            w = 1.0;
+            break;
+        }
+        spectrum->window[i] = (float)w;
+        power += w * w;
+    }
+    spectrum->scale = (float)(1.0 / (spectrum->cfg.sample_rate * power));
+
+    spectrum_reset(spectrum);
+    spectrum->flag.is_inited = true;
+    return true;
+}
+
+void spectrum_deinit(spectrum_t *spectrum)
+{
+    ASSERT(spectrum != NULL);
+
+    if (!spectrum->flag.is_inited)
+    {
+        return; // 未初始化成功时 fft 与缓存都不归本模块所有
+    }
+    spectrum_buff_free(spectrum);
+    fft_real_deinit(&spectrum->fft);
+    spectrum->flag.value = 0;
+}
+
+void spectrum_reset(spectrum_t *spectrum)
+{
+    ASSERT(spectrum != NULL);
+
+    spectrum->fill = 0;
+    spectrum->count = 0;
+    spectrum->frames = 0;
+    spectrum->flag.is_ready = false;
+    memset(spectrum->sum, 0, (spectrum->cfg.size / 2 + 1) * sizeof(float));
+    memset(spectrum->psd, 0, (spectrum->cfg.size / 2 + 1) * sizeof(float));
+}
+
+// 处理一整段：加窗 -> 实数FFT -> 累加单边功率
+static bool spectrum_frame_process(spectrum_t *spectrum)
+{
+    uint16_t N = spectrum->cfg.size;
+    uint16_t half = N / 2;
+    float *buff = (float *)spectrum->work;
+
+    float mean = 0;
+    if (spectrum->cfg.is_remove_dc)
+    {
+        for (uint16_t i = 0; i < N; i++)
+        {
+            mean += spectrum->frame[i];
+        }
+        mean /= N;
+    }
+    for (uint16_t i = 0; i < N; i++)
+    {
+        buff[i] = (spectrum->frame[i] - mean) * spectrum->window[i];
+    }
+    fft_real_forward(&spectrum->fft, buff, spectrum->work);
+
+    // 单边谱：除直流和奈奎斯特外乘2
+    for (uint16_t k = 0; k <= half; k++)
+    {
+        float power = spectrum->work[k].real * spectrum->work[k].real + spectrum->work[k].imag * spectrum->work[k].imag;
+        spectrum->sum[k] += (k == 0 || k == half) ? power : 2.0f * power;
+    }
+    spectrum->frames++;
+
+    // 50%重叠：后一半移到前面
+    memcpy(spectrum->frame, spectrum->frame + half, half * sizeof(float));
+    spectrum->fill = half;
+
+    if (++spectrum->count < spectrum->cfg.average)
+    {
+        return false;
+    }
+
+    float scale = spectrum->scale / spectrum->count;
+    for (uint16_t k = 0; k <= half; k++)
+    {
+        spectrum->psd[k] = spectrum->sum[k] * scale;
+        spectrum->sum[k] = 0;
+    }
+    spectrum->count = 0;
+    spectrum->flag.is_ready = true;
+    return true;
+}
+
+bool spectrum_feed(spectrum_t *spectrum, const float *input, uint32_t length, uint32_t stride)
+{
+    ASSERT(spectrum != NULL);
+    ASSERT(input != NULL);
+
+    if (!spectrum->flag.is_inited)
+    {
+        return false;
+    }
+    if (stride == 0)
+    {
+        stride = 1;
+    }
+
+    bool is_updated = false;
+    uint16_t N = spectrum->cfg.size;
+    while (length > 0)
+    {
+        uint32_t n = N - spectrum->fill;
+        if (n > length)
+        {
+            n = length;
+        }
+        float *dst = spectrum->frame + spectrum->fill;
+        for (uint32_t i = 0; i < n; i++, input += stride)
+        {
+            dst[i] = *input;
+        }
+        spectrum->fill += n;
+        length -= n;
+
+        if (spectrum->fill == N)
+        {
+            is_updated |= spectrum_frame_process(spectrum);
+        }
+    }
+    return is_updated;
+}
+
+// 频率转频点，限幅到 0 ~ size/2
+static uint16_t spectrum_freq_to_bin(spectrum_t *spectrum, float freq)
+{
+    float bin = freq * spectrum->cfg.size / spectrum->cfg.sample_rate + 0.5f;
+    if (bin < 0)
+    {
+        return 0;
+    }
+    if (bin > spectrum->cfg.size / 2)
+    {
+        return spectrum->cfg.size / 2;
+    }
+    return (uint16_t)bin;
+}
+
+// 频点区间能量 [low, high]
+static float spectrum_bin_energy(spectrum_t *spectrum, int32_t low, int32_t high)
+{
+    int32_t half = spectrum->cfg.size / 2;
+    low = (low < 0) ? 0 : low;
+    high = (high > half) ? half : high;
+
+    float energy = 0;
+    for (int32_t k = low; k <= high; k++)
+    {
+        energy += spectrum->psd[k];
+    }
+    return energy * spectrum->cfg.sample_rate / spectrum->cfg.size;
+}
+
+float spectrum_band_energy(spectrum_t *spectrum, float freq_low, float freq_high)
+{
+    ASSERT(spectrum != NULL);
+
+    if (!spectrum->flag.is_ready)
+    {
+        return 0;
+    }
+    return spectrum_bin_energy(spectrum, spectrum_freq_to_bin(spectrum, freq_low), spectrum_freq_to_bin(spectrum, freq_high));
+}
+
+float spectrum_peak(spectrum_t *spectrum, float freq_low, float freq_high, float *freq)
+{
+    ASSERT(spectrum != NULL);
+
+    if (!spectrum->flag.is_ready)
+    {
+        return 0;
+    }
+
+    // 找最大频点，跳过直流
+    uint16_t low = spectrum_freq_to_bin(spectrum, freq_low);
+    uint16_t high = spectrum_freq_to_bin(spectrum, freq_high);
+    low = (low == 0) ? 1 : low;
+    uint16_t peak = low;
+    for (uint16_t k = low; k <= high; k++)
+    {
+        if (spectrum->psd[k] > spectrum->psd[peak])
+        {
+            peak = k;
+        }
+    }
+
+    // 主瓣能量和重心
+    int32_t lobe = spectrum_lobe_get(spectrum);
+    int32_t half = spectrum->cfg.size / 2;
+    float energy = 0, moment = 0;
+    for (int32_t k = peak - lobe; k <= peak + lobe; k++)
+    {
+        if (k >= 0 && k <= half)
+        {
+            energy += spectrum->psd[k];
+            moment += spectrum->psd[k] * k;
+        }
+    }
+    if (energy <= 0)
+    {
+        return 0;
+    }
+    if (freq != NULL)
+    {
+        *freq = spectrum_bin_freq(spectrum, moment / energy);
+    }
+    return sqrtf(2.0f * energy * spectrum->cfg.sample_rate / spectrum->cfg.size);
+}
+
+float spectrum_thd(spectrum_t *spectrum, float fundamental, uint8_t harmonics)
+{
+    ASSERT(spectrum != NULL);
+
+    if (!spectrum->flag.is_ready || fundamental <= 0)
+    {
+        return 0;
+    }
+
+    int32_t lobe = spectrum_lobe_get(spectrum);
+    float nyquist = spectrum->cfg.sample_rate / 2;
+    int32_t bin = spectrum_freq_to_bin(spectrum, fundamental);
+    float base = spectrum_bin_energy(spectrum, bin - lobe, bin + lobe);
+    if (base <= 0)
+    {
+        return 0;
+    }
+
+    float distortion = 0;
+    for (uint8_t h = 2; h <= harmonics && fundamental * h < nyquist; h++)
+    {
+        bin = spectrum_freq_to_bin(spectrum, fundamental * h);
+        distortion += spectrum_bin_energy(spectrum, bin - lobe, bin + lobe);
+    }
+    return sqrtf(distortion / base);
+}
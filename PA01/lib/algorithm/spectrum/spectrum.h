@@ -0,0 +1,162 @@
+/**
+ * @file spectrum.h
+ * @author WittXie
+ * @brief 流式频谱分析：加窗、50%重叠、Welch平均，提取峰值/THD/频带能量
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 基于 lib/algorithm/fft 的实数FFT，所有缓存在初始化时一次分配，运行中不再申请内存。
+ * 样本按块送入（支持交错数据的步长），每凑满 size 点做一次加窗FFT，之后保留后一半继续（50%重叠）；
+ * 累积 average 段后输出一次单边功率谱密度 psd（单位²/Hz），并开始下一轮平均。
+ * 每 size/2 个新样本做一次 size 点实数FFT，只要单次FFT耗时小于 size/2 个采样周期即可实时跟上。
+ *
+ * 幅值关系：频带能量 = Σ psd * df，即该频带内信号的方差；正弦幅值 A 的主瓣能量为 A²/2。
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "./../fft/fft.h"
+
+#ifndef ASSERT
+#define ASSERT(_bool, ...) ((void)0)
+#endif
+
+#ifndef MALLOC
+#define MALLOC(_size) malloc(_size)
+#define FREE(_pv) free(_pv)
+#endif
+
+#ifndef ERROR
+#define ERROR(_format, ...) ((void)0)
+#endif
+
+// 窗函数
+enum spectrum_window
+{
+    SPECTRUM_WINDOW_RECT = 0, // 矩形窗，主瓣半宽1
+    SPECTRUM_WINDOW_HANN,     // 汉宁窗，主瓣半宽2
+    SPECTRUM_WINDOW_BLACKMAN, // 布莱克曼窗，主瓣半宽3
+};
+
+typedef struct __spectrum
+{
+    // 参数
+    struct
+    {
+        const char *name;  // 名称
+        uint16_t size;     // FFT点数，2的幂
+        float sample_rate; // 采样率（Hz）
+        uint8_t window;    // 窗函数 enum spectrum_window
+        uint16_t average;  // Welch平均段数
+        bool is_remove_dc; // 每段先去均值（去掉重力/偏置）
+    } cfg;
+
+    // 标志
+    union
+    {
+        uint8_t value;
+        struct
+        {
+            bool is_inited : 1; // 是否已初始化
+            bool is_ready : 1;  // 是否已有平均结果
+        };
+    } flag;
+
+    fft_real_t fft;     // 实数FFT
+    float *window;      // 窗系数，size
+    float *frame;       // 当前段样本，size
+    complex_t *work;    // FFT工作区，size/2+1
+    float *sum;         // 功率累加，size/2+1
+    float *psd;         // 平均后的功率谱密度，size/2+1
+    float scale;        // 功率谱归一化系数 1/(fs*Σw²)
+    uint16_t fill;      // 当前段已有样本数
+    uint16_t count;     // 本轮已累加段数
+    uint32_t frames;    // 累计处理段数
+} spectrum_t;
+
+/**
+ * @brief 初始化，分配全部缓存
+ *
+ * @param spectrum 分析器指针
+ * @return true 成功
+ * @return false 参数非法或内存不足
+ */
+bool spectrum_init(spectrum_t *spectrum);
+
+/**
+ * @brief 释放缓存
+ *
+ * @param spectrum 分析器指针
+ */
+void spectrum_deinit(spectrum_t *spectrum);
+
+/**
+ * @brief 清空样本和平均结果
+ *
+ * @param spectrum 分析器指针
+ */
+void spectrum_reset(spectrum_t *spectrum);
+
+/**
+ * @brief 送入一块样本
+ *
+ * @param spectrum 分析器指针
+ * @param input 样本
+ * @param length 样本个数
+ * @param stride 相邻样本间隔（交错的多轴数据取其中一轴）
+ * @return true 本次调用产生了新的平均结果
+ */
+bool spectrum_feed(spectrum_t *spectrum, const float *input, uint32_t length, uint32_t stride);
+
+/**
+ * @brief 频点对应频率
+ *
+ * @param spectrum 分析器指针
+ * @param bin 频点 0 ~ size/2
+ * @return float 频率（Hz）
+ */
+#define spectrum_bin_freq(_spectrum, _bin) ((float)(_bin) * (_spectrum)->cfg.sample_rate / (_spectrum)->cfg.size)
+
+/**
+ * @brief 频带能量（方差），频带边界按频点取整
+ *
+ * @param spectrum 分析器指针
+ * @param freq_low 下限（Hz）
+ * @param freq_high 上限（Hz）
+ * @return float 能量，开方即频带内有效值
+ */
+float spectrum_band_energy(spectrum_t *spectrum, float freq_low, float freq_high);
+
+/**
+ * @brief 在频率范围内找最大峰，主瓣能量重心插值频率
+ *
+ * @param spectrum 分析器指针
+ * @param freq_low 搜索下限（Hz）
+ * @param freq_high 搜索上限（Hz）
+ * @param freq 输出峰值频率（Hz），可为NULL
+ * @return float 峰值正弦幅值，无结果返回0
+ */
+float spectrum_peak(spectrum_t *spectrum, float freq_low, float freq_high, float *freq);
+
+/**
+ * @brief 总谐波失真：sqrt(Σ谐波能量) / 基波幅值
+ *
+ * @param spectrum 分析器指针
+ * @param fundamental 基波频率（Hz），可用 spectrum_peak 的结果
+ * @param harmonics 计入的最高谐波次数（2 ~ ），超过奈奎斯特频率的自动忽略
+ * @return float THD（比值，乘100为百分比）
+ */
+float spectrum_thd(spectrum_t *spectrum, float fundamental, uint8_t harmonics);
+
+/**
+ * @brief 是否初始化/已有结果
+ *
+ * @param _spectrum 分析器指针
+ */
+#define spectrum_is_inited(_spectrum) ((_spectrum)->flag.is_inited)
+#define spectrum_is_ready(_spectrum) ((_spectrum)->flag.is_ready)
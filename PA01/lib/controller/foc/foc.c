@@ -2,54 +2,160 @@
 #include <stdlib.h>
 
 // 初始化FOC控制器
-void foc_init(foc_t *foc,
-              float kp_d, float ki_d, float kd_d,
-              float kp_q, float ki_q, float kd_q,
-              float output_limit)
+void foc_init(foc_t *foc, float vbus)
 {
     ASSERT(foc != NULL);
+    ASSERT(foc->cfg.ts > 0);
 
-    // 初始化d轴PID控制器
-    pid_init(&foc->id_pid, kp_d, ki_d, kd_d, 0, output_limit);
+    if (foc->cfg.bandwidth > 0)
+    {
+        // 零极点对消：PI零点 ki/kp = R/L 抵消电气极点，闭环为一阶、带宽 ωc
+        float wc = TRIG_LUT_2PI * foc->cfg.bandwidth;
+        foc->cfg.kp_d = wc * foc->cfg.ld;
+        foc->cfg.ki_d = wc * foc->cfg.rs;
+        foc->cfg.kp_q = wc * foc->cfg.lq;
+        foc->cfg.ki_q = wc * foc->cfg.rs;
+    }
+    if (foc->cfg.modulation_max <= 0 || foc->cfg.modulation_max > 1.0f)
+    {
+        foc->cfg.modulation_max = 1.0f;
+    }
 
-    // 初始化q轴PID控制器
-    pid_init(&foc->iq_pid, kp_q, ki_q, kd_q, 0, output_limit);
-
-    // 初始化其他参数
+    foc->id_pi.kp = foc->cfg.kp_d;
+    foc->id_pi.ki = foc->cfg.ki_d;
+    foc->iq_pi.kp = foc->cfg.kp_q;
+    foc->iq_pi.ki = foc->cfg.ki_q;
+    foc->vbus = vbus;
     foc->theta = 0;
     foc->speed = 0;
-    foc->vd = 0;
-    foc->vq = 0;
-    foc->id = 0;
-    foc->iq = 0;
+    foc->id_ref = 0;
+    foc->iq_ref = 0;
+    foc_reset(foc);
+    foc->flag.is_inited = true;
+}
+
+// 清零积分与输出
+void foc_reset(foc_t *foc)
+{
+    ASSERT(foc != NULL);
+    foc->id_pi.integral = 0;
+    foc->iq_pi.integral = 0;
+    foc->i_alpha = foc->i_beta = 0;
+    foc->id = foc->iq = 0;
+    foc->vd = foc->vq = 0;
+    foc->v_alpha = foc->v_beta = 0;
+    foc->duty[0] = foc->duty[1] = foc->duty[2] = 0.5f;
+    foc->sector = 1;
+    foc->flag.is_saturated = false;
 }
 
-// 更新FOC控制器
-void foc_update(foc_t *foc,
-                float id_ref, float iq_ref,
-                float id_meas, float iq_meas)
+// 设置电机角度和速度
+void foc_set_theta_speed(foc_t *foc, float theta, float speed)
 {
     ASSERT(foc != NULL);
+    foc->theta = theta;
+    foc->speed = speed;
+}
 
-    // 更新d轴PID控制器
-    foc->id_pid.setpoint = id_ref;
-    foc->vd = pid_update(&foc->id_pid, id_meas);
+// 设置电流给定
+void foc_set_current(foc_t *foc, float id_ref, float iq_ref)
+{
+    ASSERT(foc != NULL);
+    foc->id_ref = id_ref;
+    foc->iq_ref = iq_ref;
+}
+
+// 设置母线电压
+void foc_set_vbus(foc_t *foc, float vbus)
+{
+    ASSERT(foc != NULL);
+    foc->vbus = vbus;
+}
+
+// PI 积分：反算法抗饱和，u 为限幅前输出，u_sat 为限幅后输出
+static inline void foc_pi_integrate(foc_pi_t *pi, float error, float u, float u_sat, float ts)
+{
+    float back = (pi->kp > 0) ? (pi->ki / pi->kp) * (u_sat - u) : 0;
+    pi->integral += ts * (pi->ki * error + back);
+}
 
-    // 更新q轴PID控制器
-    foc->iq_pid.setpoint = iq_ref;
-    foc->vq = pid_update(&foc->iq_pid, iq_meas);
+// 只运行d/q电流PI
+void foc_update(foc_t *foc, float id_meas, float iq_meas)
+{
+    ASSERT(foc != NULL);
 
-    // 更新d轴和q轴电流
     foc->id = id_meas;
     foc->iq = iq_meas;
+    float ed = foc->id_ref - id_meas;
+    float eq = foc->iq_ref - iq_meas;
+
+    // PI + 解耦前馈
+    float vd = foc->id_pi.kp * ed + foc->id_pi.integral;
+    float vq = foc->iq_pi.kp * eq + foc->iq_pi.integral;
+    if (foc->cfg.is_decouple)
+    {
+        vd -= foc->speed * foc->cfg.lq * iq_meas;
+        vq += foc->speed * (foc->cfg.ld * id_meas + foc->cfg.flux);
+    }
+
+    // 圆形限幅，d 轴优先
+    float v_max = foc->vbus * FOC_INV_SQRT3 * foc->cfg.modulation_max;
+    float vd_sat = (vd > v_max) ? v_max : ((vd < -v_max) ? -v_max : vd);
+    float vq_max = sqrtf(v_max * v_max - vd_sat * vd_sat);
+    float vq_sat = (vq > vq_max) ? vq_max : ((vq < -vq_max) ? -vq_max : vq);
+    foc->flag.is_saturated = (vd_sat != vd) || (vq_sat != vq);
+
+    foc_pi_integrate(&foc->id_pi, ed, vd, vd_sat, foc->cfg.ts);
+    foc_pi_integrate(&foc->iq_pi, eq, vq, vq_sat, foc->cfg.ts);
+    foc->vd = vd_sat;
+    foc->vq = vq_sat;
 }
 
-// 设置电机角度和速度
-void foc_set_theta_speed(foc_t *foc, float theta, float speed)
+// 完整电流环一步
+void foc_step(foc_t *foc, float ia, float ib)
 {
     ASSERT(foc != NULL);
-    foc->theta = theta;
-    foc->speed = speed;
+
+    float s, c;
+    trig_lut_sincos(foc->theta, &s, &c);
+
+    // Clarke（等幅值）
+    foc->i_alpha = ia;
+    foc->i_beta = (ia + 2.0f * ib) * FOC_INV_SQRT3;
+
+    // Park
+    float id = foc->i_alpha * c + foc->i_beta * s;
+    float iq = foc->i_beta * c - foc->i_alpha * s;
+
+    foc_update(foc, id, iq);
+
+    // 反Park
+    foc->v_alpha = foc->vd * c - foc->vq * s;
+    foc->v_beta = foc->vd * s + foc->vq * c;
+
+    // 反Clarke 得相电压
+    float va = foc->v_alpha;
+    float vb = -0.5f * foc->v_alpha + (0.5f * FOC_SQRT3) * foc->v_beta;
+    float vc = -0.5f * foc->v_alpha - (0.5f * FOC_SQRT3) * foc->v_beta;
+
+    // 扇区：三个参考量的符号位组合 N = A + 2B + 4C 映射到 1~6
+    static const uint8_t sector_map[8] = {0, 2, 6, 1, 4, 3, 5, 0};
+    uint8_t n = (uint8_t)((foc->v_beta > 0) |
+                          ((FOC_SQRT3 * foc->v_alpha - foc->v_beta > 0) << 1) |
+                          ((-FOC_SQRT3 * foc->v_alpha - foc->v_beta > 0) << 2));
+    foc->sector = sector_map[n];
+
+    // min-max 零序注入：中点平移到 (max+min)/2
+    float v_hi = (va > vb) ? va : vb;
+    float v_lo = (va > vb) ? vb : va;
+    v_hi = (vc > v_hi) ? vc : v_hi;
+    v_lo = (vc < v_lo) ? vc : v_lo;
+    float offset = -0.5f * (v_hi + v_lo);
+    float k = (foc->vbus > 0) ? 1.0f / foc->vbus : 0;
+
+    foc->duty[0] = 0.5f + (va + offset) * k;
+    foc->duty[1] = 0.5f + (vb + offset) * k;
+    foc->duty[2] = 0.5f + (vc + offset) * k;
 }
 
 // 获取d轴和q轴电压
@@ -60,9 +166,10 @@ void foc_get_vd_vq(foc_t *foc, float *vd, float *vq)
     *vq = foc->vq;
 }
 
-// 释放FOC控制器内存
+// 反初始化
 void foc_deinit(foc_t *foc)
 {
     ASSERT(foc != NULL);
-    // 不需要释放内存，因为所有内存都是静态分配的
+    foc_reset(foc);
+    foc->flag.is_inited = false;
 }
@@ -1,15 +1,35 @@
 /**
  * @file foc.h
  * @author WittXie
- * @brief 通用FOC算法模块
- * @version 0.1
+ * @brief 通用FOC电流环：Clarke -> Park -> d/q 双PI -> 反Park -> SVPWM
+ * @version 0.2
  * @date 2024-08-29
+ * @note
+ * 一次 foc_step 完成一个PWM周期的全部计算，按 20kHz（每周期 50us）设计，实测耗时见 foc_test；
+ * 正余弦取共用的 trig_lut 查表，开方只在电压限幅时用一次 sqrtf（M7 为单条 VSQRT）。
+ * PI：u = kp*e + I，积分按反算法抗饱和 dI/dt = ki*e + (ki/kp)*(u_sat - u)，限幅后积分自动回退；
+ * 解耦：vd 前馈 -ω·Lq·iq，vq 前馈 ω·(Ld·id + ψf)，cfg.is_decouple 关闭时不加；
+ * 限幅：电压矢量限制在 SVPWM 线性区内圆 vbus/√3·modulation_max，d 轴优先；
+ * SVPWM：min-max 零序注入，与七段式 SVPWM 占空比等价，无需显式扇区和作用时间计算。
+ * cfg.bandwidth 非零时按零极点对消整定：kp = ωc·L，ki = ωc·R。
+ *
+ * 单位：电流 A，电压 V，角度为电角度 rad，角速度为电角速度 rad/s，占空比 0~1。
+ *
+ * 0.2 接口变化（不兼容 0.1）：
+ * - foc_init(foc, kp_d, ki_d, kd_d, kp_q, ki_q, kd_q, output_limit) 改为 foc_init(foc, vbus)，
+ *   增益移到 cfg（kp_d/ki_d/kp_q/ki_q，或 bandwidth 自动整定）；
+ * - 去掉微分项 kd：电流环是一阶 R-L 对象，PI 零极点对消即可，微分只会放大电流采样噪声；
+ * - output_limit 去掉，电压限幅由 vbus 与 cfg.modulation_max 决定，母线变化时调 foc_set_vbus；
+ * - foc_update(foc, id_ref, iq_ref, id_meas, iq_meas) 改为 foc_set_current(foc, id_ref, iq_ref) + foc_update(foc, id_meas, iq_meas)；
+ * - 不再依赖 pid.h，foc_t.id_pid/iq_pid 换成 id_pi/iq_pi。
+ * 电机模型 foc_motor 只用于仿真，由 foc_test 引入，bsp 不编译。
  *
  * @copyright Copyright (c) 2024
  */
 #pragma once
 
-#include "./../pid/pid.h"
+#include "./../../math/trig_lut.h"
+#include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -17,56 +37,118 @@
 #define ASSERT(_bool, ...) ((void)0)
 #endif
 
+#define FOC_SQRT3 1.73205080757f     // √3
+#define FOC_INV_SQRT3 0.57735026919f // 1/√3
+
+// 电流环PI
+typedef struct
+{
+    float kp;       // 比例增益 V/A
+    float ki;       // 积分增益 V/(A·s)
+    float integral; // 积分项 V
+} foc_pi_t;
+
 /**
  * @brief FOC控制结构体
  */
-typedef struct
+typedef struct __foc
 {
-    pid_t id_pid; // d轴PID控制器
-    pid_t iq_pid; // q轴PID控制器
-    float theta;  // 电机角度
-    float speed;  // 电机速度
-    float vd;     // d轴电压
-    float vq;     // q轴电压
-    float id;     // d轴电流
-    float iq;     // q轴电流
+    // 参数
+    struct
+    {
+        float ts;             // 控制周期 s
+        float rs;             // 相电阻 Ω
+        float ld;             // d轴电感 H
+        float lq;             // q轴电感 H
+        float flux;           // 永磁磁链 Wb，0 表示不做反电动势前馈
+        float bandwidth;      // 电流环带宽 Hz，非零时自动整定PI
+        float kp_d, ki_d;     // d轴PI，bandwidth 为0时使用
+        float kp_q, ki_q;     // q轴PI，bandwidth 为0时使用
+        float modulation_max; // 最大调制比（0~1，相对线性区内圆），留出电流采样窗口
+        bool is_decouple;     // 是否加解耦前馈
+    } cfg;
+
+    // 标志
+    union
+    {
+        uint8_t value;
+        struct
+        {
+            bool is_inited : 1;    // 是否已初始化
+            bool is_saturated : 1; // 本周期电压是否限幅
+        };
+    } flag;
+
+    foc_pi_t id_pi; // d轴PI
+    foc_pi_t iq_pi; // q轴PI
+
+    // 输入
+    float theta;  // 电角度
+    float speed;  // 电角速度
+    float vbus;   // 母线电压
+    float id_ref; // d轴电流给定
+    float iq_ref; // q轴电流给定
+
+    // 中间量与输出
+    float i_alpha, i_beta; // 静止坐标系电流
+    float id, iq;          // 旋转坐标系电流
+    float vd, vq;          // 旋转坐标系电压
+    float v_alpha, v_beta; // 静止坐标系电压
+    float duty[3];         // 三相占空比
+    uint8_t sector;        // 电压矢量所在扇区 1~6
 } foc_t;
 
 /**
  * @brief 初始化FOC控制器
+ * @param foc FOC结构体指针，cfg 需预先填好
+ * @param vbus 母线电压初值
+ */
+void foc_init(foc_t *foc, float vbus);
+
+/**
+ * @brief 清零积分与输出，占空比回到50%
+ * @param foc FOC结构体指针
+ */
+void foc_reset(foc_t *foc);
+
+/**
+ * @brief 设置电机角度和速度
  * @param foc FOC结构体指针
- * @param kp_d d轴比例增益
- * @param ki_d d轴积分增益
- * @param kd_d d轴微分增益
- * @param kp_q q轴比例增益
- * @param ki_q q轴积分增益
- * @param kd_q q轴微分增益
- * @param output_limit 输出限幅
+ * @param theta 电角度
+ * @param speed 电角速度
  */
-void foc_init(foc_t *foc,
-              float kp_d, float ki_d, float kd_d,
-              float kp_q, float ki_q, float kd_q,
-              float output_limit);
+void foc_set_theta_speed(foc_t *foc, float theta, float speed);
 
 /**
- * @brief 更新FOC控制器
+ * @brief 设置电流给定
+ * @param foc FOC结构体指针
+ * @param id_ref d轴电流
+ * @param iq_ref q轴电流
+ */
+void foc_set_current(foc_t *foc, float id_ref, float iq_ref);
+
+/**
+ * @brief 设置母线电压
+ * @param foc FOC结构体指针
+ * @param vbus 母线电压
+ */
+void foc_set_vbus(foc_t *foc, float vbus);
+
+/**
+ * @brief 只运行d/q电流PI（含解耦与限幅），结果在 foc->vd/vq
  * @param foc FOC结构体指针
- * @param id_ref d轴电流参考值
- * @param iq_ref q轴电流参考值
  * @param id_meas d轴电流测量值
  * @param iq_meas q轴电流测量值
  */
-void foc_update(foc_t *foc,
-                float id_ref, float iq_ref,
-                float id_meas, float iq_meas);
+void foc_update(foc_t *foc, float id_meas, float iq_meas);
 
 /**
- * @brief 设置电机角度和速度
+ * @brief 完整电流环一步：Clarke -> Park -> PI -> 反Park -> SVPWM，结果在 foc->duty
  * @param foc FOC结构体指针
- * @param theta 电机角度
- * @param speed 电机速度
+ * @param ia A相电流
+ * @param ib B相电流（C相按 ia+ib+ic=0 推出）
  */
-void foc_set_theta_speed(foc_t *foc, float theta, float speed);
+void foc_step(foc_t *foc, float ia, float ib);
 
 /**
  * @brief 获取d轴和q轴电压
@@ -77,7 +159,7 @@ void foc_set_theta_speed(foc_t *foc, float theta, float speed);
 void foc_get_vd_vq(foc_t *foc, float *vd, float *vq);
 
 /**
- * @brief 释放FOC控制器内存
+ * @brief 反初始化
  * @param foc FOC结构体指针
  */
 void foc_deinit(foc_t *foc);
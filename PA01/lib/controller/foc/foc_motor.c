@@ -0,0 +1,89 @@
+#include "./foc_motor.h"
+#include <stdlib.h>
+
+#define FOC_MOTOR_2PI 6.28318530718f
+
+// 初始化
+void foc_motor_init(foc_motor_t *motor)
+{
+    ASSERT(motor != NULL);
+    ASSERT(motor->cfg.ts > 0 && motor->cfg.ld > 0 && motor->cfg.lq > 0);
+    if (motor->cfg.substeps == 0)
+    {
+        motor->cfg.substeps = 1;
+    }
+    motor->id = motor->iq = 0;
+    motor->vd = motor->vq = 0;
+    motor->theta = 0;
+    motor->speed = 0;
+    motor->torque = 0;
+    motor->load = 0;
+    motor->ia = motor->ib = motor->ic = 0;
+}
+
+// 设置负载转矩
+void foc_motor_set_load(foc_motor_t *motor, float load)
+{
+    ASSERT(motor != NULL);
+    motor->load = load;
+}
+
+// 推进一个控制周期
+void foc_motor_step(foc_motor_t *motor, const float duty[3], float vbus)
+{
+    ASSERT(motor != NULL);
+    ASSERT(duty != NULL);
+
+    // 平均相电压，中性点悬空：减去三相均值
+    float mean = (duty[0] + duty[1] + duty[2]) * (1.0f / 3.0f);
+    float va = (duty[0] - mean) * vbus;
+    float vb = (duty[1] - mean) * vbus;
+    float vc = (duty[2] - mean) * vbus;
+    float v_alpha = va;
+    float v_beta = (vb - vc) * 0.57735026919f;
+
+    float dt = motor->cfg.ts / motor->cfg.substeps;
+    float p = (float)motor->cfg.pole_pairs;
+    float s = 0, c = 1;
+    for (uint8_t i = 0; i < motor->cfg.substeps; i++)
+    {
+        s = sinf(motor->theta);
+        c = cosf(motor->theta);
+        motor->vd = v_alpha * c + v_beta * s;
+        motor->vq = v_beta * c - v_alpha * s;
+
+        // 电气方程：L di/dt = v - R i ± ω 交叉耦合 - 反电动势
+        float w = motor->speed;
+        float did = (motor->vd - motor->cfg.rs * motor->id + w * motor->cfg.lq * motor->iq) / motor->cfg.ld;
+        float diq = (motor->vq - motor->cfg.rs * motor->iq - w * (motor->cfg.ld * motor->id + motor->cfg.flux)) / motor->cfg.lq;
+        motor->id += did * dt;
+        motor->iq += diq * dt;
+
+        // 转矩与机械方程（用更新后的电流，半隐式）
+        motor->torque = 1.5f * p * (motor->cfg.flux * motor->iq + (motor->cfg.ld - motor->cfg.lq) * motor->id * motor->iq);
+        if (!motor->cfg.is_locked)
+        {
+            float wm = motor->speed / p;
+            wm += (motor->torque - motor->cfg.friction * wm - motor->load) / motor->cfg.inertia * dt;
+            motor->speed = wm * p;
+            motor->theta += motor->speed * dt;
+            if (motor->theta >= FOC_MOTOR_2PI)
+            {
+                motor->theta -= FOC_MOTOR_2PI;
+            }
+            else if (motor->theta < 0)
+            {
+                motor->theta += FOC_MOTOR_2PI;
+            }
+        }
+    }
+
+    // 相电流：反Park + 反Clarke
+    s = sinf(motor->theta);
+    c = cosf(motor->theta);
+    float i_alpha = motor->id * c - motor->iq * s;
+    float i_beta = motor->id * s + motor->iq * c;
+    motor->ia = i_alpha;
+    motor->ib = -0.5f * i_alpha + 0.86602540378f * i_beta;
+    motor->ic = -0.5f * i_alpha - 0.86602540378f * i_beta;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file foc_motor.h
+ * @author WittXie
+ * @brief PMSM/BLDC 电机模型：平均值逆变器 + dq 电气方程 + 刚体机械方程，用于 FOC 闭环仿真
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 无需电机即可在板上或主机上验证电流环：foc_step 的占空比 -> foc_motor_step -> 相电流 -> 下一次 foc_step；
+ * 逆变器按一个周期内的平均电压处理（不含死区、开关纹波），中性点悬空；
+ * 每个控制周期内按 cfg.substeps 细分做半隐式欧拉积分，每个子步重新按转子角做 Park 变换；
+ * Ld = Lq 为表贴式（SPM），Ld < Lq 为内嵌式（IPM），产生磁阻转矩。
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef ASSERT
+#define ASSERT(_bool, ...) ((void)0)
+#endif
+
+/**
+ * @brief 电机模型
+ */
+typedef struct __foc_motor
+{
+    // 参数
+    struct
+    {
+        float rs;           // 相电阻 Ω
+        float ld;           // d轴电感 H
+        float lq;           // q轴电感 H
+        float flux;         // 永磁磁链 Wb
+        uint8_t pole_pairs; // 极对数
+        float inertia;      // 转动惯量 kg·m²
+        float friction;     // 粘滞摩擦系数 N·m·s/rad
+        float ts;           // 控制周期 s
+        uint8_t substeps;   // 每周期积分子步数
+        bool is_locked;     // 是否堵转（转子固定）
+    } cfg;
+
+    float id, iq;     // dq 电流
+    float vd, vq;     // dq 电压（最后一个子步）
+    float theta;      // 电角度 0~2π
+    float speed;      // 电角速度 rad/s
+    float torque;     // 电磁转矩 N·m
+    float load;       // 负载转矩 N·m
+    float ia, ib, ic; // 相电流
+} foc_motor_t;
+
+/**
+ * @brief 初始化，状态清零
+ * @param motor 电机模型，cfg 需预先填好
+ */
+void foc_motor_init(foc_motor_t *motor);
+
+/**
+ * @brief 设置负载转矩
+ * @param motor 电机模型
+ * @param load 负载转矩 N·m
+ */
+void foc_motor_set_load(foc_motor_t *motor, float load);
+
+/**
+ * @brief 推进一个控制周期
+ * @param motor 电机模型
+ * @param duty 三相占空比 0~1
+ * @param vbus 母线电压
+ */
+void foc_motor_step(foc_motor_t *motor, const float duty[3], float vbus);
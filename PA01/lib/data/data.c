@@ -46,6 +46,7 @@ static void _data_save(data_t *data)
 void data_save(data_t *data)
 {
     ASSERT(data != NULL);
+    PROFILE_SCOPE("data_save");
     if (!MUTEX_LOCK(&data->mutex))
     {
         ERROR("%s lock failed.", data->cfg.name);
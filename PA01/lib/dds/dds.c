@@ -182,6 +182,8 @@ void dds_publish(void *device, dds_topic_t *topic, void *arg)
         return;
     }
 
+    DDS_TRACE_PUBLISH_BEGIN(topic);
+
     // 遍历所有符合要求的节点
     LIST_TRAVERSE(topic, {
         if (((dds_node_t *)(LIST_TRAVERSE_NODE->data))->skip_cnt > 0)
@@ -193,6 +195,8 @@ void dds_publish(void *device, dds_topic_t *topic, void *arg)
             ((dds_node_t *)(LIST_TRAVERSE_NODE->data))->callback(device, topic, arg, ((dds_node_t *)(LIST_TRAVERSE_NODE->data))->userdata);
         }
     });
+
+    DDS_TRACE_PUBLISH_END(topic);
 }
 
 // dds临时调过一次
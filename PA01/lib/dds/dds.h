@@ -37,6 +37,12 @@
 #define TIMESTAMP_US_GET() 0
 #endif
 
+// 发布追踪钩子
+#ifndef DDS_TRACE_PUBLISH_BEGIN
+#define DDS_TRACE_PUBLISH_BEGIN(_topic) ((void)0)
+#define DDS_TRACE_PUBLISH_END(_topic) ((void)0)
+#endif
+
 #define DDS_PRIORITY_SUPER 0x1000
 #define DDS_PRIORITY_HIGH 0x4000
 #define DDS_PRIORITY_NORMAL 0x8000
@@ -0,0 +1,280 @@
+#include "./bignum.h"
+#include <string.h>
+
+void bignum_zero(bignum_t *a, uint16_t size)
+{
+    ASSERT(a != NULL);
+    ASSERT(size <= BIGNUM_WORDS_MAX);
+    memset(a->word, 0, size * sizeof(uint32_t));
+    a->size = size;
+}
+
+bool bignum_from_bytes(bignum_t *a, const uint8_t *buff, uint32_t length, uint16_t size)
+{
+    ASSERT(a != NULL);
+    ASSERT(buff != NULL || length == 0);
+
+    // 跳过高位的0
+    while (length > 0 && buff[0] == 0)
+    {
+        buff++;
+        length--;
+    }
+    if (size > BIGNUM_WORDS_MAX || length > size * 4u)
+    {
+        return false;
+    }
+
+    bignum_zero(a, size);
+    for (uint32_t i = 0; i < length; i++)
+    {
+        a->word[i / 4] |= (uint32_t)buff[length - 1 - i] << (8 * (i % 4));
+    }
+    return true;
+}
+
+void bignum_to_bytes(const bignum_t *a, uint8_t *buff, uint32_t length)
+{
+    ASSERT(a != NULL);
+    ASSERT(buff != NULL);
+    for (uint32_t i = 0; i < length; i++)
+    {
+        buff[length - 1 - i] = (i / 4 < a->size) ? (uint8_t)(a->word[i / 4] >> (8 * (i % 4))) : 0;
+    }
+}
+
+int bignum_cmp(const bignum_t *a, const bignum_t *b)
+{
+    ASSERT(a != NULL && b != NULL);
+    ASSERT(a->size == b->size);
+
+    // 从低到高扫描，高位的结果覆盖低位，不提前退出
+    int result = 0;
+    for (uint16_t i = 0; i < a->size; i++)
+    {
+        uint32_t gt = (a->word[i] > b->word[i]);
+        uint32_t lt = (a->word[i] < b->word[i]);
+        uint32_t mask = -(gt | lt);
+        result = (int)(((uint32_t)result & ~mask) | (((uint32_t)gt - lt) & mask));
+    }
+    return result;
+}
+
+uint32_t bignum_bits(const bignum_t *a)
+{
+    ASSERT(a != NULL);
+    for (uint16_t i = a->size; i > 0; i--)
+    {
+        if (a->word[i - 1] != 0)
+        {
+            return (uint32_t)(i - 1) * 32 + 32 - __builtin_clz(a->word[i - 1]);
+        }
+    }
+    return 0;
+}
+
+uint32_t bignum_sub(bignum_t *r, const bignum_t *a, const bignum_t *b)
+{
+    ASSERT(r != NULL && a != NULL && b != NULL);
+    ASSERT(a->size == b->size);
+
+    uint32_t borrow = 0;
+    for (uint16_t i = 0; i < a->size; i++)
+    {
+        uint64_t diff = (uint64_t)a->word[i] - b->word[i] - borrow;
+        r->word[i] = (uint32_t)diff;
+        borrow = (uint32_t)(diff >> 63);
+    }
+    r->size = a->size;
+    return borrow;
+}
+
+// r = select ? a : b，按字掩码选择
+static void bignum_select(uint32_t *r, const uint32_t *a, const uint32_t *b, uint16_t size, uint32_t select)
+{
+    uint32_t mask = -select;
+    for (uint16_t i = 0; i < size; i++)
+    {
+        r[i] = (a[i] & mask) | (b[i] & ~mask);
+    }
+}
+
+bool bignum_mont_init(bignum_mont_t *mont, const bignum_t *n)
+{
+    ASSERT(mont != NULL && n != NULL);
+    if ((n->word[0] & 1) == 0 || bignum_bits(n) < 2)
+    {
+        return false;
+    }
+    memcpy(&mont->n, n, sizeof(bignum_t));
+
+    // 牛顿迭代求 n^-1 mod 2^32：每次迭代有效位翻倍
+    uint32_t inv = n->word[0]; // 对奇数 n，n*n ≡ 1 mod 8，初值已有3位
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        inv *= 2 - n->word[0] * inv;
+    }
+    mont->n0 = -inv;
+
+    // R^2 mod n：从1开始倍加 2*32*size 次，每次条件减 n
+    uint16_t size = n->size;
+    bignum_t *rr = &mont->rr;
+    bignum_zero(rr, size);
+    rr->word[0] = 1;
+    for (uint32_t i = 0; i < 64u * size; i++)
+    {
+        uint32_t carry = rr->word[size - 1] >> 31;
+        for (uint16_t j = size - 1; j > 0; j--)
+        {
+            rr->word[j] = (rr->word[j] << 1) | (rr->word[j - 1] >> 31);
+        }
+        rr->word[0] <<= 1;
+
+        bignum_t diff;
+        uint32_t borrow = bignum_sub(&diff, rr, n);
+        bignum_select(rr->word, diff.word, rr->word, size, carry | (borrow ^ 1));
+    }
+    return true;
+}
+
+void bignum_mont_mul(const bignum_mont_t *mont, bignum_t *r, const bignum_t *a, const bignum_t *b)
+{
+    ASSERT(mont != NULL && r != NULL && a != NULL && b != NULL);
+    uint16_t size = mont->n.size;
+    const uint32_t *n = mont->n.word;
+    ASSERT(a->size == size && b->size == size);
+
+    // CIOS：逐字乘加后立即约减，中间结果只需 size+2 字
+    uint32_t t[BIGNUM_WORDS_MAX + 2] = {0};
+    for (uint16_t i = 0; i < size; i++)
+    {
+        uint64_t carry = 0;
+        uint32_t bi = b->word[i];
+        for (uint16_t j = 0; j < size; j++)
+        {
+            carry += (uint64_t)a->word[j] * bi + t[j];
+            t[j] = (uint32_t)carry;
+            carry >>= 32;
+        }
+        carry += t[size];
+        t[size] = (uint32_t)carry;
+        t[size + 1] = (uint32_t)(carry >> 32);
+
+        uint32_t m = t[0] * mont->n0;
+        carry = ((uint64_t)m * n[0] + t[0]) >> 32;
+        for (uint16_t j = 1; j < size; j++)
+        {
+            carry += (uint64_t)m * n[j] + t[j];
+            t[j - 1] = (uint32_t)carry;
+            carry >>= 32;
+        }
+        carry += t[size];
+        t[size - 1] = (uint32_t)carry;
+        t[size] = t[size + 1] + (uint32_t)(carry >> 32);
+    }
+
+    // t < 2n，恒时条件减 n：差值先写入 r，再按借位选择
+    uint32_t borrow = 0;
+    for (uint16_t j = 0; j < size; j++)
+    {
+        uint64_t d = (uint64_t)t[j] - n[j] - borrow;
+        r->word[j] = (uint32_t)d;
+        borrow = (uint32_t)(d >> 63);
+    }
+    bignum_select(r->word, r->word, t, size, t[size] | (borrow ^ 1));
+    r->size = size;
+}
+
+void bignum_mont_to(const bignum_mont_t *mont, bignum_t *r, const bignum_t *a)
+{
+    bignum_mont_mul(mont, r, a, &mont->rr);
+}
+
+void bignum_mont_from(const bignum_mont_t *mont, bignum_t *r, const bignum_t *a)
+{
+    bignum_t one;
+    bignum_zero(&one, mont->n.size);
+    one.word[0] = 1;
+    bignum_mont_mul(mont, r, a, &one);
+}
+
+// 取指数第 bit 位
+#define BIGNUM_EXP_BIT(_exp, _bit) (((_exp)[(_bit) / 32] >> ((_bit) % 32)) & 1)
+
+void bignum_mont_exp(const bignum_mont_t *mont, bignum_t *r, const bignum_t *base,
+                     const uint32_t *exp, uint16_t exp_size, bignum_t *table, uint8_t window)
+{
+    ASSERT(mont != NULL && r != NULL && base != NULL && table != NULL);
+    ASSERT(exp != NULL || exp_size == 0);
+    ASSERT(window >= 1 && window <= BIGNUM_WINDOW_MAX);
+
+    // 指数有效位数
+    int32_t bit = (int32_t)exp_size * 32 - 1;
+    while (bit >= 0 && BIGNUM_EXP_BIT(exp, bit) == 0)
+    {
+        bit--;
+    }
+    if (bit < 0)
+    {
+        // 指数为0
+        bignum_zero(r, mont->n.size);
+        r->word[0] = 1;
+        return;
+    }
+
+    // 奇次幂表：table[k] = base^(2k+1)，蒙哥马利域
+    bignum_mont_to(mont, &table[0], base);
+    if (window > 1)
+    {
+        bignum_mont_mul(mont, r, &table[0], &table[0]); // r 暂存 base^2
+        for (uint8_t k = 1; k < (1u << (window - 1)); k++)
+        {
+            bignum_mont_mul(mont, &table[k], &table[k - 1], r);
+        }
+    }
+
+    // 从高位向低位：遇0平方，遇1取以1结尾的最长窗口
+    bool is_first = true;
+    while (bit >= 0)
+    {
+        if (BIGNUM_EXP_BIT(exp, bit) == 0)
+        {
+            bignum_mont_mul(mont, r, r, r);
+            bit--;
+            continue;
+        }
+
+        int32_t low = bit - window + 1;
+        if (low < 0)
+        {
+            low = 0;
+        }
+        while (BIGNUM_EXP_BIT(exp, low) == 0)
+        {
+            low++;
+        }
+
+        uint32_t value = 0;
+        for (int32_t i = bit; i >= low; i--)
+        {
+            value = (value << 1) | BIGNUM_EXP_BIT(exp, i);
+            if (!is_first)
+            {
+                bignum_mont_mul(mont, r, r, r);
+            }
+        }
+
+        if (is_first)
+        {
+            memcpy(r, &table[value >> 1], sizeof(bignum_t));
+            is_first = false;
+        }
+        else
+        {
+            bignum_mont_mul(mont, r, r, &table[value >> 1]);
+        }
+        bit = low - 1;
+    }
+
+    bignum_mont_from(mont, r, r);
+}
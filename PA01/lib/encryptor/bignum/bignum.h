@@ -0,0 +1,156 @@
+/**
+ * @file bignum.h
+ * @author WittXie
+ * @brief 定长大数运算（蒙哥马利乘法、滑动窗口模幂）
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 32位字、小端字序，最大 BIGNUM_BITS_MAX 位，不使用堆；
+ * 同一次运算中所有操作数的字数（size）必须相同，等于模数的字数；
+ * 蒙哥马利乘法用 CIOS 算法，循环次数只取决于 size，末尾的条件减法用掩码选择，耗时与数据无关；
+ * 模幂的时间与指数的位模式有关，只能用于公开指数（如RSA验签），私钥运算需另做恒时处理。
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef ASSERT
+#define ASSERT(_bool, ...) ((void)0)
+#endif
+
+#ifndef BIGNUM_BITS_MAX
+#define BIGNUM_BITS_MAX 4096 // 最大位数
+#endif
+#define BIGNUM_WORDS_MAX (BIGNUM_BITS_MAX / 32) // 最大字数
+#define BIGNUM_WINDOW_MAX 6                     // 滑动窗口最大位数
+
+/**
+ * @brief 大数
+ */
+typedef struct
+{
+    uint32_t word[BIGNUM_WORDS_MAX]; // 数值，word[0]为最低字
+    uint16_t size;                   // 有效字数
+} bignum_t;
+
+/**
+ * @brief 蒙哥马利上下文，R = 2^(32*size)
+ */
+typedef struct
+{
+    bignum_t n;  // 模数（奇数）
+    bignum_t rr; // R^2 mod n
+    uint32_t n0; // -n^-1 mod 2^32
+} bignum_mont_t;
+
+/**
+ * @brief 置零
+ *
+ * @param a 大数
+ * @param size 字数
+ */
+void bignum_zero(bignum_t *a, uint16_t size);
+
+/**
+ * @brief 从大端字节串导入
+ *
+ * @param a 大数
+ * @param buff 字节串（大端）
+ * @param length 字节数
+ * @param size 字数
+ * @return true 成功
+ * @return false 数值超出 size 字
+ */
+bool bignum_from_bytes(bignum_t *a, const uint8_t *buff, uint32_t length, uint16_t size);
+
+/**
+ * @brief 导出为大端字节串，高位补零或截断
+ *
+ * @param a 大数
+ * @param buff 字节串（大端）
+ * @param length 字节数
+ */
+void bignum_to_bytes(const bignum_t *a, uint8_t *buff, uint32_t length);
+
+/**
+ * @brief 比较，耗时与数据无关
+ *
+ * @param a 大数
+ * @param b 大数
+ * @return int a<b 返回-1，相等返回0，a>b 返回1
+ */
+int bignum_cmp(const bignum_t *a, const bignum_t *b);
+
+/**
+ * @brief 有效位数
+ *
+ * @param a 大数
+ * @return uint32_t 位数，0 返回0
+ */
+uint32_t bignum_bits(const bignum_t *a);
+
+/**
+ * @brief 减法 r = a - b
+ *
+ * @param r 结果，可与 a、b 相同
+ * @param a 被减数
+ * @param b 减数
+ * @return uint32_t 借位
+ */
+uint32_t bignum_sub(bignum_t *r, const bignum_t *a, const bignum_t *b);
+
+/**
+ * @brief 初始化蒙哥马利上下文，计算 n0 与 R^2 mod n
+ *
+ * @param mont 上下文
+ * @param n 模数，必须为奇数
+ * @return true 成功
+ * @return false 模数为偶数或为1
+ */
+bool bignum_mont_init(bignum_mont_t *mont, const bignum_t *n);
+
+/**
+ * @brief 蒙哥马利乘法 r = a * b * R^-1 mod n
+ *
+ * @param mont 上下文
+ * @param r 结果，可与 a、b 相同
+ * @param a 乘数，< n
+ * @param b 乘数，< n
+ */
+void bignum_mont_mul(const bignum_mont_t *mont, bignum_t *r, const bignum_t *a, const bignum_t *b);
+
+/**
+ * @brief 转入蒙哥马利域 r = a * R mod n
+ *
+ * @param mont 上下文
+ * @param r 结果，可与 a 相同
+ * @param a 大数，< n
+ */
+void bignum_mont_to(const bignum_mont_t *mont, bignum_t *r, const bignum_t *a);
+
+/**
+ * @brief 转出蒙哥马利域 r = a * R^-1 mod n
+ *
+ * @param mont 上下文
+ * @param r 结果，可与 a 相同
+ * @param a 大数（蒙哥马利域）
+ */
+void bignum_mont_from(const bignum_mont_t *mont, bignum_t *r, const bignum_t *a);
+
+/**
+ * @brief 滑动窗口模幂 r = base ^ exp mod n（普通域输入输出）
+ *
+ * @param mont 上下文
+ * @param r 结果，不能与 table 重叠，可与 base 相同
+ * @param base 底数，< n
+ * @param exp 指数（小端字序）
+ * @param exp_size 指数字数
+ * @param table 奇次幂表，至少 1 << (window - 1) 项
+ * @param window 窗口位数 1~BIGNUM_WINDOW_MAX；短指数（如65537）取1，长指数取4~5
+ */
+void bignum_mont_exp(const bignum_mont_t *mont, bignum_t *r, const bignum_t *base,
+                     const uint32_t *exp, uint16_t exp_size, bignum_t *table, uint8_t window);
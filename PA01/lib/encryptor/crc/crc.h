@@ -87,6 +87,12 @@ typedef struct
  */
 void crc_table_create(crc_t *crc);
 
+/**
+ * @brief 释放 crc_table_create 创建的校验表
+ * @param crc CRC结构体指针
+ */
+void crc_table_free(crc_t *crc);
+
 /**
  * @brief 计算CRC校验值
  * @param crc CRC结构体指针
@@ -0,0 +1,131 @@
+#include "./hash.h"
+
+#ifndef MALLOC
+#define MALLOC(_size) malloc(_size)
+#define FREE(_pv) free(_pv)
+#endif
+
+// 算法表
+static const struct
+{
+    const char *name;
+    uint8_t size;
+} hash_info[HASH_TYPE_MAX] = {
+    [HASH_MD5] = {"MD5", MD5_DIGEST_SIZE},
+    [HASH_SHA1] = {"SHA-1", SHA1_DIGEST_SIZE},
+    [HASH_SHA256] = {"SHA-256", SHA256_DIGEST_SIZE},
+};
+
+void hash_init(hash_t *hash, enum hash_type type)
+{
+    ASSERT(hash != NULL);
+    ASSERT(type < HASH_TYPE_MAX);
+    hash->type = type;
+    switch (type)
+    {
+    case HASH_MD5:
+        md5_init(&hash->ctx.md5);
+        break;
+    case HASH_SHA1:
+        sha1_init(&hash->ctx.sha1);
+        break;
+    case HASH_SHA256:
+        sha256_init(&hash->ctx.sha256);
+        break;
+    default:
+        break;
+    }
+}
+
+void hash_update(hash_t *hash, const uint8_t *data, uint32_t length)
+{
+    ASSERT(hash != NULL);
+    switch (hash->type)
+    {
+    case HASH_MD5:
+        md5_update(&hash->ctx.md5, data, length);
+        break;
+    case HASH_SHA1:
+        sha1_update(&hash->ctx.sha1, data, length);
+        break;
+    case HASH_SHA256:
+        sha256_update(&hash->ctx.sha256, data, length);
+        break;
+    default:
+        break;
+    }
+}
+
+uint8_t hash_final(hash_t *hash, uint8_t *digest)
+{
+    ASSERT(hash != NULL);
+    ASSERT(digest != NULL);
+    switch (hash->type)
+    {
+    case HASH_MD5:
+        md5_final(&hash->ctx.md5, digest);
+        break;
+    case HASH_SHA1:
+        sha1_final(&hash->ctx.sha1, digest);
+        break;
+    case HASH_SHA256:
+        sha256_final(&hash->ctx.sha256, digest);
+        break;
+    default:
+        return 0;
+    }
+    return hash_info[hash->type].size;
+}
+
+uint8_t hash_calculate(enum hash_type type, const uint8_t *data, uint32_t length, uint8_t *digest)
+{
+    hash_t hash;
+    hash_init(&hash, type);
+    hash_update(&hash, data, length);
+    return hash_final(&hash, digest);
+}
+
+uint8_t hash_digest_size(enum hash_type type)
+{
+    return (type < HASH_TYPE_MAX) ? hash_info[type].size : 0;
+}
+
+const char *hash_name(enum hash_type type)
+{
+    return (type < HASH_TYPE_MAX) ? hash_info[type].name : "unknown";
+}
+
+bool hash_flash(hash_t *hash, flash_t *flash, uint32_t address, uint32_t length, uint8_t *buff, uint32_t chunk_size)
+{
+    ASSERT(hash != NULL);
+    ASSERT(flash != NULL);
+    if (chunk_size == 0)
+    {
+        return false;
+    }
+
+    uint8_t *chunk = buff;
+    if (chunk == NULL)
+    {
+        chunk = (uint8_t *)MALLOC(chunk_size);
+        if (chunk == NULL)
+        {
+            return false;
+        }
+    }
+
+    while (length > 0)
+    {
+        uint32_t size = (length < chunk_size) ? length : chunk_size;
+        flash_read(flash, address, chunk, size);
+        hash_update(hash, chunk, size);
+        address += size;
+        length -= size;
+    }
+
+    if (buff == NULL)
+    {
+        FREE(chunk);
+    }
+    return true;
+}
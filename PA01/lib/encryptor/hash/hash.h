@@ -0,0 +1,119 @@
+/**
+ * @file hash.h
+ * @author WittXie
+ * @brief 统一哈希接口（MD5 / SHA-1 / SHA-256）
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 流式计算：hash_init -> hash_update(任意次) -> hash_final，或一次性 hash_calculate；
+ * hash_flash 按块读取 flash_t 并累加，用于固件镜像、出厂数据、升级文件校验。
+ * 分块长度取 64 的整数倍、缓存4字节对齐时，每块都走按字直读的快速路径。
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "./../../flash/flash.h"
+#include "./../md5/md5.h"
+#include "./../sha1/sha1.h"
+#include "./../sha256/sha256.h"
+
+#ifndef ASSERT
+#define ASSERT(_bool, ...) ((void)0)
+#endif
+
+#define HASH_DIGEST_SIZE_MAX SHA256_DIGEST_SIZE // 最长摘要
+
+// 哈希算法
+enum hash_type
+{
+    HASH_MD5 = 0, // MD5，16字节
+    HASH_SHA1,    // SHA-1，20字节
+    HASH_SHA256,  // SHA-256，32字节
+    HASH_TYPE_MAX,
+};
+
+/**
+ * @brief 哈希上下文
+ */
+typedef struct __hash
+{
+    enum hash_type type; // 算法
+    union
+    {
+        md5_ctx_t md5;
+        sha1_ctx_t sha1;
+        sha256_ctx_t sha256;
+    } ctx;
+} hash_t;
+
+/**
+ * @brief 初始化
+ *
+ * @param hash 哈希上下文
+ * @param type 算法
+ */
+void hash_init(hash_t *hash, enum hash_type type);
+
+/**
+ * @brief 输入数据
+ *
+ * @param hash 哈希上下文
+ * @param data 数据
+ * @param length 数据长度
+ */
+void hash_update(hash_t *hash, const uint8_t *data, uint32_t length);
+
+/**
+ * @brief 结束计算并输出摘要
+ *
+ * @param hash 哈希上下文
+ * @param digest 摘要输出，至少 hash_digest_size 字节
+ * @return uint8_t 摘要长度
+ */
+uint8_t hash_final(hash_t *hash, uint8_t *digest);
+
+/**
+ * @brief 一次性计算
+ *
+ * @param type 算法
+ * @param data 数据
+ * @param length 数据长度
+ * @param digest 摘要输出
+ * @return uint8_t 摘要长度
+ */
+uint8_t hash_calculate(enum hash_type type, const uint8_t *data, uint32_t length, uint8_t *digest);
+
+/**
+ * @brief 摘要长度
+ *
+ * @param type 算法
+ * @return uint8_t 摘要长度，非法算法返回0
+ */
+uint8_t hash_digest_size(enum hash_type type);
+
+/**
+ * @brief 算法名称
+ *
+ * @param type 算法
+ * @return const char* 名称
+ */
+const char *hash_name(enum hash_type type);
+
+/**
+ * @brief 按块读取flash并累加到哈希（不做 init/final，可与其他数据拼接）
+ *
+ * @param hash 哈希上下文
+ * @param flash flash设备
+ * @param address 起始地址
+ * @param length 长度
+ * @param buff 读缓存，建议4字节对齐；为NULL时内部申请
+ * @param chunk_size 每次读取长度，建议取64的整数倍
+ * @return true 成功
+ * @return false 参数错误或内存不足
+ */
+bool hash_flash(hash_t *hash, flash_t *flash, uint32_t address, uint32_t length, uint8_t *buff, uint32_t chunk_size);
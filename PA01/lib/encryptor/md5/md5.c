@@ -1,149 +1,181 @@
 #include "./md5.h"
 #include <string.h>
 
-// MD5常量
-static const uint32_t MD5_S[64] = {
-    7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
-    5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20, 5, 9, 14, 20,
-    4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
-    6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21};
-
-static const uint32_t MD5_K[64] = {
-    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
-    0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
-    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
-    0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
-    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
-    0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
-    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
-    0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
-    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
-    0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
-    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
-    0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
-    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
-    0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
-    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
-    0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391};
+// 辅助函数：循环左移
+#define MD5_ROTL(_x, _c) (((_x) << (_c)) | ((_x) >> (32 - (_c))))
 
-// 填充数据
-static const uint8_t padding[64] = {
-    0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+// 四种非线性函数
+#define MD5_F(_b, _c, _d) ((_d) ^ ((_b) & ((_c) ^ (_d))))
+#define MD5_G(_b, _c, _d) ((_c) ^ ((_d) & ((_b) ^ (_c))))
+#define MD5_H(_b, _c, _d) ((_b) ^ (_c) ^ (_d))
+#define MD5_I(_b, _c, _d) ((_c) ^ ((_b) | ~(_d)))
 
-// 辅助函数：循环左移
-static uint32_t left_rotate(uint32_t x, uint32_t c)
-{
-    return (x << c) | (x >> (32 - c));
-}
+// 单步：a = b + ((a + f(b,c,d) + x + k) <<< s)
+#define MD5_STEP(_f, _a, _b, _c, _d, _x, _k, _s) \
+    {                                            \
+        _a += _f(_b, _c, _d) + (_x) + (_k);      \
+        _a = MD5_ROTL(_a, _s) + (_b);            \
+    }
+
+// 小端取字：小端机器直接读
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define MD5_LOAD(_x, _i) ((_x)[_i])
+#else
+#define MD5_LOAD(_x, _i) (((uint32_t)((const uint8_t *)(_x))[4 * (_i)]) | ((uint32_t)((const uint8_t *)(_x))[4 * (_i) + 1] << 8) |           \
+                          ((uint32_t)((const uint8_t *)(_x))[4 * (_i) + 2] << 16) | ((uint32_t)((const uint8_t *)(_x))[4 * (_i) + 3] << 24))
+#endif
+
+// 填充数据
+static const uint8_t md5_padding[64] = {0x80};
 
 // 初始化MD5上下文
 void md5_init(md5_ctx_t *ctx)
 {
     ASSERT(ctx != NULL);
-    ctx->count[0] = ctx->count[1] = 0;
+    ctx->length = 0;
     ctx->state[0] = 0x67452301;
     ctx->state[1] = 0xefcdab89;
     ctx->state[2] = 0x98badcfe;
     ctx->state[3] = 0x10325476;
 }
 
-// 辅助函数：编码函数
-static void encode(uint8_t *output, const uint32_t *input, uint32_t len)
+// 处理 count 个连续分组，x 必须4字节对齐
+static void md5_transform(uint32_t state[4], const uint32_t *x, uint32_t count)
 {
-    for (uint32_t i = 0, j = 0; j < len; i++, j += 4)
-    {
-        output[j] = (uint8_t)(input[i] & 0xff);
-        output[j + 1] = (uint8_t)((input[i] >> 8) & 0xff);
-        output[j + 2] = (uint8_t)((input[i] >> 16) & 0xff);
-        output[j + 3] = (uint8_t)((input[i] >> 24) & 0xff);
-    }
-}
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
 
-// 辅助函数：解码函数
-static void decode(uint32_t *output, const uint8_t *input, uint32_t len)
-{
-    for (uint32_t i = 0, j = 0; j < len; i++, j += 4)
+    for (; count > 0; count--, x += 16)
     {
-        output[i] = ((uint32_t)input[j]) | (((uint32_t)input[j + 1]) << 8) |
-                    (((uint32_t)input[j + 2]) << 16) | (((uint32_t)input[j + 3]) << 24);
-    }
-}
+        uint32_t x0 = MD5_LOAD(x, 0), x1 = MD5_LOAD(x, 1), x2 = MD5_LOAD(x, 2), x3 = MD5_LOAD(x, 3);
+        uint32_t x4 = MD5_LOAD(x, 4), x5 = MD5_LOAD(x, 5), x6 = MD5_LOAD(x, 6), x7 = MD5_LOAD(x, 7);
+        uint32_t x8 = MD5_LOAD(x, 8), x9 = MD5_LOAD(x, 9), x10 = MD5_LOAD(x, 10), x11 = MD5_LOAD(x, 11);
+        uint32_t x12 = MD5_LOAD(x, 12), x13 = MD5_LOAD(x, 13), x14 = MD5_LOAD(x, 14), x15 = MD5_LOAD(x, 15);
+        uint32_t aa = a, bb = b, cc = c, dd = d;
 
-// 辅助函数：转换函数
-static void md5_transform(uint32_t state[4], const uint8_t block[64])
-{
-    uint32_t a = state[0], b = state[1], c = state[2], d = state[3], x[16];
-    decode(x, block, 64);
+        // 第1轮
+        MD5_STEP(MD5_F, a, b, c, d, x0, 0xd76aa478, 7);
+        MD5_STEP(MD5_F, d, a, b, c, x1, 0xe8c7b756, 12);
+        MD5_STEP(MD5_F, c, d, a, b, x2, 0x242070db, 17);
+        MD5_STEP(MD5_F, b, c, d, a, x3, 0xc1bdceee, 22);
+        MD5_STEP(MD5_F, a, b, c, d, x4, 0xf57c0faf, 7);
+        MD5_STEP(MD5_F, d, a, b, c, x5, 0x4787c62a, 12);
+        MD5_STEP(MD5_F, c, d, a, b, x6, 0xa8304613, 17);
+        MD5_STEP(MD5_F, b, c, d, a, x7, 0xfd469501, 22);
+        MD5_STEP(MD5_F, a, b, c, d, x8, 0x698098d8, 7);
+        MD5_STEP(MD5_F, d, a, b, c, x9, 0x8b44f7af, 12);
+        MD5_STEP(MD5_F, c, d, a, b, x10, 0xffff5bb1, 17);
+        MD5_STEP(MD5_F, b, c, d, a, x11, 0x895cd7be, 22);
+        MD5_STEP(MD5_F, a, b, c, d, x12, 0x6b901122, 7);
+        MD5_STEP(MD5_F, d, a, b, c, x13, 0xfd987193, 12);
+        MD5_STEP(MD5_F, c, d, a, b, x14, 0xa679438e, 17);
+        MD5_STEP(MD5_F, b, c, d, a, x15, 0x49b40821, 22);
 
-    // 主循环
-    for (uint32_t i = 0; i < 64; i++)
-    {
-        uint32_t f, g;
-        if (i < 16)
-        {
-            f = (b & c) | ((~b) & d);
-            g = i;
-        }
-        else if (i < 32)
-        {
-            f = (d & b) | ((~d) & c);
-            g = (5 * i + 1) % 16;
-        }
-        else if (i < 48)
-        {
-            f = b ^ c ^ d;
-            g = (3 * i + 5) % 16;
-        }
-        else
-        {
-            f = c ^ (b | (~d));
-            g = (7 * i) % 16;
-        }
-        uint32_t temp = d;
-        d = c;
-        c = b;
-        b = b + left_rotate((a + f + MD5_K[i] + x[g]), MD5_S[i]);
-        a = temp;
+        // 第2轮
+        MD5_STEP(MD5_G, a, b, c, d, x1, 0xf61e2562, 5);
+        MD5_STEP(MD5_G, d, a, b, c, x6, 0xc040b340, 9);
+        MD5_STEP(MD5_G, c, d, a, b, x11, 0x265e5a51, 14);
+        MD5_STEP(MD5_G, b, c, d, a, x0, 0xe9b6c7aa, 20);
+        MD5_STEP(MD5_G, a, b, c, d, x5, 0xd62f105d, 5);
+        MD5_STEP(MD5_G, d, a, b, c, x10, 0x02441453, 9);
+        MD5_STEP(MD5_G, c, d, a, b, x15, 0xd8a1e681, 14);
+        MD5_STEP(MD5_G, b, c, d, a, x4, 0xe7d3fbc8, 20);
+        MD5_STEP(MD5_G, a, b, c, d, x9, 0x21e1cde6, 5);
+        MD5_STEP(MD5_G, d, a, b, c, x14, 0xc33707d6, 9);
+        MD5_STEP(MD5_G, c, d, a, b, x3, 0xf4d50d87, 14);
+        MD5_STEP(MD5_G, b, c, d, a, x8, 0x455a14ed, 20);
+        MD5_STEP(MD5_G, a, b, c, d, x13, 0xa9e3e905, 5);
+        MD5_STEP(MD5_G, d, a, b, c, x2, 0xfcefa3f8, 9);
+        MD5_STEP(MD5_G, c, d, a, b, x7, 0x676f02d9, 14);
+        MD5_STEP(MD5_G, b, c, d, a, x12, 0x8d2a4c8a, 20);
+
+        // 第3轮
+        MD5_STEP(MD5_H, a, b, c, d, x5, 0xfffa3942, 4);
+        MD5_STEP(MD5_H, d, a, b, c, x8, 0x8771f681, 11);
+        MD5_STEP(MD5_H, c, d, a, b, x11, 0x6d9d6122, 16);
+        MD5_STEP(MD5_H, b, c, d, a, x14, 0xfde5380c, 23);
+        MD5_STEP(MD5_H, a, b, c, d, x1, 0xa4beea44, 4);
+        MD5_STEP(MD5_H, d, a, b, c, x4, 0x4bdecfa9, 11);
+        MD5_STEP(MD5_H, c, d, a, b, x7, 0xf6bb4b60, 16);
+        MD5_STEP(MD5_H, b, c, d, a, x10, 0xbebfbc70, 23);
+        MD5_STEP(MD5_H, a, b, c, d, x13, 0x289b7ec6, 4);
+        MD5_STEP(MD5_H, d, a, b, c, x0, 0xeaa127fa, 11);
+        MD5_STEP(MD5_H, c, d, a, b, x3, 0xd4ef3085, 16);
+        MD5_STEP(MD5_H, b, c, d, a, x6, 0x04881d05, 23);
+        MD5_STEP(MD5_H, a, b, c, d, x9, 0xd9d4d039, 4);
+        MD5_STEP(MD5_H, d, a, b, c, x12, 0xe6db99e5, 11);
+        MD5_STEP(MD5_H, c, d, a, b, x15, 0x1fa27cf8, 16);
+        MD5_STEP(MD5_H, b, c, d, a, x2, 0xc4ac5665, 23);
+
+        // 第4轮
+        MD5_STEP(MD5_I, a, b, c, d, x0, 0xf4292244, 6);
+        MD5_STEP(MD5_I, d, a, b, c, x7, 0x432aff97, 10);
+        MD5_STEP(MD5_I, c, d, a, b, x14, 0xab9423a7, 15);
+        MD5_STEP(MD5_I, b, c, d, a, x5, 0xfc93a039, 21);
+        MD5_STEP(MD5_I, a, b, c, d, x12, 0x655b59c3, 6);
+        MD5_STEP(MD5_I, d, a, b, c, x3, 0x8f0ccc92, 10);
+        MD5_STEP(MD5_I, c, d, a, b, x10, 0xffeff47d, 15);
+        MD5_STEP(MD5_I, b, c, d, a, x1, 0x85845dd1, 21);
+        MD5_STEP(MD5_I, a, b, c, d, x8, 0x6fa87e4f, 6);
+        MD5_STEP(MD5_I, d, a, b, c, x15, 0xfe2ce6e0, 10);
+        MD5_STEP(MD5_I, c, d, a, b, x6, 0xa3014314, 15);
+        MD5_STEP(MD5_I, b, c, d, a, x13, 0x4e0811a1, 21);
+        MD5_STEP(MD5_I, a, b, c, d, x4, 0xf7537e82, 6);
+        MD5_STEP(MD5_I, d, a, b, c, x11, 0xbd3af235, 10);
+        MD5_STEP(MD5_I, c, d, a, b, x2, 0x2ad7d2bb, 15);
+        MD5_STEP(MD5_I, b, c, d, a, x9, 0xeb86d391, 21);
+
+        a += aa;
+        b += bb;
+        c += cc;
+        d += dd;
     }
 
-    state[0] += a;
-    state[1] += b;
-    state[2] += c;
-    state[3] += d;
+    state[0] = a;
+    state[1] = b;
+    state[2] = c;
+    state[3] = d;
 }
 
 // 更新MD5哈希计算
 void md5_update(md5_ctx_t *ctx, const uint8_t *input, uint32_t input_len)
 {
     ASSERT(ctx != NULL);
-    ASSERT(input != NULL);
+    ASSERT(input != NULL || input_len == 0);
 
-    uint32_t i, index, part_len;
-    index = (uint32_t)((ctx->count[0] >> 3) & 0x3F);
-    if ((ctx->count[0] += ((uint32_t)input_len << 3)) < ((uint32_t)input_len << 3))
-    {
-        ctx->count[1]++;
-    }
-    ctx->count[1] += ((uint32_t)input_len >> 29);
-    part_len = 64 - index;
-    if (input_len >= part_len)
+    uint32_t index = (uint32_t)(ctx->length & 0x3F);
+    ctx->length += input_len;
+
+    // 先补满缓冲区
+    if (index != 0)
     {
-        memcpy(&ctx->buffer[index], input, part_len);
-        md5_transform(ctx->state, ctx->buffer);
-        for (i = part_len; i + 63 < input_len; i += 64)
+        uint32_t part_len = MD5_BLOCK_SIZE - index;
+        if (input_len < part_len)
         {
-            md5_transform(ctx->state, &input[i]);
+            memcpy((uint8_t *)ctx->buffer + index, input, input_len);
+            return;
         }
-        index = 0;
+        memcpy((uint8_t *)ctx->buffer + index, input, part_len);
+        md5_transform(ctx->state, ctx->buffer, 1);
+        input += part_len;
+        input_len -= part_len;
+    }
+
+    // 整块：对齐时直接按字处理，否则逐块拷贝到缓冲区
+    uint32_t blocks = input_len / MD5_BLOCK_SIZE;
+    if (((uintptr_t)input & 3) == 0)
+    {
+        md5_transform(ctx->state, (const uint32_t *)input, blocks);
+        input += blocks * MD5_BLOCK_SIZE;
     }
     else
     {
-        i = 0;
+        for (; blocks > 0; blocks--, input += MD5_BLOCK_SIZE)
+        {
+            memcpy(ctx->buffer, input, MD5_BLOCK_SIZE);
+            md5_transform(ctx->state, ctx->buffer, 1);
+        }
     }
-    memcpy(&ctx->buffer[index], &input[i], input_len - i);
+    memcpy(ctx->buffer, input, input_len % MD5_BLOCK_SIZE);
 }
 
 // 完成MD5哈希计算并输出结果
@@ -152,14 +184,25 @@ void md5_final(md5_ctx_t *ctx, uint8_t output[16])
     ASSERT(ctx != NULL);
     ASSERT(output != NULL);
 
-    uint8_t bits[8];
-    uint32_t index, pad_len;
-    encode(bits, ctx->count, 8);
-    index = (uint32_t)((ctx->count[0] >> 3) & 0x3f);
-    pad_len = (index < 56) ? (56 - index) : (120 - index);
-    md5_update(ctx, padding, pad_len);
-    md5_update(ctx, bits, 8);
-    encode(output, ctx->state, 16);
+    // 位长度，小端
+    uint64_t bits = ctx->length << 3;
+    uint8_t length[8];
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        length[i] = (uint8_t)(bits >> (8 * i));
+    }
+
+    uint32_t index = (uint32_t)(ctx->length & 0x3F);
+    md5_update(ctx, md5_padding, (index < 56) ? (56 - index) : (120 - index));
+    md5_update(ctx, length, 8);
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        output[4 * i] = (uint8_t)ctx->state[i];
+        output[4 * i + 1] = (uint8_t)(ctx->state[i] >> 8);
+        output[4 * i + 2] = (uint8_t)(ctx->state[i] >> 16);
+        output[4 * i + 3] = (uint8_t)(ctx->state[i] >> 24);
+    }
 }
 
 // 计算数据的MD5哈希值
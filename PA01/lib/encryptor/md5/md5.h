@@ -2,8 +2,11 @@
  * @file md5.h
  * @author WittXie
  * @brief 通用MD5哈希模块
- * @version 0.1
+ * @version 0.2
  * @date 2024-08-29
+ * @note
+ * 按32位字处理：输入4字节对齐时直接按字读取消息块（小端），不对齐时整块拷贝到对齐缓存；
+ * 64轮全部展开，常量和移位量编译期确定。
  *
  * @copyright Copyright (c) 2024
  */
@@ -16,14 +19,17 @@
 #define ASSERT(_bool, ...) ((void)0)
 #endif
 
+#define MD5_DIGEST_SIZE 16 // 摘要长度
+#define MD5_BLOCK_SIZE 64  // 分组长度
+
 /**
  * @brief MD5上下文结构体
  */
 typedef struct
 {
-    uint32_t state[4];  // 状态（ABCD）
-    uint32_t count[2];  // 位计数器
-    uint8_t buffer[64]; // 输入缓冲区
+    uint32_t state[4];                   // 状态（ABCD）
+    uint64_t length;                     // 已输入字节数
+    uint32_t buffer[MD5_BLOCK_SIZE / 4]; // 输入缓冲区（按字对齐）
 } md5_ctx_t;
 
 /**
@@ -1,67 +1,180 @@
 #include "./rsa.h"
-#include <math.h>
-#include <stdlib.h>
+#include <string.h>
 
-// 初始化RSA密钥
-void rsa_init(rsa_key_t *key, uint64_t n, uint64_t e, uint64_t d)
+// SHA-256 的 DigestInfo 前缀（DER）
+static const uint8_t rsa_sha256_prefix[] = {
+    0x30, 0x31, 0x30, 0x0d, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01,
+    0x65, 0x03, 0x04, 0x02, 0x01, 0x05, 0x00, 0x04, 0x20};
+
+bool rsa_public_key_init(rsa_public_key_t *key, const uint8_t *modulus, uint32_t length, uint32_t e)
 {
     ASSERT(key != NULL);
-    key->n = n;
-    key->e = e;
-    key->d = d;
-}
+    ASSERT(modulus != NULL);
 
-// 快速幂模运算
-static uint64_t mod_exp(uint64_t base, uint64_t exp, uint64_t mod)
-{
-    uint64_t result = 1;
-    base = base % mod;
-    while (exp > 0)
+    bignum_t n;
+    if (!bignum_from_bytes(&n, modulus, length, (uint16_t)((length + 3) / 4)))
     {
-        if (exp % 2 == 1)
-        {
-            result = (result * base) % mod;
-        }
-        exp = exp >> 1;
-        base = (base * base) % mod;
+        return false;
     }
-    return result;
+    uint32_t bits = bignum_bits(&n);
+    if (bits < RSA_BITS_MIN || bits > RSA_BITS_MAX || e < 3 || (e & 1) == 0)
+    {
+        return false;
+    }
+
+    // 字数按有效位数重新确定，去掉高位的0字
+    n.size = (uint16_t)((bits + 31) / 32);
+    if (!bignum_mont_init(&key->mont, &n))
+    {
+        return false;
+    }
+    key->e = e;
+    key->bits = (uint16_t)bits;
+    key->size = (uint16_t)((bits + 7) / 8);
+    return true;
 }
 
-// RSA加密
-void rsa_encrypt(const rsa_key_t *key, uint8_t *ciphertext, const uint8_t *plaintext, uint32_t length)
+// 公钥运算：em = signature ^ e mod n，输出 key->size 字节
+static bool rsa_public(const rsa_public_key_t *key, const uint8_t *signature, uint32_t length, uint8_t *em)
 {
-    ASSERT(key != NULL);
-    ASSERT(plaintext != NULL);
-    ASSERT(ciphertext != NULL);
+    if (length != key->size)
+    {
+        return false;
+    }
 
-    for (uint32_t i = 0; i < length; i++)
+    bignum_t s;
+    if (!bignum_from_bytes(&s, signature, length, key->mont.n.size) || bignum_cmp(&s, &key->mont.n) >= 0)
     {
-        ciphertext[i] = (uint8_t)mod_exp(plaintext[i], key->e, key->n);
+        return false; // 签名值必须小于模数
     }
+
+    bignum_t table[1]; // 公钥指数很短，窗口取1
+    bignum_mont_exp(&key->mont, &s, &s, &key->e, 1, table, 1);
+    bignum_to_bytes(&s, em, key->size);
+    return true;
 }
 
-// RSA解密
-void rsa_decrypt(const rsa_key_t *key, const uint8_t *ciphertext, uint8_t *decryptedtext, uint32_t length)
+bool rsa_verify_pkcs1_sha256(const rsa_public_key_t *key, const uint8_t digest[SHA256_DIGEST_SIZE],
+                             const uint8_t *signature, uint32_t length)
 {
     ASSERT(key != NULL);
-    ASSERT(ciphertext != NULL);
-    ASSERT(decryptedtext != NULL);
+    ASSERT(digest != NULL);
+    ASSERT(signature != NULL);
+
+    uint8_t em[RSA_BITS_MAX / 8];
+    if (!rsa_public(key, signature, length, em))
+    {
+        return false;
+    }
 
-    for (uint32_t i = 0; i < length; i++)
+    // EM = 00 01 FF..FF 00 || DigestInfo || H，逐字节比较期望编码，不提前退出
+    uint32_t tail = sizeof(rsa_sha256_prefix) + SHA256_DIGEST_SIZE;
+    uint32_t pad_end = key->size - tail - 1; // 分隔符 00 的位置
+    uint8_t diff = em[0] | (em[1] ^ 0x01) | em[pad_end];
+    for (uint32_t i = 2; i < pad_end; i++)
     {
-        decryptedtext[i] = (uint8_t)mod_exp(ciphertext[i], key->d, key->n);
+        diff |= em[i] ^ 0xFF;
     }
+    for (uint32_t i = 0; i < sizeof(rsa_sha256_prefix); i++)
+    {
+        diff |= em[pad_end + 1 + i] ^ rsa_sha256_prefix[i];
+    }
+    for (uint32_t i = 0; i < SHA256_DIGEST_SIZE; i++)
+    {
+        diff |= em[key->size - SHA256_DIGEST_SIZE + i] ^ digest[i];
+    }
+    return diff == 0;
 }
 
-// RSA加密更新接口
-void rsa_encrypt_update(const rsa_key_t *key, uint8_t *ciphertext, const uint8_t *plaintext, uint32_t length)
+// MGF1-SHA-256：mask ^= MGF1(seed)，直接异或到 mask 上
+static void rsa_mgf1_xor(uint8_t *mask, uint32_t length, const uint8_t seed[SHA256_DIGEST_SIZE])
 {
-    rsa_encrypt(key, ciphertext, plaintext, length);
+    uint8_t block[SHA256_DIGEST_SIZE];
+    for (uint32_t counter = 0, offset = 0; offset < length; counter++)
+    {
+        uint8_t c[4] = {(uint8_t)(counter >> 24), (uint8_t)(counter >> 16), (uint8_t)(counter >> 8), (uint8_t)counter};
+        sha256_ctx_t ctx;
+        sha256_init(&ctx);
+        sha256_update(&ctx, seed, SHA256_DIGEST_SIZE);
+        sha256_update(&ctx, c, sizeof(c));
+        sha256_final(&ctx, block);
+        for (uint32_t i = 0; i < SHA256_DIGEST_SIZE && offset < length; i++, offset++)
+        {
+            mask[offset] ^= block[i];
+        }
+    }
 }
 
-// RSA解密更新接口
-void rsa_decrypt_update(const rsa_key_t *key, const uint8_t *ciphertext, uint8_t *decryptedtext, uint32_t length)
+bool rsa_verify_pss_sha256(const rsa_public_key_t *key, const uint8_t digest[SHA256_DIGEST_SIZE],
+                           const uint8_t *signature, uint32_t length, int32_t salt_length)
 {
-    rsa_decrypt(key, ciphertext, decryptedtext, length);
+    ASSERT(key != NULL);
+    ASSERT(digest != NULL);
+    ASSERT(signature != NULL);
+
+    uint8_t buff[RSA_BITS_MAX / 8];
+    if (!rsa_public(key, signature, length, buff))
+    {
+        return false;
+    }
+
+    // emBits = modBits - 1；模数位数为 8k+1 时编码比模数少一个字节，首字节必须为0
+    uint32_t em_bits = key->bits - 1;
+    uint32_t em_length = (em_bits + 7) / 8;
+    uint8_t *em = buff + (key->size - em_length);
+    uint8_t diff = (key->size != em_length) ? buff[0] : 0;
+
+    // EM = maskedDB || H || BC
+    uint32_t db_length = em_length - SHA256_DIGEST_SIZE - 1;
+    uint8_t *db = em;
+    const uint8_t *h = em + db_length;
+    uint8_t top_mask = (uint8_t)(0xFF >> (8 * em_length - em_bits));
+    diff |= em[em_length - 1] ^ 0xBC;
+    diff |= db[0] & ~top_mask;
+
+    rsa_mgf1_xor(db, db_length, h);
+    db[0] &= top_mask;
+
+    // DB = 00..00 || 01 || salt
+    uint32_t one = 0; // 01 的位置
+    if (salt_length == RSA_PSS_SALT_AUTO)
+    {
+        // 找第一个非零字节（盐长是公开信息，允许按数据长度扫描）
+        while (one < db_length && db[one] == 0)
+        {
+            one++;
+        }
+        if (one >= db_length)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        if (salt_length < 0 || (uint32_t)salt_length + 1 > db_length)
+        {
+            return false;
+        }
+        one = db_length - (uint32_t)salt_length - 1;
+        for (uint32_t i = 0; i < one; i++)
+        {
+            diff |= db[i];
+        }
+    }
+    diff |= db[one] ^ 0x01;
+
+    // H' = SHA-256(00*8 || mHash || salt)
+    static const uint8_t zeros[8] = {0};
+    uint8_t hash[SHA256_DIGEST_SIZE];
+    sha256_ctx_t ctx;
+    sha256_init(&ctx);
+    sha256_update(&ctx, zeros, sizeof(zeros));
+    sha256_update(&ctx, digest, SHA256_DIGEST_SIZE);
+    sha256_update(&ctx, db + one + 1, db_length - one - 1);
+    sha256_final(&ctx, hash);
+    for (uint32_t i = 0; i < SHA256_DIGEST_SIZE; i++)
+    {
+        diff |= hash[i] ^ h[i];
+    }
+    return diff == 0;
 }
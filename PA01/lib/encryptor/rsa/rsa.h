@@ -1,72 +1,81 @@
 /**
  * @file rsa.h
  * @author WittXie
- * @brief RSA非对称加密模块
- * @version 0.1
+ * @brief RSA签名验证模块（PKCS#1 v1.5 / PSS，SHA-256）
+ * @version 0.2
  * @date 2024-08-22
+ * @note
+ * 用于固件镜像、RF模块升级文件的签名校验，只含公钥运算；
+ * 模数 1024~BIGNUM_BITS_MAX 位（常用 2048/3072），公钥指数为奇数且不超过32位（常用65537）；
+ * 模幂走蒙哥马利乘法，公钥已预计算 R^2 mod n，单次验签只需约17次模乘（e=65537）；
+ * 编码比较不提前退出，填充错误与摘要错误走相同路径，不泄露出错位置。
+ * BIGNUM_BITS_MAX=4096 时验签栈峰值约3KB，只用2048位密钥时可把 BIGNUM_BITS_MAX 定义为2048减半。
  *
  * @copyright Copyright (c) 2024
  */
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+#include "./../bignum/bignum.h"
+#include "./../sha256/sha256.h"
+
 #ifndef ASSERT
 #define ASSERT(_bool, ...) ((void)0)
 #endif
 
-// RSA密钥结构体
-typedef struct
-{
-    uint64_t n; // 模数
-    uint64_t e; // 公钥指数
-    uint64_t d; // 私钥指数
-} rsa_key_t;
+#define RSA_BITS_MIN 1024            // 最小模数位数
+#define RSA_BITS_MAX BIGNUM_BITS_MAX // 最大模数位数
+#define RSA_PSS_SALT_AUTO (-1)       // PSS 盐长自动识别
 
 /**
- * @brief 初始化RSA密钥
- * @param key 密钥结构体指针
- * @param n 模数
- * @param e 公钥指数
- * @param d 私钥指数
+ * @brief RSA公钥
  */
-void rsa_init(rsa_key_t *key, uint64_t n, uint64_t e, uint64_t d);
-
-/**
- * @brief RSA加密
- * @param key 密钥结构体指针
- * @param plaintext 明文
- * @param ciphertext 密文缓冲区
- * @param length 明文长度
- */
-void rsa_encrypt(const rsa_key_t *key, uint8_t *ciphertext, const uint8_t *plaintext, uint32_t length);
+typedef struct
+{
+    bignum_mont_t mont; // 模数与蒙哥马利参数
+    uint32_t e;         // 公钥指数
+    uint16_t bits;      // 模数位数
+    uint16_t size;      // 模数字节数（签名长度）
+} rsa_public_key_t;
 
 /**
- * @brief RSA加密更新接口
+ * @brief 初始化公钥，预计算蒙哥马利参数
  *
- * @param key 密钥结构体指针
- * @param ciphertext 密文
- * @param plaintext 明文
- * @param length 明文长度
+ * @param key 公钥
+ * @param modulus 模数（大端）
+ * @param length 模数字节数
+ * @param e 公钥指数
+ * @return true 成功
+ * @return false 模数长度不支持、模数为偶数或指数非法
  */
-void rsa_encrypt_update(const rsa_key_t *key, uint8_t *ciphertext, const uint8_t *plaintext, uint32_t length);
+bool rsa_public_key_init(rsa_public_key_t *key, const uint8_t *modulus, uint32_t length, uint32_t e);
 
 /**
- * @brief RSA解密
- * @param key 密钥结构体指针
- * @param ciphertext 密文
- * @param decryptedtext 待解密的明文缓冲区
- * @param length 密文长度
+ * @brief RSASSA-PKCS1-v1_5 验签（SHA-256）
+ *
+ * @param key 公钥
+ * @param digest 消息的SHA-256摘要
+ * @param signature 签名（大端）
+ * @param length 签名字节数，必须等于模数字节数
+ * @return true 签名有效
+ * @return false 签名无效
  */
-void rsa_decrypt(const rsa_key_t *key, const uint8_t *ciphertext, uint8_t *decryptedtext, uint32_t length);
+bool rsa_verify_pkcs1_sha256(const rsa_public_key_t *key, const uint8_t digest[SHA256_DIGEST_SIZE],
+                             const uint8_t *signature, uint32_t length);
 
 /**
- * @brief RSA解密更新接口
+ * @brief RSASSA-PSS 验签（SHA-256，MGF1-SHA-256）
  *
- * @param key 密钥结构体指针
- * @param ciphertext 密文
- * @param decryptedtext 待解密的明文缓冲区
- * @param length 密文长度
+ * @param key 公钥
+ * @param digest 消息的SHA-256摘要
+ * @param signature 签名（大端）
+ * @param length 签名字节数，必须等于模数字节数
+ * @param salt_length 盐长，RSA_PSS_SALT_AUTO 时从编码中识别
+ * @return true 签名有效
+ * @return false 签名无效
  */
-void rsa_decrypt_update(const rsa_key_t *key, const uint8_t *ciphertext, uint8_t *decryptedtext, uint32_t length);
+bool rsa_verify_pss_sha256(const rsa_public_key_t *key, const uint8_t digest[SHA256_DIGEST_SIZE],
+                           const uint8_t *signature, uint32_t length, int32_t salt_length);
@@ -0,0 +1,245 @@
+#include "./sha1.h"
+#include <string.h>
+
+#define SHA1_ROTL(_x, _n) (((_x) << (_n)) | ((_x) >> (32 - (_n))))
+
+// 大端取字：小端机器读字后字节反转
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define SHA1_LOAD(_x, _i) __builtin_bswap32((_x)[_i])
+#else
+#define SHA1_LOAD(_x, _i) ((_x)[_i])
+#endif
+
+// 消息扩展：16字循环缓存
+#define SHA1_W(_i) (w[(_i) & 15] = SHA1_ROTL(w[((_i) + 13) & 15] ^ w[((_i) + 8) & 15] ^ w[((_i) + 2) & 15] ^ w[(_i) & 15], 1))
+
+// 单轮，变量按轮次轮换，不做整体搬移
+#define SHA1_R0(_a, _b, _c, _d, _e, _i)                                                \
+    {                                                                                  \
+        _e += (((_b) & ((_c) ^ (_d))) ^ (_d)) + w[_i] + 0x5A827999 + SHA1_ROTL(_a, 5); \
+        _b = SHA1_ROTL(_b, 30);                                                        \
+    }
+#define SHA1_R1(_a, _b, _c, _d, _e, _i)                                                     \
+    {                                                                                       \
+        _e += (((_b) & ((_c) ^ (_d))) ^ (_d)) + SHA1_W(_i) + 0x5A827999 + SHA1_ROTL(_a, 5); \
+        _b = SHA1_ROTL(_b, 30);                                                             \
+    }
+#define SHA1_R2(_a, _b, _c, _d, _e, _i)                                          \
+    {                                                                            \
+        _e += ((_b) ^ (_c) ^ (_d)) + SHA1_W(_i) + 0x6ED9EBA1 + SHA1_ROTL(_a, 5); \
+        _b = SHA1_ROTL(_b, 30);                                                  \
+    }
+#define SHA1_R3(_a, _b, _c, _d, _e, _i)                                                              \
+    {                                                                                                \
+        _e += ((((_b) | (_c)) & (_d)) | ((_b) & (_c))) + SHA1_W(_i) + 0x8F1BBCDC + SHA1_ROTL(_a, 5); \
+        _b = SHA1_ROTL(_b, 30);                                                                      \
+    }
+#define SHA1_R4(_a, _b, _c, _d, _e, _i)                                          \
+    {                                                                            \
+        _e += ((_b) ^ (_c) ^ (_d)) + SHA1_W(_i) + 0xCA62C1D6 + SHA1_ROTL(_a, 5); \
+        _b = SHA1_ROTL(_b, 30);                                                  \
+    }
+
+// 填充数据
+static const uint8_t sha1_padding[64] = {0x80};
+
+// 初始化SHA-1上下文
+void sha1_init(sha1_ctx_t *ctx)
+{
+    ASSERT(ctx != NULL);
+    ctx->length = 0;
+    ctx->state[0] = 0x67452301;
+    ctx->state[1] = 0xEFCDAB89;
+    ctx->state[2] = 0x98BADCFE;
+    ctx->state[3] = 0x10325476;
+    ctx->state[4] = 0xC3D2E1F0;
+}
+
+// 处理 count 个连续分组，x 必须4字节对齐
+static void sha1_transform(uint32_t state[5], const uint32_t *x, uint32_t count)
+{
+    uint32_t w[16];
+
+    for (; count > 0; count--, x += 16)
+    {
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+        for (uint8_t i = 0; i < 16; i++)
+        {
+            w[i] = SHA1_LOAD(x, i);
+        }
+
+        // 第1~16轮：消息字直接取自分组
+        SHA1_R0(a, b, c, d, e, 0);
+        SHA1_R0(e, a, b, c, d, 1);
+        SHA1_R0(d, e, a, b, c, 2);
+        SHA1_R0(c, d, e, a, b, 3);
+        SHA1_R0(b, c, d, e, a, 4);
+        SHA1_R0(a, b, c, d, e, 5);
+        SHA1_R0(e, a, b, c, d, 6);
+        SHA1_R0(d, e, a, b, c, 7);
+        SHA1_R0(c, d, e, a, b, 8);
+        SHA1_R0(b, c, d, e, a, 9);
+        SHA1_R0(a, b, c, d, e, 10);
+        SHA1_R0(e, a, b, c, d, 11);
+        SHA1_R0(d, e, a, b, c, 12);
+        SHA1_R0(c, d, e, a, b, 13);
+        SHA1_R0(b, c, d, e, a, 14);
+        SHA1_R0(a, b, c, d, e, 15);
+
+        // 第17~20轮：开始消息扩展
+        SHA1_R1(e, a, b, c, d, 16);
+        SHA1_R1(d, e, a, b, c, 17);
+        SHA1_R1(c, d, e, a, b, 18);
+        SHA1_R1(b, c, d, e, a, 19);
+
+        // 第21~40轮
+        SHA1_R2(a, b, c, d, e, 20);
+        SHA1_R2(e, a, b, c, d, 21);
+        SHA1_R2(d, e, a, b, c, 22);
+        SHA1_R2(c, d, e, a, b, 23);
+        SHA1_R2(b, c, d, e, a, 24);
+        SHA1_R2(a, b, c, d, e, 25);
+        SHA1_R2(e, a, b, c, d, 26);
+        SHA1_R2(d, e, a, b, c, 27);
+        SHA1_R2(c, d, e, a, b, 28);
+        SHA1_R2(b, c, d, e, a, 29);
+        SHA1_R2(a, b, c, d, e, 30);
+        SHA1_R2(e, a, b, c, d, 31);
+        SHA1_R2(d, e, a, b, c, 32);
+        SHA1_R2(c, d, e, a, b, 33);
+        SHA1_R2(b, c, d, e, a, 34);
+        SHA1_R2(a, b, c, d, e, 35);
+        SHA1_R2(e, a, b, c, d, 36);
+        SHA1_R2(d, e, a, b, c, 37);
+        SHA1_R2(c, d, e, a, b, 38);
+        SHA1_R2(b, c, d, e, a, 39);
+
+        // 第41~60轮
+        SHA1_R3(a, b, c, d, e, 40);
+        SHA1_R3(e, a, b, c, d, 41);
+        SHA1_R3(d, e, a, b, c, 42);
+        SHA1_R3(c, d, e, a, b, 43);
+        SHA1_R3(b, c, d, e, a, 44);
+        SHA1_R3(a, b, c, d, e, 45);
+        SHA1_R3(e, a, b, c, d, 46);
+        SHA1_R3(d, e, a, b, c, 47);
+        SHA1_R3(c, d, e, a, b, 48);
+        SHA1_R3(b, c, d, e, a, 49);
+        SHA1_R3(a, b, c, d, e, 50);
+        SHA1_R3(e, a, b, c, d, 51);
+        SHA1_R3(d, e, a, b, c, 52);
+        SHA1_R3(c, d, e, a, b, 53);
+        SHA1_R3(b, c, d, e, a, 54);
+        SHA1_R3(a, b, c, d, e, 55);
+        SHA1_R3(e, a, b, c, d, 56);
+        SHA1_R3(d, e, a, b, c, 57);
+        SHA1_R3(c, d, e, a, b, 58);
+        SHA1_R3(b, c, d, e, a, 59);
+
+        // 第61~80轮
+        SHA1_R4(a, b, c, d, e, 60);
+        SHA1_R4(e, a, b, c, d, 61);
+        SHA1_R4(d, e, a, b, c, 62);
+        SHA1_R4(c, d, e, a, b, 63);
+        SHA1_R4(b, c, d, e, a, 64);
+        SHA1_R4(a, b, c, d, e, 65);
+        SHA1_R4(e, a, b, c, d, 66);
+        SHA1_R4(d, e, a, b, c, 67);
+        SHA1_R4(c, d, e, a, b, 68);
+        SHA1_R4(b, c, d, e, a, 69);
+        SHA1_R4(a, b, c, d, e, 70);
+        SHA1_R4(e, a, b, c, d, 71);
+        SHA1_R4(d, e, a, b, c, 72);
+        SHA1_R4(c, d, e, a, b, 73);
+        SHA1_R4(b, c, d, e, a, 74);
+        SHA1_R4(a, b, c, d, e, 75);
+        SHA1_R4(e, a, b, c, d, 76);
+        SHA1_R4(d, e, a, b, c, 77);
+        SHA1_R4(c, d, e, a, b, 78);
+        SHA1_R4(b, c, d, e, a, 79);
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+    }
+}
+
+// 更新SHA-1哈希计算
+void sha1_update(sha1_ctx_t *ctx, const uint8_t *input, uint32_t input_len)
+{
+    ASSERT(ctx != NULL);
+    ASSERT(input != NULL || input_len == 0);
+
+    uint32_t index = (uint32_t)(ctx->length & 0x3F);
+    ctx->length += input_len;
+
+    // 先补满缓冲区
+    if (index != 0)
+    {
+        uint32_t part_len = SHA1_BLOCK_SIZE - index;
+        if (input_len < part_len)
+        {
+            memcpy((uint8_t *)ctx->buffer + index, input, input_len);
+            return;
+        }
+        memcpy((uint8_t *)ctx->buffer + index, input, part_len);
+        sha1_transform(ctx->state, ctx->buffer, 1);
+        input += part_len;
+        input_len -= part_len;
+    }
+
+    // 整块：对齐时直接按字处理，否则逐块拷贝到缓冲区
+    uint32_t blocks = input_len / SHA1_BLOCK_SIZE;
+    if (((uintptr_t)input & 3) == 0)
+    {
+        sha1_transform(ctx->state, (const uint32_t *)input, blocks);
+        input += blocks * SHA1_BLOCK_SIZE;
+    }
+    else
+    {
+        for (; blocks > 0; blocks--, input += SHA1_BLOCK_SIZE)
+        {
+            memcpy(ctx->buffer, input, SHA1_BLOCK_SIZE);
+            sha1_transform(ctx->state, ctx->buffer, 1);
+        }
+    }
+    memcpy(ctx->buffer, input, input_len % SHA1_BLOCK_SIZE);
+}
+
+// 完成SHA-1哈希计算并输出结果
+void sha1_final(sha1_ctx_t *ctx, uint8_t output[20])
+{
+    ASSERT(ctx != NULL);
+    ASSERT(output != NULL);
+
+    // 位长度，大端
+    uint64_t bits = ctx->length << 3;
+    uint8_t length[8];
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        length[i] = (uint8_t)(bits >> (56 - 8 * i));
+    }
+
+    uint32_t index = (uint32_t)(ctx->length & 0x3F);
+    sha1_update(ctx, sha1_padding, (index < 56) ? (56 - index) : (120 - index));
+    sha1_update(ctx, length, 8);
+
+    for (uint8_t i = 0; i < 20 / 4; i++)
+    {
+        output[4 * i] = (uint8_t)(ctx->state[i] >> 24);
+        output[4 * i + 1] = (uint8_t)(ctx->state[i] >> 16);
+        output[4 * i + 2] = (uint8_t)(ctx->state[i] >> 8);
+        output[4 * i + 3] = (uint8_t)ctx->state[i];
+    }
+}
+
+// 计算数据的SHA-1哈希值
+void sha1_calculate(const uint8_t *data, uint32_t length, uint8_t output[20])
+{
+    sha1_ctx_t ctx;
+    sha1_init(&ctx);
+    sha1_update(&ctx, data, length);
+    sha1_final(&ctx, output);
+}
@@ -0,0 +1,201 @@
+#include "./sha256.h"
+#include <string.h>
+
+#define SHA256_ROTR(_x, _n) (((_x) >> (_n)) | ((_x) << (32 - (_n))))
+
+// 大端取字：小端机器读字后字节反转
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define SHA256_LOAD(_x, _i) __builtin_bswap32((_x)[_i])
+#else
+#define SHA256_LOAD(_x, _i) ((_x)[_i])
+#endif
+
+#define SHA256_S0(_x) (SHA256_ROTR(_x, 2) ^ SHA256_ROTR(_x, 13) ^ SHA256_ROTR(_x, 22))
+#define SHA256_S1(_x) (SHA256_ROTR(_x, 6) ^ SHA256_ROTR(_x, 11) ^ SHA256_ROTR(_x, 25))
+#define SHA256_s0(_x) (SHA256_ROTR(_x, 7) ^ SHA256_ROTR(_x, 18) ^ ((_x) >> 3))
+#define SHA256_s1(_x) (SHA256_ROTR(_x, 17) ^ SHA256_ROTR(_x, 19) ^ ((_x) >> 10))
+#define SHA256_CH(_e, _f, _g) ((_g) ^ ((_e) & ((_f) ^ (_g))))
+#define SHA256_MAJ(_a, _b, _c) (((_a) & (_b)) | ((_c) & ((_a) | (_b))))
+
+// 消息扩展：16字循环缓存
+#define SHA256_W(_i) (w[(_i) & 15] += SHA256_s1(w[((_i) + 14) & 15]) + w[((_i) + 9) & 15] + SHA256_s0(w[((_i) + 1) & 15]))
+
+// 单轮，变量按轮次轮换：d += t1，h = t1 + t2
+#define SHA256_ROUND(_a, _b, _c, _d, _e, _f, _g, _h, _k, _w)                      \
+    {                                                                             \
+        uint32_t t1 = (_h) + SHA256_S1(_e) + SHA256_CH(_e, _f, _g) + (_k) + (_w); \
+        _d += t1;                                                                 \
+        _h = t1 + SHA256_S0(_a) + SHA256_MAJ(_a, _b, _c);                         \
+    }
+#define SHA256_R0(_a, _b, _c, _d, _e, _f, _g, _h, _i) SHA256_ROUND(_a, _b, _c, _d, _e, _f, _g, _h, SHA256_K[_i], w[_i])
+#define SHA256_R1(_a, _b, _c, _d, _e, _f, _g, _h, _i) SHA256_ROUND(_a, _b, _c, _d, _e, _f, _g, _h, SHA256_K[_i], SHA256_W(_i))
+
+static const uint32_t SHA256_K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+// 填充数据
+static const uint8_t sha256_padding[64] = {0x80};
+
+// 初始化SHA-256上下文
+void sha256_init(sha256_ctx_t *ctx)
+{
+    ASSERT(ctx != NULL);
+    ctx->length = 0;
+    ctx->state[0] = 0x6a09e667;
+    ctx->state[1] = 0xbb67ae85;
+    ctx->state[2] = 0x3c6ef372;
+    ctx->state[3] = 0xa54ff53a;
+    ctx->state[4] = 0x510e527f;
+    ctx->state[5] = 0x9b05688c;
+    ctx->state[6] = 0x1f83d9ab;
+    ctx->state[7] = 0x5be0cd19;
+}
+
+// 处理 count 个连续分组，x 必须4字节对齐
+static void sha256_transform(uint32_t state[8], const uint32_t *x, uint32_t count)
+{
+    uint32_t w[16];
+
+    for (; count > 0; count--, x += 16)
+    {
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+        for (uint8_t i = 0; i < 16; i++)
+        {
+            w[i] = SHA256_LOAD(x, i);
+        }
+
+        // 第1~16轮：消息字直接取自分组
+        SHA256_R0(a, b, c, d, e, f, g, h, 0);
+        SHA256_R0(h, a, b, c, d, e, f, g, 1);
+        SHA256_R0(g, h, a, b, c, d, e, f, 2);
+        SHA256_R0(f, g, h, a, b, c, d, e, 3);
+        SHA256_R0(e, f, g, h, a, b, c, d, 4);
+        SHA256_R0(d, e, f, g, h, a, b, c, 5);
+        SHA256_R0(c, d, e, f, g, h, a, b, 6);
+        SHA256_R0(b, c, d, e, f, g, h, a, 7);
+        SHA256_R0(a, b, c, d, e, f, g, h, 8);
+        SHA256_R0(h, a, b, c, d, e, f, g, 9);
+        SHA256_R0(g, h, a, b, c, d, e, f, 10);
+        SHA256_R0(f, g, h, a, b, c, d, e, 11);
+        SHA256_R0(e, f, g, h, a, b, c, d, 12);
+        SHA256_R0(d, e, f, g, h, a, b, c, 13);
+        SHA256_R0(c, d, e, f, g, h, a, b, 14);
+        SHA256_R0(b, c, d, e, f, g, h, a, 15);
+
+        // 第17~64轮：16轮一组，边扩展边压缩
+        for (uint32_t i = 16; i < 64; i += 16)
+        {
+            SHA256_R1(a, b, c, d, e, f, g, h, i + 0);
+            SHA256_R1(h, a, b, c, d, e, f, g, i + 1);
+            SHA256_R1(g, h, a, b, c, d, e, f, i + 2);
+            SHA256_R1(f, g, h, a, b, c, d, e, i + 3);
+            SHA256_R1(e, f, g, h, a, b, c, d, i + 4);
+            SHA256_R1(d, e, f, g, h, a, b, c, i + 5);
+            SHA256_R1(c, d, e, f, g, h, a, b, i + 6);
+            SHA256_R1(b, c, d, e, f, g, h, a, i + 7);
+            SHA256_R1(a, b, c, d, e, f, g, h, i + 8);
+            SHA256_R1(h, a, b, c, d, e, f, g, i + 9);
+            SHA256_R1(g, h, a, b, c, d, e, f, i + 10);
+            SHA256_R1(f, g, h, a, b, c, d, e, i + 11);
+            SHA256_R1(e, f, g, h, a, b, c, d, i + 12);
+            SHA256_R1(d, e, f, g, h, a, b, c, i + 13);
+            SHA256_R1(c, d, e, f, g, h, a, b, i + 14);
+            SHA256_R1(b, c, d, e, f, g, h, a, i + 15);
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+}
+
+// 更新SHA-256哈希计算
+void sha256_update(sha256_ctx_t *ctx, const uint8_t *input, uint32_t input_len)
+{
+    ASSERT(ctx != NULL);
+    ASSERT(input != NULL || input_len == 0);
+
+    uint32_t index = (uint32_t)(ctx->length & 0x3F);
+    ctx->length += input_len;
+
+    // 先补满缓冲区
+    if (index != 0)
+    {
+        uint32_t part_len = SHA256_BLOCK_SIZE - index;
+        if (input_len < part_len)
+        {
+            memcpy((uint8_t *)ctx->buffer + index, input, input_len);
+            return;
+        }
+        memcpy((uint8_t *)ctx->buffer + index, input, part_len);
+        sha256_transform(ctx->state, ctx->buffer, 1);
+        input += part_len;
+        input_len -= part_len;
+    }
+
+    // 整块：对齐时直接按字处理，否则逐块拷贝到缓冲区
+    uint32_t blocks = input_len / SHA256_BLOCK_SIZE;
+    if (((uintptr_t)input & 3) == 0)
+    {
+        sha256_transform(ctx->state, (const uint32_t *)input, blocks);
+        input += blocks * SHA256_BLOCK_SIZE;
+    }
+    else
+    {
+        for (; blocks > 0; blocks--, input += SHA256_BLOCK_SIZE)
+        {
+            memcpy(ctx->buffer, input, SHA256_BLOCK_SIZE);
+            sha256_transform(ctx->state, ctx->buffer, 1);
+        }
+    }
+    memcpy(ctx->buffer, input, input_len % SHA256_BLOCK_SIZE);
+}
+
+// 完成SHA-256哈希计算并输出结果
+void sha256_final(sha256_ctx_t *ctx, uint8_t output[32])
+{
+    ASSERT(ctx != NULL);
+    ASSERT(output != NULL);
+
+    // 位长度，大端
+    uint64_t bits = ctx->length << 3;
+    uint8_t length[8];
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        length[i] = (uint8_t)(bits >> (56 - 8 * i));
+    }
+
+    uint32_t index = (uint32_t)(ctx->length & 0x3F);
+    sha256_update(ctx, sha256_padding, (index < 56) ? (56 - index) : (120 - index));
+    sha256_update(ctx, length, 8);
+
+    for (uint8_t i = 0; i < 32 / 4; i++)
+    {
+        output[4 * i] = (uint8_t)(ctx->state[i] >> 24);
+        output[4 * i + 1] = (uint8_t)(ctx->state[i] >> 16);
+        output[4 * i + 2] = (uint8_t)(ctx->state[i] >> 8);
+        output[4 * i + 3] = (uint8_t)ctx->state[i];
+    }
+}
+
+// 计算数据的SHA-256哈希值
+void sha256_calculate(const uint8_t *data, uint32_t length, uint8_t output[32])
+{
+    sha256_ctx_t ctx;
+    sha256_init(&ctx);
+    sha256_update(&ctx, data, length);
+    sha256_final(&ctx, output);
+}
@@ -0,0 +1,62 @@
+/**
+ * @file sha256.h
+ * @author WittXie
+ * @brief SHA-256哈希模块
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 接口同 md5。消息字为大端：输入4字节对齐时直接按字读取再字节反转（REV），不对齐时整块拷贝到对齐缓存；
+ * 64轮按8轮一组展开（变量轮换代替赋值），消息扩展用16字循环缓存，与压缩交织计算。
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef ASSERT
+#define ASSERT(_bool, ...) ((void)0)
+#endif
+
+#define SHA256_DIGEST_SIZE 32 // 摘要长度
+#define SHA256_BLOCK_SIZE 64  // 分组长度
+
+/**
+ * @brief SHA-256上下文结构体
+ */
+typedef struct
+{
+    uint32_t state[8];                      // 状态（A~H）
+    uint64_t length;                        // 已输入字节数
+    uint32_t buffer[SHA256_BLOCK_SIZE / 4]; // 输入缓冲区（按字对齐）
+} sha256_ctx_t;
+
+/**
+ * @brief 初始化SHA-256上下文
+ * @param ctx SHA-256上下文指针
+ */
+void sha256_init(sha256_ctx_t *ctx);
+
+/**
+ * @brief 更新SHA-256哈希计算
+ * @param ctx SHA-256上下文指针
+ * @param input 输入数据指针
+ * @param input_len 输入数据长度
+ */
+void sha256_update(sha256_ctx_t *ctx, const uint8_t *input, uint32_t input_len);
+
+/**
+ * @brief 完成SHA-256哈希计算并输出结果
+ * @param ctx SHA-256上下文指针
+ * @param output 输出结果缓冲区（32字节）
+ */
+void sha256_final(sha256_ctx_t *ctx, uint8_t output[32]);
+
+/**
+ * @brief 计算数据的SHA-256哈希值
+ * @param data 数据指针
+ * @param length 数据长度
+ * @param output 输出结果缓冲区（32字节）
+ */
+void sha256_calculate(const uint8_t *data, uint32_t length, uint8_t output[32]);
@@ -16,6 +16,29 @@ void elliptic_filter_init(elliptic_filter_t *filter,
     ASSERT(ripple > 0);
     ASSERT(stopband_attenuation > 0);
 
+    // 未给出系数时按参数设计
+    if (coeff.b0 == 0.0f)
+    {
+        filter_design_t design = {
+            .proto = FILTER_DESIGN_ELLIPTIC,
+            .band = FILTER_DESIGN_LOWPASS,
+            .order = 2,
+            .sample_rate = sample_rate,
+            .freq1 = cutoff_freq,
+            .ripple = ripple,
+            .attenuation = stopband_attenuation,
+        };
+        sos_coeff_t sos;
+        if (filter_design(&design, &sos, 1) == 1)
+        {
+            coeff.b0 = sos.b0;
+            coeff.b1 = sos.b1;
+            coeff.b2 = sos.b2;
+            coeff.a1 = sos.a1;
+            coeff.a2 = sos.a2;
+        }
+    }
+
     // 设置滤波器的参数
     filter->coeff = coeff;
     filter->cutoff_freq = cutoff_freq;
@@ -12,6 +12,8 @@
 #include <math.h>
 #include <stdint.h>
 
+#include "./filter_design.h"
+
 #ifndef ASSERT
 #define ASSERT(_bool, ...) ((void)0)
 #endif
@@ -41,7 +43,7 @@ typedef struct
 
 /**
  * @brief 初始化椭圆滤波器
- * @param coeff 滤波器系数
+ * @param coeff 滤波器系数，b0为0时由后面的参数设计二阶椭圆低通
  * @param filter 滤波器结构体指针
  * @param cutoff_freq 截止频率
  * @param sample_rate 采样率
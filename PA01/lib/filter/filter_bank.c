@@ -0,0 +1,216 @@
+#include "./filter_bank.h"
+#include <stdlib.h>
+#include <string.h>
+
+// 初始化一阶低通级联
+void filter_bank_lp_init(filter_bank_t *bank, uint16_t channels, float *state, float cutoff_freq, float sample_rate, uint16_t order)
+{
+    ASSERT(bank != NULL);
+    ASSERT(state != NULL);
+    ASSERT(channels > 0);
+    ASSERT(cutoff_freq > 0);
+    ASSERT(sample_rate > 0);
+    ASSERT(order > 0);
+
+    memset(bank, 0, sizeof(filter_bank_t));
+    bank->kernel = FILTER_BANK_LP;
+    bank->channels = channels;
+    bank->stages = order;
+    bank->state = state;
+    bank->alpha = 1.0f / (1.0 + (1.0 / (2.0 * M_PI * cutoff_freq)) * sample_rate); // 同 lp_filter_init
+    filter_bank_reset(bank);
+}
+
+// 初始化二阶节级联
+void filter_bank_biquad_init(filter_bank_t *bank, uint16_t channels, float *state, const sos_coeff_t *coeff, uint16_t sections)
+{
+    ASSERT(bank != NULL);
+    ASSERT(state != NULL);
+    ASSERT(coeff != NULL);
+    ASSERT(channels > 0);
+    ASSERT(sections > 0);
+
+    memset(bank, 0, sizeof(filter_bank_t));
+    bank->kernel = FILTER_BANK_BIQUAD;
+    bank->channels = channels;
+    bank->stages = sections;
+    bank->state = state;
+    bank->coeff = coeff;
+    filter_bank_reset(bank);
+}
+
+// 初始化滑动平均
+void filter_bank_ma_init(filter_bank_t *bank, uint16_t channels, uint16_t *history, uint32_t *sum, uint16_t window)
+{
+    ASSERT(bank != NULL);
+    ASSERT(history != NULL);
+    ASSERT(sum != NULL);
+    ASSERT(channels > 0);
+    ASSERT(window > 0 && window <= 0xFFFF);
+
+    memset(bank, 0, sizeof(filter_bank_t));
+    bank->kernel = FILTER_BANK_MA;
+    bank->channels = channels;
+    bank->stages = window;
+    bank->history = history;
+    bank->sum = sum;
+    filter_bank_reset(bank);
+}
+
+// 清空状态
+void filter_bank_reset(filter_bank_t *bank)
+{
+    ASSERT(bank != NULL);
+
+    switch (bank->kernel)
+    {
+    case FILTER_BANK_LP:
+        memset(bank->state, 0, 2 * bank->channels * sizeof(float));
+        break;
+    case FILTER_BANK_BIQUAD:
+        memset(bank->state, 0, (uint32_t)bank->stages * 2 * bank->channels * sizeof(float));
+        break;
+    case FILTER_BANK_MA:
+        memset(bank->history, 0, (uint32_t)bank->stages * bank->channels * sizeof(uint16_t));
+        memset(bank->sum, 0, bank->channels * sizeof(uint32_t));
+        break;
+    default:
+        break;
+    }
+    bank->pos = 0;
+    bank->is_first = true;
+}
+
+// 一阶低通级联，逐级与 lp_filter 的 _lp_filter 相同
+static void filter_bank_lp_frame(filter_bank_t *bank, float *x)
+{
+    uint16_t channels = bank->channels;
+    float *prev_input = bank->state;
+    float *prev_output = bank->state + channels;
+    float alpha = bank->alpha;
+
+    if (bank->is_first)
+    {
+        for (uint16_t ch = 0; ch < channels; ch++)
+        {
+            prev_input[ch] = x[ch];
+            prev_output[ch] = x[ch];
+        }
+        return;
+    }
+
+    for (uint16_t s = 0; s < bank->stages; s++)
+    {
+        for (uint16_t ch = 0; ch < channels; ch++)
+        {
+            float input = x[ch];
+            prev_output[ch] = alpha * (alpha * input + prev_input[ch] * (1.0f - alpha)) + (1.0f - alpha) * prev_output[ch];
+            prev_input[ch] = input;
+            x[ch] = prev_output[ch];
+        }
+    }
+}
+
+// 二阶节级联，第一帧按直流稳态装入状态，避免从0开始的阶跃过渡
+static void filter_bank_biquad_frame(filter_bank_t *bank, float *x)
+{
+    uint16_t channels = bank->channels;
+    float *z = bank->state;
+    const sos_coeff_t *c = bank->coeff;
+
+    if (bank->is_first)
+    {
+        for (uint16_t s = 0; s < bank->stages; s++, c++, z += 2 * channels)
+        {
+            float gain = (c->b0 + c->b1 + c->b2) / (1.0f + c->a1 + c->a2); // 直流增益
+            for (uint16_t ch = 0; ch < channels; ch++)
+            {
+                float y = gain * x[ch];
+                z[ch] = y - c->b0 * x[ch];
+                z[channels + ch] = c->b2 * x[ch] - c->a2 * y;
+                x[ch] = y;
+            }
+        }
+        return;
+    }
+
+    for (uint16_t s = 0; s < bank->stages; s++, c++, z += 2 * channels)
+    {
+        float b0 = c->b0, b1 = c->b1, b2 = c->b2, a1 = c->a1, a2 = c->a2;
+        float *z1 = z;
+        float *z2 = z + channels;
+        for (uint16_t ch = 0; ch < channels; ch++)
+        {
+            float input = x[ch];
+            float y = b0 * input + z1[ch];
+            z1[ch] = b1 * input - a1 * y + z2[ch];
+            z2[ch] = b2 * input - a2 * y;
+            x[ch] = y;
+        }
+    }
+}
+
+// 滑动平均，第一帧用当前值填满窗口
+static void filter_bank_ma_frame(filter_bank_t *bank, const uint16_t *frame, const uint8_t *index, float full_scale, float *x)
+{
+    uint16_t channels = bank->channels;
+    uint16_t window = bank->stages;
+
+    if (bank->is_first)
+    {
+        for (uint16_t ch = 0; ch < channels; ch++)
+        {
+            for (uint16_t i = 0; i < window; i++)
+            {
+                bank->history[i * channels + ch] = frame[index[ch]];
+            }
+            bank->sum[ch] = (uint32_t)frame[index[ch]] * window;
+        }
+    }
+
+    uint16_t *history = &bank->history[bank->pos * channels];
+    float gain = 1.0f / (full_scale * (float)window);
+    for (uint16_t ch = 0; ch < channels; ch++)
+    {
+        uint16_t sample = frame[index[ch]];
+        bank->sum[ch] += sample - history[ch];
+        history[ch] = sample;
+        x[ch] = (float)bank->sum[ch] * gain;
+    }
+    bank->pos = (bank->pos + 1 == window) ? 0 : bank->pos + 1;
+}
+
+// 处理交错缓存
+void filter_bank_process(filter_bank_t *bank, const uint16_t *buff, uint32_t frames, uint16_t stride, const uint8_t *index, float full_scale, float *output)
+{
+    ASSERT(bank != NULL);
+    ASSERT(buff != NULL);
+    ASSERT(index != NULL);
+    ASSERT(output != NULL);
+
+    for (uint32_t f = 0; f < frames; f++, buff += stride)
+    {
+        if (bank->kernel == FILTER_BANK_MA)
+        {
+            filter_bank_ma_frame(bank, buff, index, full_scale, output);
+        }
+        else
+        {
+            // 解交错
+            for (uint16_t ch = 0; ch < bank->channels; ch++)
+            {
+                output[ch] = buff[index[ch]] / full_scale; // 与 adc / 65535.0f 相同，保证逐位一致
+            }
+
+            if (bank->kernel == FILTER_BANK_LP)
+            {
+                filter_bank_lp_frame(bank, output);
+            }
+            else
+            {
+                filter_bank_biquad_frame(bank, output);
+            }
+        }
+        bank->is_first = false;
+    }
+}
@@ -0,0 +1,105 @@
+/**
+ * @file filter_bank.h
+ * @author WittXie
+ * @brief 多通道滤波器组：共用系数，状态按结构体数组（SoA）存放，一次处理交错的DMA缓存
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 状态布局 state[级][通道]，级外循环、通道内循环：每级系数只加载一次，同级各通道状态连续。
+ * 输入为ADC扫描顺序交错的 uint16_t 缓存，index 给出每个通道在一帧中的位置，边解交错边滤波。
+ * 核:
+ *  LP     : 与 lp_filter 相同的一阶级联，结果逐位一致
+ *  BIQUAD : 二阶节级联，转置直接II型，系数同 sos_filter
+ *  MA     : 滑动平均（一阶CIC），整数累加，无累计误差
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "./sos_filter.h"
+
+#ifndef ASSERT
+#define ASSERT(_bool, ...) ((void)0)
+#endif
+
+#ifndef M_PI
+#define M_PI 3.14159265359f
+#endif
+
+// 滤波核
+enum filter_bank_kernel
+{
+    FILTER_BANK_LP = 0, // 一阶低通级联
+    FILTER_BANK_BIQUAD, // 二阶节级联
+    FILTER_BANK_MA,     // 滑动平均
+};
+
+// 滤波器组结构体
+typedef struct
+{
+    enum filter_bank_kernel kernel; // 滤波核
+    uint16_t channels;              // 通道数
+    uint16_t stages;                // 级数：LP为阶数，BIQUAD为节数，MA为窗口长度
+
+    float alpha;              // LP 系数
+    const sos_coeff_t *coeff; // BIQUAD 系数
+
+    float *state;      // LP: [2][通道]；BIQUAD: [节][2][通道]
+    uint16_t *history; // MA: [窗口][通道] 原始样本
+    uint32_t *sum;     // MA: [通道] 窗口和
+    uint16_t pos;      // MA: 窗口写位置
+    bool is_first;     // 第一帧直接装入状态
+} filter_bank_t;
+
+/**
+ * @brief 初始化一阶低通级联，与 lp_filter_init 参数相同
+ * @param bank 滤波器组
+ * @param channels 通道数
+ * @param state 状态缓存，长度 2 * channels
+ * @param cutoff_freq 截止频率
+ * @param sample_rate 采样率
+ * @param order 阶数
+ */
+void filter_bank_lp_init(filter_bank_t *bank, uint16_t channels, float *state, float cutoff_freq, float sample_rate, uint16_t order);
+
+/**
+ * @brief 初始化二阶节级联
+ * @param bank 滤波器组
+ * @param channels 通道数
+ * @param state 状态缓存，长度 sections * 2 * channels
+ * @param coeff 各节系数，可由 filter_design 生成
+ * @param sections 节数
+ */
+void filter_bank_biquad_init(filter_bank_t *bank, uint16_t channels, float *state, const sos_coeff_t *coeff, uint16_t sections);
+
+/**
+ * @brief 初始化滑动平均
+ * @param bank 滤波器组
+ * @param channels 通道数
+ * @param history 历史缓存，长度 window * channels
+ * @param sum 窗口和缓存，长度 channels
+ * @param window 窗口长度
+ */
+void filter_bank_ma_init(filter_bank_t *bank, uint16_t channels, uint16_t *history, uint32_t *sum, uint16_t window);
+
+/**
+ * @brief 清空状态，下一帧重新装入
+ * @param bank 滤波器组
+ */
+void filter_bank_reset(filter_bank_t *bank);
+
+/**
+ * @brief 处理交错缓存
+ * @param bank 滤波器组
+ * @param buff 交错的原始样本，frames 帧，每帧 stride 个
+ * @param frames 帧数
+ * @param stride 每帧样本数
+ * @param index 各通道在帧内的位置，长度 channels
+ * @param full_scale 原始满量程，输出为 原始值/full_scale
+ * @param output 各通道最后一帧的输出，长度 channels
+ */
+void filter_bank_process(filter_bank_t *bank, const uint16_t *buff, uint32_t frames, uint16_t stride, const uint8_t *index, float full_scale, float *output);
@@ -0,0 +1,481 @@
+#include "./filter_design.h"
+#include <complex.h>
+#include <math.h>
+#include <stdlib.h>
+
+#define FILTER_DESIGN_ROOT_MAX (FILTER_DESIGN_ORDER_MAX * 2) // 带通/带阻后根数翻倍
+#define FILTER_DESIGN_LANDEN_SIZE 7                          // Landen 变换次数
+#define FILTER_DESIGN_EPS 1e-10
+
+typedef double complex zcomplex_t;
+
+// 零极点增益
+typedef struct
+{
+    zcomplex_t zeros[FILTER_DESIGN_ROOT_MAX];
+    zcomplex_t poles[FILTER_DESIGN_ROOT_MAX];
+    uint16_t zero_size;
+    uint16_t pole_size;
+    double gain;
+} zpk_t;
+
+// ---------------------------------------------------------------- 椭圆函数（Orfanidis, Landen变换）
+
+static void landen(double k, double *v)
+{
+    for (int i = 0; i < FILTER_DESIGN_LANDEN_SIZE; i++)
+    {
+        double kp = sqrt(1.0 - k * k);
+        k = (k / (1.0 + kp)) * (k / (1.0 + kp));
+        v[i] = k;
+    }
+}
+
+// cd(u*K, k)
+static zcomplex_t cde(zcomplex_t u, double k)
+{
+    double v[FILTER_DESIGN_LANDEN_SIZE];
+    landen(k, v);
+    zcomplex_t w = ccos(u * M_PI / 2.0);
+    for (int i = FILTER_DESIGN_LANDEN_SIZE - 1; i >= 0; i--)
+    {
+        w = (1.0 + v[i]) * w / (1.0 + v[i] * w * w);
+    }
+    return w;
+}
+
+// sn(u*K, k)
+static zcomplex_t sne(zcomplex_t u, double k)
+{
+    double v[FILTER_DESIGN_LANDEN_SIZE];
+    landen(k, v);
+    zcomplex_t w = csin(u * M_PI / 2.0);
+    for (int i = FILTER_DESIGN_LANDEN_SIZE - 1; i >= 0; i--)
+    {
+        w = (1.0 + v[i]) * w / (1.0 + v[i] * w * w);
+    }
+    return w;
+}
+
+// sn 的反函数，返回以K为单位的自变量
+static zcomplex_t asne(zcomplex_t w, double k)
+{
+    double v[FILTER_DESIGN_LANDEN_SIZE];
+    landen(k, v);
+    for (int i = 0; i < FILTER_DESIGN_LANDEN_SIZE; i++)
+    {
+        double v1 = (i == 0) ? k : v[i - 1];
+        w = w / (1.0 + csqrt(1.0 - w * w * v1 * v1)) * 2.0 / (1.0 + v[i]);
+    }
+    return 1.0 - 2.0 / M_PI * cacos(w);
+}
+
+// 求解椭圆滤波器的度方程，由阶数和 k1 得到选择性因子 k
+static double ellipdeg(uint16_t order, double k1)
+{
+    double k1p = sqrt(1.0 - k1 * k1);
+    double kp = pow(k1p, order);
+    for (uint16_t i = 1; i <= order / 2; i++)
+    {
+        double sn = creal(sne((2.0 * i - 1.0) / order, k1p));
+        kp *= sn * sn * sn * sn;
+    }
+    return sqrt(1.0 - kp * kp);
+}
+
+// ---------------------------------------------------------------- 模拟原型（通带边缘 1 rad/s）
+
+static double zpk_dc_gain(const zpk_t *zpk)
+{
+    zcomplex_t h = 1.0;
+    for (uint16_t i = 0; i < zpk->zero_size; i++)
+    {
+        h *= -zpk->zeros[i];
+    }
+    for (uint16_t i = 0; i < zpk->pole_size; i++)
+    {
+        h /= -zpk->poles[i];
+    }
+    return cabs(h);
+}
+
+static void proto_butterworth(zpk_t *zpk, uint16_t order)
+{
+    for (uint16_t i = 0; i < order; i++)
+    {
+        zpk->poles[i] = cexp(I * M_PI * (2.0 * i + order + 1.0) / (2.0 * order));
+    }
+    zpk->pole_size = order;
+    zpk->zero_size = 0;
+    zpk->gain = 1.0;
+}
+
+static void proto_cheby1(zpk_t *zpk, uint16_t order, double ripple)
+{
+    double eps = sqrt(pow(10.0, ripple / 10.0) - 1.0);
+    double mu = asinh(1.0 / eps) / order;
+    for (uint16_t i = 0; i < order; i++)
+    {
+        double theta = M_PI * (2.0 * i + 1.0) / (2.0 * order);
+        zpk->poles[i] = -sinh(mu) * sin(theta) + I * cosh(mu) * cos(theta);
+    }
+    zpk->pole_size = order;
+    zpk->zero_size = 0;
+    zpk->gain = 1.0;
+    zpk->gain = 1.0 / zpk_dc_gain(zpk);
+    if (order % 2 == 0)
+    {
+        zpk->gain /= sqrt(1.0 + eps * eps); // 偶数阶直流在波纹谷底
+    }
+}
+
+static void proto_cheby2(zpk_t *zpk, uint16_t order, double attenuation)
+{
+    double eps = 1.0 / sqrt(pow(10.0, attenuation / 10.0) - 1.0);
+    double mu = asinh(1.0 / eps) / order;
+    zpk->zero_size = 0;
+    for (uint16_t i = 0; i < order; i++)
+    {
+        double theta = M_PI * (2.0 * i + 1.0) / (2.0 * order);
+        zpk->poles[i] = 1.0 / (-sinh(mu) * sin(theta) + I * cosh(mu) * cos(theta));
+        if (fabs(cos(theta)) > FILTER_DESIGN_EPS)
+        {
+            zpk->zeros[zpk->zero_size++] = I / cos(theta);
+        }
+    }
+    zpk->pole_size = order;
+    zpk->gain = 1.0;
+    zpk->gain = 1.0 / zpk_dc_gain(zpk);
+}
+
+static void proto_elliptic(zpk_t *zpk, uint16_t order, double ripple, double attenuation)
+{
+    double eps_p = sqrt(pow(10.0, ripple / 10.0) - 1.0);
+    double eps_s = sqrt(pow(10.0, attenuation / 10.0) - 1.0);
+    double k1 = eps_p / eps_s;
+    double k = ellipdeg(order, k1);
+    double v0 = creal(-I * asne(I / eps_p, k1) / order);
+
+    zpk->zero_size = 0;
+    zpk->pole_size = 0;
+    for (uint16_t i = 1; i <= order / 2; i++)
+    {
+        double u = (2.0 * i - 1.0) / order;
+        double zeta = creal(cde(u, k));
+        zcomplex_t zero = I / (k * zeta);
+        zcomplex_t pole = I * cde(u - I * v0, k);
+        zpk->zeros[zpk->zero_size++] = zero;
+        zpk->zeros[zpk->zero_size++] = conj(zero);
+        zpk->poles[zpk->pole_size++] = pole;
+        zpk->poles[zpk->pole_size++] = conj(pole);
+    }
+    if (order % 2 == 1)
+    {
+        zpk->poles[zpk->pole_size++] = creal(I * sne(I * v0, k));
+    }
+
+    zpk->gain = 1.0;
+    zpk->gain = 1.0 / zpk_dc_gain(zpk);
+    if (order % 2 == 0)
+    {
+        zpk->gain /= sqrt(1.0 + eps_p * eps_p);
+    }
+}
+
+// ---------------------------------------------------------------- 频率变换
+
+static zcomplex_t zpk_prod(const zcomplex_t *roots, uint16_t size, zcomplex_t offset)
+{
+    zcomplex_t prod = 1.0;
+    for (uint16_t i = 0; i < size; i++)
+    {
+        prod *= offset - roots[i];
+    }
+    return prod;
+}
+
+static void zpk_lp2lp(zpk_t *zpk, double wc)
+{
+    for (uint16_t i = 0; i < zpk->zero_size; i++)
+    {
+        zpk->zeros[i] *= wc;
+    }
+    for (uint16_t i = 0; i < zpk->pole_size; i++)
+    {
+        zpk->poles[i] *= wc;
+    }
+    zpk->gain *= pow(wc, zpk->pole_size - zpk->zero_size);
+}
+
+static void zpk_lp2hp(zpk_t *zpk, double wc)
+{
+    zpk->gain *= creal(zpk_prod(zpk->zeros, zpk->zero_size, 0) / zpk_prod(zpk->poles, zpk->pole_size, 0));
+    for (uint16_t i = 0; i < zpk->zero_size; i++)
+    {
+        zpk->zeros[i] = wc / zpk->zeros[i];
+    }
+    for (uint16_t i = 0; i < zpk->pole_size; i++)
+    {
+        zpk->poles[i] = wc / zpk->poles[i];
+    }
+    while (zpk->zero_size < zpk->pole_size)
+    {
+        zpk->zeros[zpk->zero_size++] = 0;
+    }
+}
+
+// 每个根 r 变为 r*bw/2 ± sqrt((r*bw/2)^2 - w0^2)
+static uint16_t zpk_roots_bp(zcomplex_t *roots, uint16_t size, double w0, double bw)
+{
+    for (uint16_t i = 0; i < size; i++)
+    {
+        zcomplex_t r = roots[i] * bw / 2.0;
+        zcomplex_t d = csqrt(r * r - w0 * w0);
+        roots[i] = r + d;
+        roots[size + i] = r - d;
+    }
+    return size * 2;
+}
+
+static void zpk_lp2bp(zpk_t *zpk, double w0, double bw)
+{
+    uint16_t degree = zpk->pole_size - zpk->zero_size;
+    zpk->zero_size = zpk_roots_bp(zpk->zeros, zpk->zero_size, w0, bw);
+    zpk->pole_size = zpk_roots_bp(zpk->poles, zpk->pole_size, w0, bw);
+    for (uint16_t i = 0; i < degree; i++)
+    {
+        zpk->zeros[zpk->zero_size++] = 0;
+    }
+    zpk->gain *= pow(bw, degree);
+}
+
+static void zpk_lp2bs(zpk_t *zpk, double w0, double bw)
+{
+    uint16_t degree = zpk->pole_size - zpk->zero_size;
+    zpk->gain *= creal(zpk_prod(zpk->zeros, zpk->zero_size, 0) / zpk_prod(zpk->poles, zpk->pole_size, 0));
+    for (uint16_t i = 0; i < zpk->zero_size; i++)
+    {
+        zpk->zeros[i] = 1.0 / zpk->zeros[i];
+    }
+    for (uint16_t i = 0; i < zpk->pole_size; i++)
+    {
+        zpk->poles[i] = 1.0 / zpk->poles[i];
+    }
+    zpk->zero_size = zpk_roots_bp(zpk->zeros, zpk->zero_size, w0, bw);
+    zpk->pole_size = zpk_roots_bp(zpk->poles, zpk->pole_size, w0, bw);
+    for (uint16_t i = 0; i < degree; i++)
+    {
+        zpk->zeros[zpk->zero_size++] = I * w0;
+        zpk->zeros[zpk->zero_size++] = -I * w0;
+    }
+}
+
+// 双线性变换，无穷远零点映射到 z=-1
+static void zpk_bilinear(zpk_t *zpk, double fs)
+{
+    double fs2 = 2.0 * fs;
+    zpk->gain *= creal(zpk_prod(zpk->zeros, zpk->zero_size, fs2) / zpk_prod(zpk->poles, zpk->pole_size, fs2));
+    for (uint16_t i = 0; i < zpk->zero_size; i++)
+    {
+        zpk->zeros[i] = (fs2 + zpk->zeros[i]) / (fs2 - zpk->zeros[i]);
+    }
+    for (uint16_t i = 0; i < zpk->pole_size; i++)
+    {
+        zpk->poles[i] = (fs2 + zpk->poles[i]) / (fs2 - zpk->poles[i]);
+    }
+    while (zpk->zero_size < zpk->pole_size)
+    {
+        zpk->zeros[zpk->zero_size++] = -1.0;
+    }
+}
+
+// ---------------------------------------------------------------- 配对成二阶节
+
+// 取出一对根：优先取离 target 最近的复根及其共轭，否则取两个最近的实根
+static uint16_t zpk_take_pair(zcomplex_t *roots, uint16_t *size, zcomplex_t target, zcomplex_t *pair)
+{
+    if (*size == 0)
+    {
+        return 0;
+    }
+
+    // 最近的根
+    uint16_t best = 0;
+    for (uint16_t i = 1; i < *size; i++)
+    {
+        if (cabs(roots[i] - target) < cabs(roots[best] - target))
+        {
+            best = i;
+        }
+    }
+    pair[0] = roots[best];
+    roots[best] = roots[--(*size)];
+
+    // 复根取共轭，实根再取一个最近的实根
+    bool is_complex = fabs(cimag(pair[0])) > FILTER_DESIGN_EPS;
+    int16_t mate = -1;
+    for (uint16_t i = 0; i < *size; i++)
+    {
+        bool is_match = is_complex ? (cabs(roots[i] - conj(pair[0])) < 1e-6) : (fabs(cimag(roots[i])) <= FILTER_DESIGN_EPS);
+        if (is_match && (mate < 0 || cabs(roots[i] - target) < cabs(roots[mate] - target)))
+        {
+            mate = i;
+        }
+    }
+    if (mate < 0)
+    {
+        return 1;
+    }
+    pair[1] = is_complex ? conj(pair[0]) : roots[mate];
+    roots[mate] = roots[--(*size)];
+    return 2;
+}
+
+// 一对根在 z 处的模 |(z - r0)(z - r1)|
+static double zpk_pair_abs(const zcomplex_t *pair, uint16_t count, zcomplex_t z)
+{
+    double h = 1.0;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        h *= cabs(z - pair[i]);
+    }
+    return h;
+}
+
+// w 为通带参考角频率（rad/样本），各节在 w 处归一化后均分总增益，避免级联中间级饱和或下溢
+static uint16_t zpk_to_sos(zpk_t *zpk, sos_coeff_t *sos, uint16_t size, double w)
+{
+    uint16_t sections = (zpk->pole_size + 1) / 2;
+    if (sections > size)
+    {
+        return 0;
+    }
+
+    zcomplex_t z = cexp(I * w);
+    double magnitude[FILTER_DESIGN_ORDER_MAX]; // 各节在 w 处的幅值
+    double residual = fabs(zpk->gain);         // 各节归一化后剩余的总增益
+
+    // 由最靠近单位圆的极点开始配对，排在最后，峰值高的节在后
+    for (int16_t s = sections - 1; s >= 0; s--)
+    {
+        uint16_t best = 0;
+        for (uint16_t i = 1; i < zpk->pole_size; i++)
+        {
+            if (cabs(zpk->poles[i]) > cabs(zpk->poles[best]))
+            {
+                best = i;
+            }
+        }
+        zcomplex_t poles[2] = {0, 0};
+        zcomplex_t zeros[2] = {0, 0};
+        uint16_t pole_count = zpk_take_pair(zpk->poles, &zpk->pole_size, zpk->poles[best], poles);
+        uint16_t zero_count = zpk_take_pair(zpk->zeros, &zpk->zero_size, poles[0], zeros);
+
+        sos[s].b0 = 1.0f;
+        sos[s].b1 = (zero_count >= 1) ? (float)creal(-(zeros[0] + ((zero_count == 2) ? zeros[1] : 0))) : 0.0f;
+        sos[s].b2 = (zero_count == 2) ? (float)creal(zeros[0] * zeros[1]) : 0.0f;
+        sos[s].a1 = (float)creal(-(poles[0] + ((pole_count == 2) ? poles[1] : 0)));
+        sos[s].a2 = (pole_count == 2) ? (float)creal(poles[0] * poles[1]) : 0.0f;
+
+        // 零点恰在参考频率上时不归一化该节
+        magnitude[s] = zpk_pair_abs(zeros, zero_count, z) / zpk_pair_abs(poles, pole_count, z);
+        if (!(magnitude[s] > FILTER_DESIGN_EPS))
+        {
+            magnitude[s] = 1.0;
+        }
+        residual *= magnitude[s];
+    }
+
+    // 剩余增益（如切比雪夫偶数阶的波纹谷底）开 sections 次方均分，符号并入第一节
+    double share = pow(residual, 1.0 / sections);
+    for (uint16_t s = 0; s < sections; s++)
+    {
+        float k = (float)(share / magnitude[s]);
+        if (s == 0 && zpk->gain < 0)
+        {
+            k = -k;
+        }
+        sos[s].b0 *= k;
+        sos[s].b1 *= k;
+        sos[s].b2 *= k;
+    }
+    return sections;
+}
+
+// 设计滤波器
+uint16_t filter_design(const filter_design_t *design, sos_coeff_t *sos, uint16_t size)
+{
+    ASSERT(design != NULL);
+    ASSERT(sos != NULL);
+
+    double fs = design->sample_rate;
+    bool is_band = (design->band == FILTER_DESIGN_BANDPASS || design->band == FILTER_DESIGN_BANDSTOP);
+    if (design->order == 0 || design->order > FILTER_DESIGN_ORDER_MAX || fs <= 0 ||
+        design->freq1 <= 0 || design->freq1 >= fs / 2 ||
+        (is_band && (design->freq2 <= design->freq1 || design->freq2 >= fs / 2)))
+    {
+        return 0;
+    }
+
+    zpk_t *zpk = (zpk_t *)MALLOC(sizeof(zpk_t)); // 约1KB，不占用调用者栈
+    if (zpk == NULL)
+    {
+        return 0;
+    }
+
+    switch (design->proto)
+    {
+    case FILTER_DESIGN_BUTTERWORTH:
+        proto_butterworth(zpk, design->order);
+        break;
+    case FILTER_DESIGN_CHEBY1:
+        proto_cheby1(zpk, design->order, design->ripple);
+        break;
+    case FILTER_DESIGN_CHEBY2:
+        proto_cheby2(zpk, design->order, design->attenuation);
+        break;
+    case FILTER_DESIGN_ELLIPTIC:
+        proto_elliptic(zpk, design->order, design->ripple, design->attenuation);
+        break;
+    default:
+        FREE(zpk);
+        return 0;
+    }
+
+    // 预畸变
+    double w1 = 2.0 * fs * tan(M_PI * design->freq1 / fs);
+    double w2 = is_band ? 2.0 * fs * tan(M_PI * design->freq2 / fs) : 0;
+    switch (design->band)
+    {
+    case FILTER_DESIGN_LOWPASS:
+        zpk_lp2lp(zpk, w1);
+        break;
+    case FILTER_DESIGN_HIGHPASS:
+        zpk_lp2hp(zpk, w1);
+        break;
+    case FILTER_DESIGN_BANDPASS:
+        zpk_lp2bp(zpk, sqrt(w1 * w2), w2 - w1);
+        break;
+    case FILTER_DESIGN_BANDSTOP:
+        zpk_lp2bs(zpk, sqrt(w1 * w2), w2 - w1);
+        break;
+    default:
+        break;
+    }
+
+    // 通带参考频率：低通/带阻取直流，高通取奈奎斯特，带通取中心
+    double w_ref = 0;
+    if (design->band == FILTER_DESIGN_HIGHPASS)
+    {
+        w_ref = M_PI;
+    }
+    else if (design->band == FILTER_DESIGN_BANDPASS)
+    {
+        w_ref = 2.0 * atan(sqrt(w1 * w2) / (2.0 * fs));
+    }
+
+    zpk_bilinear(zpk, fs);
+    uint16_t sections = zpk_to_sos(zpk, sos, size, w_ref);
+    FREE(zpk);
+    return sections;
+}
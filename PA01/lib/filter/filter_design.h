@@ -0,0 +1,65 @@
+/**
+ * @file filter_design.h
+ * @author WittXie
+ * @brief IIR滤波器设计：巴特沃斯/切比雪夫I、II型/椭圆，低通/高通/带通/带阻，输出SOS系数
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 流程: 模拟原型零极点 -> 频率变换（预畸变） -> 双线性变换 -> 零极点配对成二阶节。
+ * 设计在初始化阶段执行，内部用 double 计算，不适合在中断中调用。
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "./sos_filter.h"
+
+#ifndef MALLOC
+#define MALLOC(_size) malloc(_size)
+#define FREE(_pv) free(_pv)
+#endif
+
+#define FILTER_DESIGN_ORDER_MAX 16 // 原型最大阶数，带通/带阻的节数等于阶数
+
+// 原型
+enum filter_design_proto
+{
+    FILTER_DESIGN_BUTTERWORTH = 0, // 巴特沃斯：通带最平
+    FILTER_DESIGN_CHEBY1,          // 切比雪夫I型：通带等波纹 ripple
+    FILTER_DESIGN_CHEBY2,          // 切比雪夫II型：阻带等波纹 attenuation，freq为阻带边缘
+    FILTER_DESIGN_ELLIPTIC,        // 椭圆：通带 ripple、阻带 attenuation 均等波纹
+};
+
+// 频带
+enum filter_design_band
+{
+    FILTER_DESIGN_LOWPASS = 0, // 低通，freq1
+    FILTER_DESIGN_HIGHPASS,    // 高通，freq1
+    FILTER_DESIGN_BANDPASS,    // 带通，freq1~freq2
+    FILTER_DESIGN_BANDSTOP,    // 带阻/陷波，freq1~freq2
+};
+
+// 设计参数
+typedef struct
+{
+    enum filter_design_proto proto; // 原型
+    enum filter_design_band band;   // 频带
+    uint16_t order;                 // 原型阶数
+    float sample_rate;              // 采样率
+    float freq1;                    // 截止频率/下边缘
+    float freq2;                    // 上边缘（带通/带阻）
+    float ripple;                   // 通带波纹（dB）
+    float attenuation;              // 阻带衰减（dB）
+} filter_design_t;
+
+/**
+ * @brief 设计滤波器
+ * @param design 设计参数
+ * @param sos 输出的二阶节系数，总增益按通带参考频率均分到各节（每节通带增益约为1）
+ * @param size sos 数组长度，低通/高通需 (order+1)/2，带通/带阻需 order
+ * @return uint16_t 节数，参数非法返回0
+ */
+uint16_t filter_design(const filter_design_t *design, sos_coeff_t *sos, uint16_t size);
@@ -8,52 +8,131 @@ void fir_filter_init(fir_filter_t *filter, float *coeff, uint16_t coeff_length,
     ASSERT(filter != NULL);
     ASSERT(coeff != NULL);
     ASSERT(coeff_length > 0);
-    ASSERT(buff_length >= coeff_length);
+    ASSERT(buff_length >= 2 * coeff_length);
     ASSERT(buff != NULL);
 
     // 设置滤波器系数和长度
     filter->coeff = coeff;
     filter->coeff_length = coeff_length;
 
-    // 分配输入缓冲区
+    // 延迟线
     filter->buff = buff;
     filter->buff_length = buff_length;
 
-    // 初始化缓冲区索引
-    filter->idx = 0;
+    fir_filter_reset(filter);
+}
+
+// 清空延迟线
+void fir_filter_reset(fir_filter_t *filter)
+{
+    ASSERT(filter != NULL);
 
-    // 初始化缓冲区为0
-    for (uint16_t i = 0; i < buff_length; i++)
+    filter->idx = 0;
+    filter->phase = 0;
+    for (uint16_t i = 0; i < 2 * filter->coeff_length; i++)
     {
         filter->buff[i] = 0.0f;
     }
 }
 
+// 写入一个样本，返回由新到旧的连续窗口
+static inline const float *fir_filter_push(fir_filter_t *filter, float input)
+{
+    uint16_t idx = (filter->idx == 0) ? filter->coeff_length - 1 : filter->idx - 1;
+    filter->buff[idx] = input;
+    filter->buff[idx + filter->coeff_length] = input;
+    filter->idx = idx;
+    return &filter->buff[idx];
+}
+
+// 内积，coeff 按 stride 取，4路展开
+static inline float fir_filter_dot(const float *coeff, const float *window, uint16_t taps, uint16_t stride)
+{
+    float acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+    uint16_t i = 0;
+    const float *c = coeff;
+
+    for (; i + 4 <= taps; i += 4)
+    {
+        acc0 += c[0] * window[i];
+        acc1 += c[stride] * window[i + 1];
+        acc2 += c[2 * stride] * window[i + 2];
+        acc3 += c[3 * stride] * window[i + 3];
+        c += 4 * stride;
+    }
+    for (; i < taps; i++)
+    {
+        acc0 += c[0] * window[i];
+        c += stride;
+    }
+    return (acc0 + acc1) + (acc2 + acc3);
+}
+
 // 更新FIR滤波器的输出值
 float fir_filter(fir_filter_t *filter, float input)
 {
     ASSERT(filter != NULL);
 
-    // 更新缓冲区
-    filter->buff[filter->idx] = input;
+    const float *window = fir_filter_push(filter, input);
+    return fir_filter_dot(filter->coeff, window, filter->coeff_length, 1);
+}
+
+// 块处理
+void fir_filter_block(fir_filter_t *filter, const float *input, float *output, uint32_t length)
+{
+    ASSERT(filter != NULL);
+    ASSERT(input != NULL);
+    ASSERT(output != NULL);
+
+    const float *coeff = filter->coeff;
+    uint16_t taps = filter->coeff_length;
+    for (uint32_t n = 0; n < length; n++)
+    {
+        const float *window = fir_filter_push(filter, input[n]);
+        output[n] = fir_filter_dot(coeff, window, taps, 1);
+    }
+}
+
+// 抽取
+uint32_t fir_decimate_block(fir_filter_t *filter, const float *input, float *output, uint32_t length, uint16_t factor)
+{
+    ASSERT(filter != NULL);
+    ASSERT(input != NULL);
+    ASSERT(output != NULL);
+    ASSERT(factor > 0);
 
-    // 计算输出值
-    float output = 0.0f;
-    uint16_t j = filter->idx;
-    for (uint16_t i = 0; i < filter->coeff_length; i++)
+    uint32_t count = 0;
+    for (uint32_t n = 0; n < length; n++)
     {
-        output += filter->coeff[i] * filter->buff[j];
-        if (j == 0)
+        const float *window = fir_filter_push(filter, input[n]);
+        if (++filter->phase >= factor)
         {
-            j = filter->buff_length - 1;
+            filter->phase = 0;
+            output[count++] = fir_filter_dot(filter->coeff, window, filter->coeff_length, 1);
         }
-        else
+    }
+    return count;
+}
+
+// 多相插值：第 p 个输出用系数 coeff[p], coeff[p + factor], ...，乘 factor 补偿插零损失的增益
+uint32_t fir_interpolate_block(fir_filter_t *filter, const float *input, float *output, uint32_t length, uint16_t factor)
+{
+    ASSERT(filter != NULL);
+    ASSERT(input != NULL);
+    ASSERT(output != NULL);
+    ASSERT(output != input);
+    ASSERT(factor > 0);
+
+    float gain = (float)factor;
+    uint32_t count = 0;
+    for (uint32_t n = 0; n < length; n++)
+    {
+        const float *window = fir_filter_push(filter, input[n]);
+        for (uint16_t p = 0; p < factor; p++)
         {
-            j--;
+            uint16_t taps = (filter->coeff_length - p + factor - 1) / factor; // 该相位的系数个数
+            output[count++] = gain * fir_filter_dot(&filter->coeff[p], window, taps, factor);
         }
     }
-
-    // 更新缓冲区索引
-    filter->idx = (filter->idx + 1) % filter->buff_length;
-    return output;
+    return count;
 }
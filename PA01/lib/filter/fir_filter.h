@@ -2,8 +2,12 @@
  * @file fir_filter.h
  * @author WittXie
  * @brief FIR滤波器
- * @version 0.1
+ * @version 0.2
  * @date 2024-08-26
+ * @note
+ * 延迟线为双倍长度镜像缓存：每个样本同时写入 buff[idx] 和 buff[idx + coeff_length]，
+ * buff[idx .. idx + coeff_length - 1] 始终是由新到旧的连续窗口，内积循环不需要回绕判断。
+ * 内积4路展开、4个累加器，FPU流水线不被单一累加链阻塞。
  *
  * @copyright Copyright (c) 2024
  */
@@ -19,10 +23,11 @@
 typedef struct
 {
     float *coeff;          // 滤波器系数
-    float *buff;           // 输入缓冲区
-    uint16_t buff_length;  // 缓冲区长度，缓存的长度必须大于输入的数据长度
+    float *buff;           // 延迟线（镜像）
+    uint16_t buff_length;  // 延迟线长度，必须 >= 2 * coeff_length
     uint16_t coeff_length; // 系数长度
-    uint16_t idx;          // 当前缓冲区索引
+    uint16_t idx;          // 最新样本位置
+    uint16_t phase;        // 抽取相位
 } fir_filter_t;
 
 /**
@@ -30,15 +35,52 @@ typedef struct
  * @param filter 滤波器结构体指针
  * @param coeff 滤波器系数数组
  * @param coeff_length 滤波器系数长度
- * @param buff 缓冲
- * @param buff_length 输入缓冲区长度
+ * @param buff 延迟线缓存
+ * @param buff_length 延迟线缓存长度，必须 >= 2 * coeff_length
  */
 void fir_filter_init(fir_filter_t *filter, float *coeff, uint16_t coeff_length, float *buff, uint16_t buff_length);
 
+/**
+ * @brief 清空延迟线
+ * @param filter 滤波器结构体指针
+ */
+void fir_filter_reset(fir_filter_t *filter);
+
 /**
  * @brief 更新FIR滤波器的输出值
  * @param filter 滤波器结构体指针
- * @param input 当前输入值, 输入次数 < buff_length
+ * @param input 当前输入值
  * @return 滤波后的输出值
  */
 float fir_filter(fir_filter_t *filter, float input);
+
+/**
+ * @brief 块处理
+ * @param filter 滤波器结构体指针
+ * @param input 输入
+ * @param output 输出，可与输入相同
+ * @param length 样本数
+ */
+void fir_filter_block(fir_filter_t *filter, const float *input, float *output, uint32_t length);
+
+/**
+ * @brief 抽取：每 factor 个输入只计算一个输出，相位跨块保持
+ * @param filter 滤波器结构体指针
+ * @param input 输入
+ * @param output 输出，可与输入相同
+ * @param length 输入样本数
+ * @param factor 抽取倍数
+ * @return uint32_t 输出样本数
+ */
+uint32_t fir_decimate_block(fir_filter_t *filter, const float *input, float *output, uint32_t length, uint16_t factor);
+
+/**
+ * @brief 多相插值：每个输入产生 factor 个输出，系数长度应为 factor 的整数倍
+ * @param filter 滤波器结构体指针
+ * @param input 输入
+ * @param output 输出，长度 length * factor，不能与输入相同
+ * @param length 输入样本数
+ * @param factor 插值倍数
+ * @return uint32_t 输出样本数
+ */
+uint32_t fir_interpolate_block(fir_filter_t *filter, const float *input, float *output, uint32_t length, uint16_t factor);
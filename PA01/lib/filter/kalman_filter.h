@@ -1,14 +1,26 @@
 /**
  * @file kalman_filter.h
  * @author WittXie
- * @brief 卡尔曼滤波器
- * @version 0.1
+ * @brief 卡尔曼滤波器：标量一维滤波器 + 定长 N 维线性卡尔曼滤波器（2~9维）
+ * @version 0.2
  * @date 2024-08-26
+ * @note
+ * N 维滤波器由 KALMAN_FILTER_DEFINE(n) 展开为 kalman<n>_t，基于 matrix.h 的定长矩阵，全部内联、不分配内存：
+ * - 预测：x = F·x (+ u)，P = F·P·Fᵀ + Q，二次型只算上三角，P 保持严格对称；
+ * - 更新：多维观测拆成逐个标量观测依次更新（观测噪声互不相关时与整体更新等价），
+ *         每次只需一个标量除法，不求逆；协方差用 Joseph 形式
+ *         P = (I - k·hᵀ)·P·(I - k·hᵀ)ᵀ + r·k·kᵀ，I - k·hᵀ 是秩 1 修正，先算 (I - k·hᵀ)·P 再右乘其转置，
+ *         两步各 O(n²)，最后对称化；不借助 s = hᵀ·P·h + r 展开相消，舍入误差下仍保持对称半正定；
+ * - kalman<n>_update_state 为观测矩阵只选一个状态分量（h = e_i）时的快速路径。
+ * 更新函数返回归一化新息平方 y²/s，可用于野值门限（χ²(1) 的 99% 分位约为 6.63）。
  *
  * @copyright Copyright (c) 2024
  */
 #pragma once
 
+#include "./../math/matrix.h"
+#include <math.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifndef ASSERT
@@ -50,3 +62,122 @@ float kalman_filter(kalman_filter_t *filter, float input);
  * @param measurement_error 测量误差：当前测量值与滤波器输出值之差
  */
 void kalman_filter_adapt(kalman_filter_t *filter, float measurement_error);
+
+#define KALMAN_FILTER_DEFINE(_n)                                                                                     \
+    /* N 维线性卡尔曼滤波器 */                                                                                                \
+    typedef struct                                                                                                   \
+    {                                                                                                                \
+        mat##_n##_t f; /* 状态转移矩阵 */                                                                                  \
+        mat##_n##_t q; /* 过程噪声协方差 */                                                                                 \
+        mat##_n##_t p; /* 估计误差协方差 */                                                                                 \
+        vec##_n##_t x; /* 状态 */                                                                                      \
+    } kalman##_n##_t;                                                                                                \
+                                                                                                                     \
+    /* 初始化：F = I，Q = 0，x0/p0 为 NULL 时取 0 / 单位阵 */                                                                    \
+    static inline void kalman##_n##_init(kalman##_n##_t *kf, const float *x0, const float *p0_diag)                  \
+    {                                                                                                                \
+        ASSERT(kf != NULL);                                                                                          \
+        mat##_n##_diag(&kf->f, NULL);                                                                                \
+        mat##_n##_zero(&kf->q);                                                                                      \
+        mat##_n##_diag(&kf->p, p0_diag);                                                                             \
+        for (uint8_t i = 0; i < _n; i++)                                                                             \
+        {                                                                                                            \
+            kf->x.v[i] = (x0 != NULL) ? x0[i] : 0;                                                                   \
+        }                                                                                                            \
+    }                                                                                                                \
+                                                                                                                     \
+    /* 预测：x = F·x + u（u 可为 NULL），P = F·P·Fᵀ + Q */                                                                   \
+    static inline void kalman##_n##_predict(kalman##_n##_t *kf, const vec##_n##_t *u)                                \
+    {                                                                                                                \
+        ASSERT(kf != NULL);                                                                                          \
+        vec##_n##_t x;                                                                                               \
+        mat##_n##_mul_vec(&x, &kf->f, &kf->x);                                                                       \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                               \
+        {                                                                                                            \
+            kf->x.v[i] = (u != NULL) ? x.v[i] + u->v[i] : x.v[i];                                                    \
+        }                                                                                                            \
+        mat##_n##_t p;                                                                                               \
+        mat##_n##_sandwich(&p, &kf->f, &kf->p);                                                                      \
+        mat##_n##_add(&kf->p, &p, &kf->q);                                                                           \
+    }                                                                                                                \
+                                                                                                                     \
+    /* Joseph 形式协方差更新：P = (I - k·hᵀ)·P·(I - k·hᵀ)ᵀ + r·k·kᵀ，两次秩 1 修正直接相乘后对称化 */                                      \
+    static inline void kalman##_n##_joseph(kalman##_n##_t *kf, const vec##_n##_t *h, const vec##_n##_t *k, float r)  \
+    {                                                                                                                \
+        vec##_n##_t hp, aph;                                                                                         \
+        mat##_n##_t ap;                                                                                              \
+        MATRIX_UNROLL for (uint8_t j = 0; j < _n; j++) /* hp = hᵀ·P */                                               \
+        {                                                                                                            \
+            hp.v[j] = 0;                                                                                             \
+            MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                           \
+            {                                                                                                        \
+                hp.v[j] += h->v[i] * kf->p.m[i][j];                                                                  \
+            }                                                                                                        \
+        }                                                                                                            \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++) /* ap = (I - k·hᵀ)·P，aph = ap·h */                            \
+        {                                                                                                            \
+            aph.v[i] = 0;                                                                                            \
+            MATRIX_UNROLL for (uint8_t j = 0; j < _n; j++)                                                           \
+            {                                                                                                        \
+                ap.m[i][j] = kf->p.m[i][j] - k->v[i] * hp.v[j];                                                      \
+                aph.v[i] += ap.m[i][j] * h->v[j];                                                                    \
+            }                                                                                                        \
+        }                                                                                                            \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++) /* P = ap·(I - k·hᵀ)ᵀ + r·k·kᵀ */                             \
+        {                                                                                                            \
+            MATRIX_UNROLL for (uint8_t j = 0; j < _n; j++)                                                           \
+            {                                                                                                        \
+                kf->p.m[i][j] = ap.m[i][j] - aph.v[i] * k->v[j] + r * k->v[i] * k->v[j];                             \
+            }                                                                                                        \
+        }                                                                                                            \
+        mat##_n##_symmetrize(&kf->p);                                                                                \
+    }                                                                                                                \
+                                                                                                                     \
+    /* 标量观测更新 z = hᵀ·x + v，v ~ N(0, r)，返回 y²/s */                                                                    \
+    static inline float kalman##_n##_update(kalman##_n##_t *kf, const vec##_n##_t *h, float z, float r)              \
+    {                                                                                                                \
+        ASSERT(kf != NULL && h != NULL);                                                                             \
+        vec##_n##_t ph, k;                                                                                           \
+        mat##_n##_mul_vec(&ph, &kf->p, h);                                                                           \
+        float s = vec##_n##_dot(h, &ph) + r;                                                                         \
+        float y = z - vec##_n##_dot(h, &kf->x);                                                                      \
+        float inv = 1.0f / s;                                                                                        \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                               \
+        {                                                                                                            \
+            k.v[i] = ph.v[i] * inv;                                                                                  \
+            kf->x.v[i] += k.v[i] * y;                                                                                \
+        }                                                                                                            \
+        kalman##_n##_joseph(kf, h, &k, r);                                                                           \
+        return y * y * inv;                                                                                          \
+    }                                                                                                                \
+                                                                                                                     \
+    /* 单分量观测更新 z = x[index] + v，h = e_index，P·h 直接取 P 的一列 */                                                         \
+    static inline float kalman##_n##_update_state(kalman##_n##_t *kf, uint8_t index, float z, float r)               \
+    {                                                                                                                \
+        ASSERT(kf != NULL && index < _n);                                                                            \
+        vec##_n##_t ph, k, h = {0};                                                                                  \
+        h.v[index] = 1.0f;                                                                                           \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                               \
+        {                                                                                                            \
+            ph.v[i] = kf->p.m[i][index];                                                                             \
+        }                                                                                                            \
+        float s = ph.v[index] + r;                                                                                   \
+        float y = z - kf->x.v[index];                                                                                \
+        float inv = 1.0f / s;                                                                                        \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                               \
+        {                                                                                                            \
+            k.v[i] = ph.v[i] * inv;                                                                                  \
+            kf->x.v[i] += k.v[i] * y;                                                                                \
+        }                                                                                                            \
+        kalman##_n##_joseph(kf, &h, &k, r);                                                                          \
+        return y * y * inv;                                                                                          \
+    }
+
+KALMAN_FILTER_DEFINE(2)
+KALMAN_FILTER_DEFINE(3)
+KALMAN_FILTER_DEFINE(4)
+KALMAN_FILTER_DEFINE(5)
+KALMAN_FILTER_DEFINE(6)
+KALMAN_FILTER_DEFINE(7)
+KALMAN_FILTER_DEFINE(8)
+KALMAN_FILTER_DEFINE(9)
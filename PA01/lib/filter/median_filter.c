@@ -0,0 +1,327 @@
+#include "./median_filter.h"
+
+// ---------------------------------------------------------------- 双堆
+
+// 堆位置 i > 0 属于小顶堆，i < 0 属于大顶堆，0 为中值；子节点为 2i、2i±1，父节点为 i/2（向零取整）
+#define MEDIAN_HEAP_LESS(_m, _i, _j) ((_m)->data[(_m)->heap[_i]] < (_m)->data[(_m)->heap[_j]])
+#define MEDIAN_MIN_COUNT(_m) (((int32_t)(_m)->count - 1) / 2) // 小顶堆元素数
+#define MEDIAN_MAX_COUNT(_m) ((int32_t)(_m)->count / 2)       // 大顶堆元素数
+
+// ---------------------------------------------------------------- 按类型展开
+
+// _wide 为求差的宽类型，_mean 为偶数个样本时中间两个值的均值
+#define MEDIAN_FILTER_DEFINE(_name, _type, _wide, _mean)                                                                      \
+    static inline void median_##_name##_swap(median_##_name##_t *m, int32_t i, int32_t j)                                     \
+    {                                                                                                                         \
+        int16_t temp = m->heap[i];                                                                                            \
+        m->heap[i] = m->heap[j];                                                                                              \
+        m->heap[j] = temp;                                                                                                    \
+        m->pos[m->heap[i]] = i;                                                                                               \
+        m->pos[m->heap[j]] = j;                                                                                               \
+    }                                                                                                                         \
+    /* heap[i] < heap[j] 时交换 */                                                                                               \
+    static inline bool median_##_name##_exchange(median_##_name##_t *m, int32_t i, int32_t j)                                 \
+    {                                                                                                                         \
+        if (!MEDIAN_HEAP_LESS(m, i, j))                                                                                       \
+        {                                                                                                                     \
+            return false;                                                                                                     \
+        }                                                                                                                     \
+        median_##_name##_swap(m, i, j);                                                                                       \
+        return true;                                                                                                          \
+    }                                                                                                                         \
+    /* 小顶堆下沉，i 为首个子节点 */                                                                                                      \
+    static void median_##_name##_min_down(median_##_name##_t *m, int32_t i)                                                   \
+    {                                                                                                                         \
+        for (; i <= MEDIAN_MIN_COUNT(m); i *= 2)                                                                              \
+        {                                                                                                                     \
+            if (i > 1 && i < MEDIAN_MIN_COUNT(m) && MEDIAN_HEAP_LESS(m, i + 1, i))                                            \
+            {                                                                                                                 \
+                i++;                                                                                                          \
+            }                                                                                                                 \
+            if (!median_##_name##_exchange(m, i, i / 2))                                                                      \
+            {                                                                                                                 \
+                break;                                                                                                        \
+            }                                                                                                                 \
+        }                                                                                                                     \
+    }                                                                                                                         \
+    /* 大顶堆下沉，i 为首个子节点 */                                                                                                      \
+    static void median_##_name##_max_down(median_##_name##_t *m, int32_t i)                                                   \
+    {                                                                                                                         \
+        for (; i >= -MEDIAN_MAX_COUNT(m); i *= 2)                                                                             \
+        {                                                                                                                     \
+            if (i < -1 && i > -MEDIAN_MAX_COUNT(m) && MEDIAN_HEAP_LESS(m, i, i - 1))                                          \
+            {                                                                                                                 \
+                i--;                                                                                                          \
+            }                                                                                                                 \
+            if (!median_##_name##_exchange(m, i / 2, i))                                                                      \
+            {                                                                                                                 \
+                break;                                                                                                        \
+            }                                                                                                                 \
+        }                                                                                                                     \
+    }                                                                                                                         \
+    /* 上浮，到达中值位置返回 true */                                                                                                    \
+    static bool median_##_name##_min_up(median_##_name##_t *m, int32_t i)                                                     \
+    {                                                                                                                         \
+        while (i > 0 && median_##_name##_exchange(m, i, i / 2))                                                               \
+        {                                                                                                                     \
+            i /= 2;                                                                                                           \
+        }                                                                                                                     \
+        return i == 0;                                                                                                        \
+    }                                                                                                                         \
+    static bool median_##_name##_max_up(median_##_name##_t *m, int32_t i)                                                     \
+    {                                                                                                                         \
+        while (i < 0 && median_##_name##_exchange(m, i / 2, i))                                                               \
+        {                                                                                                                     \
+            i /= 2;                                                                                                           \
+        }                                                                                                                     \
+        return i == 0;                                                                                                        \
+    }                                                                                                                         \
+                                                                                                                              \
+    void median_##_name##_init(median_##_name##_t *filter, uint16_t window, _type *data, int16_t *index)                      \
+    {                                                                                                                         \
+        ASSERT(filter != NULL);                                                                                               \
+        ASSERT(data != NULL);                                                                                                 \
+        ASSERT(index != NULL);                                                                                                \
+        ASSERT(window > 0 && window <= MEDIAN_FILTER_WINDOW_MAX);                                                             \
+                                                                                                                              \
+        filter->data = data;                                                                                                  \
+        filter->pos = index;                                                                                                  \
+        filter->heap = index + window + window / 2;                                                                           \
+        filter->window = window;                                                                                              \
+        median_##_name##_reset(filter);                                                                                       \
+    }                                                                                                                         \
+                                                                                                                              \
+    void median_##_name##_reset(median_##_name##_t *filter)                                                                   \
+    {                                                                                                                         \
+        ASSERT(filter != NULL);                                                                                               \
+                                                                                                                              \
+        filter->idx = 0;                                                                                                      \
+        filter->count = 0;                                                                                                    \
+        /* 样本 k 初始位置 0, -1, 1, -2, 2 ...，从中值向两侧交替 */                                                                          \
+        for (int32_t k = 0; k < filter->window; k++)                                                                          \
+        {                                                                                                                     \
+            filter->pos[k] = ((k + 1) / 2) * ((k & 1) ? -1 : 1);                                                              \
+            filter->heap[filter->pos[k]] = k;                                                                                 \
+        }                                                                                                                     \
+    }                                                                                                                         \
+                                                                                                                              \
+    _type median_##_name(median_##_name##_t *filter, _type input)                                                             \
+    {                                                                                                                         \
+        bool is_new = (filter->count < filter->window);                                                                       \
+        int32_t p = filter->pos[filter->idx];                                                                                 \
+        _type old = filter->data[filter->idx];                                                                                \
+        filter->data[filter->idx] = input;                                                                                    \
+        filter->idx = (filter->idx + 1 == filter->window) ? 0 : filter->idx + 1;                                              \
+        filter->count += is_new;                                                                                              \
+                                                                                                                              \
+        /* 新样本占据最旧样本的堆位置，按大小关系上浮或下沉 */                                                                                        \
+        if (p > 0)                                                                                                            \
+        {                                                                                                                     \
+            if (!is_new && old < input)                                                                                       \
+            {                                                                                                                 \
+                median_##_name##_min_down(filter, p * 2);                                                                     \
+            }                                                                                                                 \
+            else if (median_##_name##_min_up(filter, p))                                                                      \
+            {                                                                                                                 \
+                median_##_name##_max_down(filter, -1);                                                                        \
+            }                                                                                                                 \
+        }                                                                                                                     \
+        else if (p < 0)                                                                                                       \
+        {                                                                                                                     \
+            if (!is_new && input < old)                                                                                       \
+            {                                                                                                                 \
+                median_##_name##_max_down(filter, p * 2);                                                                     \
+            }                                                                                                                 \
+            else if (median_##_name##_max_up(filter, p))                                                                      \
+            {                                                                                                                 \
+                median_##_name##_min_down(filter, 1);                                                                         \
+            }                                                                                                                 \
+        }                                                                                                                     \
+        else                                                                                                                  \
+        {                                                                                                                     \
+            if (MEDIAN_MAX_COUNT(filter) > 0)                                                                                 \
+            {                                                                                                                 \
+                median_##_name##_max_down(filter, -1);                                                                        \
+            }                                                                                                                 \
+            if (MEDIAN_MIN_COUNT(filter) > 0)                                                                                 \
+            {                                                                                                                 \
+                median_##_name##_min_down(filter, 1);                                                                         \
+            }                                                                                                                 \
+        }                                                                                                                     \
+                                                                                                                              \
+        _type value = filter->data[filter->heap[0]];                                                                          \
+        if ((filter->count & 1) == 0)                                                                                         \
+        {                                                                                                                     \
+            value = _mean(value, filter->data[filter->heap[-1]]);                                                             \
+        }                                                                                                                     \
+        return value;                                                                                                         \
+    }                                                                                                                         \
+                                                                                                                              \
+    void median_##_name##_block(median_##_name##_t *filter, const _type *input, _type *output, uint32_t length)               \
+    {                                                                                                                         \
+        ASSERT(filter != NULL);                                                                                               \
+        ASSERT(input != NULL && output != NULL);                                                                              \
+        for (uint32_t i = 0; i < length; i++)                                                                                 \
+        {                                                                                                                     \
+            output[i] = median_##_name(filter, input[i]);                                                                     \
+        }                                                                                                                     \
+    }                                                                                                                         \
+                                                                                                                              \
+    void median_sorted_##_name##_init(median_sorted_##_name##_t *filter, uint16_t window, _type *buff)                        \
+    {                                                                                                                         \
+        ASSERT(filter != NULL);                                                                                               \
+        ASSERT(buff != NULL);                                                                                                 \
+        ASSERT(window > 0 && window <= MEDIAN_FILTER_WINDOW_MAX);                                                             \
+                                                                                                                              \
+        filter->ring = buff;                                                                                                  \
+        filter->sorted = buff + window;                                                                                       \
+        filter->window = window;                                                                                              \
+        median_sorted_##_name##_reset(filter);                                                                                \
+    }                                                                                                                         \
+                                                                                                                              \
+    void median_sorted_##_name##_reset(median_sorted_##_name##_t *filter)                                                     \
+    {                                                                                                                         \
+        ASSERT(filter != NULL);                                                                                               \
+        filter->idx = 0;                                                                                                      \
+        filter->count = 0;                                                                                                    \
+    }                                                                                                                         \
+                                                                                                                              \
+    /* 把新样本放入有序窗口：窗口满时从最旧样本的位置向新值方向挪动，否则从末尾插入 */                                                                              \
+    static inline void median_sorted_##_name##_insert(median_sorted_##_name##_t *filter, _type input)                         \
+    {                                                                                                                         \
+        _type *sorted = filter->sorted;                                                                                       \
+        uint32_t count = filter->count;                                                                                       \
+        uint32_t p = count;                                                                                                   \
+                                                                                                                              \
+        if (count == filter->window)                                                                                          \
+        {                                                                                                                     \
+            /* 二分查找最旧样本 */                                                                                                    \
+            _type old = filter->ring[filter->idx];                                                                            \
+            uint32_t lo = 0, hi = count - 1;                                                                                  \
+            while (lo < hi)                                                                                                   \
+            {                                                                                                                 \
+                uint32_t mid = (lo + hi) / 2;                                                                                 \
+                if (sorted[mid] < old)                                                                                        \
+                {                                                                                                             \
+                    lo = mid + 1;                                                                                             \
+                }                                                                                                             \
+                else                                                                                                          \
+                {                                                                                                             \
+                    hi = mid;                                                                                                 \
+                }                                                                                                             \
+            }                                                                                                                 \
+            p = lo;                                                                                                           \
+            while (p + 1 < count && sorted[p + 1] < input)                                                                    \
+            {                                                                                                                 \
+                sorted[p] = sorted[p + 1];                                                                                    \
+                p++;                                                                                                          \
+            }                                                                                                                 \
+        }                                                                                                                     \
+        else                                                                                                                  \
+        {                                                                                                                     \
+            filter->count++;                                                                                                  \
+        }                                                                                                                     \
+        while (p > 0 && input < sorted[p - 1])                                                                                \
+        {                                                                                                                     \
+            sorted[p] = sorted[p - 1];                                                                                        \
+            p--;                                                                                                              \
+        }                                                                                                                     \
+        sorted[p] = input;                                                                                                    \
+                                                                                                                              \
+        filter->ring[filter->idx] = input;                                                                                    \
+        filter->idx = (filter->idx + 1 == filter->window) ? 0 : filter->idx + 1;                                              \
+    }                                                                                                                         \
+                                                                                                                              \
+    _type median_sorted_##_name(median_sorted_##_name##_t *filter, _type input)                                               \
+    {                                                                                                                         \
+        median_sorted_##_name##_insert(filter, input);                                                                        \
+        uint32_t count = filter->count;                                                                                       \
+        _type value = filter->sorted[count / 2];                                                                              \
+        if ((count & 1) == 0)                                                                                                 \
+        {                                                                                                                     \
+            value = _mean(value, filter->sorted[count / 2 - 1]);                                                              \
+        }                                                                                                                     \
+        return value;                                                                                                         \
+    }                                                                                                                         \
+                                                                                                                              \
+    void median_sorted_##_name##_block(median_sorted_##_name##_t *filter, const _type *input, _type *output, uint32_t length) \
+    {                                                                                                                         \
+        ASSERT(filter != NULL);                                                                                               \
+        ASSERT(input != NULL && output != NULL);                                                                              \
+        for (uint32_t i = 0; i < length; i++)                                                                                 \
+        {                                                                                                                     \
+            output[i] = median_sorted_##_name(filter, input[i]);                                                              \
+        }                                                                                                                     \
+    }                                                                                                                         \
+                                                                                                                              \
+    void hampel_##_name##_init(hampel_##_name##_t *filter, uint16_t window, _type *buff, float k)                             \
+    {                                                                                                                         \
+        ASSERT(filter != NULL);                                                                                               \
+        ASSERT(k > 0);                                                                                                        \
+                                                                                                                              \
+        median_sorted_##_name##_init(&filter->window, window, buff);                                                          \
+        filter->threshold = k * 1.4826f; /* 正态分布下 MAD 与标准差的比例 */                                                              \
+        filter->replaced = 0;                                                                                                 \
+    }                                                                                                                         \
+                                                                                                                              \
+    _type hampel_##_name(hampel_##_name##_t *filter, _type input)                                                             \
+    {                                                                                                                         \
+        median_sorted_##_name##_t *window = &filter->window;                                                                  \
+        _type median = median_sorted_##_name(window, input);                                                                  \
+        const _type *sorted = window->sorted;                                                                                 \
+        uint32_t count = window->count;                                                                                       \
+                                                                                                                              \
+        /* 窗口中心样本 */                                                                                                          \
+        _type center = window->ring[(window->idx + window->window - 1 - count / 2) % window->window];                         \
+                                                                                                                              \
+        /* MAD：中值两侧的偏差各自有序，归并到第 (count-1)/2 和 count/2 个 */                                                                    \
+        int32_t left = (count - 1) / 2, right = left + 1;                                                                     \
+        _wide mad_low = 0, mad_high = 0;                                                                                      \
+        for (uint32_t rank = 0; rank <= count / 2; rank++)                                                                    \
+        {                                                                                                                     \
+            _wide dev;                                                                                                        \
+            if (right >= (int32_t)count || (left >= 0 && (_wide)median - sorted[left] <= (_wide)sorted[right] - median))      \
+            {                                                                                                                 \
+                dev = (_wide)median - sorted[left--];                                                                         \
+            }                                                                                                                 \
+            else                                                                                                              \
+            {                                                                                                                 \
+                dev = (_wide)sorted[right++] - median;                                                                        \
+            }                                                                                                                 \
+            if (rank == (count - 1) / 2)                                                                                      \
+            {                                                                                                                 \
+                mad_low = dev;                                                                                                \
+            }                                                                                                                 \
+            mad_high = dev;                                                                                                   \
+        }                                                                                                                     \
+        float mad = 0.5f * (float)(mad_low + mad_high);                                                                       \
+                                                                                                                              \
+        _wide dev = (_wide)center - median;                                                                                   \
+        if (dev < 0)                                                                                                          \
+        {                                                                                                                     \
+            dev = -dev;                                                                                                       \
+        }                                                                                                                     \
+        if ((float)dev > filter->threshold * mad)                                                                             \
+        {                                                                                                                     \
+            filter->replaced++;                                                                                               \
+            return median;                                                                                                    \
+        }                                                                                                                     \
+        return center;                                                                                                        \
+    }                                                                                                                         \
+                                                                                                                              \
+    void hampel_##_name##_block(hampel_##_name##_t *filter, const _type *input, _type *output, uint32_t length)               \
+    {                                                                                                                         \
+        ASSERT(filter != NULL);                                                                                               \
+        ASSERT(input != NULL && output != NULL);                                                                              \
+        for (uint32_t i = 0; i < length; i++)                                                                                 \
+        {                                                                                                                     \
+            output[i] = hampel_##_name(filter, input[i]);                                                                     \
+        }                                                                                                                     \
+    }
+
+#define MEDIAN_MEAN_F32(_a, _b) (((_a) + (_b)) * 0.5f)
+#define MEDIAN_MEAN_INT(_a, _b) (((int32_t)(_a) + (int32_t)(_b)) >> 1)
+
+MEDIAN_FILTER_DEFINE(f32, float, float, MEDIAN_MEAN_F32)
+MEDIAN_FILTER_DEFINE(s16, int16_t, int32_t, MEDIAN_MEAN_INT)
+MEDIAN_FILTER_DEFINE(u16, uint16_t, int32_t, MEDIAN_MEAN_INT)
@@ -0,0 +1,101 @@
+/**
+ * @file median_filter.h
+ * @author WittXie
+ * @brief 滑动窗口中值/Hampel滤波：双堆索引窗口 O(log w)、小窗口有序插入 O(w)、Hampel野值替换
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 每种样本类型由 MEDIAN_FILTER_DECLARE 展开（f32/s16/u16），比较内联，不经函数指针：
+ * - median_<t>        : 双堆中值，大顶堆/小顶堆共用一个以中值为中心的数组（负下标为大顶堆），
+ *                       窗口满后新样本原地替换最旧样本的堆位置再上浮/下沉，每样本 O(log w)，适合 w > 8 左右；
+ * - median_sorted_<t> : 有序数组，二分定位最旧样本，从该位置向新值方向逐个挪动元素，删除与插入一趟完成，
+ *                       最多移动两者间距个元素，w 较小时常数更低；
+ * - hampel_<t>        : 基于有序窗口，|x - 中值| > k * 1.4826 * MAD 时输出中值，否则原样输出，
+ *                       判断的是窗口中心样本，输出延迟 w/2 个样本。
+ * 窗口未满时按已有样本计算；样本数为偶数时取中间两个的均值（整型向下取整）。
+ * 缓存由调用者提供，便于放在静态区。
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef ASSERT
+#define ASSERT(_bool, ...) ((void)0)
+#endif
+
+#define MEDIAN_FILTER_WINDOW_MAX 0x7FFF // 最大窗口长度
+
+#define MEDIAN_FILTER_DECLARE(_name, _type)                                                                                    \
+    /* 双堆中值滤波器 */                                                                                                              \
+    typedef struct                                                                                                             \
+    {                                                                                                                          \
+        _type *data;     /* 环形窗口，window 个样本 */                                                                                 \
+        int16_t *pos;    /* 各样本所在堆位置 */                                                                                        \
+        int16_t *heap;   /* 堆，指向中间，下标 -(window/2) ~ (window-1)/2，存样本位置 */                                                      \
+        uint16_t window; /* 窗口长度 */                                                                                            \
+        uint16_t idx;    /* 下一个写入位置 */                                                                                         \
+        uint16_t count;  /* 有效样本数 */                                                                                           \
+    } median_##_name##_t;                                                                                                      \
+                                                                                                                               \
+    /* 有序插入中值滤波器 */                                                                                                            \
+    typedef struct                                                                                                             \
+    {                                                                                                                          \
+        _type *ring;     /* 环形窗口，window 个样本 */                                                                                 \
+        _type *sorted;   /* 升序窗口，window 个样本 */                                                                                 \
+        uint16_t window; /* 窗口长度 */                                                                                            \
+        uint16_t idx;    /* 下一个写入位置 */                                                                                         \
+        uint16_t count;  /* 有效样本数 */                                                                                           \
+    } median_sorted_##_name##_t;                                                                                               \
+                                                                                                                               \
+    /* Hampel 滤波器 */                                                                                                           \
+    typedef struct                                                                                                             \
+    {                                                                                                                          \
+        median_sorted_##_name##_t window; /* 有序窗口 */                                                                           \
+        float threshold;                  /* k * 1.4826 */                                                                     \
+        uint32_t replaced;                /* 累计替换的野值个数 */                                                                      \
+    } hampel_##_name##_t;                                                                                                      \
+                                                                                                                               \
+    void median_##_name##_init(median_##_name##_t *filter, uint16_t window, _type *data, int16_t *index);                      \
+    void median_##_name##_reset(median_##_name##_t *filter);                                                                   \
+    _type median_##_name(median_##_name##_t *filter, _type input);                                                             \
+    void median_##_name##_block(median_##_name##_t *filter, const _type *input, _type *output, uint32_t length);               \
+                                                                                                                               \
+    void median_sorted_##_name##_init(median_sorted_##_name##_t *filter, uint16_t window, _type *buff);                        \
+    void median_sorted_##_name##_reset(median_sorted_##_name##_t *filter);                                                     \
+    _type median_sorted_##_name(median_sorted_##_name##_t *filter, _type input);                                               \
+    void median_sorted_##_name##_block(median_sorted_##_name##_t *filter, const _type *input, _type *output, uint32_t length); \
+                                                                                                                               \
+    void hampel_##_name##_init(hampel_##_name##_t *filter, uint16_t window, _type *buff, float k);                             \
+    _type hampel_##_name(hampel_##_name##_t *filter, _type input);                                                             \
+    void hampel_##_name##_block(hampel_##_name##_t *filter, const _type *input, _type *output, uint32_t length);
+
+/*
+ * 接口（<t> = f32/s16/u16）:
+ *
+ * median_<t>_init(filter, window, data, index)
+ *   data  : 样本缓存，window 个
+ *   index : 索引缓存，2 * window 个 int16_t
+ * median_sorted_<t>_init(filter, window, buff) / hampel_<t>_init(filter, window, buff, k)
+ *   buff  : 样本缓存，2 * window 个
+ *   k     : Hampel 门限，常用 3
+ * median_<t>(filter, input) / median_sorted_<t>(filter, input) / hampel_<t>(filter, input)
+ *   单样本更新，返回输出
+ * *_block(filter, input, output, length)
+ *   块处理，output 可与 input 相同
+ * *_reset(filter)
+ *   清空窗口
+ */
+MEDIAN_FILTER_DECLARE(f32, float)
+MEDIAN_FILTER_DECLARE(s16, int16_t)
+MEDIAN_FILTER_DECLARE(u16, uint16_t)
+
+/**
+ * @brief 滤波器是否已填满窗口
+ *
+ * @param _filter 中值滤波器指针（hampel 传 &filter->window）
+ */
+#define median_is_full(_filter) ((_filter)->count == (_filter)->window)
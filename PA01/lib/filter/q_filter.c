@@ -0,0 +1,343 @@
+#include "./q_filter.h"
+#include <math.h>
+#include <stdlib.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265359f
+#endif
+
+// ---------------------------------------------------------------- FIR
+
+void fir_q15_init(fir_q15_t *filter, const q15_t *coeff, uint16_t coeff_length, q15_t *buff)
+{
+    ASSERT(filter != NULL);
+    ASSERT(coeff != NULL);
+    ASSERT(coeff_length > 0);
+    ASSERT(buff != NULL);
+
+    filter->coeff = coeff;
+    filter->coeff_length = coeff_length;
+    filter->buff = buff;
+    filter->idx = 0;
+    for (uint32_t i = 0; i < 2u * coeff_length; i++)
+    {
+        buff[i] = 0;
+    }
+}
+
+void fir_q31_init(fir_q31_t *filter, const q31_t *coeff, uint16_t coeff_length, q31_t *buff)
+{
+    ASSERT(filter != NULL);
+    ASSERT(coeff != NULL);
+    ASSERT(coeff_length > 0);
+    ASSERT(buff != NULL);
+
+    filter->coeff = coeff;
+    filter->coeff_length = coeff_length;
+    filter->buff = buff;
+    filter->idx = 0;
+    for (uint32_t i = 0; i < 2u * coeff_length; i++)
+    {
+        buff[i] = 0;
+    }
+}
+
+void fir_q15_block(fir_q15_t *filter, const q15_t *input, q15_t *output, uint32_t length)
+{
+    ASSERT(filter != NULL);
+    ASSERT(input != NULL);
+    ASSERT(output != NULL);
+
+    uint16_t taps = filter->coeff_length;
+    const q15_t *coeff = filter->coeff;
+    for (uint32_t n = 0; n < length; n++)
+    {
+        uint16_t idx = (filter->idx == 0) ? taps - 1 : filter->idx - 1;
+        filter->buff[idx] = input[n];
+        filter->buff[idx + taps] = input[n];
+        filter->idx = idx;
+
+        const q15_t *window = &filter->buff[idx];
+        int64_t acc0 = 0, acc1 = 0;
+        uint16_t i = 0;
+        for (; i + 2 <= taps; i += 2)
+        {
+            acc0 += (int32_t)coeff[i] * window[i];
+            acc1 += (int32_t)coeff[i + 1] * window[i + 1];
+        }
+        if (i < taps)
+        {
+            acc0 += (int32_t)coeff[i] * window[i];
+        }
+        output[n] = q15_sat((int32_t)((acc0 + acc1) >> 15));
+    }
+}
+
+void fir_q31_block(fir_q31_t *filter, const q31_t *input, q31_t *output, uint32_t length)
+{
+    ASSERT(filter != NULL);
+    ASSERT(input != NULL);
+    ASSERT(output != NULL);
+
+    uint16_t taps = filter->coeff_length;
+    const q31_t *coeff = filter->coeff;
+    for (uint32_t n = 0; n < length; n++)
+    {
+        uint16_t idx = (filter->idx == 0) ? taps - 1 : filter->idx - 1;
+        filter->buff[idx] = input[n];
+        filter->buff[idx + taps] = input[n];
+        filter->idx = idx;
+
+        // Q62 乘积右移1位累加，留出保护位
+        const q31_t *window = &filter->buff[idx];
+        int64_t acc0 = 0, acc1 = 0;
+        uint16_t i = 0;
+        for (; i + 2 <= taps; i += 2)
+        {
+            acc0 += ((int64_t)coeff[i] * window[i]) >> 1;
+            acc1 += ((int64_t)coeff[i + 1] * window[i + 1]) >> 1;
+        }
+        if (i < taps)
+        {
+            acc0 += ((int64_t)coeff[i] * window[i]) >> 1;
+        }
+        output[n] = q31_sat((acc0 + acc1) >> 30);
+    }
+}
+
+// ---------------------------------------------------------------- 双二阶
+
+// 一节系数的最大绝对值所需的缩放位数，超过上限返回 SOS_Q_SHIFT_MAX + 1
+static uint8_t sos_shift_get(const sos_coeff_t *sos)
+{
+    float c[5] = {sos->b0, sos->b1, sos->b2, sos->a1, sos->a2};
+    float max = 0;
+    for (int i = 0; i < 5; i++)
+    {
+        if (fabsf(c[i]) > max)
+        {
+            max = fabsf(c[i]);
+        }
+    }
+    uint8_t shift = 0;
+    while (max >= (float)(1u << shift) && shift <= SOS_Q_SHIFT_MAX)
+    {
+        shift++;
+    }
+    return shift;
+}
+
+bool sos_to_q31(const sos_coeff_t *sos, uint16_t sections, sos_q31_t *q31)
+{
+    ASSERT(sos != NULL);
+    ASSERT(q31 != NULL);
+
+    bool is_ok = true;
+    for (uint16_t s = 0; s < sections; s++)
+    {
+        uint8_t shift = sos_shift_get(&sos[s]);
+        if (shift > SOS_Q_SHIFT_MAX)
+        {
+            shift = SOS_Q_SHIFT_MAX;
+            is_ok = false;
+        }
+        float scale = 1.0f / (float)(1u << shift);
+        q31[s].b0 = float_to_q31(sos[s].b0 * scale);
+        q31[s].b1 = float_to_q31(sos[s].b1 * scale);
+        q31[s].b2 = float_to_q31(sos[s].b2 * scale);
+        q31[s].a1 = float_to_q31(sos[s].a1 * scale);
+        q31[s].a2 = float_to_q31(sos[s].a2 * scale);
+        q31[s].shift = shift;
+    }
+    return is_ok;
+}
+
+bool sos_to_q15(const sos_coeff_t *sos, uint16_t sections, sos_q15_t *q15)
+{
+    ASSERT(sos != NULL);
+    ASSERT(q15 != NULL);
+
+    bool is_ok = true;
+    for (uint16_t s = 0; s < sections; s++)
+    {
+        uint8_t shift = sos_shift_get(&sos[s]);
+        if (shift > SOS_Q_SHIFT_MAX)
+        {
+            shift = SOS_Q_SHIFT_MAX;
+            is_ok = false;
+        }
+        float scale = 1.0f / (float)(1u << shift);
+        q15[s].b0 = float_to_q15(sos[s].b0 * scale);
+        q15[s].b1 = float_to_q15(sos[s].b1 * scale);
+        q15[s].b2 = float_to_q15(sos[s].b2 * scale);
+        q15[s].a1 = float_to_q15(sos[s].a1 * scale);
+        q15[s].a2 = float_to_q15(sos[s].a2 * scale);
+        q15[s].shift = shift;
+    }
+    return is_ok;
+}
+
+void biquad_q31_init(biquad_q31_t *filter, const sos_q31_t *coeff, uint16_t sections, q31_t *state, bool is_shaping)
+{
+    ASSERT(filter != NULL);
+    ASSERT(coeff != NULL);
+    ASSERT(sections > 0);
+    ASSERT(state != NULL);
+
+    filter->coeff = coeff;
+    filter->sections = sections;
+    filter->state = state;
+    filter->is_shaping = is_shaping;
+    for (uint32_t i = 0; i < sections * 5u; i++)
+    {
+        state[i] = 0;
+    }
+}
+
+void biquad_q15_init(biquad_q15_t *filter, const sos_q15_t *coeff, uint16_t sections, int32_t *state, bool is_shaping)
+{
+    ASSERT(filter != NULL);
+    ASSERT(coeff != NULL);
+    ASSERT(sections > 0);
+    ASSERT(state != NULL);
+
+    filter->coeff = coeff;
+    filter->sections = sections;
+    filter->state = state;
+    filter->is_shaping = is_shaping;
+    for (uint32_t i = 0; i < sections * 5u; i++)
+    {
+        state[i] = 0;
+    }
+}
+
+// 直接I型：acc = b0*x + b1*x1 + b2*x2 - a1*y1 - a2*y2，Q62 累加，按本节 shift 恢复，误差反馈保留截断位
+void biquad_q31_block(biquad_q31_t *filter, const q31_t *input, q31_t *output, uint32_t length)
+{
+    ASSERT(filter != NULL);
+    ASSERT(input != NULL);
+    ASSERT(output != NULL);
+
+    const q31_t *in = input;
+    q31_t *z = filter->state;
+    const sos_q31_t *c = filter->coeff;
+    for (uint16_t s = 0; s < filter->sections; s++, c++, z += 5)
+    {
+        uint8_t bits = 31 - c->shift;
+        int64_t mask = ((int64_t)1 << bits) - 1;
+        q31_t x1 = z[0], x2 = z[1], y1 = z[2], y2 = z[3];
+        int64_t err = z[4];
+        for (uint32_t n = 0; n < length; n++)
+        {
+            q31_t x = in[n];
+            int64_t acc = (int64_t)c->b0 * x + (int64_t)c->b1 * x1 + (int64_t)c->b2 * x2 - (int64_t)c->a1 * y1 - (int64_t)c->a2 * y2;
+            if (filter->is_shaping)
+            {
+                acc += err;
+                err = acc & mask;
+            }
+            q31_t y = q31_sat(acc >> bits);
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            output[n] = y;
+        }
+        z[0] = x1;
+        z[1] = x2;
+        z[2] = y1;
+        z[3] = y2;
+        z[4] = (q31_t)err;
+        in = output; // 后续节原地处理
+    }
+}
+
+void biquad_q15_block(biquad_q15_t *filter, const q15_t *input, q15_t *output, uint32_t length)
+{
+    ASSERT(filter != NULL);
+    ASSERT(input != NULL);
+    ASSERT(output != NULL);
+
+    const q15_t *in = input;
+    int32_t *z = filter->state;
+    const sos_q15_t *c = filter->coeff;
+    for (uint16_t s = 0; s < filter->sections; s++, c++, z += 5)
+    {
+        uint8_t bits = 15 - c->shift;
+        int64_t mask = ((int64_t)1 << bits) - 1;
+        q15_t x1 = z[0], x2 = z[1], y1 = z[2], y2 = z[3];
+        int64_t err = z[4];
+        for (uint32_t n = 0; n < length; n++)
+        {
+            q15_t x = in[n];
+            int64_t acc = (int64_t)c->b0 * x + (int64_t)c->b1 * x1 + (int64_t)c->b2 * x2 - (int64_t)c->a1 * y1 - (int64_t)c->a2 * y2; // 单项 2^30，两项之和即超 int32
+            if (filter->is_shaping)
+            {
+                acc += err;
+                err = acc & mask;
+            }
+            q15_t y = q15_sat((int32_t)(acc >> bits));
+            x2 = x1;
+            x1 = x;
+            y2 = y1;
+            y1 = y;
+            output[n] = y;
+        }
+        z[0] = x1;
+        z[1] = x2;
+        z[2] = y1;
+        z[3] = y2;
+        z[4] = (int32_t)err;
+        in = output;
+    }
+}
+
+// ---------------------------------------------------------------- 一阶低通/高通
+
+void onepole_q_init(onepole_q_t *filter, float cutoff_freq, float sample_rate, bool is_high)
+{
+    ASSERT(filter != NULL);
+    ASSERT(cutoff_freq > 0);
+    ASSERT(sample_rate > 0);
+
+    filter->alpha = float_to_q31(1.0f - expf(-2.0f * (float)M_PI * cutoff_freq / sample_rate));
+    filter->state = 0;
+    filter->is_high = is_high;
+    filter->is_first = true;
+}
+
+static inline q31_t onepole_q_step(onepole_q_t *filter, q31_t x)
+{
+    if (filter->is_first)
+    {
+        filter->state = x;
+        filter->is_first = false;
+    }
+    filter->state += (q31_t)(((int64_t)filter->alpha * ((int64_t)x - filter->state)) >> 31);
+    return filter->is_high ? q31_sat((int64_t)x - filter->state) : filter->state;
+}
+
+void onepole_q15_block(onepole_q_t *filter, const q15_t *input, q15_t *output, uint32_t length)
+{
+    ASSERT(filter != NULL);
+    ASSERT(input != NULL);
+    ASSERT(output != NULL);
+
+    for (uint32_t n = 0; n < length; n++)
+    {
+        q31_t y = onepole_q_step(filter, (q31_t)input[n] * 65536); // 状态保留 Q31 精度；负数左移是未定义行为，用乘法
+        output[n] = (q15_t)(y >> 16);
+    }
+}
+
+void onepole_q31_block(onepole_q_t *filter, const q31_t *input, q31_t *output, uint32_t length)
+{
+    ASSERT(filter != NULL);
+    ASSERT(input != NULL);
+    ASSERT(output != NULL);
+
+    for (uint32_t n = 0; n < length; n++)
+    {
+        output[n] = onepole_q_step(filter, input[n]);
+    }
+}
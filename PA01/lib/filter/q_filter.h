@@ -0,0 +1,181 @@
+/**
+ * @file q_filter.h
+ * @author WittXie
+ * @brief 定点滤波器：Q15/Q31 的 FIR、双二阶（64位累加+误差反馈噪声整形）、一阶低通/高通
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 与浮点版本共用块接口 (filter, input, output, length)，ADC和PCM样本不再来回转换浮点。
+ * 所有输出饱和到 Q15/Q31 范围。
+ * 双二阶系数可能超过 ±1（a1 接近 -2），每节按各自的 2^shift 缩小后存放，累加后再左移 shift 位恢复，
+ * 增益集中在某一节时其余节不损失精度。
+ * Q15 双二阶系数精度有限，截止频率低于 fs/50 左右时极点误差明显，应改用 Q31。
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "./sos_filter.h"
+
+#ifndef ASSERT
+#define ASSERT(_bool, ...) ((void)0)
+#endif
+
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+
+// 饱和
+static inline q15_t q15_sat(int32_t x)
+{
+    return (x > INT16_MAX) ? INT16_MAX : ((x < INT16_MIN) ? INT16_MIN : (q15_t)x);
+}
+static inline q31_t q31_sat(int64_t x)
+{
+    return (x > INT32_MAX) ? INT32_MAX : ((x < INT32_MIN) ? INT32_MIN : (q31_t)x);
+}
+
+// 浮点转定点（饱和）
+#define float_to_q15(_x) q15_sat((int32_t)lrintf((_x) * 32768.0f))
+#define float_to_q31(_x) q31_sat((int64_t)llrint((double)(_x) * 2147483648.0))
+#define q15_to_float(_x) ((float)(_x) / 32768.0f)
+#define q31_to_float(_x) ((float)(_x) / 2147483648.0f)
+
+// ---------------------------------------------------------------- FIR
+
+// FIR（镜像延迟线，同 fir_filter_t）
+typedef struct
+{
+    const q15_t *coeff;    // 系数 Q15
+    q15_t *buff;           // 延迟线，长度 >= 2 * coeff_length
+    uint16_t coeff_length; // 系数长度
+    uint16_t idx;          // 最新样本位置
+} fir_q15_t;
+
+typedef struct
+{
+    const q31_t *coeff;    // 系数 Q31
+    q31_t *buff;           // 延迟线，长度 >= 2 * coeff_length
+    uint16_t coeff_length; // 系数长度
+    uint16_t idx;          // 最新样本位置
+} fir_q31_t;
+
+/**
+ * @brief 初始化定点FIR
+ * @param filter 滤波器
+ * @param coeff 系数
+ * @param coeff_length 系数长度
+ * @param buff 延迟线，长度 >= 2 * coeff_length
+ */
+void fir_q15_init(fir_q15_t *filter, const q15_t *coeff, uint16_t coeff_length, q15_t *buff);
+void fir_q31_init(fir_q31_t *filter, const q31_t *coeff, uint16_t coeff_length, q31_t *buff);
+
+/**
+ * @brief 定点FIR块处理，累加器 64 位
+ * @param filter 滤波器
+ * @param input 输入
+ * @param output 输出，可与输入相同
+ * @param length 样本数
+ */
+void fir_q15_block(fir_q15_t *filter, const q15_t *input, q15_t *output, uint32_t length);
+void fir_q31_block(fir_q31_t *filter, const q31_t *input, q31_t *output, uint32_t length);
+
+// ---------------------------------------------------------------- 双二阶
+
+// 定点二阶节系数，实际值 = 存放值 * 2^shift
+typedef struct
+{
+    q31_t b0, b1, b2; // 输入系数
+    q31_t a1, a2;     // 输出系数，a0=1
+    uint8_t shift;    // 本节缩放位数
+} sos_q31_t;
+
+typedef struct
+{
+    q15_t b0, b1, b2; // 输入系数
+    q15_t a1, a2;     // 输出系数，a0=1
+    uint8_t shift;    // 本节缩放位数
+} sos_q15_t;
+
+#define SOS_Q_SHIFT_MAX 8 // 系数绝对值上限 2^8
+
+// 直接I型，每节状态 x1 x2 y1 y2 err
+typedef struct
+{
+    const sos_q31_t *coeff; // 各节系数
+    q31_t *state;           // 状态，sections * 5
+    uint16_t sections;      // 节数
+    bool is_shaping;        // 误差反馈噪声整形
+} biquad_q31_t;
+
+typedef struct
+{
+    const sos_q15_t *coeff; // 各节系数
+    int32_t *state;         // 状态，sections * 5
+    uint16_t sections;      // 节数
+    bool is_shaping;        // 误差反馈噪声整形
+} biquad_q15_t;
+
+/**
+ * @brief 浮点二阶节系数转定点，逐节选择 shift
+ * @param sos 浮点系数
+ * @param sections 节数
+ * @param q31/q15 定点系数输出
+ * @return bool 系数绝对值超过 2^SOS_Q_SHIFT_MAX 返回 false，该节按上限饱和
+ */
+bool sos_to_q31(const sos_coeff_t *sos, uint16_t sections, sos_q31_t *q31);
+bool sos_to_q15(const sos_coeff_t *sos, uint16_t sections, sos_q15_t *q15);
+
+/**
+ * @brief 初始化定点双二阶
+ * @param filter 滤波器
+ * @param coeff 系数
+ * @param sections 节数
+ * @param state 状态，sections * 5
+ * @param is_shaping 是否噪声整形：截断误差送入下一个样本，量化噪声移到高频
+ */
+void biquad_q31_init(biquad_q31_t *filter, const sos_q31_t *coeff, uint16_t sections, q31_t *state, bool is_shaping);
+void biquad_q15_init(biquad_q15_t *filter, const sos_q15_t *coeff, uint16_t sections, int32_t *state, bool is_shaping);
+
+/**
+ * @brief 定点双二阶块处理
+ * @param filter 滤波器
+ * @param input 输入
+ * @param output 输出，可与输入相同
+ * @param length 样本数
+ */
+void biquad_q31_block(biquad_q31_t *filter, const q31_t *input, q31_t *output, uint32_t length);
+void biquad_q15_block(biquad_q15_t *filter, const q15_t *input, q15_t *output, uint32_t length);
+
+// ---------------------------------------------------------------- 一阶低通/高通
+
+// y += alpha * (x - y)，状态保留 Q31 精度，高通为 x - 低通
+typedef struct
+{
+    q31_t alpha;  // 系数 Q31
+    q31_t state;  // 低通状态 Q31
+    bool is_high; // 高通
+    bool is_first;
+} onepole_q_t;
+
+/**
+ * @brief 初始化一阶低通/高通
+ * @param filter 滤波器
+ * @param cutoff_freq 截止频率
+ * @param sample_rate 采样率
+ * @param is_high 是否高通
+ */
+void onepole_q_init(onepole_q_t *filter, float cutoff_freq, float sample_rate, bool is_high);
+
+/**
+ * @brief 一阶块处理
+ * @param filter 滤波器
+ * @param input 输入
+ * @param output 输出，可与输入相同
+ * @param length 样本数
+ */
+void onepole_q15_block(onepole_q_t *filter, const q15_t *input, q15_t *output, uint32_t length);
+void onepole_q31_block(onepole_q_t *filter, const q31_t *input, q31_t *output, uint32_t length);
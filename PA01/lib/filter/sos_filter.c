@@ -0,0 +1,103 @@
+#include "./sos_filter.h"
+#include <math.h>
+#include <stdlib.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265359f
+#endif
+
+// 初始化SOS滤波器
+void sos_filter_init(sos_filter_t *filter, const sos_coeff_t *coeff, uint16_t sections, float *state, uint16_t channels)
+{
+    ASSERT(filter != NULL);
+    ASSERT(coeff != NULL);
+    ASSERT(sections > 0);
+    ASSERT(state != NULL);
+    ASSERT(channels > 0);
+
+    filter->coeff = coeff;
+    filter->sections = sections;
+    filter->state = state;
+    filter->channels = channels;
+    sos_filter_reset(filter);
+}
+
+// 清空状态
+void sos_filter_reset(sos_filter_t *filter)
+{
+    ASSERT(filter != NULL);
+
+    uint32_t size = (uint32_t)filter->channels * filter->sections * 2;
+    for (uint32_t i = 0; i < size; i++)
+    {
+        filter->state[i] = 0.0f;
+    }
+}
+
+// 单样本滤波
+float sos_filter(sos_filter_t *filter, uint16_t channel, float input)
+{
+    ASSERT(filter != NULL);
+    ASSERT(channel < filter->channels);
+
+    float *z = &filter->state[(uint32_t)channel * filter->sections * 2];
+    const sos_coeff_t *c = filter->coeff;
+    for (uint16_t s = 0; s < filter->sections; s++, c++, z += 2)
+    {
+        float y = c->b0 * input + z[0];
+        z[0] = c->b1 * input - c->a1 * y + z[1];
+        z[1] = c->b2 * input - c->a2 * y;
+        input = y;
+    }
+    return input;
+}
+
+// 块处理：节外循环
+void sos_filter_block(sos_filter_t *filter, uint16_t channel, const float *input, float *output, uint32_t length)
+{
+    ASSERT(filter != NULL);
+    ASSERT(channel < filter->channels);
+    ASSERT(input != NULL);
+    ASSERT(output != NULL);
+
+    float *z = &filter->state[(uint32_t)channel * filter->sections * 2];
+    const sos_coeff_t *c = filter->coeff;
+    const float *in = input;
+    for (uint16_t s = 0; s < filter->sections; s++, c++, z += 2)
+    {
+        float b0 = c->b0, b1 = c->b1, b2 = c->b2, a1 = c->a1, a2 = c->a2;
+        float z1 = z[0], z2 = z[1];
+        for (uint32_t n = 0; n < length; n++)
+        {
+            float x = in[n];
+            float y = b0 * x + z1;
+            z1 = b1 * x - a1 * y + z2;
+            z2 = b2 * x - a2 * y;
+            output[n] = y;
+        }
+        z[0] = z1;
+        z[1] = z2;
+        in = output; // 后续节原地处理
+    }
+}
+
+// 频率响应幅值
+float sos_filter_magnitude(const sos_coeff_t *coeff, uint16_t sections, float freq, float sample_rate)
+{
+    ASSERT(coeff != NULL);
+
+    float w = 2.0f * (float)M_PI * freq / sample_rate;
+    float c1 = cosf(w), s1 = sinf(w);
+    float c2 = cosf(2.0f * w), s2 = sinf(2.0f * w);
+    float magnitude = 1.0f;
+    for (uint16_t s = 0; s < sections; s++)
+    {
+        // H = (b0 + b1 e^-jw + b2 e^-2jw) / (1 + a1 e^-jw + a2 e^-2jw)
+        float nr = coeff[s].b0 + coeff[s].b1 * c1 + coeff[s].b2 * c2;
+        float ni = -coeff[s].b1 * s1 - coeff[s].b2 * s2;
+        float dr = 1.0f + coeff[s].a1 * c1 + coeff[s].a2 * c2;
+        float di = -coeff[s].a1 * s1 - coeff[s].a2 * s2;
+        magnitude *= sqrtf((nr * nr + ni * ni) / (dr * dr + di * di));
+    }
+    return magnitude;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file sos_filter.h
+ * @author WittXie
+ * @brief 二阶节级联（SOS）双二阶滤波器，转置直接II型
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 每节: y = b0*x + z1; z1 = b1*x - a1*y + z2; z2 = b2*x - a2*y
+ * 系数由 filter_design 生成或手工给出（a0已归一化）；多通道共用系数，状态按 [通道][节][2] 存放。
+ * 块处理时按节外循环、样本内循环，每节系数只加载一次，状态常驻寄存器。
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <stdint.h>
+
+#ifndef ASSERT
+#define ASSERT(_bool, ...) ((void)0)
+#endif
+
+// 二阶节系数
+typedef struct
+{
+    float b0, b1, b2; // 输入系数
+    float a1, a2;     // 输出系数，a0=1
+} sos_coeff_t;
+
+// SOS滤波器结构体
+typedef struct
+{
+    const sos_coeff_t *coeff; // 各节系数
+    float *state;             // 状态，channels * sections * 2
+    uint16_t sections;        // 节数
+    uint16_t channels;        // 通道数
+} sos_filter_t;
+
+/**
+ * @brief 初始化SOS滤波器
+ * @param filter 滤波器结构体指针
+ * @param coeff 各节系数
+ * @param sections 节数
+ * @param state 状态缓存，长度 channels * sections * 2
+ * @param channels 通道数
+ */
+void sos_filter_init(sos_filter_t *filter, const sos_coeff_t *coeff, uint16_t sections, float *state, uint16_t channels);
+
+/**
+ * @brief 清空状态
+ * @param filter 滤波器结构体指针
+ */
+void sos_filter_reset(sos_filter_t *filter);
+
+/**
+ * @brief 单样本滤波
+ * @param filter 滤波器结构体指针
+ * @param channel 通道
+ * @param input 输入
+ * @return float 输出
+ */
+float sos_filter(sos_filter_t *filter, uint16_t channel, float input);
+
+/**
+ * @brief 块处理
+ * @param filter 滤波器结构体指针
+ * @param channel 通道
+ * @param input 输入
+ * @param output 输出，可与输入相同
+ * @param length 样本数
+ */
+void sos_filter_block(sos_filter_t *filter, uint16_t channel, const float *input, float *output, uint32_t length);
+
+/**
+ * @brief 频率响应幅值
+ * @param coeff 各节系数
+ * @param sections 节数
+ * @param freq 频率
+ * @param sample_rate 采样率
+ * @return float 幅值（线性）
+ */
+float sos_filter_magnitude(const sos_coeff_t *coeff, uint16_t sections, float freq, float sample_rate);
@@ -0,0 +1,186 @@
+#include "./ahrs.h"
+#include <stddef.h>
+
+void ahrs_init(ahrs_t *ahrs)
+{
+    ASSERT(ahrs != NULL);
+    ASSERT(ahrs->cfg.sample_rate > 0);
+
+    ahrs->q0 = 1.0f;
+    ahrs->q1 = ahrs->q2 = ahrs->q3 = 0.0f;
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        ahrs->bias[i] = 0;
+        ahrs->integral[i] = 0;
+    }
+    ahrs->dt = 1.0f / ahrs->cfg.sample_rate;
+    ahrs->accel_norm = 0;
+    ahrs->rest = 0;
+    ahrs->is_aligned = false;
+}
+
+// 用重力方向直接求初始横滚/俯仰，只在第一次执行
+static void ahrs_align(ahrs_t *ahrs, float ax, float ay, float az)
+{
+    float roll = fast_atan2_hp(ay, az);
+    float pitch = fast_atan2_hp(-ax, sqrtf(ay * ay + az * az));
+    float cr, sr, cp, sp;
+    fast_sincos_hp(roll * 0.5f, &sr, &cr);
+    fast_sincos_hp(pitch * 0.5f, &sp, &cp);
+    ahrs->q0 = cr * cp;
+    ahrs->q1 = sr * cp;
+    ahrs->q2 = cr * sp;
+    ahrs->q3 = -sr * sp;
+    ahrs->is_aligned = true;
+}
+
+// 静止检测 + 零偏估计
+static void ahrs_rest_update(ahrs_t *ahrs, float gx, float gy, float gz, float norm)
+{
+    if (ahrs->cfg.rest_gyro <= 0)
+    {
+        return;
+    }
+
+    float rest_gyro = ahrs->cfg.rest_gyro;
+    float dx = gx - ahrs->bias[0], dy = gy - ahrs->bias[1], dz = gz - ahrs->bias[2];
+    float delta = norm - ahrs->accel_norm;
+    bool is_still = (dx * dx + dy * dy + dz * dz < rest_gyro * rest_gyro) && (delta * delta < 0.0016f * norm * norm); // 模长平方变化 < 4%
+    ahrs->accel_norm = norm;
+
+    if (!is_still)
+    {
+        ahrs->rest = 0;
+        return;
+    }
+    if (ahrs->rest < ahrs->cfg.rest_count)
+    {
+        ahrs->rest++;
+        return;
+    }
+    ahrs->bias[0] += ahrs->cfg.bias_alpha * dx;
+    ahrs->bias[1] += ahrs->cfg.bias_alpha * dy;
+    ahrs->bias[2] += ahrs->cfg.bias_alpha * dz;
+}
+
+void ahrs_update(ahrs_t *ahrs, const ahrs_sample_t *sample)
+{
+    ASSERT(ahrs != NULL);
+    ASSERT(sample != NULL);
+
+    float ax = sample->ax, ay = sample->ay, az = sample->az;
+    float norm = ax * ax + ay * ay + az * az;
+    if (!ahrs->is_aligned && norm > 0)
+    {
+        ahrs_align(ahrs, ax, ay, az);
+    }
+    ahrs_rest_update(ahrs, sample->gx, sample->gy, sample->gz, norm);
+
+    float gx = sample->gx - ahrs->bias[0];
+    float gy = sample->gy - ahrs->bias[1];
+    float gz = sample->gz - ahrs->bias[2];
+    float q0 = ahrs->q0, q1 = ahrs->q1, q2 = ahrs->q2, q3 = ahrs->q3;
+    float dt = ahrs->dt;
+
+    // 四元数导数 0.5 * q ⊗ (0, g)
+    float dq0 = 0.5f * (-q1 * gx - q2 * gy - q3 * gz);
+    float dq1 = 0.5f * (q0 * gx + q2 * gz - q3 * gy);
+    float dq2 = 0.5f * (q0 * gy - q1 * gz + q3 * gx);
+    float dq3 = 0.5f * (q0 * gz + q1 * gy - q2 * gx);
+
+    if (norm > 0) // 自由落体时只积分陀螺仪
+    {
+        float recip = fast_rsqrt_mp(norm);
+        ax *= recip;
+        ay *= recip;
+        az *= recip;
+
+        if (ahrs->cfg.mode == AHRS_MODE_MADGWICK)
+        {
+            // 目标函数 f = q* ⊗ (0,0,1) ⊗ q - a 的梯度 J^T f
+            float f1 = 2.0f * (q1 * q3 - q0 * q2) - ax;
+            float f2 = 2.0f * (q0 * q1 + q2 * q3) - ay;
+            float f3 = 1.0f - 2.0f * (q1 * q1 + q2 * q2) - az;
+            float s0 = -2.0f * q2 * f1 + 2.0f * q1 * f2;
+            float s1 = 2.0f * q3 * f1 + 2.0f * q0 * f2 - 4.0f * q1 * f3;
+            float s2 = -2.0f * q0 * f1 + 2.0f * q3 * f2 - 4.0f * q2 * f3;
+            float s3 = 2.0f * q1 * f1 + 2.0f * q2 * f2;
+            float s_norm = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+            if (s_norm > 0)
+            {
+                float step = ahrs->cfg.beta * fast_rsqrt_mp(s_norm);
+                dq0 -= step * s0;
+                dq1 -= step * s1;
+                dq2 -= step * s2;
+                dq3 -= step * s3;
+            }
+        }
+        else
+        {
+            // 估计的重力方向与测量值的叉积即为姿态误差
+            float vx = 2.0f * (q1 * q3 - q0 * q2);
+            float vy = 2.0f * (q0 * q1 + q2 * q3);
+            float vz = q0 * q0 - q1 * q1 - q2 * q2 + q3 * q3;
+            float ex = ay * vz - az * vy;
+            float ey = az * vx - ax * vz;
+            float ez = ax * vy - ay * vx;
+            if (ahrs->cfg.ki > 0)
+            {
+                ahrs->integral[0] += ahrs->cfg.ki * ex * dt;
+                ahrs->integral[1] += ahrs->cfg.ki * ey * dt;
+                ahrs->integral[2] += ahrs->cfg.ki * ez * dt;
+            }
+            float cx = ahrs->cfg.kp * ex + ahrs->integral[0];
+            float cy = ahrs->cfg.kp * ey + ahrs->integral[1];
+            float cz = ahrs->cfg.kp * ez + ahrs->integral[2];
+            dq0 += 0.5f * (-q1 * cx - q2 * cy - q3 * cz);
+            dq1 += 0.5f * (q0 * cx + q2 * cz - q3 * cy);
+            dq2 += 0.5f * (q0 * cy - q1 * cz + q3 * cx);
+            dq3 += 0.5f * (q0 * cz + q1 * cy - q2 * cx);
+        }
+    }
+
+    q0 += dq0 * dt;
+    q1 += dq1 * dt;
+    q2 += dq2 * dt;
+    q3 += dq3 * dt;
+
+    // |q| 每步只偏离1一个小量，一阶牛顿修正代替开方
+    float fix = 0.5f * (3.0f - (q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3));
+    ahrs->q0 = q0 * fix;
+    ahrs->q1 = q1 * fix;
+    ahrs->q2 = q2 * fix;
+    ahrs->q3 = q3 * fix;
+}
+
+void ahrs_update_block(ahrs_t *ahrs, const ahrs_sample_t *samples, uint32_t count)
+{
+    ASSERT(ahrs != NULL);
+    ASSERT(samples != NULL);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        ahrs_update(ahrs, &samples[i]);
+    }
+}
+
+void ahrs_euler_get(ahrs_t *ahrs, float *roll, float *pitch, float *yaw)
+{
+    ASSERT(ahrs != NULL);
+
+    float q0 = ahrs->q0, q1 = ahrs->q1, q2 = ahrs->q2, q3 = ahrs->q3;
+    if (roll != NULL)
+    {
+        *roll = fast_atan2_hp(2.0f * (q0 * q1 + q2 * q3), 1.0f - 2.0f * (q1 * q1 + q2 * q2));
+    }
+    if (pitch != NULL)
+    {
+        float s = 2.0f * (q0 * q2 - q3 * q1);
+        s = (s > 1.0f) ? 1.0f : ((s < -1.0f) ? -1.0f : s);
+        *pitch = fast_atan2_hp(s, sqrtf(1.0f - s * s)); // asin
+    }
+    if (yaw != NULL)
+    {
+        *yaw = fast_atan2_hp(2.0f * (q0 * q3 + q1 * q2), 1.0f - 2.0f * (q2 * q2 + q3 * q3));
+    }
+}
@@ -0,0 +1,106 @@
+/**
+ * @file ahrs.h
+ * @author WittXie
+ * @brief 四元数姿态解算（Mahony / Madgwick），固定周期更新
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 输入：陀螺仪角速度（rad/s）和加速度（任意单位，只用方向），机体坐标系 x前 y左 z上。
+ * 四元数积分没有万向锁，偏航角由陀螺仪积分得到（无磁力计时会缓慢漂移）。
+ * 每次更新不调用 libm：加速度和梯度用快速平方根倒数归一化，
+ * 四元数用一阶牛顿修正 q *= (3 - |q|²) / 2 保持单位长度，不开方。
+ * 静止检测：连续 rest_count 个样本角速度小于 rest_gyro 且加速度模长稳定时，低通估计陀螺零偏。
+ * 欧拉角只在 ahrs_euler_get 时由四元数计算。
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "./../../math/fast_math.h"
+
+#ifndef ASSERT
+#define ASSERT(_bool, ...) ((void)0)
+#endif
+
+// 算法
+enum ahrs_mode
+{
+    AHRS_MODE_MAHONY = 0, // 互补PI：kp 比例，ki 积分（同时吸收零偏）
+    AHRS_MODE_MADGWICK,   // 梯度下降：beta 步长
+};
+
+// 一个样本
+typedef struct
+{
+    float gx, gy, gz; // 角速度（rad/s）
+    float ax, ay, az; // 加速度
+} ahrs_sample_t;
+
+typedef struct __ahrs
+{
+    // 参数
+    struct
+    {
+        uint8_t mode;        // 算法 enum ahrs_mode
+        float sample_rate;   // 更新频率（Hz）
+        float kp;            // Mahony 比例增益
+        float ki;            // Mahony 积分增益
+        float beta;          // Madgwick 步长
+        float rest_gyro;     // 静止判定角速度阈值（rad/s），0 关闭零偏估计
+        uint16_t rest_count; // 静止判定连续样本数
+        float bias_alpha;    // 静止时零偏低通系数 0~1
+    } cfg;
+
+    float q0, q1, q2, q3; // 姿态四元数（机体到世界）
+    float bias[3];        // 陀螺零偏估计（rad/s）
+    float integral[3];    // Mahony 积分项
+    float dt;             // 积分步长，默认 1/sample_rate，轮询抖动时可每次改写
+    float accel_norm;     // 上一样本加速度模长平方
+    uint16_t rest;        // 已连续静止样本数
+    bool is_aligned;      // 是否已用加速度对齐初始姿态
+} ahrs_t;
+
+/**
+ * @brief 初始化：单位四元数，清零偏，首个样本对齐重力
+ *
+ * @param ahrs 姿态解算器指针
+ */
+void ahrs_init(ahrs_t *ahrs);
+
+/**
+ * @brief 更新一个样本
+ *
+ * @param ahrs 姿态解算器指针
+ * @param sample 样本
+ */
+void ahrs_update(ahrs_t *ahrs, const ahrs_sample_t *sample);
+
+/**
+ * @brief 批量更新（FIFO 一次读出的连续样本）
+ *
+ * @param ahrs 姿态解算器指针
+ * @param samples 样本
+ * @param count 样本个数
+ */
+void ahrs_update_block(ahrs_t *ahrs, const ahrs_sample_t *samples, uint32_t count);
+
+/**
+ * @brief 按需计算欧拉角（ZYX 顺序，弧度）
+ *
+ * @param ahrs 姿态解算器指针
+ * @param roll 横滚 -π~π，可为NULL
+ * @param pitch 俯仰 -π/2~π/2，可为NULL
+ * @param yaw 偏航 -π~π，可为NULL
+ */
+void ahrs_euler_get(ahrs_t *ahrs, float *roll, float *pitch, float *yaw);
+
+/**
+ * @brief 是否处于静止（零偏估计中）
+ *
+ * @param _ahrs 姿态解算器指针
+ */
+#define ahrs_is_rest(_ahrs) ((_ahrs)->rest >= (_ahrs)->cfg.rest_count && (_ahrs)->cfg.rest_gyro > 0)
@@ -81,7 +81,20 @@ void lsm6dsdtr_poll(lsm6dsdtr_t *lsm6dsdtr)
                 lsm6dsdtr->ops.write(REG_CTRL10_C, &lsm6dsdtr->cfg.config.ctrl10_c, 1);
 
                 // 通过配置计算灵敏度
-                lsm6dsdtr->data.gyro_sensitivity = powf(2, lsm6dsdtr->cfg.config.ctrl2_g_bits.fs_g) * 250.0f / 16383.0f;
+                lsm6dsdtr->data.gyro_sensitivity = (float)(1u << lsm6dsdtr->cfg.config.ctrl2_g_bits.fs_g) * 250.0f / 16383.0f;
+
+                // 姿态解算按轮询周期更新，步长每次实测
+                ahrs_t *ahrs = &lsm6dsdtr->data.ahrs;
+                ahrs->cfg.mode = lsm6dsdtr->cfg.ahrs_mode;
+                ahrs->cfg.sample_rate = 10;
+                ahrs->cfg.kp = lsm6dsdtr->cfg.ahrs_gain;
+                ahrs->cfg.ki = 0;
+                ahrs->cfg.beta = lsm6dsdtr->cfg.ahrs_gain;
+                ahrs->cfg.rest_gyro = 3.0f * (M_PI / 180.0f);
+                ahrs->cfg.rest_count = 20;
+                ahrs->cfg.bias_alpha = 0.05f;
+                ahrs_init(ahrs);
+                ahrs->bias[2] = lsm6dsdtr->cfg.bias * lsm6dsdtr->data.gyro_sensitivity * (M_PI / 180.0f);
 
                 lsm6dsdtr->flag.is_inited = true;
             }
@@ -131,16 +144,23 @@ void lsm6dsdtr_poll(lsm6dsdtr_t *lsm6dsdtr)
     lsm6dsdtr->data.accel.x = (int16_t)((accel_x_h << 8) | accel_x_l); // 计算加速度计
     lsm6dsdtr->data.accel.y = (int16_t)((accel_y_h << 8) | accel_y_l);
     lsm6dsdtr->data.accel.z = (int16_t)((accel_z_h << 8) | accel_z_l);
-    lsm6dsdtr->data.angle.x = atan2(lsm6dsdtr->data.accel.y, lsm6dsdtr->data.accel.z) * (180.0 / M_PI); // 计算角度
-    lsm6dsdtr->data.angle.y = atan2(-lsm6dsdtr->data.accel.x, sqrt(lsm6dsdtr->data.accel.y * lsm6dsdtr->data.accel.y + lsm6dsdtr->data.accel.z * lsm6dsdtr->data.accel.z)) * (180.0 / M_PI);
 
-    // 计算角度（通过角速度积分）
-    float dt = (current_timestamp - lsm6dsdtr->data.timestamp) / 1000000.0; // 时间差，单位为秒
-
-    // 使用互补滤波器融合加速度计和陀螺仪的数据
-    float accel_angle_z = atan2(lsm6dsdtr->data.accel.x, sqrt(lsm6dsdtr->data.accel.y * lsm6dsdtr->data.accel.y + lsm6dsdtr->data.accel.z * lsm6dsdtr->data.accel.z)) * (180.0 / M_PI);
-    lsm6dsdtr->data.angle_z_accum += ((lsm6dsdtr->data.gyro.z - lsm6dsdtr->cfg.bias) * lsm6dsdtr->data.gyro_sensitivity) * dt;
-    lsm6dsdtr->data.angle.z = lsm6dsdtr->cfg.filter_alpha * lsm6dsdtr->data.angle_z_accum + (1 - lsm6dsdtr->cfg.filter_alpha) * accel_angle_z;
+    // 姿态解算：角速度转 rad/s，加速度只用方向
+    float dt = (current_timestamp - lsm6dsdtr->data.timestamp) / 1000000.0f; // 时间差，单位为秒
+    float gyro_scale = lsm6dsdtr->data.gyro_sensitivity * (M_PI / 180.0f);
+    ahrs_sample_t sample = {
+        .gx = lsm6dsdtr->data.gyro.x * gyro_scale,
+        .gy = lsm6dsdtr->data.gyro.y * gyro_scale,
+        .gz = lsm6dsdtr->data.gyro.z * gyro_scale,
+        .ax = lsm6dsdtr->data.accel.x,
+        .ay = lsm6dsdtr->data.accel.y,
+        .az = lsm6dsdtr->data.accel.z,
+    };
+    if (dt > 0)
+    {
+        lsm6dsdtr->data.ahrs.dt = dt;
+        ahrs_update(&lsm6dsdtr->data.ahrs, &sample);
+    }
 
     // 更新时间戳
     lsm6dsdtr->data.timestamp = current_timestamp;
@@ -149,6 +169,18 @@ void lsm6dsdtr_poll(lsm6dsdtr_t *lsm6dsdtr)
     dds_publish(lsm6dsdtr, &lsm6dsdtr->UPDATE, NULL);
 }
 
+// 由姿态四元数计算欧拉角
+void lsm6dsdtr_angle_update(lsm6dsdtr_t *lsm6dsdtr)
+{
+    ASSERT(lsm6dsdtr != NULL);
+
+    float roll, pitch, yaw;
+    ahrs_euler_get(&lsm6dsdtr->data.ahrs, &roll, &pitch, &yaw);
+    lsm6dsdtr->data.angle.x = roll * (180.0f / M_PI);
+    lsm6dsdtr->data.angle.y = pitch * (180.0f / M_PI);
+    lsm6dsdtr->data.angle.z = yaw * (180.0f / M_PI);
+}
+
 // 打印所有参数
 void lsm6dsdtr_args_print(lsm6dsdtr_t *lsm6dsdtr)
 {
@@ -164,8 +196,9 @@ void lsm6dsdtr_args_print(lsm6dsdtr_t *lsm6dsdtr)
          "ctrl6_c: 0x%02X\r\n"
          "ctrl7_g: 0x%02X\r\n"
          "ctrl8_xl: 0x%02X\r\n"
-         "bias: 3.02f\r\n"
-         "filter_alpha: %3.02f\r\n",
+         "bias: %3.02f\r\n"
+         "ahrs_mode: %u\r\n"
+         "ahrs_gain: %3.02f\r\n",
          lsm6dsdtr->cfg.name,
          lsm6dsdtr->cfg.config.ctrl1_xl,
          lsm6dsdtr->cfg.config.ctrl2_g,
@@ -176,5 +209,6 @@ void lsm6dsdtr_args_print(lsm6dsdtr_t *lsm6dsdtr)
          lsm6dsdtr->cfg.config.ctrl7_g,
          lsm6dsdtr->cfg.config.ctrl8_xl,
          lsm6dsdtr->cfg.bias,
-         lsm6dsdtr->cfg.filter_alpha);
+         lsm6dsdtr->cfg.ahrs_mode,
+         lsm6dsdtr->cfg.ahrs_gain);
 }
@@ -15,6 +15,7 @@
 
 // 依赖
 #include "./../../dds/dds.h" // 订阅机制
+#include "./../ahrs/ahrs.h"  // 姿态解算
 
 // 通用接口
 #ifndef ASSERT
@@ -191,8 +192,9 @@ typedef struct __lsm6dsdtr
     {
         const char *name;          // 名称
         lsm6dsdtr_config_t config; // 芯片配置
-        float filter_alpha;        // 低通滤波系数 0~1
-        float bias;                // 角速度偏置(即0漂)
+        uint8_t ahrs_mode;         // 姿态算法 enum ahrs_mode
+        float ahrs_gain;           // Mahony kp / Madgwick beta
+        float bias;                // z轴角速度偏置初值(LSB)，运行中静止时自动估计
         uint8_t try_cnt;           // 初始化尝试次数
     } cfg;
 
@@ -224,16 +226,16 @@ typedef struct __lsm6dsdtr
             int16_t z; // Z轴角速度 (单位: mdps)
         } gyro;
 
-        // 角度数据 (范围: -180° to +180°)
+        // 角度数据 (范围: -180° to +180°)，调用 lsm6dsdtr_angle_update 后有效
         struct
         {
-            float x; // X轴角度 (单位: °)
-            float y; // Y轴角度 (单位: °)
-            float z; // Z轴角度 (单位: °)
+            float x; // 横滚角 (单位: °)
+            float y; // 俯仰角 (单位: °)
+            float z; // 偏航角 (单位: °)
         } angle;
 
         float gyro_sensitivity; // 陀螺仪灵敏度
-        float angle_z_accum;    // z轴角度累加值
+        ahrs_t ahrs;            // 四元数姿态
 
         // 温度数据 (范围: -40°C to +85°C)
         int16_t temperature; // 温度 (单位: °C)
@@ -274,6 +276,13 @@ void lsm6dsdtr_init(lsm6dsdtr_t *lsm6dsdtr);
  */
 void lsm6dsdtr_poll(lsm6dsdtr_t *lsm6dsdtr);
 
+/**
+ * @brief 由姿态四元数计算欧拉角，写入 data.angle
+ *
+ * @param lsm6dsdtr 设备指针
+ */
+void lsm6dsdtr_angle_update(lsm6dsdtr_t *lsm6dsdtr);
+
 /**
  * @brief 打印
  *
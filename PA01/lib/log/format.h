@@ -46,8 +46,33 @@
         log_print((_log), "\r\n");                                                                         \
     }
 
+/**
+ * @brief 打印16进制字节，整行编码后一次输出，输出与 log_print_array(..., "%02X", ...) 相同
+ *
+ * @param buff 数据
+ * @param length 数据长度
+ * @param num_per_line 每行打印个数（常量）
+ */
+#define log_print_hex8_line(_log, _format, _buff, _length, _num_per_line, ...)                                       \
+    {                                                                                                                \
+        log_print_trace((_log), COLOR_H_WHITE _format, ##__VA_ARGS__);                                               \
+        char _line[HEX_ENCODE_SEP_SIZE(_num_per_line) + 2];                                                          \
+        const uint8_t *_data = (const uint8_t *)(_buff);                                                             \
+        for (uint32_t _i = 0; _i < (uint32_t)(_length); _i += (_num_per_line))                                       \
+        {                                                                                                            \
+            uint32_t _n = ((uint32_t)(_length) - _i < (_num_per_line)) ? (uint32_t)(_length) - _i : (_num_per_line); \
+            uint32_t _size = hex_encode_sep(_line, &_data[_i], _n, ' ', true);                                       \
+            if (_n == (_num_per_line))                                                                               \
+            {                                                                                                        \
+                memcpy(&_line[_size], "\r\n", 3);                                                                    \
+            }                                                                                                        \
+            log_print((_log), "%s", _line);                                                                          \
+        }                                                                                                            \
+        log_print((_log), "\r\n");                                                                                   \
+    }
+
 #define log_print_array(_log, _format, _type, _buff, _length, ...) log_print_format_hex(_log, _format, _buff, _length, "", _type, " ", 32, ##__VA_ARGS__)
-#define log_print_hex8(_log, _format, _buff, _length, ...) log_print_array(_log, _format, "%02X", _buff, _length, ##__VA_ARGS__)
+#define log_print_hex8(_log, _format, _buff, _length, ...) log_print_hex8_line(_log, _format, _buff, _length, 32, ##__VA_ARGS__)
 #define log_print_hex16(_log, _format, _buff, _length, ...) log_print_array(_log, _format, "%04X", _buff, _length, ##__VA_ARGS__)
 #define log_print_hex32(_log, _format, _buff, _length, ...) log_print_array(_log, _format, "%08X", _buff, _length, ##__VA_ARGS__)
 #define log_print_float(_log, _format, _buff, _length, ...) log_print_array(_log, _format, "%0.2f", _buff, _length, ##__VA_ARGS__)
@@ -18,8 +18,9 @@ void log_std_write(void *device, dds_topic_t *topic, void *arg, void *userdata)
     // 检查TAG
     if (log->cfg.filter != NULL)
     {
-        // 检查筛选词
-        char *ret = strstr((char *)arg, log->cfg.filter);
+        // 检查筛选词：在本行内容中查找
+        log_str_t *line = (log_str_t *)arg;
+        char *ret = strnstr(line->data, log->cfg.filter, line->length, strlen(log->cfg.filter));
         if (ret == NULL)
         {
             // 不存在筛选词，直接返回
@@ -62,7 +63,7 @@ void log_print_hook(log_t *log, const char *format, ...)
     }
 
     va_start(arg, format);
-    length = vsnprintf((char *)(buff), log->cfg.buff_size, format, arg); // 格式化提取内容
+    length = fmt_vsnprintf((char *)(buff), log->cfg.buff_size, format, arg); // 格式化提取内容
     va_end(arg);
 
     // 发布主题
@@ -109,7 +110,7 @@ void log_dprint_hook(log_t *log, const char *format, ...)
     }
 
     va_start(arg, format);
-    length = vsnprintf((char *)(buff), log->cfg.buff_size, format, arg); // 格式化提取内容
+    length = fmt_vsnprintf((char *)(buff), log->cfg.buff_size, format, arg); // 格式化提取内容
     va_end(arg);
 
     // 发布主题
@@ -0,0 +1,112 @@
+/**
+ * @file lut.h
+ * @author WittXie
+ * @brief 常量查找表：生成表的统一入口 + 均匀网格插值
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 表由 tools/lut/lut_gen.py 按 tools/lut/lut_spec.json 在主机上生成（lut_table.h/.c，随代码提交），
+ * 全部是 const，链接进 FLASH：不占 RAM，上电不用 malloc + 逐项计算。增删表只改 spec 后重新生成。
+ * 当前表：CRC-16/CCITT、1024 点 FFT 旋转因子、整周 float 正弦、1/4 周 Q15 正弦、gamma 2.2、-80~+20 dB 增益。
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "./lut_table.h"
+
+/**
+ * @brief 均匀网格线性插值
+ *
+ * @param table 表
+ * @param size 表长，>= 2
+ * @param x 浮点下标，[0, size-1] 之外取端点
+ * @return float 插值结果
+ */
+static inline float lut_interp_f32(const float *table, uint32_t size, float x)
+{
+    if (!(x > 0.0f))
+    {
+        return table[0]; // 含 NaN
+    }
+    if (x >= (float)(size - 1))
+    {
+        return table[size - 1];
+    }
+    uint32_t i = (uint32_t)x;
+    float a = table[i];
+    return a + (table[i + 1] - a) * (x - (float)i);
+}
+
+/**
+ * @brief 均匀网格线性插值，定点下标
+ *
+ * @param table 表
+ * @param size 表长，>= 2
+ * @param x_q16 Q16 定点下标，超出 size-1 取末项
+ * @return int32_t 插值结果
+ */
+static inline int32_t lut_interp_i16_q16(const int16_t *table, uint32_t size, uint32_t x_q16)
+{
+    uint32_t i = x_q16 >> 16;
+    if (i >= size - 1)
+    {
+        return table[size - 1];
+    }
+    int32_t a = table[i];
+    return a + (((table[i + 1] - a) * (int32_t)(x_q16 & 0xFFFF)) >> 16);
+}
+
+/**
+ * @brief Q15 正弦，1/4 周表按象限对称展开 + 线性插值
+ * @note 最大误差约 1 LSB（Q15 量化本身为 0.5 LSB）
+ *
+ * @param phase 16 位整周角，65536 对应 2π，自然溢出回绕
+ * @return int16_t sin，Q15（-32767 ~ 32767）
+ */
+static inline int16_t lut_sin_q15(uint16_t phase)
+{
+    uint32_t quadrant = phase >> 14;
+    uint32_t x = phase & 0x3FFFu;
+    if (quadrant & 1)
+    {
+        x = 0x4000u - x; // 第二、四象限镜像，x ∈ (0, 0x4000]
+    }
+
+    uint32_t shift = 14 - LUT_SIN_Q15_BITS;
+    uint32_t index = x >> shift;
+    int32_t frac = (int32_t)(x & ((1u << shift) - 1));
+    int32_t y = g_lut_sin_q15[index];
+    if (frac != 0)
+    {
+        y += ((g_lut_sin_q15[index + 1] - y) * frac + (1 << (shift - 1))) >> shift; // 四舍五入
+    }
+    return (int16_t)((quadrant & 2) ? -y : y);
+}
+
+static inline int16_t lut_cos_q15(uint16_t phase)
+{
+    return lut_sin_q15((uint16_t)(phase + 0x4000u));
+}
+
+/**
+ * @brief gamma 校正
+ *
+ * @param value 线性亮度 0~255
+ * @return uint8_t 校正后的 PWM 占空比 0~255
+ */
+#define lut_gamma8(_value) (g_lut_gamma8[(uint8_t)(_value)])
+
+/**
+ * @brief 分贝转幅值增益 10^(dB/20)
+ * @note 1 dB 网格线性插值，相对误差 < 0.2%；超出 [LUT_DB_GAIN_MIN, LUT_DB_GAIN_MAX] 取端点
+ *
+ * @param db 分贝
+ * @return float 增益
+ */
+static inline float lut_db_to_gain(float db)
+{
+    return lut_interp_f32(g_lut_db_gain, LUT_DB_GAIN_SIZE, (db - LUT_DB_GAIN_MIN) * (1.0f / LUT_DB_GAIN_STEP));
+}
@@ -0,0 +1,412 @@
+#include "./lut_table.h"
+
+const uint32_t g_lut_crc_ccitt[LUT_CRC_CCITT_SIZE] = {
+    0x00000000, 0x00001021, 0x00002042, 0x00003063, 0x00004084, 0x000050A5, 0x000060C6, 0x000070E7,
+    0x00008108, 0x00009129, 0x0000A14A, 0x0000B16B, 0x0000C18C, 0x0000D1AD, 0x0000E1CE, 0x0000F1EF,
+    0x00001231, 0x00000210, 0x00003273, 0x00002252, 0x000052B5, 0x00004294, 0x000072F7, 0x000062D6,
+    0x00009339, 0x00008318, 0x0000B37B, 0x0000A35A, 0x0000D3BD, 0x0000C39C, 0x0000F3FF, 0x0000E3DE,
+    0x00002462, 0x00003443, 0x00000420, 0x00001401, 0x000064E6, 0x000074C7, 0x000044A4, 0x00005485,
+    0x0000A56A, 0x0000B54B, 0x00008528, 0x00009509, 0x0000E5EE, 0x0000F5CF, 0x0000C5AC, 0x0000D58D,
+    0x00003653, 0x00002672, 0x00001611, 0x00000630, 0x000076D7, 0x000066F6, 0x00005695, 0x000046B4,
+    0x0000B75B, 0x0000A77A, 0x00009719, 0x00008738, 0x0000F7DF, 0x0000E7FE, 0x0000D79D, 0x0000C7BC,
+    0x000048C4, 0x000058E5, 0x00006886, 0x000078A7, 0x00000840, 0x00001861, 0x00002802, 0x00003823,
+    0x0000C9CC, 0x0000D9ED, 0x0000E98E, 0x0000F9AF, 0x00008948, 0x00009969, 0x0000A90A, 0x0000B92B,
+    0x00005AF5, 0x00004AD4, 0x00007AB7, 0x00006A96, 0x00001A71, 0x00000A50, 0x00003A33, 0x00002A12,
+    0x0000DBFD, 0x0000CBDC, 0x0000FBBF, 0x0000EB9E, 0x00009B79, 0x00008B58, 0x0000BB3B, 0x0000AB1A,
+    0x00006CA6, 0x00007C87, 0x00004CE4, 0x00005CC5, 0x00002C22, 0x00003C03, 0x00000C60, 0x00001C41,
+    0x0000EDAE, 0x0000FD8F, 0x0000CDEC, 0x0000DDCD, 0x0000AD2A, 0x0000BD0B, 0x00008D68, 0x00009D49,
+    0x00007E97, 0x00006EB6, 0x00005ED5, 0x00004EF4, 0x00003E13, 0x00002E32, 0x00001E51, 0x00000E70,
+    0x0000FF9F, 0x0000EFBE, 0x0000DFDD, 0x0000CFFC, 0x0000BF1B, 0x0000AF3A, 0x00009F59, 0x00008F78,
+    0x00009188, 0x000081A9, 0x0000B1CA, 0x0000A1EB, 0x0000D10C, 0x0000C12D, 0x0000F14E, 0x0000E16F,
+    0x00001080, 0x000000A1, 0x000030C2, 0x000020E3, 0x00005004, 0x00004025, 0x00007046, 0x00006067,
+    0x000083B9, 0x00009398, 0x0000A3FB, 0x0000B3DA, 0x0000C33D, 0x0000D31C, 0x0000E37F, 0x0000F35E,
+    0x000002B1, 0x00001290, 0x000022F3, 0x000032D2, 0x00004235, 0x00005214, 0x00006277, 0x00007256,
+    0x0000B5EA, 0x0000A5CB, 0x000095A8, 0x00008589, 0x0000F56E, 0x0000E54F, 0x0000D52C, 0x0000C50D,
+    0x000034E2, 0x000024C3, 0x000014A0, 0x00000481, 0x00007466, 0x00006447, 0x00005424, 0x00004405,
+    0x0000A7DB, 0x0000B7FA, 0x00008799, 0x000097B8, 0x0000E75F, 0x0000F77E, 0x0000C71D, 0x0000D73C,
+    0x000026D3, 0x000036F2, 0x00000691, 0x000016B0, 0x00006657, 0x00007676, 0x00004615, 0x00005634,
+    0x0000D94C, 0x0000C96D, 0x0000F90E, 0x0000E92F, 0x000099C8, 0x000089E9, 0x0000B98A, 0x0000A9AB,
+    0x00005844, 0x00004865, 0x00007806, 0x00006827, 0x000018C0, 0x000008E1, 0x00003882, 0x000028A3,
+    0x0000CB7D, 0x0000DB5C, 0x0000EB3F, 0x0000FB1E, 0x00008BF9, 0x00009BD8, 0x0000ABBB, 0x0000BB9A,
+    0x00004A75, 0x00005A54, 0x00006A37, 0x00007A16, 0x00000AF1, 0x00001AD0, 0x00002AB3, 0x00003A92,
+    0x0000FD2E, 0x0000ED0F, 0x0000DD6C, 0x0000CD4D, 0x0000BDAA, 0x0000AD8B, 0x00009DE8, 0x00008DC9,
+    0x00007C26, 0x00006C07, 0x00005C64, 0x00004C45, 0x00003CA2, 0x00002C83, 0x00001CE0, 0x00000CC1,
+    0x0000EF1F, 0x0000FF3E, 0x0000CF5D, 0x0000DF7C, 0x0000AF9B, 0x0000BFBA, 0x00008FD9, 0x00009FF8,
+    0x00006E17, 0x00007E36, 0x00004E55, 0x00005E74, 0x00002E93, 0x00003EB2, 0x00000ED1, 0x00001EF0};
+
+const float g_lut_fft_twiddle[LUT_FFT_TWIDDLE_COUNT * 2] = {
+    1.000000000e+00f, -0.000000000e+00f, 9.999811649e-01f, -6.135884672e-03f, 9.999247193e-01f, -1.227153838e-02f, 9.998306036e-01f, -1.840673015e-02f,
+    9.996988177e-01f, -2.454122901e-02f, 9.995294213e-01f, -3.067480400e-02f, 9.993223548e-01f, -3.680722415e-02f, 9.990777373e-01f, -4.293825850e-02f,
+    9.987954497e-01f, -4.906767607e-02f, 9.984755516e-01f, -5.519524589e-02f, 9.981181026e-01f, -6.132073700e-02f, 9.977230430e-01f, -6.744392216e-02f,
+    9.972904325e-01f, -7.356456667e-02f, 9.968202710e-01f, -7.968243957e-02f, 9.963126183e-01f, -8.579730988e-02f, 9.957674146e-01f, -9.190895408e-02f,
+    9.951847196e-01f, -9.801714122e-02f, 9.945645928e-01f, -1.041216329e-01f, 9.939069748e-01f, -1.102222055e-01f, 9.932119250e-01f, -1.163186282e-01f,
+    9.924795628e-01f, -1.224106774e-01f, 9.917097688e-01f, -1.284981072e-01f, 9.909026623e-01f, -1.345807016e-01f, 9.900581837e-01f, -1.406582445e-01f,
+    9.891765118e-01f, -1.467304677e-01f, 9.882575870e-01f, -1.527971923e-01f, 9.873014092e-01f, -1.588581502e-01f, 9.863080978e-01f, -1.649131179e-01f,
+    9.852776527e-01f, -1.709618866e-01f, 9.842100739e-01f, -1.770042181e-01f, 9.831054807e-01f, -1.830398887e-01f, 9.819638729e-01f, -1.890686601e-01f,
+    9.807852507e-01f, -1.950903237e-01f, 9.795697927e-01f, -2.011046410e-01f, 9.783173800e-01f, -2.071113735e-01f, 9.770281315e-01f, -2.131103128e-01f,
+    9.757021070e-01f, -2.191012353e-01f, 9.743393660e-01f, -2.250839174e-01f, 9.729399681e-01f, -2.310581058e-01f, 9.715039134e-01f, -2.370236069e-01f,
+    9.700312614e-01f, -2.429801822e-01f, 9.685220718e-01f, -2.489276081e-01f, 9.669764638e-01f, -2.548656464e-01f, 9.653944373e-01f, -2.607941031e-01f,
+    9.637760520e-01f, -2.667127550e-01f, 9.621214271e-01f, -2.726213634e-01f, 9.604305029e-01f, -2.785196900e-01f, 9.587034583e-01f, -2.844075263e-01f,
+    9.569403529e-01f, -2.902846634e-01f, 9.551411867e-01f, -2.961508930e-01f, 9.533060193e-01f, -3.020059466e-01f, 9.514350295e-01f, -3.078496456e-01f,
+    9.495281577e-01f, -3.136817515e-01f, 9.475855827e-01f, -3.195020258e-01f, 9.456073046e-01f, -3.253102899e-01f, 9.435934424e-01f, -3.311063051e-01f,
+    9.415440559e-01f, -3.368898630e-01f, 9.394592047e-01f, -3.426607251e-01f, 9.373390079e-01f, -3.484186828e-01f, 9.351835251e-01f, -3.541635275e-01f,
+    9.329928160e-01f, -3.598950505e-01f, 9.307669401e-01f, -3.656129837e-01f, 9.285060763e-01f, -3.713172078e-01f, 9.262102246e-01f, -3.770074248e-01f,
+    9.238795042e-01f, -3.826834261e-01f, 9.215140343e-01f, -3.883450329e-01f, 9.191138744e-01f, -3.939920366e-01f, 9.166790843e-01f, -3.996241987e-01f,
+    9.142097831e-01f, -4.052413106e-01f, 9.117060304e-01f, -4.108431637e-01f, 9.091680050e-01f, -4.164295495e-01f, 9.065957069e-01f, -4.220002592e-01f,
+    9.039893150e-01f, -4.275550842e-01f, 9.013488293e-01f, -4.330938160e-01f, 8.986744881e-01f, -4.386162460e-01f, 8.959662318e-01f, -4.441221356e-01f,
+    8.932242990e-01f, -4.496113360e-01f, 8.904487491e-01f, -4.550835788e-01f, 8.876396418e-01f, -4.605387151e-01f, 8.847970963e-01f, -4.659765065e-01f,
+    8.819212914e-01f, -4.713967443e-01f, 8.790122271e-01f, -4.767992198e-01f, 8.760700822e-01f, -4.821837842e-01f, 8.730949759e-01f, -4.875501692e-01f,
+    8.700869679e-01f, -4.928981960e-01f, 8.670462370e-01f, -4.982276559e-01f, 8.639728427e-01f, -5.035383701e-01f, 8.608669639e-01f, -5.088301301e-01f,
+    8.577286005e-01f, -5.141027570e-01f, 8.545579910e-01f, -5.193560123e-01f, 8.513551950e-01f, -5.245896578e-01f, 8.481203318e-01f, -5.298036337e-01f,
+    8.448535800e-01f, -5.349976420e-01f, 8.415549994e-01f, -5.401714444e-01f, 8.382247090e-01f, -5.453249812e-01f, 8.348628879e-01f, -5.504579544e-01f,
+    8.314695954e-01f, -5.555702448e-01f, 8.280450702e-01f, -5.606615543e-01f, 8.245893121e-01f, -5.657318234e-01f, 8.211025000e-01f, -5.707807541e-01f,
+    8.175848126e-01f, -5.758081675e-01f, 8.140363097e-01f, -5.808139443e-01f, 8.104571700e-01f, -5.857978463e-01f, 8.068475723e-01f, -5.907596946e-01f,
+    8.032075167e-01f, -5.956993103e-01f, 7.995372415e-01f, -6.006164551e-01f, 7.958369255e-01f, -6.055110693e-01f, 7.921065688e-01f, -6.103827953e-01f,
+    7.883464098e-01f, -6.152315736e-01f, 7.845565677e-01f, -6.200572252e-01f, 7.807372212e-01f, -6.248595119e-01f, 7.768884897e-01f, -6.296382546e-01f,
+    7.730104327e-01f, -6.343932748e-01f, 7.691033483e-01f, -6.391244531e-01f, 7.651672363e-01f, -6.438315511e-01f, 7.612023950e-01f, -6.485143900e-01f,
+    7.572088242e-01f, -6.531728506e-01f, 7.531868219e-01f, -6.578066945e-01f, 7.491363883e-01f, -6.624158025e-01f, 7.450577617e-01f, -6.669999361e-01f,
+    7.409511209e-01f, -6.715589762e-01f, 7.368165851e-01f, -6.760926843e-01f, 7.326542735e-01f, -6.806010008e-01f, 7.284643650e-01f, -6.850836873e-01f,
+    7.242470980e-01f, -6.895405650e-01f, 7.200025320e-01f, -6.939714551e-01f, 7.157308459e-01f, -6.983762383e-01f, 7.114322186e-01f, -7.027547359e-01f,
+    7.071067691e-01f, -7.071067691e-01f, 7.027547359e-01f, -7.114322186e-01f, 6.983762383e-01f, -7.157308459e-01f, 6.939714551e-01f, -7.200025320e-01f,
+    6.895405650e-01f, -7.242470980e-01f, 6.850836873e-01f, -7.284643650e-01f, 6.806010008e-01f, -7.326542735e-01f, 6.760926843e-01f, -7.368165851e-01f,
+    6.715589762e-01f, -7.409511209e-01f, 6.669999361e-01f, -7.450577617e-01f, 6.624158025e-01f, -7.491363883e-01f, 6.578066945e-01f, -7.531868219e-01f,
+    6.531728506e-01f, -7.572088242e-01f, 6.485143900e-01f, -7.612023950e-01f, 6.438315511e-01f, -7.651672363e-01f, 6.391244531e-01f, -7.691033483e-01f,
+    6.343932748e-01f, -7.730104327e-01f, 6.296382546e-01f, -7.768884897e-01f, 6.248595119e-01f, -7.807372212e-01f, 6.200572252e-01f, -7.845565677e-01f,
+    6.152315736e-01f, -7.883464098e-01f, 6.103827953e-01f, -7.921065688e-01f, 6.055110693e-01f, -7.958369255e-01f, 6.006164551e-01f, -7.995372415e-01f,
+    5.956993103e-01f, -8.032075167e-01f, 5.907596946e-01f, -8.068475723e-01f, 5.857978463e-01f, -8.104571700e-01f, 5.808139443e-01f, -8.140363097e-01f,
+    5.758081675e-01f, -8.175848126e-01f, 5.707807541e-01f, -8.211025000e-01f, 5.657318234e-01f, -8.245893121e-01f, 5.606615543e-01f, -8.280450702e-01f,
+    5.555702448e-01f, -8.314695954e-01f, 5.504579544e-01f, -8.348628879e-01f, 5.453249812e-01f, -8.382247090e-01f, 5.401714444e-01f, -8.415549994e-01f,
+    5.349976420e-01f, -8.448535800e-01f, 5.298036337e-01f, -8.481203318e-01f, 5.245896578e-01f, -8.513551950e-01f, 5.193560123e-01f, -8.545579910e-01f,
+    5.141027570e-01f, -8.577286005e-01f, 5.088301301e-01f, -8.608669639e-01f, 5.035383701e-01f, -8.639728427e-01f, 4.982276559e-01f, -8.670462370e-01f,
+    4.928981960e-01f, -8.700869679e-01f, 4.875501692e-01f, -8.730949759e-01f, 4.821837842e-01f, -8.760700822e-01f, 4.767992198e-01f, -8.790122271e-01f,
+    4.713967443e-01f, -8.819212914e-01f, 4.659765065e-01f, -8.847970963e-01f, 4.605387151e-01f, -8.876396418e-01f, 4.550835788e-01f, -8.904487491e-01f,
+    4.496113360e-01f, -8.932242990e-01f, 4.441221356e-01f, -8.959662318e-01f, 4.386162460e-01f, -8.986744881e-01f, 4.330938160e-01f, -9.013488293e-01f,
+    4.275550842e-01f, -9.039893150e-01f, 4.220002592e-01f, -9.065957069e-01f, 4.164295495e-01f, -9.091680050e-01f, 4.108431637e-01f, -9.117060304e-01f,
+    4.052413106e-01f, -9.142097831e-01f, 3.996241987e-01f, -9.166790843e-01f, 3.939920366e-01f, -9.191138744e-01f, 3.883450329e-01f, -9.215140343e-01f,
+    3.826834261e-01f, -9.238795042e-01f, 3.770074248e-01f, -9.262102246e-01f, 3.713172078e-01f, -9.285060763e-01f, 3.656129837e-01f, -9.307669401e-01f,
+    3.598950505e-01f, -9.329928160e-01f, 3.541635275e-01f, -9.351835251e-01f, 3.484186828e-01f, -9.373390079e-01f, 3.426607251e-01f, -9.394592047e-01f,
+    3.368898630e-01f, -9.415440559e-01f, 3.311063051e-01f, -9.435934424e-01f, 3.253102899e-01f, -9.456073046e-01f, 3.195020258e-01f, -9.475855827e-01f,
+    3.136817515e-01f, -9.495281577e-01f, 3.078496456e-01f, -9.514350295e-01f, 3.020059466e-01f, -9.533060193e-01f, 2.961508930e-01f, -9.551411867e-01f,
+    2.902846634e-01f, -9.569403529e-01f, 2.844075263e-01f, -9.587034583e-01f, 2.785196900e-01f, -9.604305029e-01f, 2.726213634e-01f, -9.621214271e-01f,
+    2.667127550e-01f, -9.637760520e-01f, 2.607941031e-01f, -9.653944373e-01f, 2.548656464e-01f, -9.669764638e-01f, 2.489276081e-01f, -9.685220718e-01f,
+    2.429801822e-01f, -9.700312614e-01f, 2.370236069e-01f, -9.715039134e-01f, 2.310581058e-01f, -9.729399681e-01f, 2.250839174e-01f, -9.743393660e-01f,
+    2.191012353e-01f, -9.757021070e-01f, 2.131103128e-01f, -9.770281315e-01f, 2.071113735e-01f, -9.783173800e-01f, 2.011046410e-01f, -9.795697927e-01f,
+    1.950903237e-01f, -9.807852507e-01f, 1.890686601e-01f, -9.819638729e-01f, 1.830398887e-01f, -9.831054807e-01f, 1.770042181e-01f, -9.842100739e-01f,
+    1.709618866e-01f, -9.852776527e-01f, 1.649131179e-01f, -9.863080978e-01f, 1.588581502e-01f, -9.873014092e-01f, 1.527971923e-01f, -9.882575870e-01f,
+    1.467304677e-01f, -9.891765118e-01f, 1.406582445e-01f, -9.900581837e-01f, 1.345807016e-01f, -9.909026623e-01f, 1.284981072e-01f, -9.917097688e-01f,
+    1.224106774e-01f, -9.924795628e-01f, 1.163186282e-01f, -9.932119250e-01f, 1.102222055e-01f, -9.939069748e-01f, 1.041216329e-01f, -9.945645928e-01f,
+    9.801714122e-02f, -9.951847196e-01f, 9.190895408e-02f, -9.957674146e-01f, 8.579730988e-02f, -9.963126183e-01f, 7.968243957e-02f, -9.968202710e-01f,
+    7.356456667e-02f, -9.972904325e-01f, 6.744392216e-02f, -9.977230430e-01f, 6.132073700e-02f, -9.981181026e-01f, 5.519524589e-02f, -9.984755516e-01f,
+    4.906767607e-02f, -9.987954497e-01f, 4.293825850e-02f, -9.990777373e-01f, 3.680722415e-02f, -9.993223548e-01f, 3.067480400e-02f, -9.995294213e-01f,
+    2.454122901e-02f, -9.996988177e-01f, 1.840673015e-02f, -9.998306036e-01f, 1.227153838e-02f, -9.999247193e-01f, 6.135884672e-03f, -9.999811649e-01f,
+    6.123234263e-17f, -1.000000000e+00f, -6.135884672e-03f, -9.999811649e-01f, -1.227153838e-02f, -9.999247193e-01f, -1.840673015e-02f, -9.998306036e-01f,
+    -2.454122901e-02f, -9.996988177e-01f, -3.067480400e-02f, -9.995294213e-01f, -3.680722415e-02f, -9.993223548e-01f, -4.293825850e-02f, -9.990777373e-01f,
+    -4.906767607e-02f, -9.987954497e-01f, -5.519524589e-02f, -9.984755516e-01f, -6.132073700e-02f, -9.981181026e-01f, -6.744392216e-02f, -9.977230430e-01f,
+    -7.356456667e-02f, -9.972904325e-01f, -7.968243957e-02f, -9.968202710e-01f, -8.579730988e-02f, -9.963126183e-01f, -9.190895408e-02f, -9.957674146e-01f,
+    -9.801714122e-02f, -9.951847196e-01f, -1.041216329e-01f, -9.945645928e-01f, -1.102222055e-01f, -9.939069748e-01f, -1.163186282e-01f, -9.932119250e-01f,
+    -1.224106774e-01f, -9.924795628e-01f, -1.284981072e-01f, -9.917097688e-01f, -1.345807016e-01f, -9.909026623e-01f, -1.406582445e-01f, -9.900581837e-01f,
+    -1.467304677e-01f, -9.891765118e-01f, -1.527971923e-01f, -9.882575870e-01f, -1.588581502e-01f, -9.873014092e-01f, -1.649131179e-01f, -9.863080978e-01f,
+    -1.709618866e-01f, -9.852776527e-01f, -1.770042181e-01f, -9.842100739e-01f, -1.830398887e-01f, -9.831054807e-01f, -1.890686601e-01f, -9.819638729e-01f,
+    -1.950903237e-01f, -9.807852507e-01f, -2.011046410e-01f, -9.795697927e-01f, -2.071113735e-01f, -9.783173800e-01f, -2.131103128e-01f, -9.770281315e-01f,
+    -2.191012353e-01f, -9.757021070e-01f, -2.250839174e-01f, -9.743393660e-01f, -2.310581058e-01f, -9.729399681e-01f, -2.370236069e-01f, -9.715039134e-01f,
+    -2.429801822e-01f, -9.700312614e-01f, -2.489276081e-01f, -9.685220718e-01f, -2.548656464e-01f, -9.669764638e-01f, -2.607941031e-01f, -9.653944373e-01f,
+    -2.667127550e-01f, -9.637760520e-01f, -2.726213634e-01f, -9.621214271e-01f, -2.785196900e-01f, -9.604305029e-01f, -2.844075263e-01f, -9.587034583e-01f,
+    -2.902846634e-01f, -9.569403529e-01f, -2.961508930e-01f, -9.551411867e-01f, -3.020059466e-01f, -9.533060193e-01f, -3.078496456e-01f, -9.514350295e-01f,
+    -3.136817515e-01f, -9.495281577e-01f, -3.195020258e-01f, -9.475855827e-01f, -3.253102899e-01f, -9.456073046e-01f, -3.311063051e-01f, -9.435934424e-01f,
+    -3.368898630e-01f, -9.415440559e-01f, -3.426607251e-01f, -9.394592047e-01f, -3.484186828e-01f, -9.373390079e-01f, -3.541635275e-01f, -9.351835251e-01f,
+    -3.598950505e-01f, -9.329928160e-01f, -3.656129837e-01f, -9.307669401e-01f, -3.713172078e-01f, -9.285060763e-01f, -3.770074248e-01f, -9.262102246e-01f,
+    -3.826834261e-01f, -9.238795042e-01f, -3.883450329e-01f, -9.215140343e-01f, -3.939920366e-01f, -9.191138744e-01f, -3.996241987e-01f, -9.166790843e-01f,
+    -4.052413106e-01f, -9.142097831e-01f, -4.108431637e-01f, -9.117060304e-01f, -4.164295495e-01f, -9.091680050e-01f, -4.220002592e-01f, -9.065957069e-01f,
+    -4.275550842e-01f, -9.039893150e-01f, -4.330938160e-01f, -9.013488293e-01f, -4.386162460e-01f, -8.986744881e-01f, -4.441221356e-01f, -8.959662318e-01f,
+    -4.496113360e-01f, -8.932242990e-01f, -4.550835788e-01f, -8.904487491e-01f, -4.605387151e-01f, -8.876396418e-01f, -4.659765065e-01f, -8.847970963e-01f,
+    -4.713967443e-01f, -8.819212914e-01f, -4.767992198e-01f, -8.790122271e-01f, -4.821837842e-01f, -8.760700822e-01f, -4.875501692e-01f, -8.730949759e-01f,
+    -4.928981960e-01f, -8.700869679e-01f, -4.982276559e-01f, -8.670462370e-01f, -5.035383701e-01f, -8.639728427e-01f, -5.088301301e-01f, -8.608669639e-01f,
+    -5.141027570e-01f, -8.577286005e-01f, -5.193560123e-01f, -8.545579910e-01f, -5.245896578e-01f, -8.513551950e-01f, -5.298036337e-01f, -8.481203318e-01f,
+    -5.349976420e-01f, -8.448535800e-01f, -5.401714444e-01f, -8.415549994e-01f, -5.453249812e-01f, -8.382247090e-01f, -5.504579544e-01f, -8.348628879e-01f,
+    -5.555702448e-01f, -8.314695954e-01f, -5.606615543e-01f, -8.280450702e-01f, -5.657318234e-01f, -8.245893121e-01f, -5.707807541e-01f, -8.211025000e-01f,
+    -5.758081675e-01f, -8.175848126e-01f, -5.808139443e-01f, -8.140363097e-01f, -5.857978463e-01f, -8.104571700e-01f, -5.907596946e-01f, -8.068475723e-01f,
+    -5.956993103e-01f, -8.032075167e-01f, -6.006164551e-01f, -7.995372415e-01f, -6.055110693e-01f, -7.958369255e-01f, -6.103827953e-01f, -7.921065688e-01f,
+    -6.152315736e-01f, -7.883464098e-01f, -6.200572252e-01f, -7.845565677e-01f, -6.248595119e-01f, -7.807372212e-01f, -6.296382546e-01f, -7.768884897e-01f,
+    -6.343932748e-01f, -7.730104327e-01f, -6.391244531e-01f, -7.691033483e-01f, -6.438315511e-01f, -7.651672363e-01f, -6.485143900e-01f, -7.612023950e-01f,
+    -6.531728506e-01f, -7.572088242e-01f, -6.578066945e-01f, -7.531868219e-01f, -6.624158025e-01f, -7.491363883e-01f, -6.669999361e-01f, -7.450577617e-01f,
+    -6.715589762e-01f, -7.409511209e-01f, -6.760926843e-01f, -7.368165851e-01f, -6.806010008e-01f, -7.326542735e-01f, -6.850836873e-01f, -7.284643650e-01f,
+    -6.895405650e-01f, -7.242470980e-01f, -6.939714551e-01f, -7.200025320e-01f, -6.983762383e-01f, -7.157308459e-01f, -7.027547359e-01f, -7.114322186e-01f,
+    -7.071067691e-01f, -7.071067691e-01f, -7.114322186e-01f, -7.027547359e-01f, -7.157308459e-01f, -6.983762383e-01f, -7.200025320e-01f, -6.939714551e-01f,
+    -7.242470980e-01f, -6.895405650e-01f, -7.284643650e-01f, -6.850836873e-01f, -7.326542735e-01f, -6.806010008e-01f, -7.368165851e-01f, -6.760926843e-01f,
+    -7.409511209e-01f, -6.715589762e-01f, -7.450577617e-01f, -6.669999361e-01f, -7.491363883e-01f, -6.624158025e-01f, -7.531868219e-01f, -6.578066945e-01f,
+    -7.572088242e-01f, -6.531728506e-01f, -7.612023950e-01f, -6.485143900e-01f, -7.651672363e-01f, -6.438315511e-01f, -7.691033483e-01f, -6.391244531e-01f,
+    -7.730104327e-01f, -6.343932748e-01f, -7.768884897e-01f, -6.296382546e-01f, -7.807372212e-01f, -6.248595119e-01f, -7.845565677e-01f, -6.200572252e-01f,
+    -7.883464098e-01f, -6.152315736e-01f, -7.921065688e-01f, -6.103827953e-01f, -7.958369255e-01f, -6.055110693e-01f, -7.995372415e-01f, -6.006164551e-01f,
+    -8.032075167e-01f, -5.956993103e-01f, -8.068475723e-01f, -5.907596946e-01f, -8.104571700e-01f, -5.857978463e-01f, -8.140363097e-01f, -5.808139443e-01f,
+    -8.175848126e-01f, -5.758081675e-01f, -8.211025000e-01f, -5.707807541e-01f, -8.245893121e-01f, -5.657318234e-01f, -8.280450702e-01f, -5.606615543e-01f,
+    -8.314695954e-01f, -5.555702448e-01f, -8.348628879e-01f, -5.504579544e-01f, -8.382247090e-01f, -5.453249812e-01f, -8.415549994e-01f, -5.401714444e-01f,
+    -8.448535800e-01f, -5.349976420e-01f, -8.481203318e-01f, -5.298036337e-01f, -8.513551950e-01f, -5.245896578e-01f, -8.545579910e-01f, -5.193560123e-01f,
+    -8.577286005e-01f, -5.141027570e-01f, -8.608669639e-01f, -5.088301301e-01f, -8.639728427e-01f, -5.035383701e-01f, -8.670462370e-01f, -4.982276559e-01f,
+    -8.700869679e-01f, -4.928981960e-01f, -8.730949759e-01f, -4.875501692e-01f, -8.760700822e-01f, -4.821837842e-01f, -8.790122271e-01f, -4.767992198e-01f,
+    -8.819212914e-01f, -4.713967443e-01f, -8.847970963e-01f, -4.659765065e-01f, -8.876396418e-01f, -4.605387151e-01f, -8.904487491e-01f, -4.550835788e-01f,
+    -8.932242990e-01f, -4.496113360e-01f, -8.959662318e-01f, -4.441221356e-01f, -8.986744881e-01f, -4.386162460e-01f, -9.013488293e-01f, -4.330938160e-01f,
+    -9.039893150e-01f, -4.275550842e-01f, -9.065957069e-01f, -4.220002592e-01f, -9.091680050e-01f, -4.164295495e-01f, -9.117060304e-01f, -4.108431637e-01f,
+    -9.142097831e-01f, -4.052413106e-01f, -9.166790843e-01f, -3.996241987e-01f, -9.191138744e-01f, -3.939920366e-01f, -9.215140343e-01f, -3.883450329e-01f,
+    -9.238795042e-01f, -3.826834261e-01f, -9.262102246e-01f, -3.770074248e-01f, -9.285060763e-01f, -3.713172078e-01f, -9.307669401e-01f, -3.656129837e-01f,
+    -9.329928160e-01f, -3.598950505e-01f, -9.351835251e-01f, -3.541635275e-01f, -9.373390079e-01f, -3.484186828e-01f, -9.394592047e-01f, -3.426607251e-01f,
+    -9.415440559e-01f, -3.368898630e-01f, -9.435934424e-01f, -3.311063051e-01f, -9.456073046e-01f, -3.253102899e-01f, -9.475855827e-01f, -3.195020258e-01f,
+    -9.495281577e-01f, -3.136817515e-01f, -9.514350295e-01f, -3.078496456e-01f, -9.533060193e-01f, -3.020059466e-01f, -9.551411867e-01f, -2.961508930e-01f,
+    -9.569403529e-01f, -2.902846634e-01f, -9.587034583e-01f, -2.844075263e-01f, -9.604305029e-01f, -2.785196900e-01f, -9.621214271e-01f, -2.726213634e-01f,
+    -9.637760520e-01f, -2.667127550e-01f, -9.653944373e-01f, -2.607941031e-01f, -9.669764638e-01f, -2.548656464e-01f, -9.685220718e-01f, -2.489276081e-01f,
+    -9.700312614e-01f, -2.429801822e-01f, -9.715039134e-01f, -2.370236069e-01f, -9.729399681e-01f, -2.310581058e-01f, -9.743393660e-01f, -2.250839174e-01f,
+    -9.757021070e-01f, -2.191012353e-01f, -9.770281315e-01f, -2.131103128e-01f, -9.783173800e-01f, -2.071113735e-01f, -9.795697927e-01f, -2.011046410e-01f,
+    -9.807852507e-01f, -1.950903237e-01f, -9.819638729e-01f, -1.890686601e-01f, -9.831054807e-01f, -1.830398887e-01f, -9.842100739e-01f, -1.770042181e-01f,
+    -9.852776527e-01f, -1.709618866e-01f, -9.863080978e-01f, -1.649131179e-01f, -9.873014092e-01f, -1.588581502e-01f, -9.882575870e-01f, -1.527971923e-01f,
+    -9.891765118e-01f, -1.467304677e-01f, -9.900581837e-01f, -1.406582445e-01f, -9.909026623e-01f, -1.345807016e-01f, -9.917097688e-01f, -1.284981072e-01f,
+    -9.924795628e-01f, -1.224106774e-01f, -9.932119250e-01f, -1.163186282e-01f, -9.939069748e-01f, -1.102222055e-01f, -9.945645928e-01f, -1.041216329e-01f,
+    -9.951847196e-01f, -9.801714122e-02f, -9.957674146e-01f, -9.190895408e-02f, -9.963126183e-01f, -8.579730988e-02f, -9.968202710e-01f, -7.968243957e-02f,
+    -9.972904325e-01f, -7.356456667e-02f, -9.977230430e-01f, -6.744392216e-02f, -9.981181026e-01f, -6.132073700e-02f, -9.984755516e-01f, -5.519524589e-02f,
+    -9.987954497e-01f, -4.906767607e-02f, -9.990777373e-01f, -4.293825850e-02f, -9.993223548e-01f, -3.680722415e-02f, -9.995294213e-01f, -3.067480400e-02f,
+    -9.996988177e-01f, -2.454122901e-02f, -9.998306036e-01f, -1.840673015e-02f, -9.999247193e-01f, -1.227153838e-02f, -9.999811649e-01f, -6.135884672e-03f,
+    -1.000000000e+00f, -1.224646853e-16f, -9.999811649e-01f, 6.135884672e-03f, -9.999247193e-01f, 1.227153838e-02f, -9.998306036e-01f, 1.840673015e-02f,
+    -9.996988177e-01f, 2.454122901e-02f, -9.995294213e-01f, 3.067480400e-02f, -9.993223548e-01f, 3.680722415e-02f, -9.990777373e-01f, 4.293825850e-02f,
+    -9.987954497e-01f, 4.906767607e-02f, -9.984755516e-01f, 5.519524589e-02f, -9.981181026e-01f, 6.132073700e-02f, -9.977230430e-01f, 6.744392216e-02f,
+    -9.972904325e-01f, 7.356456667e-02f, -9.968202710e-01f, 7.968243957e-02f, -9.963126183e-01f, 8.579730988e-02f, -9.957674146e-01f, 9.190895408e-02f,
+    -9.951847196e-01f, 9.801714122e-02f, -9.945645928e-01f, 1.041216329e-01f, -9.939069748e-01f, 1.102222055e-01f, -9.932119250e-01f, 1.163186282e-01f,
+    -9.924795628e-01f, 1.224106774e-01f, -9.917097688e-01f, 1.284981072e-01f, -9.909026623e-01f, 1.345807016e-01f, -9.900581837e-01f, 1.406582445e-01f,
+    -9.891765118e-01f, 1.467304677e-01f, -9.882575870e-01f, 1.527971923e-01f, -9.873014092e-01f, 1.588581502e-01f, -9.863080978e-01f, 1.649131179e-01f,
+    -9.852776527e-01f, 1.709618866e-01f, -9.842100739e-01f, 1.770042181e-01f, -9.831054807e-01f, 1.830398887e-01f, -9.819638729e-01f, 1.890686601e-01f,
+    -9.807852507e-01f, 1.950903237e-01f, -9.795697927e-01f, 2.011046410e-01f, -9.783173800e-01f, 2.071113735e-01f, -9.770281315e-01f, 2.131103128e-01f,
+    -9.757021070e-01f, 2.191012353e-01f, -9.743393660e-01f, 2.250839174e-01f, -9.729399681e-01f, 2.310581058e-01f, -9.715039134e-01f, 2.370236069e-01f,
+    -9.700312614e-01f, 2.429801822e-01f, -9.685220718e-01f, 2.489276081e-01f, -9.669764638e-01f, 2.548656464e-01f, -9.653944373e-01f, 2.607941031e-01f,
+    -9.637760520e-01f, 2.667127550e-01f, -9.621214271e-01f, 2.726213634e-01f, -9.604305029e-01f, 2.785196900e-01f, -9.587034583e-01f, 2.844075263e-01f,
+    -9.569403529e-01f, 2.902846634e-01f, -9.551411867e-01f, 2.961508930e-01f, -9.533060193e-01f, 3.020059466e-01f, -9.514350295e-01f, 3.078496456e-01f,
+    -9.495281577e-01f, 3.136817515e-01f, -9.475855827e-01f, 3.195020258e-01f, -9.456073046e-01f, 3.253102899e-01f, -9.435934424e-01f, 3.311063051e-01f,
+    -9.415440559e-01f, 3.368898630e-01f, -9.394592047e-01f, 3.426607251e-01f, -9.373390079e-01f, 3.484186828e-01f, -9.351835251e-01f, 3.541635275e-01f,
+    -9.329928160e-01f, 3.598950505e-01f, -9.307669401e-01f, 3.656129837e-01f, -9.285060763e-01f, 3.713172078e-01f, -9.262102246e-01f, 3.770074248e-01f,
+    -9.238795042e-01f, 3.826834261e-01f, -9.215140343e-01f, 3.883450329e-01f, -9.191138744e-01f, 3.939920366e-01f, -9.166790843e-01f, 3.996241987e-01f,
+    -9.142097831e-01f, 4.052413106e-01f, -9.117060304e-01f, 4.108431637e-01f, -9.091680050e-01f, 4.164295495e-01f, -9.065957069e-01f, 4.220002592e-01f,
+    -9.039893150e-01f, 4.275550842e-01f, -9.013488293e-01f, 4.330938160e-01f, -8.986744881e-01f, 4.386162460e-01f, -8.959662318e-01f, 4.441221356e-01f,
+    -8.932242990e-01f, 4.496113360e-01f, -8.904487491e-01f, 4.550835788e-01f, -8.876396418e-01f, 4.605387151e-01f, -8.847970963e-01f, 4.659765065e-01f,
+    -8.819212914e-01f, 4.713967443e-01f, -8.790122271e-01f, 4.767992198e-01f, -8.760700822e-01f, 4.821837842e-01f, -8.730949759e-01f, 4.875501692e-01f,
+    -8.700869679e-01f, 4.928981960e-01f, -8.670462370e-01f, 4.982276559e-01f, -8.639728427e-01f, 5.035383701e-01f, -8.608669639e-01f, 5.088301301e-01f,
+    -8.577286005e-01f, 5.141027570e-01f, -8.545579910e-01f, 5.193560123e-01f, -8.513551950e-01f, 5.245896578e-01f, -8.481203318e-01f, 5.298036337e-01f,
+    -8.448535800e-01f, 5.349976420e-01f, -8.415549994e-01f, 5.401714444e-01f, -8.382247090e-01f, 5.453249812e-01f, -8.348628879e-01f, 5.504579544e-01f,
+    -8.314695954e-01f, 5.555702448e-01f, -8.280450702e-01f, 5.606615543e-01f, -8.245893121e-01f, 5.657318234e-01f, -8.211025000e-01f, 5.707807541e-01f,
+    -8.175848126e-01f, 5.758081675e-01f, -8.140363097e-01f, 5.808139443e-01f, -8.104571700e-01f, 5.857978463e-01f, -8.068475723e-01f, 5.907596946e-01f,
+    -8.032075167e-01f, 5.956993103e-01f, -7.995372415e-01f, 6.006164551e-01f, -7.958369255e-01f, 6.055110693e-01f, -7.921065688e-01f, 6.103827953e-01f,
+    -7.883464098e-01f, 6.152315736e-01f, -7.845565677e-01f, 6.200572252e-01f, -7.807372212e-01f, 6.248595119e-01f, -7.768884897e-01f, 6.296382546e-01f,
+    -7.730104327e-01f, 6.343932748e-01f, -7.691033483e-01f, 6.391244531e-01f, -7.651672363e-01f, 6.438315511e-01f, -7.612023950e-01f, 6.485143900e-01f,
+    -7.572088242e-01f, 6.531728506e-01f, -7.531868219e-01f, 6.578066945e-01f, -7.491363883e-01f, 6.624158025e-01f, -7.450577617e-01f, 6.669999361e-01f,
+    -7.409511209e-01f, 6.715589762e-01f, -7.368165851e-01f, 6.760926843e-01f, -7.326542735e-01f, 6.806010008e-01f, -7.284643650e-01f, 6.850836873e-01f,
+    -7.242470980e-01f, 6.895405650e-01f, -7.200025320e-01f, 6.939714551e-01f, -7.157308459e-01f, 6.983762383e-01f, -7.114322186e-01f, 7.027547359e-01f,
+    -7.071067691e-01f, 7.071067691e-01f, -7.027547359e-01f, 7.114322186e-01f, -6.983762383e-01f, 7.157308459e-01f, -6.939714551e-01f, 7.200025320e-01f,
+    -6.895405650e-01f, 7.242470980e-01f, -6.850836873e-01f, 7.284643650e-01f, -6.806010008e-01f, 7.326542735e-01f, -6.760926843e-01f, 7.368165851e-01f,
+    -6.715589762e-01f, 7.409511209e-01f, -6.669999361e-01f, 7.450577617e-01f, -6.624158025e-01f, 7.491363883e-01f, -6.578066945e-01f, 7.531868219e-01f,
+    -6.531728506e-01f, 7.572088242e-01f, -6.485143900e-01f, 7.612023950e-01f, -6.438315511e-01f, 7.651672363e-01f, -6.391244531e-01f, 7.691033483e-01f,
+    -6.343932748e-01f, 7.730104327e-01f, -6.296382546e-01f, 7.768884897e-01f, -6.248595119e-01f, 7.807372212e-01f, -6.200572252e-01f, 7.845565677e-01f,
+    -6.152315736e-01f, 7.883464098e-01f, -6.103827953e-01f, 7.921065688e-01f, -6.055110693e-01f, 7.958369255e-01f, -6.006164551e-01f, 7.995372415e-01f,
+    -5.956993103e-01f, 8.032075167e-01f, -5.907596946e-01f, 8.068475723e-01f, -5.857978463e-01f, 8.104571700e-01f, -5.808139443e-01f, 8.140363097e-01f,
+    -5.758081675e-01f, 8.175848126e-01f, -5.707807541e-01f, 8.211025000e-01f, -5.657318234e-01f, 8.245893121e-01f, -5.606615543e-01f, 8.280450702e-01f,
+    -5.555702448e-01f, 8.314695954e-01f, -5.504579544e-01f, 8.348628879e-01f, -5.453249812e-01f, 8.382247090e-01f, -5.401714444e-01f, 8.415549994e-01f,
+    -5.349976420e-01f, 8.448535800e-01f, -5.298036337e-01f, 8.481203318e-01f, -5.245896578e-01f, 8.513551950e-01f, -5.193560123e-01f, 8.545579910e-01f,
+    -5.141027570e-01f, 8.577286005e-01f, -5.088301301e-01f, 8.608669639e-01f, -5.035383701e-01f, 8.639728427e-01f, -4.982276559e-01f, 8.670462370e-01f,
+    -4.928981960e-01f, 8.700869679e-01f, -4.875501692e-01f, 8.730949759e-01f, -4.821837842e-01f, 8.760700822e-01f, -4.767992198e-01f, 8.790122271e-01f,
+    -4.713967443e-01f, 8.819212914e-01f, -4.659765065e-01f, 8.847970963e-01f, -4.605387151e-01f, 8.876396418e-01f, -4.550835788e-01f, 8.904487491e-01f,
+    -4.496113360e-01f, 8.932242990e-01f, -4.441221356e-01f, 8.959662318e-01f, -4.386162460e-01f, 8.986744881e-01f, -4.330938160e-01f, 9.013488293e-01f,
+    -4.275550842e-01f, 9.039893150e-01f, -4.220002592e-01f, 9.065957069e-01f, -4.164295495e-01f, 9.091680050e-01f, -4.108431637e-01f, 9.117060304e-01f,
+    -4.052413106e-01f, 9.142097831e-01f, -3.996241987e-01f, 9.166790843e-01f, -3.939920366e-01f, 9.191138744e-01f, -3.883450329e-01f, 9.215140343e-01f,
+    -3.826834261e-01f, 9.238795042e-01f, -3.770074248e-01f, 9.262102246e-01f, -3.713172078e-01f, 9.285060763e-01f, -3.656129837e-01f, 9.307669401e-01f,
+    -3.598950505e-01f, 9.329928160e-01f, -3.541635275e-01f, 9.351835251e-01f, -3.484186828e-01f, 9.373390079e-01f, -3.426607251e-01f, 9.394592047e-01f,
+    -3.368898630e-01f, 9.415440559e-01f, -3.311063051e-01f, 9.435934424e-01f, -3.253102899e-01f, 9.456073046e-01f, -3.195020258e-01f, 9.475855827e-01f,
+    -3.136817515e-01f, 9.495281577e-01f, -3.078496456e-01f, 9.514350295e-01f, -3.020059466e-01f, 9.533060193e-01f, -2.961508930e-01f, 9.551411867e-01f,
+    -2.902846634e-01f, 9.569403529e-01f, -2.844075263e-01f, 9.587034583e-01f, -2.785196900e-01f, 9.604305029e-01f, -2.726213634e-01f, 9.621214271e-01f,
+    -2.667127550e-01f, 9.637760520e-01f, -2.607941031e-01f, 9.653944373e-01f, -2.548656464e-01f, 9.669764638e-01f, -2.489276081e-01f, 9.685220718e-01f,
+    -2.429801822e-01f, 9.700312614e-01f, -2.370236069e-01f, 9.715039134e-01f, -2.310581058e-01f, 9.729399681e-01f, -2.250839174e-01f, 9.743393660e-01f,
+    -2.191012353e-01f, 9.757021070e-01f, -2.131103128e-01f, 9.770281315e-01f, -2.071113735e-01f, 9.783173800e-01f, -2.011046410e-01f, 9.795697927e-01f,
+    -1.950903237e-01f, 9.807852507e-01f, -1.890686601e-01f, 9.819638729e-01f, -1.830398887e-01f, 9.831054807e-01f, -1.770042181e-01f, 9.842100739e-01f,
+    -1.709618866e-01f, 9.852776527e-01f, -1.649131179e-01f, 9.863080978e-01f, -1.588581502e-01f, 9.873014092e-01f, -1.527971923e-01f, 9.882575870e-01f,
+    -1.467304677e-01f, 9.891765118e-01f, -1.406582445e-01f, 9.900581837e-01f, -1.345807016e-01f, 9.909026623e-01f, -1.284981072e-01f, 9.917097688e-01f,
+    -1.224106774e-01f, 9.924795628e-01f, -1.163186282e-01f, 9.932119250e-01f, -1.102222055e-01f, 9.939069748e-01f, -1.041216329e-01f, 9.945645928e-01f,
+    -9.801714122e-02f, 9.951847196e-01f, -9.190895408e-02f, 9.957674146e-01f, -8.579730988e-02f, 9.963126183e-01f, -7.968243957e-02f, 9.968202710e-01f,
+    -7.356456667e-02f, 9.972904325e-01f, -6.744392216e-02f, 9.977230430e-01f, -6.132073700e-02f, 9.981181026e-01f, -5.519524589e-02f, 9.984755516e-01f,
+    -4.906767607e-02f, 9.987954497e-01f, -4.293825850e-02f, 9.990777373e-01f, -3.680722415e-02f, 9.993223548e-01f, -3.067480400e-02f, 9.995294213e-01f,
+    -2.454122901e-02f, 9.996988177e-01f, -1.840673015e-02f, 9.998306036e-01f, -1.227153838e-02f, 9.999247193e-01f, -6.135884672e-03f, 9.999811649e-01f};
+
+const float g_lut_sin[LUT_SIN_SIZE + 1] = {
+    0.000000000e+00f, 6.135884672e-03f, 1.227153838e-02f, 1.840673015e-02f, 2.454122901e-02f, 3.067480400e-02f, 3.680722415e-02f, 4.293825850e-02f,
+    4.906767607e-02f, 5.519524589e-02f, 6.132073700e-02f, 6.744392216e-02f, 7.356456667e-02f, 7.968243957e-02f, 8.579730988e-02f, 9.190895408e-02f,
+    9.801714122e-02f, 1.041216329e-01f, 1.102222055e-01f, 1.163186282e-01f, 1.224106774e-01f, 1.284981072e-01f, 1.345807016e-01f, 1.406582445e-01f,
+    1.467304677e-01f, 1.527971923e-01f, 1.588581502e-01f, 1.649131179e-01f, 1.709618866e-01f, 1.770042181e-01f, 1.830398887e-01f, 1.890686601e-01f,
+    1.950903237e-01f, 2.011046410e-01f, 2.071113735e-01f, 2.131103128e-01f, 2.191012353e-01f, 2.250839174e-01f, 2.310581058e-01f, 2.370236069e-01f,
+    2.429801822e-01f, 2.489276081e-01f, 2.548656464e-01f, 2.607941031e-01f, 2.667127550e-01f, 2.726213634e-01f, 2.785196900e-01f, 2.844075263e-01f,
+    2.902846634e-01f, 2.961508930e-01f, 3.020059466e-01f, 3.078496456e-01f, 3.136817515e-01f, 3.195020258e-01f, 3.253102899e-01f, 3.311063051e-01f,
+    3.368898630e-01f, 3.426607251e-01f, 3.484186828e-01f, 3.541635275e-01f, 3.598950505e-01f, 3.656129837e-01f, 3.713172078e-01f, 3.770074248e-01f,
+    3.826834261e-01f, 3.883450329e-01f, 3.939920366e-01f, 3.996241987e-01f, 4.052413106e-01f, 4.108431637e-01f, 4.164295495e-01f, 4.220002592e-01f,
+    4.275550842e-01f, 4.330938160e-01f, 4.386162460e-01f, 4.441221356e-01f, 4.496113360e-01f, 4.550835788e-01f, 4.605387151e-01f, 4.659765065e-01f,
+    4.713967443e-01f, 4.767992198e-01f, 4.821837842e-01f, 4.875501692e-01f, 4.928981960e-01f, 4.982276559e-01f, 5.035383701e-01f, 5.088301301e-01f,
+    5.141027570e-01f, 5.193560123e-01f, 5.245896578e-01f, 5.298036337e-01f, 5.349976420e-01f, 5.401714444e-01f, 5.453249812e-01f, 5.504579544e-01f,
+    5.555702448e-01f, 5.606615543e-01f, 5.657318234e-01f, 5.707807541e-01f, 5.758081675e-01f, 5.808139443e-01f, 5.857978463e-01f, 5.907596946e-01f,
+    5.956993103e-01f, 6.006164551e-01f, 6.055110693e-01f, 6.103827953e-01f, 6.152315736e-01f, 6.200572252e-01f, 6.248595119e-01f, 6.296382546e-01f,
+    6.343932748e-01f, 6.391244531e-01f, 6.438315511e-01f, 6.485143900e-01f, 6.531728506e-01f, 6.578066945e-01f, 6.624158025e-01f, 6.669999361e-01f,
+    6.715589762e-01f, 6.760926843e-01f, 6.806010008e-01f, 6.850836873e-01f, 6.895405650e-01f, 6.939714551e-01f, 6.983762383e-01f, 7.027547359e-01f,
+    7.071067691e-01f, 7.114322186e-01f, 7.157308459e-01f, 7.200025320e-01f, 7.242470980e-01f, 7.284643650e-01f, 7.326542735e-01f, 7.368165851e-01f,
+    7.409511209e-01f, 7.450577617e-01f, 7.491363883e-01f, 7.531868219e-01f, 7.572088242e-01f, 7.612023950e-01f, 7.651672363e-01f, 7.691033483e-01f,
+    7.730104327e-01f, 7.768884897e-01f, 7.807372212e-01f, 7.845565677e-01f, 7.883464098e-01f, 7.921065688e-01f, 7.958369255e-01f, 7.995372415e-01f,
+    8.032075167e-01f, 8.068475723e-01f, 8.104571700e-01f, 8.140363097e-01f, 8.175848126e-01f, 8.211025000e-01f, 8.245893121e-01f, 8.280450702e-01f,
+    8.314695954e-01f, 8.348628879e-01f, 8.382247090e-01f, 8.415549994e-01f, 8.448535800e-01f, 8.481203318e-01f, 8.513551950e-01f, 8.545579910e-01f,
+    8.577286005e-01f, 8.608669639e-01f, 8.639728427e-01f, 8.670462370e-01f, 8.700869679e-01f, 8.730949759e-01f, 8.760700822e-01f, 8.790122271e-01f,
+    8.819212914e-01f, 8.847970963e-01f, 8.876396418e-01f, 8.904487491e-01f, 8.932242990e-01f, 8.959662318e-01f, 8.986744881e-01f, 9.013488293e-01f,
+    9.039893150e-01f, 9.065957069e-01f, 9.091680050e-01f, 9.117060304e-01f, 9.142097831e-01f, 9.166790843e-01f, 9.191138744e-01f, 9.215140343e-01f,
+    9.238795042e-01f, 9.262102246e-01f, 9.285060763e-01f, 9.307669401e-01f, 9.329928160e-01f, 9.351835251e-01f, 9.373390079e-01f, 9.394592047e-01f,
+    9.415440559e-01f, 9.435934424e-01f, 9.456073046e-01f, 9.475855827e-01f, 9.495281577e-01f, 9.514350295e-01f, 9.533060193e-01f, 9.551411867e-01f,
+    9.569403529e-01f, 9.587034583e-01f, 9.604305029e-01f, 9.621214271e-01f, 9.637760520e-01f, 9.653944373e-01f, 9.669764638e-01f, 9.685220718e-01f,
+    9.700312614e-01f, 9.715039134e-01f, 9.729399681e-01f, 9.743393660e-01f, 9.757021070e-01f, 9.770281315e-01f, 9.783173800e-01f, 9.795697927e-01f,
+    9.807852507e-01f, 9.819638729e-01f, 9.831054807e-01f, 9.842100739e-01f, 9.852776527e-01f, 9.863080978e-01f, 9.873014092e-01f, 9.882575870e-01f,
+    9.891765118e-01f, 9.900581837e-01f, 9.909026623e-01f, 9.917097688e-01f, 9.924795628e-01f, 9.932119250e-01f, 9.939069748e-01f, 9.945645928e-01f,
+    9.951847196e-01f, 9.957674146e-01f, 9.963126183e-01f, 9.968202710e-01f, 9.972904325e-01f, 9.977230430e-01f, 9.981181026e-01f, 9.984755516e-01f,
+    9.987954497e-01f, 9.990777373e-01f, 9.993223548e-01f, 9.995294213e-01f, 9.996988177e-01f, 9.998306036e-01f, 9.999247193e-01f, 9.999811649e-01f,
+    1.000000000e+00f, 9.999811649e-01f, 9.999247193e-01f, 9.998306036e-01f, 9.996988177e-01f, 9.995294213e-01f, 9.993223548e-01f, 9.990777373e-01f,
+    9.987954497e-01f, 9.984755516e-01f, 9.981181026e-01f, 9.977230430e-01f, 9.972904325e-01f, 9.968202710e-01f, 9.963126183e-01f, 9.957674146e-01f,
+    9.951847196e-01f, 9.945645928e-01f, 9.939069748e-01f, 9.932119250e-01f, 9.924795628e-01f, 9.917097688e-01f, 9.909026623e-01f, 9.900581837e-01f,
+    9.891765118e-01f, 9.882575870e-01f, 9.873014092e-01f, 9.863080978e-01f, 9.852776527e-01f, 9.842100739e-01f, 9.831054807e-01f, 9.819638729e-01f,
+    9.807852507e-01f, 9.795697927e-01f, 9.783173800e-01f, 9.770281315e-01f, 9.757021070e-01f, 9.743393660e-01f, 9.729399681e-01f, 9.715039134e-01f,
+    9.700312614e-01f, 9.685220718e-01f, 9.669764638e-01f, 9.653944373e-01f, 9.637760520e-01f, 9.621214271e-01f, 9.604305029e-01f, 9.587034583e-01f,
+    9.569403529e-01f, 9.551411867e-01f, 9.533060193e-01f, 9.514350295e-01f, 9.495281577e-01f, 9.475855827e-01f, 9.456073046e-01f, 9.435934424e-01f,
+    9.415440559e-01f, 9.394592047e-01f, 9.373390079e-01f, 9.351835251e-01f, 9.329928160e-01f, 9.307669401e-01f, 9.285060763e-01f, 9.262102246e-01f,
+    9.238795042e-01f, 9.215140343e-01f, 9.191138744e-01f, 9.166790843e-01f, 9.142097831e-01f, 9.117060304e-01f, 9.091680050e-01f, 9.065957069e-01f,
+    9.039893150e-01f, 9.013488293e-01f, 8.986744881e-01f, 8.959662318e-01f, 8.932242990e-01f, 8.904487491e-01f, 8.876396418e-01f, 8.847970963e-01f,
+    8.819212914e-01f, 8.790122271e-01f, 8.760700822e-01f, 8.730949759e-01f, 8.700869679e-01f, 8.670462370e-01f, 8.639728427e-01f, 8.608669639e-01f,
+    8.577286005e-01f, 8.545579910e-01f, 8.513551950e-01f, 8.481203318e-01f, 8.448535800e-01f, 8.415549994e-01f, 8.382247090e-01f, 8.348628879e-01f,
+    8.314695954e-01f, 8.280450702e-01f, 8.245893121e-01f, 8.211025000e-01f, 8.175848126e-01f, 8.140363097e-01f, 8.104571700e-01f, 8.068475723e-01f,
+    8.032075167e-01f, 7.995372415e-01f, 7.958369255e-01f, 7.921065688e-01f, 7.883464098e-01f, 7.845565677e-01f, 7.807372212e-01f, 7.768884897e-01f,
+    7.730104327e-01f, 7.691033483e-01f, 7.651672363e-01f, 7.612023950e-01f, 7.572088242e-01f, 7.531868219e-01f, 7.491363883e-01f, 7.450577617e-01f,
+    7.409511209e-01f, 7.368165851e-01f, 7.326542735e-01f, 7.284643650e-01f, 7.242470980e-01f, 7.200025320e-01f, 7.157308459e-01f, 7.114322186e-01f,
+    7.071067691e-01f, 7.027547359e-01f, 6.983762383e-01f, 6.939714551e-01f, 6.895405650e-01f, 6.850836873e-01f, 6.806010008e-01f, 6.760926843e-01f,
+    6.715589762e-01f, 6.669999361e-01f, 6.624158025e-01f, 6.578066945e-01f, 6.531728506e-01f, 6.485143900e-01f, 6.438315511e-01f, 6.391244531e-01f,
+    6.343932748e-01f, 6.296382546e-01f, 6.248595119e-01f, 6.200572252e-01f, 6.152315736e-01f, 6.103827953e-01f, 6.055110693e-01f, 6.006164551e-01f,
+    5.956993103e-01f, 5.907596946e-01f, 5.857978463e-01f, 5.808139443e-01f, 5.758081675e-01f, 5.707807541e-01f, 5.657318234e-01f, 5.606615543e-01f,
+    5.555702448e-01f, 5.504579544e-01f, 5.453249812e-01f, 5.401714444e-01f, 5.349976420e-01f, 5.298036337e-01f, 5.245896578e-01f, 5.193560123e-01f,
+    5.141027570e-01f, 5.088301301e-01f, 5.035383701e-01f, 4.982276559e-01f, 4.928981960e-01f, 4.875501692e-01f, 4.821837842e-01f, 4.767992198e-01f,
+    4.713967443e-01f, 4.659765065e-01f, 4.605387151e-01f, 4.550835788e-01f, 4.496113360e-01f, 4.441221356e-01f, 4.386162460e-01f, 4.330938160e-01f,
+    4.275550842e-01f, 4.220002592e-01f, 4.164295495e-01f, 4.108431637e-01f, 4.052413106e-01f, 3.996241987e-01f, 3.939920366e-01f, 3.883450329e-01f,
+    3.826834261e-01f, 3.770074248e-01f, 3.713172078e-01f, 3.656129837e-01f, 3.598950505e-01f, 3.541635275e-01f, 3.484186828e-01f, 3.426607251e-01f,
+    3.368898630e-01f, 3.311063051e-01f, 3.253102899e-01f, 3.195020258e-01f, 3.136817515e-01f, 3.078496456e-01f, 3.020059466e-01f, 2.961508930e-01f,
+    2.902846634e-01f, 2.844075263e-01f, 2.785196900e-01f, 2.726213634e-01f, 2.667127550e-01f, 2.607941031e-01f, 2.548656464e-01f, 2.489276081e-01f,
+    2.429801822e-01f, 2.370236069e-01f, 2.310581058e-01f, 2.250839174e-01f, 2.191012353e-01f, 2.131103128e-01f, 2.071113735e-01f, 2.011046410e-01f,
+    1.950903237e-01f, 1.890686601e-01f, 1.830398887e-01f, 1.770042181e-01f, 1.709618866e-01f, 1.649131179e-01f, 1.588581502e-01f, 1.527971923e-01f,
+    1.467304677e-01f, 1.406582445e-01f, 1.345807016e-01f, 1.284981072e-01f, 1.224106774e-01f, 1.163186282e-01f, 1.102222055e-01f, 1.041216329e-01f,
+    9.801714122e-02f, 9.190895408e-02f, 8.579730988e-02f, 7.968243957e-02f, 7.356456667e-02f, 6.744392216e-02f, 6.132073700e-02f, 5.519524589e-02f,
+    4.906767607e-02f, 4.293825850e-02f, 3.680722415e-02f, 3.067480400e-02f, 2.454122901e-02f, 1.840673015e-02f, 1.227153838e-02f, 6.135884672e-03f,
+    1.224646853e-16f, -6.135884672e-03f, -1.227153838e-02f, -1.840673015e-02f, -2.454122901e-02f, -3.067480400e-02f, -3.680722415e-02f, -4.293825850e-02f,
+    -4.906767607e-02f, -5.519524589e-02f, -6.132073700e-02f, -6.744392216e-02f, -7.356456667e-02f, -7.968243957e-02f, -8.579730988e-02f, -9.190895408e-02f,
+    -9.801714122e-02f, -1.041216329e-01f, -1.102222055e-01f, -1.163186282e-01f, -1.224106774e-01f, -1.284981072e-01f, -1.345807016e-01f, -1.406582445e-01f,
+    -1.467304677e-01f, -1.527971923e-01f, -1.588581502e-01f, -1.649131179e-01f, -1.709618866e-01f, -1.770042181e-01f, -1.830398887e-01f, -1.890686601e-01f,
+    -1.950903237e-01f, -2.011046410e-01f, -2.071113735e-01f, -2.131103128e-01f, -2.191012353e-01f, -2.250839174e-01f, -2.310581058e-01f, -2.370236069e-01f,
+    -2.429801822e-01f, -2.489276081e-01f, -2.548656464e-01f, -2.607941031e-01f, -2.667127550e-01f, -2.726213634e-01f, -2.785196900e-01f, -2.844075263e-01f,
+    -2.902846634e-01f, -2.961508930e-01f, -3.020059466e-01f, -3.078496456e-01f, -3.136817515e-01f, -3.195020258e-01f, -3.253102899e-01f, -3.311063051e-01f,
+    -3.368898630e-01f, -3.426607251e-01f, -3.484186828e-01f, -3.541635275e-01f, -3.598950505e-01f, -3.656129837e-01f, -3.713172078e-01f, -3.770074248e-01f,
+    -3.826834261e-01f, -3.883450329e-01f, -3.939920366e-01f, -3.996241987e-01f, -4.052413106e-01f, -4.108431637e-01f, -4.164295495e-01f, -4.220002592e-01f,
+    -4.275550842e-01f, -4.330938160e-01f, -4.386162460e-01f, -4.441221356e-01f, -4.496113360e-01f, -4.550835788e-01f, -4.605387151e-01f, -4.659765065e-01f,
+    -4.713967443e-01f, -4.767992198e-01f, -4.821837842e-01f, -4.875501692e-01f, -4.928981960e-01f, -4.982276559e-01f, -5.035383701e-01f, -5.088301301e-01f,
+    -5.141027570e-01f, -5.193560123e-01f, -5.245896578e-01f, -5.298036337e-01f, -5.349976420e-01f, -5.401714444e-01f, -5.453249812e-01f, -5.504579544e-01f,
+    -5.555702448e-01f, -5.606615543e-01f, -5.657318234e-01f, -5.707807541e-01f, -5.758081675e-01f, -5.808139443e-01f, -5.857978463e-01f, -5.907596946e-01f,
+    -5.956993103e-01f, -6.006164551e-01f, -6.055110693e-01f, -6.103827953e-01f, -6.152315736e-01f, -6.200572252e-01f, -6.248595119e-01f, -6.296382546e-01f,
+    -6.343932748e-01f, -6.391244531e-01f, -6.438315511e-01f, -6.485143900e-01f, -6.531728506e-01f, -6.578066945e-01f, -6.624158025e-01f, -6.669999361e-01f,
+    -6.715589762e-01f, -6.760926843e-01f, -6.806010008e-01f, -6.850836873e-01f, -6.895405650e-01f, -6.939714551e-01f, -6.983762383e-01f, -7.027547359e-01f,
+    -7.071067691e-01f, -7.114322186e-01f, -7.157308459e-01f, -7.200025320e-01f, -7.242470980e-01f, -7.284643650e-01f, -7.326542735e-01f, -7.368165851e-01f,
+    -7.409511209e-01f, -7.450577617e-01f, -7.491363883e-01f, -7.531868219e-01f, -7.572088242e-01f, -7.612023950e-01f, -7.651672363e-01f, -7.691033483e-01f,
+    -7.730104327e-01f, -7.768884897e-01f, -7.807372212e-01f, -7.845565677e-01f, -7.883464098e-01f, -7.921065688e-01f, -7.958369255e-01f, -7.995372415e-01f,
+    -8.032075167e-01f, -8.068475723e-01f, -8.104571700e-01f, -8.140363097e-01f, -8.175848126e-01f, -8.211025000e-01f, -8.245893121e-01f, -8.280450702e-01f,
+    -8.314695954e-01f, -8.348628879e-01f, -8.382247090e-01f, -8.415549994e-01f, -8.448535800e-01f, -8.481203318e-01f, -8.513551950e-01f, -8.545579910e-01f,
+    -8.577286005e-01f, -8.608669639e-01f, -8.639728427e-01f, -8.670462370e-01f, -8.700869679e-01f, -8.730949759e-01f, -8.760700822e-01f, -8.790122271e-01f,
+    -8.819212914e-01f, -8.847970963e-01f, -8.876396418e-01f, -8.904487491e-01f, -8.932242990e-01f, -8.959662318e-01f, -8.986744881e-01f, -9.013488293e-01f,
+    -9.039893150e-01f, -9.065957069e-01f, -9.091680050e-01f, -9.117060304e-01f, -9.142097831e-01f, -9.166790843e-01f, -9.191138744e-01f, -9.215140343e-01f,
+    -9.238795042e-01f, -9.262102246e-01f, -9.285060763e-01f, -9.307669401e-01f, -9.329928160e-01f, -9.351835251e-01f, -9.373390079e-01f, -9.394592047e-01f,
+    -9.415440559e-01f, -9.435934424e-01f, -9.456073046e-01f, -9.475855827e-01f, -9.495281577e-01f, -9.514350295e-01f, -9.533060193e-01f, -9.551411867e-01f,
+    -9.569403529e-01f, -9.587034583e-01f, -9.604305029e-01f, -9.621214271e-01f, -9.637760520e-01f, -9.653944373e-01f, -9.669764638e-01f, -9.685220718e-01f,
+    -9.700312614e-01f, -9.715039134e-01f, -9.729399681e-01f, -9.743393660e-01f, -9.757021070e-01f, -9.770281315e-01f, -9.783173800e-01f, -9.795697927e-01f,
+    -9.807852507e-01f, -9.819638729e-01f, -9.831054807e-01f, -9.842100739e-01f, -9.852776527e-01f, -9.863080978e-01f, -9.873014092e-01f, -9.882575870e-01f,
+    -9.891765118e-01f, -9.900581837e-01f, -9.909026623e-01f, -9.917097688e-01f, -9.924795628e-01f, -9.932119250e-01f, -9.939069748e-01f, -9.945645928e-01f,
+    -9.951847196e-01f, -9.957674146e-01f, -9.963126183e-01f, -9.968202710e-01f, -9.972904325e-01f, -9.977230430e-01f, -9.981181026e-01f, -9.984755516e-01f,
+    -9.987954497e-01f, -9.990777373e-01f, -9.993223548e-01f, -9.995294213e-01f, -9.996988177e-01f, -9.998306036e-01f, -9.999247193e-01f, -9.999811649e-01f,
+    -1.000000000e+00f, -9.999811649e-01f, -9.999247193e-01f, -9.998306036e-01f, -9.996988177e-01f, -9.995294213e-01f, -9.993223548e-01f, -9.990777373e-01f,
+    -9.987954497e-01f, -9.984755516e-01f, -9.981181026e-01f, -9.977230430e-01f, -9.972904325e-01f, -9.968202710e-01f, -9.963126183e-01f, -9.957674146e-01f,
+    -9.951847196e-01f, -9.945645928e-01f, -9.939069748e-01f, -9.932119250e-01f, -9.924795628e-01f, -9.917097688e-01f, -9.909026623e-01f, -9.900581837e-01f,
+    -9.891765118e-01f, -9.882575870e-01f, -9.873014092e-01f, -9.863080978e-01f, -9.852776527e-01f, -9.842100739e-01f, -9.831054807e-01f, -9.819638729e-01f,
+    -9.807852507e-01f, -9.795697927e-01f, -9.783173800e-01f, -9.770281315e-01f, -9.757021070e-01f, -9.743393660e-01f, -9.729399681e-01f, -9.715039134e-01f,
+    -9.700312614e-01f, -9.685220718e-01f, -9.669764638e-01f, -9.653944373e-01f, -9.637760520e-01f, -9.621214271e-01f, -9.604305029e-01f, -9.587034583e-01f,
+    -9.569403529e-01f, -9.551411867e-01f, -9.533060193e-01f, -9.514350295e-01f, -9.495281577e-01f, -9.475855827e-01f, -9.456073046e-01f, -9.435934424e-01f,
+    -9.415440559e-01f, -9.394592047e-01f, -9.373390079e-01f, -9.351835251e-01f, -9.329928160e-01f, -9.307669401e-01f, -9.285060763e-01f, -9.262102246e-01f,
+    -9.238795042e-01f, -9.215140343e-01f, -9.191138744e-01f, -9.166790843e-01f, -9.142097831e-01f, -9.117060304e-01f, -9.091680050e-01f, -9.065957069e-01f,
+    -9.039893150e-01f, -9.013488293e-01f, -8.986744881e-01f, -8.959662318e-01f, -8.932242990e-01f, -8.904487491e-01f, -8.876396418e-01f, -8.847970963e-01f,
+    -8.819212914e-01f, -8.790122271e-01f, -8.760700822e-01f, -8.730949759e-01f, -8.700869679e-01f, -8.670462370e-01f, -8.639728427e-01f, -8.608669639e-01f,
+    -8.577286005e-01f, -8.545579910e-01f, -8.513551950e-01f, -8.481203318e-01f, -8.448535800e-01f, -8.415549994e-01f, -8.382247090e-01f, -8.348628879e-01f,
+    -8.314695954e-01f, -8.280450702e-01f, -8.245893121e-01f, -8.211025000e-01f, -8.175848126e-01f, -8.140363097e-01f, -8.104571700e-01f, -8.068475723e-01f,
+    -8.032075167e-01f, -7.995372415e-01f, -7.958369255e-01f, -7.921065688e-01f, -7.883464098e-01f, -7.845565677e-01f, -7.807372212e-01f, -7.768884897e-01f,
+    -7.730104327e-01f, -7.691033483e-01f, -7.651672363e-01f, -7.612023950e-01f, -7.572088242e-01f, -7.531868219e-01f, -7.491363883e-01f, -7.450577617e-01f,
+    -7.409511209e-01f, -7.368165851e-01f, -7.326542735e-01f, -7.284643650e-01f, -7.242470980e-01f, -7.200025320e-01f, -7.157308459e-01f, -7.114322186e-01f,
+    -7.071067691e-01f, -7.027547359e-01f, -6.983762383e-01f, -6.939714551e-01f, -6.895405650e-01f, -6.850836873e-01f, -6.806010008e-01f, -6.760926843e-01f,
+    -6.715589762e-01f, -6.669999361e-01f, -6.624158025e-01f, -6.578066945e-01f, -6.531728506e-01f, -6.485143900e-01f, -6.438315511e-01f, -6.391244531e-01f,
+    -6.343932748e-01f, -6.296382546e-01f, -6.248595119e-01f, -6.200572252e-01f, -6.152315736e-01f, -6.103827953e-01f, -6.055110693e-01f, -6.006164551e-01f,
+    -5.956993103e-01f, -5.907596946e-01f, -5.857978463e-01f, -5.808139443e-01f, -5.758081675e-01f, -5.707807541e-01f, -5.657318234e-01f, -5.606615543e-01f,
+    -5.555702448e-01f, -5.504579544e-01f, -5.453249812e-01f, -5.401714444e-01f, -5.349976420e-01f, -5.298036337e-01f, -5.245896578e-01f, -5.193560123e-01f,
+    -5.141027570e-01f, -5.088301301e-01f, -5.035383701e-01f, -4.982276559e-01f, -4.928981960e-01f, -4.875501692e-01f, -4.821837842e-01f, -4.767992198e-01f,
+    -4.713967443e-01f, -4.659765065e-01f, -4.605387151e-01f, -4.550835788e-01f, -4.496113360e-01f, -4.441221356e-01f, -4.386162460e-01f, -4.330938160e-01f,
+    -4.275550842e-01f, -4.220002592e-01f, -4.164295495e-01f, -4.108431637e-01f, -4.052413106e-01f, -3.996241987e-01f, -3.939920366e-01f, -3.883450329e-01f,
+    -3.826834261e-01f, -3.770074248e-01f, -3.713172078e-01f, -3.656129837e-01f, -3.598950505e-01f, -3.541635275e-01f, -3.484186828e-01f, -3.426607251e-01f,
+    -3.368898630e-01f, -3.311063051e-01f, -3.253102899e-01f, -3.195020258e-01f, -3.136817515e-01f, -3.078496456e-01f, -3.020059466e-01f, -2.961508930e-01f,
+    -2.902846634e-01f, -2.844075263e-01f, -2.785196900e-01f, -2.726213634e-01f, -2.667127550e-01f, -2.607941031e-01f, -2.548656464e-01f, -2.489276081e-01f,
+    -2.429801822e-01f, -2.370236069e-01f, -2.310581058e-01f, -2.250839174e-01f, -2.191012353e-01f, -2.131103128e-01f, -2.071113735e-01f, -2.011046410e-01f,
+    -1.950903237e-01f, -1.890686601e-01f, -1.830398887e-01f, -1.770042181e-01f, -1.709618866e-01f, -1.649131179e-01f, -1.588581502e-01f, -1.527971923e-01f,
+    -1.467304677e-01f, -1.406582445e-01f, -1.345807016e-01f, -1.284981072e-01f, -1.224106774e-01f, -1.163186282e-01f, -1.102222055e-01f, -1.041216329e-01f,
+    -9.801714122e-02f, -9.190895408e-02f, -8.579730988e-02f, -7.968243957e-02f, -7.356456667e-02f, -6.744392216e-02f, -6.132073700e-02f, -5.519524589e-02f,
+    -4.906767607e-02f, -4.293825850e-02f, -3.680722415e-02f, -3.067480400e-02f, -2.454122901e-02f, -1.840673015e-02f, -1.227153838e-02f, -6.135884672e-03f,
+    0.000000000e+00f};
+
+const int16_t g_lut_sin_q15[LUT_SIN_Q15_SIZE + 1] = {
+    0, 201, 402, 603, 804, 1005, 1206, 1407, 1608, 1809, 2009, 2210, 2411, 2611, 2811, 3012,
+    3212, 3412, 3612, 3812, 4011, 4211, 4410, 4609, 4808, 5007, 5205, 5404, 5602, 5800, 5998, 6195,
+    6393, 6590, 6787, 6983, 7180, 7376, 7571, 7767, 7962, 8157, 8351, 8546, 8740, 8933, 9127, 9319,
+    9512, 9704, 9896, 10088, 10279, 10469, 10660, 10850, 11039, 11228, 11417, 11605, 11793, 11980, 12167, 12354,
+    12540, 12725, 12910, 13095, 13279, 13463, 13646, 13828, 14010, 14192, 14373, 14553, 14733, 14912, 15091, 15269,
+    15447, 15624, 15800, 15976, 16151, 16326, 16500, 16673, 16846, 17018, 17190, 17361, 17531, 17700, 17869, 18037,
+    18205, 18372, 18538, 18703, 18868, 19032, 19195, 19358, 19520, 19681, 19841, 20001, 20160, 20318, 20475, 20632,
+    20788, 20943, 21097, 21251, 21403, 21555, 21706, 21856, 22006, 22154, 22302, 22449, 22595, 22740, 22884, 23028,
+    23170, 23312, 23453, 23593, 23732, 23870, 24008, 24144, 24279, 24414, 24548, 24680, 24812, 24943, 25073, 25202,
+    25330, 25457, 25583, 25708, 25833, 25956, 26078, 26199, 26320, 26439, 26557, 26674, 26791, 26906, 27020, 27133,
+    27246, 27357, 27467, 27576, 27684, 27791, 27897, 28002, 28106, 28209, 28311, 28411, 28511, 28610, 28707, 28803,
+    28899, 28993, 29086, 29178, 29269, 29359, 29448, 29535, 29622, 29707, 29792, 29875, 29957, 30038, 30118, 30196,
+    30274, 30350, 30425, 30499, 30572, 30644, 30715, 30784, 30853, 30920, 30986, 31050, 31114, 31177, 31238, 31298,
+    31357, 31415, 31471, 31527, 31581, 31634, 31686, 31737, 31786, 31834, 31881, 31927, 31972, 32015, 32058, 32099,
+    32138, 32177, 32214, 32251, 32286, 32319, 32352, 32383, 32413, 32442, 32470, 32496, 32522, 32546, 32568, 32590,
+    32610, 32629, 32647, 32664, 32679, 32693, 32706, 32718, 32729, 32738, 32746, 32753, 32758, 32762, 32766, 32767,
+    32767};
+
+const uint8_t g_lut_gamma8[LUT_GAMMA8_SIZE] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2,
+    3, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 6, 6, 6,
+    6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10, 11, 11, 11, 12,
+    12, 13, 13, 13, 14, 14, 15, 15, 16, 16, 17, 17, 18, 18, 19, 19,
+    20, 20, 21, 22, 22, 23, 23, 24, 25, 25, 26, 26, 27, 28, 28, 29,
+    30, 30, 31, 32, 33, 33, 34, 35, 35, 36, 37, 38, 39, 39, 40, 41,
+    42, 43, 43, 44, 45, 46, 47, 48, 49, 49, 50, 51, 52, 53, 54, 55,
+    56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+    73, 74, 75, 76, 77, 78, 79, 81, 82, 83, 84, 85, 87, 88, 89, 90,
+    91, 93, 94, 95, 97, 98, 99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+    113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+    137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+    163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+    192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+    223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255};
+
+const float g_lut_db_gain[LUT_DB_GAIN_SIZE] = {
+    9.999999747e-05f, 1.122018439e-04f, 1.258925477e-04f, 1.412537531e-04f, 1.584893180e-04f, 1.778279402e-04f, 1.995262282e-04f, 2.238721208e-04f,
+    2.511886414e-04f, 2.818382927e-04f, 3.162277571e-04f, 3.548133827e-04f, 3.981071641e-04f, 4.466835817e-04f, 5.011872272e-04f, 5.623413017e-04f,
+    6.309573655e-04f, 7.079457864e-04f, 7.943282253e-04f, 8.912509657e-04f, 1.000000047e-03f, 1.122018439e-03f, 1.258925418e-03f, 1.412537531e-03f,
+    1.584893209e-03f, 1.778279431e-03f, 1.995262224e-03f, 2.238721121e-03f, 2.511886414e-03f, 2.818383044e-03f, 3.162277630e-03f, 3.548133885e-03f,
+    3.981071524e-03f, 4.466835875e-03f, 5.011872388e-03f, 5.623413250e-03f, 6.309573539e-03f, 7.079457864e-03f, 7.943281904e-03f, 8.912509307e-03f,
+    9.999999776e-03f, 1.122018415e-02f, 1.258925442e-02f, 1.412537508e-02f, 1.584893279e-02f, 1.778279431e-02f, 1.995262317e-02f, 2.238721214e-02f,
+    2.511886507e-02f, 2.818382904e-02f, 3.162277490e-02f, 3.548133746e-02f, 3.981071711e-02f, 4.466835782e-02f, 5.011872202e-02f, 5.623413250e-02f,
+    6.309573352e-02f, 7.079457492e-02f, 7.943282276e-02f, 8.912509680e-02f, 1.000000015e-01f, 1.122018471e-01f, 1.258925349e-01f, 1.412537545e-01f,
+    1.584893167e-01f, 1.778279394e-01f, 1.995262355e-01f, 2.238721102e-01f, 2.511886358e-01f, 2.818382978e-01f, 3.162277639e-01f, 3.548133969e-01f,
+    3.981071711e-01f, 4.466835856e-01f, 5.011872053e-01f, 5.623413324e-01f, 6.309573650e-01f, 7.079457641e-01f, 7.943282127e-01f, 8.912509084e-01f,
+    1.000000000e+00f, 1.122018456e+00f, 1.258925438e+00f, 1.412537575e+00f, 1.584893227e+00f, 1.778279424e+00f, 1.995262265e+00f, 2.238721132e+00f,
+    2.511886358e+00f, 2.818382978e+00f, 3.162277699e+00f, 3.548133850e+00f, 3.981071711e+00f, 4.466835976e+00f, 5.011872292e+00f, 5.623413086e+00f,
+    6.309573650e+00f, 7.079457760e+00f, 7.943282127e+00f, 8.912508965e+00f, 1.000000000e+01f};
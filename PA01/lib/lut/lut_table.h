@@ -0,0 +1,58 @@
+/**
+ * @file lut_table.h
+ * @author WittXie
+ * @brief 常量查找表声明
+ * @version 0.1
+ * @date 2026-10-19
+ * @note 由 tools/lut/lut_gen.py 按 tools/lut/lut_spec.json 生成，勿手工修改
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <stdint.h>
+
+// crc_ccitt
+#define LUT_CRC_CCITT_SIZE 256          // 表长
+#define LUT_CRC_CCITT_POLYNOMIAL 0x1021 // 多项式
+#define LUT_CRC_CCITT_WIDTH 16          // CRC宽度
+
+// fft_twiddle
+#define LUT_FFT_TWIDDLE_SIZE 1024 // 对应的FFT点数
+#define LUT_FFT_TWIDDLE_COUNT 768 // 旋转因子个数
+
+// sin
+#define LUT_SIN_BITS 10                   // 表长位数
+#define LUT_SIN_SIZE (1u << LUT_SIN_BITS) // 每周点数
+
+// sin_q15
+#define LUT_SIN_Q15_BITS 8                        // 表长位数
+#define LUT_SIN_Q15_SIZE (1u << LUT_SIN_Q15_BITS) // 1/4 周点数
+
+// gamma8
+#define LUT_GAMMA8_SIZE 256   // 表长
+#define LUT_GAMMA8_GAMMA 2.2f // gamma 值
+
+// db_gain
+#define LUT_DB_GAIN_MIN (-80.0f) // 起点 dB
+#define LUT_DB_GAIN_MAX (20.0f)  // 终点 dB
+#define LUT_DB_GAIN_STEP (1.0f)  // 网格间距 dB
+#define LUT_DB_GAIN_SIZE 101     // 表长
+
+// CRC-16/CCITT-FALSE 查表，MSB 先行，与 crc_t.table 格式一致
+extern const uint32_t g_lut_crc_ccitt[LUT_CRC_CCITT_SIZE];
+
+// FFT 旋转因子 W_N^k = exp(-2πik/N)，k < 3N/4，{real, imag} 交错；点数 N/s 的变换按步长 s 取用
+extern const float g_lut_fft_twiddle[LUT_FFT_TWIDDLE_COUNT * 2];
+
+// 整周正弦表 sin(2π·i/N)，末尾多一项供插值
+extern const float g_lut_sin[LUT_SIN_SIZE + 1];
+
+// 1/4 周正弦表 Q15，sin(π/2·i/N)，末尾多一项供插值
+extern const int16_t g_lut_sin_q15[LUT_SIN_Q15_SIZE + 1];
+
+// 8 位 gamma 校正，255·(i/255)^gamma 四舍五入
+extern const uint8_t g_lut_gamma8[LUT_GAMMA8_SIZE];
+
+// 分贝转幅值增益 10^(dB/20)，均匀 dB 网格
+extern const float g_lut_db_gain[LUT_DB_GAIN_SIZE];
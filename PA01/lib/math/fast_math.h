@@ -0,0 +1,357 @@
+/**
+ * @file fast_math.h
+ * @author WittXie
+ * @brief 快速数学函数：sin/cos/sincos、atan2、sqrt/rsqrt、exp/log/pow、tanh 的多项式（minimax）近似
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 每个函数三档精度，后缀 _lp/_mp/_hp 依次更准、更慢，全部内联，无查表。
+ * 误差为对照双精度 libm 全范围扫描实测的最大值（abs 绝对误差，rel 相对误差，ulp 结果的末位单位）：
+ *
+ *  函数         _lp             _mp             _hp             适用范围
+ *  sin/cos      abs 2.9e-4      abs 1.2e-6      abs 8.8e-8      |x| <= 8192，超出后误差随 |x| 增长
+ *  atan2        abs 1.1e-3 rad  abs 1.0e-5 rad  abs 3.6e-7 rad  有限值，atan2(0, 0) = 0
+ *  rsqrt/sqrt   rel 6.5e-4      rel 8.4e-7      rel 2.2e-7      x 为正规数，sqrt(0) = 0
+ *  exp2         rel 1.7e-3      rel 2.7e-6      rel 1.6e-7      x < -126 返回 0，x >= 128 返回 inf
+ *  exp          rel 1.7e-3      rel 2.7e-6      rel 1.9e-7      x < -87.3 返回 0，x > 88.72 返回 inf
+ *  log2/log     abs 4.9e-3      abs 1.5e-5      abs 1.7e-7      x > 0，x = 0 返回 -inf，x < 0 返回 NaN；_hp 在 |log2(x)| >= 1 时 1.7 ulp
+ *  pow          rel 误差 ≈ |y| * log2 绝对误差 * ln2 + exp2 相对误差，x < 0 返回 NaN
+ *  tanh         abs 8.6e-4      abs 1.4e-6      abs 1.6e-7
+ *
+ * sin/cos 按 π/2 象限规约（三段 Cody-Waite），[-π/4, π/4] 上 sin 用奇多项式、cos 用偶多项式；
+ * atan2 规约到 [0, 1] 后用奇多项式；rsqrt 为魔数初值 + Kadlec 修正 + 0~2 次牛顿迭代；
+ * exp2 拆整数部分直接写指数位，小数部分多项式；log2 取指数位，尾数按 s = (m-1)/(m+1) 的奇多项式（_lp 为尾数二次式，无除法）。
+ * Cortex-M7 的 sqrtf 为单条 VSQRT 指令（-fno-math-errno 时），sqrt 的 _mp/_hp 档只在没有硬件开方时有优势。
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef M_PI
+#define M_PI 3.14159265359f
+#endif
+
+#define FAST_PI_2 1.57079632679f  // π/2
+#define FAST_LOG2E 1.44269504089f // log2(e)
+#define FAST_LN2 0.69314718056f   // ln(2)
+#define FAST_LN2_A 0.693145751953125f // ln(2) 高段，低位为零
+#define FAST_LN2_B 1.428606765330187e-6f // ln(2) 低段
+
+// 浮点与位模式互转
+typedef union
+{
+    float f;
+    uint32_t i;
+} fast_bits_t;
+
+// ---------------------------------------------------------------- sin/cos
+
+// 三段 π/2，前两段低位为零，k * 高段在 |k| < 2^13 时无舍入
+#define FAST_PI_2_A 1.5703125f
+#define FAST_PI_2_B 4.837512969970703125e-4f
+#define FAST_PI_2_C 7.54978995489188216e-8f
+
+// 规约到 [-π/4, π/4]，返回象限
+static inline int32_t fast_sincos_reduce(float x, float *r)
+{
+    float t = x * (1.0f / FAST_PI_2);
+    int32_t k = (int32_t)(t + ((t >= 0) ? 0.5f : -0.5f));
+    float kf = (float)k;
+    *r = ((x - kf * FAST_PI_2_A) - kf * FAST_PI_2_B) - kf * FAST_PI_2_C;
+    return k;
+}
+
+// [-π/4, π/4] 上的 sin/cos 多项式
+static inline float fast_sin_poly_lp(float r)
+{
+    float r2 = r * r;
+    return r * (9.995915890e-01f + r2 * -1.615350991e-01f);
+}
+static inline float fast_cos_poly_lp(float r)
+{
+    float r2 = r * r;
+    return 9.999900460e-01f + r2 * (-4.997081459e-01f + r2 * 4.039853439e-02f);
+}
+static inline float fast_sin_poly_mp(float r)
+{
+    float r2 = r * r;
+    return r * (9.999985099e-01f + r2 * (-1.666238159e-01f + r2 * 8.150056936e-03f));
+}
+static inline float fast_cos_poly_mp(float r)
+{
+    float r2 = r * r;
+    return 1.0f + r2 * (-4.999985695e-01f + r2 * (4.165502638e-02f + r2 * -1.358590904e-03f));
+}
+static inline float fast_sin_poly_hp(float r)
+{
+    float r2 = r * r;
+    return r + r * r2 * (-1.666665077e-01f + r2 * (8.332016878e-03f + r2 * -1.950182195e-04f));
+}
+static inline float fast_cos_poly_hp(float r)
+{
+    float r2 = r * r;
+    return 1.0f + r2 * (-5.000000000e-01f + r2 * (4.166661575e-02f + r2 * (-1.388661913e-03f + r2 * 2.437992953e-05f)));
+}
+
+// 按象限组合：sin = [s, c, -s, -c]，cos = [c, -s, -c, s]
+#define FAST_SINCOS_DEFINE(_tier)                                                   \
+    static inline float fast_sin_##_tier(float x)                                   \
+    {                                                                               \
+        float r;                                                                    \
+        int32_t k = fast_sincos_reduce(x, &r);                                      \
+        float v = (k & 1) ? fast_cos_poly_##_tier(r) : fast_sin_poly_##_tier(r);    \
+        return (k & 2) ? -v : v;                                                    \
+    }                                                                               \
+    static inline float fast_cos_##_tier(float x)                                   \
+    {                                                                               \
+        float r;                                                                    \
+        int32_t k = fast_sincos_reduce(x, &r);                                      \
+        float v = (k & 1) ? fast_sin_poly_##_tier(r) : fast_cos_poly_##_tier(r);    \
+        return ((k + 1) & 2) ? -v : v;                                              \
+    }                                                                               \
+    static inline void fast_sincos_##_tier(float x, float *sin_out, float *cos_out) \
+    {                                                                               \
+        float r;                                                                    \
+        int32_t k = fast_sincos_reduce(x, &r);                                      \
+        float s = fast_sin_poly_##_tier(r), c = fast_cos_poly_##_tier(r);           \
+        if (k & 1)                                                                  \
+        {                                                                           \
+            float t = s;                                                            \
+            s = c;                                                                  \
+            c = -t;                                                                 \
+        }                                                                           \
+        *sin_out = (k & 2) ? -s : s;                                                \
+        *cos_out = (k & 2) ? -c : c;                                                \
+    }
+
+FAST_SINCOS_DEFINE(lp)
+FAST_SINCOS_DEFINE(mp)
+FAST_SINCOS_DEFINE(hp)
+
+// ---------------------------------------------------------------- atan2
+
+// [0, 1] 上的 atan 奇多项式
+static inline float fast_atan_poly_lp(float t)
+{
+    float t2 = t * t;
+    return t * (9.980741739e-01f + t2 * (-2.957436144e-01f + t2 * 8.306764066e-02f));
+}
+static inline float fast_atan_poly_mp(float t)
+{
+    float t2 = t * t;
+    return t * (9.999995828e-01f + t2 * (-3.332260847e-01f + t2 * (1.975369006e-01f + t2 * (-1.264000386e-01f + t2 * (6.305945665e-02f + t2 * -1.557161380e-02f)))));
+}
+static inline float fast_atan_poly_hp(float t)
+{
+    float t2 = t * t;
+    float p = -2.142428607e-02f + t2 * 4.240624607e-03f;
+    p = -8.156170696e-02f + t2 * (5.095542222e-02f + t2 * p);
+    p = 1.999918967e-01f + t2 * (-1.426591575e-01f + t2 * (1.091886237e-01f + t2 * p));
+    return t + t * t2 * (-3.333332539e-01f + t2 * p);
+}
+
+// 规约：t = min/max，|y| > |x| 时取余角，再按象限翻转
+#define FAST_ATAN2_DEFINE(_tier)                                    \
+    static inline float fast_atan2_##_tier(float y, float x)        \
+    {                                                               \
+        float ax = fabsf(x), ay = fabsf(y);                         \
+        float max = (ax > ay) ? ax : ay, min = (ax > ay) ? ay : ax; \
+        if (max == 0)                                               \
+        {                                                           \
+            return 0;                                               \
+        }                                                           \
+        float r = fast_atan_poly_##_tier(min / max);                \
+        if (ay > ax)                                                \
+        {                                                           \
+            r = FAST_PI_2 - r;                                      \
+        }                                                           \
+        if (x < 0)                                                  \
+        {                                                           \
+            r = (float)M_PI - r;                                    \
+        }                                                           \
+        return (y < 0) ? -r : r;                                    \
+    }
+
+FAST_ATAN2_DEFINE(lp)
+FAST_ATAN2_DEFINE(mp)
+FAST_ATAN2_DEFINE(hp)
+
+// ---------------------------------------------------------------- sqrt/rsqrt
+
+// 魔数初值 + Kadlec 一次修正，相对误差 6.5e-4
+static inline float fast_rsqrt_lp(float x)
+{
+    fast_bits_t v = {.f = x};
+    v.i = 0x5F1FFFF9u - (v.i >> 1);
+    return v.f * 0.703952253f * (2.38924456f - x * v.f * v.f);
+}
+
+// 再加一次牛顿迭代，误差平方级下降
+static inline float fast_rsqrt_mp(float x)
+{
+    float y = fast_rsqrt_lp(x);
+    return y * (1.5f - 0.5f * x * y * y);
+}
+
+static inline float fast_rsqrt_hp(float x)
+{
+    float y = fast_rsqrt_mp(x);
+    return y * (1.5f - 0.5f * x * y * y);
+}
+
+// sqrt(x) = x * rsqrt(x)，x = 0 时结果为 0
+static inline float fast_sqrt_lp(float x)
+{
+    return x * fast_rsqrt_lp(x);
+}
+static inline float fast_sqrt_mp(float x)
+{
+    return x * fast_rsqrt_mp(x);
+}
+static inline float fast_sqrt_hp(float x)
+{
+    return x * fast_rsqrt_hp(x);
+}
+
+// ---------------------------------------------------------------- exp/log/pow
+
+// [0, 1) 上的 2^f 多项式
+static inline float fast_exp2_poly_lp(float f)
+{
+    return 1.001724720e+00f + f * (6.576362848e-01f + f * 3.371894360e-01f);
+}
+static inline float fast_exp2_poly_mp(float f)
+{
+    return 1.000002623e+00f + f * (6.930038333e-01f + f * (2.414427549e-01f + f * (5.201146007e-02f + f * 1.353416778e-02f)));
+}
+static inline float fast_exp2_poly_hp(float f)
+{
+    return 9.999999404e-01f + f * (6.931530833e-01f + f * (2.401536107e-01f + f * (5.582631752e-02f + f * (8.989339694e-03f + f * 1.877576695e-03f))));
+}
+
+// [√½, √2) 上的 log2(m)，s = (m-1)/(m+1)
+static inline float fast_log2_poly_mp(float s)
+{
+    return s * (2.885325909e+00f + s * s * 9.791280627e-01f);
+}
+static inline float fast_log2_poly_hp(float s)
+{
+    float s2 = s * s;
+    return s * (2.885390520e+00f + s2 * (9.615883231e-01f + s2 * 5.957806706e-01f));
+}
+
+// 2^x：整数部分写入指数位，小数部分多项式
+#define FAST_EXP_DEFINE(_tier)                                          \
+    static inline float fast_exp2_##_tier(float x)                      \
+    {                                                                   \
+        if (x < -126.0f)                                                \
+        {                                                               \
+            return 0;                                                   \
+        }                                                               \
+        if (x >= 128.0f)                                                \
+        {                                                               \
+            return HUGE_VALF;                                           \
+        }                                                               \
+        int32_t i = (int32_t)x;                                         \
+        if (x < (float)i)                                               \
+        {                                                               \
+            i--; /* 向下取整 */                                             \
+        }                                                               \
+        fast_bits_t v = {.f = fast_exp2_poly_##_tier(x - (float)i)};    \
+        v.i += (uint32_t)i << 23;                                       \
+        return v.f;                                                     \
+    }                                                                   \
+    /* e^x：k = floor(x * log2(e))，r = x - k * ln2 两段相减，乘法舍入不随 |x| 放大 */ \
+    static inline float fast_exp_##_tier(float x)                       \
+    {                                                                   \
+        if (x < -87.3f)                                                 \
+        {                                                               \
+            return 0;                                                   \
+        }                                                               \
+        if (x > 88.72f)                                                 \
+        {                                                               \
+            return HUGE_VALF;                                           \
+        }                                                               \
+        float t = x * FAST_LOG2E;                                       \
+        int32_t k = (int32_t)t;                                         \
+        if (t < (float)k)                                               \
+        {                                                               \
+            k--;                                                        \
+        }                                                               \
+        float r = (x - (float)k * FAST_LN2_A) - (float)k * FAST_LN2_B;  \
+        fast_bits_t v = {.f = fast_exp2_poly_##_tier(r * FAST_LOG2E)};  \
+        v.i += (uint32_t)k << 23;                                       \
+        return v.f;                                                     \
+    }
+
+FAST_EXP_DEFINE(lp)
+FAST_EXP_DEFINE(mp)
+FAST_EXP_DEFINE(hp)
+
+// log2：_lp 尾数 [1, 2) 二次式，无除法
+static inline float fast_log2_lp(float x)
+{
+    if (!(x > 0))
+    {
+        return (x == 0) ? -HUGE_VALF : NAN;
+    }
+    fast_bits_t v = {.f = x};
+    float e = (float)((int32_t)(v.i >> 23) - 127);
+    v.i = (v.i & 0x007FFFFFu) | 0x3F800000u;
+    return e + -1.674877589e+00f + v.f * (2.024665783e+00f + v.f * -3.448484342e-01f);
+}
+
+// log2：_mp/_hp 尾数规约到 [√½, √2)
+#define FAST_LOG_DEFINE(_tier)                                                 \
+    static inline float fast_log2_##_tier(float x)                             \
+    {                                                                          \
+        if (!(x > 0))                                                          \
+        {                                                                      \
+            return (x == 0) ? -HUGE_VALF : NAN;                                \
+        }                                                                      \
+        fast_bits_t v = {.f = x};                                              \
+        int32_t e = (int32_t)(v.i >> 23) - 127;                                \
+        v.i = (v.i & 0x007FFFFFu) | 0x3F800000u;                               \
+        if (v.f > 1.41421356f)                                                 \
+        {                                                                      \
+            v.f *= 0.5f;                                                       \
+            e++;                                                               \
+        }                                                                      \
+        return (float)e + fast_log2_poly_##_tier((v.f - 1.0f) / (v.f + 1.0f)); \
+    }
+
+FAST_LOG_DEFINE(mp)
+FAST_LOG_DEFINE(hp)
+
+// ln(x)、x^y、tanh
+#define FAST_LOG_POW_TANH_DEFINE(_tier)                                               \
+    static inline float fast_log_##_tier(float x)                                     \
+    {                                                                                 \
+        return fast_log2_##_tier(x) * FAST_LN2;                                       \
+    }                                                                                 \
+    static inline float fast_pow_##_tier(float x, float y)                            \
+    {                                                                                 \
+        if (x == 0)                                                                   \
+        {                                                                             \
+            return (y == 0) ? 1.0f : ((y > 0) ? 0.0f : HUGE_VALF);                    \
+        }                                                                             \
+        return fast_exp2_##_tier(y * fast_log2_##_tier(x));                           \
+    }                                                                                 \
+    static inline float fast_tanh_##_tier(float x)                                    \
+    {                                                                                 \
+        float ax = fabsf(x);                                                          \
+        if (ax > 9.0f)                                                                \
+        {                                                                             \
+            return (x > 0) ? 1.0f : -1.0f; /* 已饱和 */                                  \
+        }                                                                             \
+        float r = 1.0f - 2.0f / (fast_exp2_##_tier(ax * (2.0f * FAST_LOG2E)) + 1.0f); \
+        return (x < 0) ? -r : r;                                                      \
+    }
+
+FAST_LOG_POW_TANH_DEFINE(lp)
+FAST_LOG_POW_TANH_DEFINE(mp)
+FAST_LOG_POW_TANH_DEFINE(hp)
@@ -0,0 +1,328 @@
+/**
+ * @file matrix.h
+ * @author WittXie
+ * @brief 定长小矩阵/向量运算（2x2 ~ 9x9）：乘法、转置、对称二次型更新、Cholesky/LDLT 分解求解
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 每个维度由 MATRIX_DEFINE(n) 展开为 mat<n>_t / vec<n>_t 和一组 static inline 函数，维度是编译期常量，
+ * 循环由编译器完全展开（GCC 加 unroll 提示），不分配内存，全部在栈或静态区；
+ * 行主序 m[行][列]；除特别说明外输出不能与输入重叠；
+ * mat<n>_sandwich 计算对称结果 A·P·Aᵀ，只算上三角再镜像，保证结果严格对称；
+ * cholesky 要求对称正定，ldlt 只要求对称且主元非零，无开方，半正定/病态时更稳。
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__GNUC__) && !defined(__clang__)
+#define MATRIX_UNROLL _Pragma("GCC unroll 9")
+#else
+#define MATRIX_UNROLL
+#endif
+
+#define MATRIX_PIVOT_MIN 1e-20f // 分解时主元下限
+
+#define MATRIX_DEFINE(_n)                                                                                   \
+    typedef struct                                                                                          \
+    {                                                                                                       \
+        float m[_n][_n];                                                                                    \
+    } mat##_n##_t;                                                                                          \
+                                                                                                            \
+    typedef struct                                                                                          \
+    {                                                                                                       \
+        float v[_n];                                                                                        \
+    } vec##_n##_t;                                                                                          \
+                                                                                                            \
+    /* 零矩阵 */                                                                                               \
+    static inline void mat##_n##_zero(mat##_n##_t *r)                                                       \
+    {                                                                                                       \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                      \
+        {                                                                                                   \
+            MATRIX_UNROLL for (uint8_t j = 0; j < _n; j++)                                                  \
+            {                                                                                               \
+                r->m[i][j] = 0;                                                                             \
+            }                                                                                               \
+        }                                                                                                   \
+    }                                                                                                       \
+                                                                                                            \
+    /* 对角阵 r = diag(d)，d 为 NULL 时为单位阵 */                                                                    \
+    static inline void mat##_n##_diag(mat##_n##_t *r, const float *d)                                       \
+    {                                                                                                       \
+        mat##_n##_zero(r);                                                                                  \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                      \
+        {                                                                                                   \
+            r->m[i][i] = (d != NULL) ? d[i] : 1.0f;                                                         \
+        }                                                                                                   \
+    }                                                                                                       \
+                                                                                                            \
+    /* r = a + b，可重叠 */                                                                                     \
+    static inline void mat##_n##_add(mat##_n##_t *r, const mat##_n##_t *a, const mat##_n##_t *b)            \
+    {                                                                                                       \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                      \
+        {                                                                                                   \
+            MATRIX_UNROLL for (uint8_t j = 0; j < _n; j++)                                                  \
+            {                                                                                               \
+                r->m[i][j] = a->m[i][j] + b->m[i][j];                                                       \
+            }                                                                                               \
+        }                                                                                                   \
+    }                                                                                                       \
+                                                                                                            \
+    /* r = a - b，可重叠 */                                                                                     \
+    static inline void mat##_n##_sub(mat##_n##_t *r, const mat##_n##_t *a, const mat##_n##_t *b)            \
+    {                                                                                                       \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                      \
+        {                                                                                                   \
+            MATRIX_UNROLL for (uint8_t j = 0; j < _n; j++)                                                  \
+            {                                                                                               \
+                r->m[i][j] = a->m[i][j] - b->m[i][j];                                                       \
+            }                                                                                               \
+        }                                                                                                   \
+    }                                                                                                       \
+                                                                                                            \
+    /* r = a * k，可重叠 */                                                                                     \
+    static inline void mat##_n##_scale(mat##_n##_t *r, const mat##_n##_t *a, float k)                       \
+    {                                                                                                       \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                      \
+        {                                                                                                   \
+            MATRIX_UNROLL for (uint8_t j = 0; j < _n; j++)                                                  \
+            {                                                                                               \
+                r->m[i][j] = a->m[i][j] * k;                                                                \
+            }                                                                                               \
+        }                                                                                                   \
+    }                                                                                                       \
+                                                                                                            \
+    /* r = aᵀ */                                                                                            \
+    static inline void mat##_n##_transpose(mat##_n##_t *r, const mat##_n##_t *a)                            \
+    {                                                                                                       \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                      \
+        {                                                                                                   \
+            MATRIX_UNROLL for (uint8_t j = 0; j < _n; j++)                                                  \
+            {                                                                                               \
+                r->m[j][i] = a->m[i][j];                                                                    \
+            }                                                                                               \
+        }                                                                                                   \
+    }                                                                                                       \
+                                                                                                            \
+    /* r = a * b */                                                                                         \
+    static inline void mat##_n##_mul(mat##_n##_t *r, const mat##_n##_t *a, const mat##_n##_t *b)            \
+    {                                                                                                       \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                      \
+        {                                                                                                   \
+            MATRIX_UNROLL for (uint8_t j = 0; j < _n; j++)                                                  \
+            {                                                                                               \
+                float sum = 0;                                                                              \
+                MATRIX_UNROLL for (uint8_t k = 0; k < _n; k++)                                              \
+                {                                                                                           \
+                    sum += a->m[i][k] * b->m[k][j];                                                         \
+                }                                                                                           \
+                r->m[i][j] = sum;                                                                           \
+            }                                                                                               \
+        }                                                                                                   \
+    }                                                                                                       \
+                                                                                                            \
+    /* r = a * bᵀ */                                                                                        \
+    static inline void mat##_n##_mul_abt(mat##_n##_t *r, const mat##_n##_t *a, const mat##_n##_t *b)        \
+    {                                                                                                       \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                      \
+        {                                                                                                   \
+            MATRIX_UNROLL for (uint8_t j = 0; j < _n; j++)                                                  \
+            {                                                                                               \
+                float sum = 0;                                                                              \
+                MATRIX_UNROLL for (uint8_t k = 0; k < _n; k++)                                              \
+                {                                                                                           \
+                    sum += a->m[i][k] * b->m[j][k];                                                         \
+                }                                                                                           \
+                r->m[i][j] = sum;                                                                           \
+            }                                                                                               \
+        }                                                                                                   \
+    }                                                                                                       \
+                                                                                                            \
+    /* r = a * x */                                                                                         \
+    static inline void mat##_n##_mul_vec(vec##_n##_t *r, const mat##_n##_t *a, const vec##_n##_t *x)        \
+    {                                                                                                       \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                      \
+        {                                                                                                   \
+            float sum = 0;                                                                                  \
+            MATRIX_UNROLL for (uint8_t k = 0; k < _n; k++)                                                  \
+            {                                                                                               \
+                sum += a->m[i][k] * x->v[k];                                                                \
+            }                                                                                               \
+            r->v[i] = sum;                                                                                  \
+        }                                                                                                   \
+    }                                                                                                       \
+                                                                                                            \
+    /* r = a * p * aᵀ，p 对称；只算上三角再镜像 */                                                                      \
+    static inline void mat##_n##_sandwich(mat##_n##_t *r, const mat##_n##_t *a, const mat##_n##_t *p)       \
+    {                                                                                                       \
+        mat##_n##_t ap;                                                                                     \
+        mat##_n##_mul(&ap, a, p);                                                                           \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                      \
+        {                                                                                                   \
+            MATRIX_UNROLL for (uint8_t j = i; j < _n; j++)                                                  \
+            {                                                                                               \
+                float sum = 0;                                                                              \
+                MATRIX_UNROLL for (uint8_t k = 0; k < _n; k++)                                              \
+                {                                                                                           \
+                    sum += ap.m[i][k] * a->m[j][k];                                                         \
+                }                                                                                           \
+                r->m[i][j] = sum;                                                                           \
+                r->m[j][i] = sum;                                                                           \
+            }                                                                                               \
+        }                                                                                                   \
+    }                                                                                                       \
+                                                                                                            \
+    /* 对称化 r = (r + rᵀ) / 2，原地 */                                                                           \
+    static inline void mat##_n##_symmetrize(mat##_n##_t *r)                                                 \
+    {                                                                                                       \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                      \
+        {                                                                                                   \
+            MATRIX_UNROLL for (uint8_t j = i + 1; j < _n; j++)                                              \
+            {                                                                                               \
+                float mean = 0.5f * (r->m[i][j] + r->m[j][i]);                                              \
+                r->m[i][j] = mean;                                                                          \
+                r->m[j][i] = mean;                                                                          \
+            }                                                                                               \
+        }                                                                                                   \
+    }                                                                                                       \
+                                                                                                            \
+    /* 点积 */                                                                                                \
+    static inline float vec##_n##_dot(const vec##_n##_t *a, const vec##_n##_t *b)                           \
+    {                                                                                                       \
+        float sum = 0;                                                                                      \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                      \
+        {                                                                                                   \
+            sum += a->v[i] * b->v[i];                                                                       \
+        }                                                                                                   \
+        return sum;                                                                                         \
+    }                                                                                                       \
+                                                                                                            \
+    /* Cholesky 分解 a = l * lᵀ，l 为下三角（上三角清零），可与 a 重叠；非正定返回 false */                                          \
+    static inline bool mat##_n##_cholesky(mat##_n##_t *l, const mat##_n##_t *a)                             \
+    {                                                                                                       \
+        MATRIX_UNROLL for (uint8_t j = 0; j < _n; j++)                                                      \
+        {                                                                                                   \
+            float d = a->m[j][j];                                                                           \
+            for (uint8_t k = 0; k < j; k++)                                                                 \
+            {                                                                                               \
+                d -= l->m[j][k] * l->m[j][k];                                                               \
+            }                                                                                               \
+            if (!(d > MATRIX_PIVOT_MIN))                                                                    \
+            {                                                                                               \
+                return false;                                                                               \
+            }                                                                                               \
+            d = sqrtf(d);                                                                                   \
+            float inv = 1.0f / d;                                                                           \
+            for (uint8_t i = j + 1; i < _n; i++)                                                            \
+            {                                                                                               \
+                float sum = a->m[i][j];                                                                     \
+                for (uint8_t k = 0; k < j; k++)                                                             \
+                {                                                                                           \
+                    sum -= l->m[i][k] * l->m[j][k];                                                         \
+                }                                                                                           \
+                l->m[i][j] = sum * inv;                                                                     \
+            }                                                                                               \
+            l->m[j][j] = d;                                                                                 \
+            for (uint8_t i = 0; i < j; i++)                                                                 \
+            {                                                                                               \
+                l->m[i][j] = 0;                                                                             \
+            }                                                                                               \
+        }                                                                                                   \
+        return true;                                                                                        \
+    }                                                                                                       \
+                                                                                                            \
+    /* 解 l * lᵀ * x = b，x 可与 b 重叠 */                                                                        \
+    static inline void mat##_n##_cholesky_solve(vec##_n##_t *x, const mat##_n##_t *l, const vec##_n##_t *b) \
+    {                                                                                                       \
+        vec##_n##_t y;                                                                                      \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                      \
+        {                                                                                                   \
+            float sum = b->v[i];                                                                            \
+            for (uint8_t k = 0; k < i; k++)                                                                 \
+            {                                                                                               \
+                sum -= l->m[i][k] * y.v[k];                                                                 \
+            }                                                                                               \
+            y.v[i] = sum / l->m[i][i];                                                                      \
+        }                                                                                                   \
+        MATRIX_UNROLL for (int8_t i = _n - 1; i >= 0; i--)                                                  \
+        {                                                                                                   \
+            float sum = y.v[i];                                                                             \
+            for (uint8_t k = i + 1; k < _n; k++)                                                            \
+            {                                                                                               \
+                sum -= l->m[k][i] * x->v[k];                                                                \
+            }                                                                                               \
+            x->v[i] = sum / l->m[i][i];                                                                     \
+        }                                                                                                   \
+    }                                                                                                       \
+                                                                                                            \
+    /* LDLT 分解 a = l * d * lᵀ，结果对角线存 d、下三角存单位下三角 l 的非对角元，可与 a 重叠 */                                         \
+    static inline bool mat##_n##_ldlt(mat##_n##_t *ld, const mat##_n##_t *a)                                \
+    {                                                                                                       \
+        MATRIX_UNROLL for (uint8_t j = 0; j < _n; j++)                                                      \
+        {                                                                                                   \
+            float d = a->m[j][j];                                                                           \
+            for (uint8_t k = 0; k < j; k++)                                                                 \
+            {                                                                                               \
+                d -= ld->m[j][k] * ld->m[j][k] * ld->m[k][k];                                               \
+            }                                                                                               \
+            if (!(fabsf(d) > MATRIX_PIVOT_MIN))                                                             \
+            {                                                                                               \
+                return false;                                                                               \
+            }                                                                                               \
+            float inv = 1.0f / d;                                                                           \
+            for (uint8_t i = j + 1; i < _n; i++)                                                            \
+            {                                                                                               \
+                float sum = a->m[i][j];                                                                     \
+                for (uint8_t k = 0; k < j; k++)                                                             \
+                {                                                                                           \
+                    sum -= ld->m[i][k] * ld->m[j][k] * ld->m[k][k];                                         \
+                }                                                                                           \
+                ld->m[i][j] = sum * inv;                                                                    \
+            }                                                                                               \
+            ld->m[j][j] = d;                                                                                \
+            for (uint8_t i = 0; i < j; i++)                                                                 \
+            {                                                                                               \
+                ld->m[i][j] = 0;                                                                            \
+            }                                                                                               \
+        }                                                                                                   \
+        return true;                                                                                        \
+    }                                                                                                       \
+                                                                                                            \
+    /* 解 l * d * lᵀ * x = b，x 可与 b 重叠 */                                                                    \
+    static inline void mat##_n##_ldlt_solve(vec##_n##_t *x, const mat##_n##_t *ld, const vec##_n##_t *b)    \
+    {                                                                                                       \
+        vec##_n##_t y;                                                                                      \
+        MATRIX_UNROLL for (uint8_t i = 0; i < _n; i++)                                                      \
+        {                                                                                                   \
+            float sum = b->v[i];                                                                            \
+            for (uint8_t k = 0; k < i; k++)                                                                 \
+            {                                                                                               \
+                sum -= ld->m[i][k] * y.v[k];                                                                \
+            }                                                                                               \
+            y.v[i] = sum;                                                                                   \
+        }                                                                                                   \
+        MATRIX_UNROLL for (int8_t i = _n - 1; i >= 0; i--)                                                  \
+        {                                                                                                   \
+            float sum = y.v[i] / ld->m[i][i];                                                               \
+            for (uint8_t k = i + 1; k < _n; k++)                                                            \
+            {                                                                                               \
+                sum -= ld->m[k][i] * x->v[k];                                                               \
+            }                                                                                               \
+            x->v[i] = sum;                                                                                  \
+        }                                                                                                   \
+    }
+
+MATRIX_DEFINE(2)
+MATRIX_DEFINE(3)
+MATRIX_DEFINE(4)
+MATRIX_DEFINE(5)
+MATRIX_DEFINE(6)
+MATRIX_DEFINE(7)
+MATRIX_DEFINE(8)
+MATRIX_DEFINE(9)
+
@@ -257,6 +257,13 @@ void player_volume_set(player_t *player, float volume)
     player->volume = volume;
 }
 
+// 按分贝调节音量
+void player_volume_db_set(player_t *player, float db)
+{
+    // 0 dB 为满幅，<= LUT_DB_GAIN_MIN 视为静音
+    player_volume_set(player, (db <= LUT_DB_GAIN_MIN) ? 0.0f : ((db >= 0.0f) ? 1.0f : lut_db_to_gain(db)));
+}
+
 // 突发播放
 void player_play_burst(player_t *player, voice_t *voice, float begin_percent, float end_percent)
 {
@@ -16,6 +16,7 @@
 // 依赖
 #include "./../dds/dds.h"   // 订阅机制
 #include "./../list/list.h" // 链表
+#include "./../lut/lut.h"   // 分贝换算
 
 // 通用接口
 #ifndef ASSERT
@@ -165,6 +166,14 @@ void player_clear(player_t *player);
  */
 void player_volume_set(player_t *player, float volume);
 
+/**
+ * @brief 按分贝设置音量，听感上均匀的音量档位用这个
+ *
+ * @param player 设备指针
+ * @param db 分贝，0 为满幅，<= LUT_DB_GAIN_MIN 静音
+ */
+void player_volume_db_set(player_t *player, float db);
+
 /**
  * @brief 突发播放
  *
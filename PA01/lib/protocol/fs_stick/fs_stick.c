@@ -6,6 +6,7 @@ void fs_stick_init(fs_stick_t *fs_stick)
     ASSERT(fs_stick->cfg.name != NULL);
     ASSERT(fs_stick->cfg.threshold != 0);
     ASSERT(fs_stick->cfg.try_cnt != 0);
+    ASSERT(fs_stick->cfg.median_window <= FS_STICK_MEDIAN_WINDOW_MAX);
     ASSERT(fs_stick->ops.init != NULL);
     ASSERT(fs_stick->ops.write != NULL);
 
@@ -13,6 +14,14 @@ void fs_stick_init(fs_stick_t *fs_stick)
     fs_stick->ops.init();
     fs_stick->init_try_cnt = 0;
     fs_stick->flag.value = 0;
+
+    if (fs_stick->cfg.median_window > 1)
+    {
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            median_sorted_f32_init(&fs_stick->median[i], fs_stick->cfg.median_window, fs_stick->median_buff[i]);
+        }
+    }
 }
 
 // 论询
@@ -44,10 +53,10 @@ void fs_stick_poll(fs_stick_t *fs_stick)
 
     // 检查摇杆是否在阈值内
     bool all_sticks_below_threshold =
-        (fabs(fs_stick->stick[0].x) < fs_stick->cfg.threshold) &&
-        (fabs(fs_stick->stick[0].y) < fs_stick->cfg.threshold) &&
-        (fabs(fs_stick->stick[1].x) < fs_stick->cfg.threshold) &&
-        (fabs(fs_stick->stick[1].y) < fs_stick->cfg.threshold);
+        (fabsf(fs_stick->stick[0].x) < fs_stick->cfg.threshold) &&
+        (fabsf(fs_stick->stick[0].y) < fs_stick->cfg.threshold) &&
+        (fabsf(fs_stick->stick[1].x) < fs_stick->cfg.threshold) &&
+        (fabsf(fs_stick->stick[1].y) < fs_stick->cfg.threshold);
 
     if (all_sticks_below_threshold)
     {
@@ -68,17 +77,17 @@ void fs_stick_poll(fs_stick_t *fs_stick)
 
         for (int i = 0; i < 2; i++)
         {
-            if ((fabs(fs_stick->stick[i].x) > fs_stick->cfg.threshold && fabs(fs_stick->last_stick[i].x) < fs_stick->cfg.threshold) ||
-                (fabs(fs_stick->stick[i].y) > fs_stick->cfg.threshold && fabs(fs_stick->last_stick[i].y) < fs_stick->cfg.threshold))
+            if ((fabsf(fs_stick->stick[i].x) > fs_stick->cfg.threshold && fabsf(fs_stick->last_stick[i].x) < fs_stick->cfg.threshold) ||
+                (fabsf(fs_stick->stick[i].y) > fs_stick->cfg.threshold && fabsf(fs_stick->last_stick[i].y) < fs_stick->cfg.threshold))
             {
                 changed_to_press = true;
             }
-            if ((fabs(fs_stick->stick[i].x) < fs_stick->cfg.threshold && fabs(fs_stick->last_stick[i].x) > fs_stick->cfg.threshold) ||
-                (fabs(fs_stick->stick[i].y) < fs_stick->cfg.threshold && fabs(fs_stick->last_stick[i].y) > fs_stick->cfg.threshold))
+            if ((fabsf(fs_stick->stick[i].x) < fs_stick->cfg.threshold && fabsf(fs_stick->last_stick[i].x) > fs_stick->cfg.threshold) ||
+                (fabsf(fs_stick->stick[i].y) < fs_stick->cfg.threshold && fabsf(fs_stick->last_stick[i].y) > fs_stick->cfg.threshold))
             {
                 changed_to_release = true;
             }
-            if (fabs(fs_stick->stick[i].x) > fs_stick->cfg.threshold || fabs(fs_stick->last_stick[i].y) > fs_stick->cfg.threshold)
+            if (fabsf(fs_stick->stick[i].x) > fs_stick->cfg.threshold || fabsf(fs_stick->last_stick[i].y) > fs_stick->cfg.threshold)
             {
                 changed = true;
             }
@@ -117,6 +126,15 @@ void fs_stick_read_hook(fs_stick_t *fs_stick, uint32_t cmd, uint8_t *data, uint3
             FS_PROTOCOL_STICK_HALL_EXCHANGE(&fs_stick->data.hall, &fs_stick->data.param,
                                             &fs_stick->stick[0].x, &fs_stick->stick[0].y,
                                             &fs_stick->stick[1].x, &fs_stick->stick[1].y);
+
+            // 中值滤波，单点尖峰不触发按下/释放
+            if (fs_stick->cfg.median_window > 1)
+            {
+                fs_stick->stick[0].x = median_sorted_f32(&fs_stick->median[0], fs_stick->stick[0].x);
+                fs_stick->stick[0].y = median_sorted_f32(&fs_stick->median[1], fs_stick->stick[0].y);
+                fs_stick->stick[1].x = median_sorted_f32(&fs_stick->median[2], fs_stick->stick[1].x);
+                fs_stick->stick[1].y = median_sorted_f32(&fs_stick->median[3], fs_stick->stick[1].y);
+            }
         }
         else
         {
@@ -15,8 +15,9 @@
 #include <string.h>
 
 // 依赖
-#include "./../../dds/dds.h"     // 订阅机制
-#include "./fs_stick_protocol.h" // 协议
+#include "./../../dds/dds.h"              // 订阅机制
+#include "./../../filter/median_filter.h" // 中值滤波
+#include "./fs_stick_protocol.h"          // 协议
 
 #ifndef ASSERT
 #define ASSERT(_bool, ...) ((void)0)
@@ -39,6 +40,8 @@
 #define SLEEP_MS(_ms)
 #endif
 
+#define FS_STICK_MEDIAN_WINDOW_MAX 7 // 霍尔值中值窗口上限
+
 typedef struct __fs_stick_data
 {
     // 协议数据
@@ -52,9 +55,10 @@ typedef struct __fs_stick
     // 参数
     struct
     {
-        const char *name; // 名称
-        float threshold;  // 最小变动阈值 0~1
-        uint32_t try_cnt; // 初始化尝试次数
+        const char *name;      // 名称
+        float threshold;       // 最小变动阈值 0~1
+        uint32_t try_cnt;      // 初始化尝试次数
+        uint8_t median_window; // 霍尔值中值窗口，滤除单点尖峰，0/1 不滤波
     } cfg;
 
     // 函数接口
@@ -80,6 +84,9 @@ typedef struct __fs_stick
         float y;     // 摇杆y轴
     } last_stick[2]; // 摇杆影子值
 
+    median_sorted_f32_t median[4];                        // 中值滤波 x0 y0 x1 y1
+    float median_buff[4][2 * FS_STICK_MEDIAN_WINDOW_MAX]; // 中值滤波缓存
+
     // 标志
     union
     {
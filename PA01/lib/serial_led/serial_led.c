@@ -140,25 +140,29 @@ void serial_led_color_set(sled_t *led, uint32_t index, sled_color_t color)
         break;
     }
 
-    // 填装数据
+    // gamma 校正
+    if (led->cfg.is_gamma)
+    {
+        rgb[0] = lut_gamma8(rgb[0]), rgb[1] = lut_gamma8(rgb[1]), rgb[2] = lut_gamma8(rgb[2]);
+    }
+
+    // 填装数据：24位从高到低，每位对应一个脉宽
+    uint32_t bits = ((uint32_t)rgb[0] << 16) | ((uint32_t)rgb[1] << 8) | rgb[2];
+    uint32_t offset = led->pulse_reset_length + index * 24;
     if (led->cfg.timer_bits == 16)
     {
-        uint16_t *pulse = (uint16_t *)(led->pulse);
-        for (uint8_t i = 0; i < 8; i++)
+        uint16_t *pulse = (uint16_t *)(led->pulse) + offset;
+        for (uint8_t i = 0; i < 24; i++, bits <<= 1)
         {
-            pulse[led->pulse_reset_length + index * 24 + i] = (rgb[0] & (0x80 >> i)) ? led->pulse_t0l : led->pulse_t0h;
-            pulse[led->pulse_reset_length + index * 24 + i + 8] = (rgb[1] & (0x80 >> i)) ? led->pulse_t0l : led->pulse_t0h;
-            pulse[led->pulse_reset_length + index * 24 + i + 16] = (rgb[2] & (0x80 >> i)) ? led->pulse_t0l : led->pulse_t0h;
+            pulse[i] = (bits & 0x800000) ? led->pulse_t0l : led->pulse_t0h;
         }
     }
     else if (led->cfg.timer_bits == 32)
     {
-        uint32_t *pulse = (uint32_t *)(led->pulse);
-        for (uint8_t i = 0; i < 8; i++)
+        uint32_t *pulse = (uint32_t *)(led->pulse) + offset;
+        for (uint8_t i = 0; i < 24; i++, bits <<= 1)
         {
-            pulse[led->pulse_reset_length + index * 24 + i] = (rgb[0] & (0x80 >> i)) ? led->pulse_t0l : led->pulse_t0h;
-            pulse[led->pulse_reset_length + index * 24 + i + 8] = (rgb[1] & (0x80 >> i)) ? led->pulse_t0l : led->pulse_t0h;
-            pulse[led->pulse_reset_length + index * 24 + i + 16] = (rgb[2] & (0x80 >> i)) ? led->pulse_t0l : led->pulse_t0h;
+            pulse[i] = (bits & 0x800000) ? led->pulse_t0l : led->pulse_t0h;
         }
     }
     else
@@ -13,6 +13,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "./../lut/lut.h" // gamma 表
+
 #ifndef MALLOC
 #define MALLOC(_size) malloc(_size)
 #define FREE(_pv) free(_pv)
@@ -63,6 +65,7 @@ typedef struct __serial_led
         uint32_t time_t0h;         // T0H时间，单位ns
         uint32_t time_t0l;         // T0L时间，单位ns
         serial_led_order_et order; // 颜色顺序
+        bool is_gamma;             // 是否做 gamma 校正（亮度观感线性）
     } cfg;
 
     // 函数接口
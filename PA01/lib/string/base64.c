@@ -0,0 +1,130 @@
+#include "./base64.h"
+
+static const char base64_alphabet[64] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// 字符 -> 6 位值，非法为 0xFF
+static const uint8_t base64_table[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+// Base64 编码
+uint32_t base64_encode(char *text, const void *data, uint32_t length)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    char *out = text;
+    uint32_t i = 0;
+
+    for (; i + 3 <= length; i += 3)
+    {
+        uint32_t n = ((uint32_t)p[i] << 16) | ((uint32_t)p[i + 1] << 8) | p[i + 2];
+        uint32_t word = (uint32_t)base64_alphabet[n >> 18] |
+                        ((uint32_t)base64_alphabet[(n >> 12) & 0x3F] << 8) |
+                        ((uint32_t)base64_alphabet[(n >> 6) & 0x3F] << 16) |
+                        ((uint32_t)base64_alphabet[n & 0x3F] << 24);
+        memcpy(out, &word, sizeof(word)); // 小端：低字节在前
+        out += 4;
+    }
+
+    if (i < length)
+    {
+        uint32_t n = (uint32_t)p[i] << 16;
+        if (i + 1 < length)
+        {
+            n |= (uint32_t)p[i + 1] << 8;
+        }
+        out[0] = base64_alphabet[n >> 18];
+        out[1] = base64_alphabet[(n >> 12) & 0x3F];
+        out[2] = (i + 1 < length) ? base64_alphabet[(n >> 6) & 0x3F] : '=';
+        out[3] = '=';
+        out += 4;
+    }
+    *out = '\0';
+    return (uint32_t)(out - text);
+}
+
+// Base64 严格解码
+bool base64_decode(void *data, uint32_t size, const char *text, uint32_t length, uint32_t *data_length)
+{
+    const uint8_t *t = (const uint8_t *)text;
+    uint8_t *out = (uint8_t *)data;
+
+    if (length & 3)
+    {
+        return false;
+    }
+
+    // 末组的填充
+    uint32_t pad = 0;
+    if (length > 0)
+    {
+        pad = (t[length - 1] == '=') + ((t[length - 1] == '=') && (t[length - 2] == '='));
+    }
+    uint32_t total = length / 4 * 3 - pad;
+    if (total > size)
+    {
+        return false;
+    }
+
+    // 完整组：4 个查表结果或运算后只判断一次
+    uint32_t full = (pad > 0) ? length - 4 : length;
+    uint32_t i = 0;
+    for (; i < full; i += 4)
+    {
+        uint32_t a = base64_table[t[i]];
+        uint32_t b = base64_table[t[i + 1]];
+        uint32_t c = base64_table[t[i + 2]];
+        uint32_t d = base64_table[t[i + 3]];
+        if ((a | b | c | d) & 0xC0)
+        {
+            return false;
+        }
+        uint32_t n = (a << 18) | (b << 12) | (c << 6) | d;
+        out[0] = (uint8_t)(n >> 16);
+        out[1] = (uint8_t)(n >> 8);
+        out[2] = (uint8_t)n;
+        out += 3;
+    }
+
+    // 带填充的末组："xx==" 或 "xxx="
+    if (pad > 0)
+    {
+        uint32_t a = base64_table[t[i]];
+        uint32_t b = base64_table[t[i + 1]];
+        uint32_t c = (pad == 1) ? base64_table[t[i + 2]] : 0;
+        if ((a | b | c) & 0xC0)
+        {
+            return false;
+        }
+        uint32_t n = (a << 18) | (b << 12) | (c << 6);
+        if (n & ((pad == 1) ? 0xFFu : 0xFFFFu))
+        {
+            return false; // 无效位非 0
+        }
+        out[0] = (uint8_t)(n >> 16);
+        if (pad == 1)
+        {
+            out[1] = (uint8_t)(n >> 8);
+        }
+    }
+
+    if (data_length != NULL)
+    {
+        *data_length = total;
+    }
+    return true;
+}
@@ -0,0 +1,44 @@
+/**
+ * @file base64.h
+ * @author WittXie
+ * @brief Base64 编解码（RFC 4648 标准字母表，带 '=' 填充）
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 编码每 3 字节拼成 24 位后查表输出 4 字符，一次写入一个字；
+ * 解码严格校验：长度为 4 的倍数，只允许字母表字符，'=' 只能出现在末尾且最多 2 个，
+ * 填充前的无效位必须为 0（拒绝非规范编码），不接受空白；不申请内存。
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define BASE64_ENCODE_SIZE(_length) (((_length) + 2) / 3 * 4 + 1) // 编码输出缓存大小（含结束符）
+#define BASE64_DECODE_SIZE(_length) ((_length) / 4 * 3)           // 解码输出缓存大小上限
+
+/**
+ * @brief Base64 编码
+ *
+ * @param text 输出，至少 BASE64_ENCODE_SIZE(length)，以 '\0' 结尾
+ * @param data 数据
+ * @param length 数据长度
+ * @return uint32_t 字符串长度
+ */
+uint32_t base64_encode(char *text, const void *data, uint32_t length);
+
+/**
+ * @brief Base64 严格解码
+ *
+ * @param data 输出
+ * @param size 输出缓存大小
+ * @param text Base64 字符串
+ * @param length 字符串长度
+ * @param data_length 返回解码长度，可为 NULL
+ * @return bool 是否成功：格式非法或 size 不足时返回 false
+ */
+bool base64_decode(void *data, uint32_t size, const char *text, uint32_t length, uint32_t *data_length);
@@ -0,0 +1,875 @@
+#include "./fmt.h"
+#include <stdio.h>
+#include <string.h>
+
+// 两位十进制表 "00"~"99"
+static const char fmt_digits[200] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const char fmt_hex_lower[16] = "0123456789abcdef";
+static const char fmt_hex_upper[16] = "0123456789ABCDEF";
+
+// 5^p，p <= 12 时 < 2^32
+static const uint32_t fmt_pow5[FMT_FLOAT_PRECISION_MAX + 1] = {
+    1u, 5u, 25u, 125u, 625u, 3125u, 15625u, 78125u, 390625u,
+    1953125u, 9765625u, 48828125u, 244140625u};
+
+// 10^p
+static const uint64_t fmt_pow10[FMT_FLOAT_PRECISION_MAX + 1] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+    1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull};
+
+// 格式标志
+#define FMT_FLAG_LEFT 0x01  // '-' 左对齐
+#define FMT_FLAG_PLUS 0x02  // '+' 正数显示+
+#define FMT_FLAG_SPACE 0x04 // ' ' 正数显示空格
+#define FMT_FLAG_ZERO 0x08  // '0' 补0
+#define FMT_FLAG_ALT 0x10   // '#' 备用格式
+
+#define FMT_SPEC_LENGTH_MAX 32 // 重建格式说明最大长度：% + 5标志 + 宽度10 + .精度10 + 长度2 + 转换
+
+// 格式说明
+typedef struct
+{
+    uint8_t flags;     // 标志
+    int32_t width;     // 宽度
+    int32_t precision; // 精度，-1 表示未指定
+} fmt_spec_t;
+
+/**
+ * 从 end 向前写十进制，返回首字符地址
+ * 每轮一次除以常量100（乘法+移位）和一次两字节拷贝
+ */
+static inline char *fmt_dec32_write(char *end, uint32_t value)
+{
+    while (value >= 100)
+    {
+        uint32_t q = value / 100;
+        uint32_t r = value - q * 100;
+        end -= 2;
+        memcpy(end, &fmt_digits[r * 2], 2);
+        value = q;
+    }
+    if (value >= 10)
+    {
+        end -= 2;
+        memcpy(end, &fmt_digits[value * 2], 2);
+    }
+    else
+    {
+        *--end = (char)('0' + value);
+    }
+    return end;
+}
+
+// 从 end 向前写固定8位十进制（value < 10^8）
+static inline char *fmt_dec8_write(char *end, uint32_t value)
+{
+    uint32_t hi = value / 10000;
+    uint32_t lo = value - hi * 10000;
+    uint32_t a = hi / 100, b = hi - a * 100;
+    uint32_t c = lo / 100, d = lo - c * 100;
+    end -= 8;
+    memcpy(end + 0, &fmt_digits[a * 2], 2);
+    memcpy(end + 2, &fmt_digits[b * 2], 2);
+    memcpy(end + 4, &fmt_digits[c * 2], 2);
+    memcpy(end + 6, &fmt_digits[d * 2], 2);
+    return end;
+}
+
+// 从 end 向前写64位十进制：超过32位的部分按 10^8 分段
+static inline char *fmt_dec64_write(char *end, uint64_t value)
+{
+    while (value >> 32)
+    {
+        uint64_t q = value / 100000000u;
+        end = fmt_dec8_write(end, (uint32_t)(value - q * 100000000u));
+        value = q;
+    }
+    return fmt_dec32_write(end, (uint32_t)value);
+}
+
+// 从 end 向前写十六进制，至少 width 位
+static inline char *fmt_hex64_write(char *end, uint64_t value, uint8_t width, bool is_upper)
+{
+    const char *table = is_upper ? fmt_hex_upper : fmt_hex_lower;
+    char *start = end - width;
+    uint32_t lo = (uint32_t)value, hi = (uint32_t)(value >> 32);
+    if (hi)
+    {
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            *--end = table[lo & 0x0F];
+            lo >>= 4;
+        }
+        lo = hi;
+    }
+    do
+    {
+        *--end = table[lo & 0x0F];
+        lo >>= 4;
+    } while (lo);
+    while (end > start)
+    {
+        *--end = '0';
+    }
+    return end;
+}
+
+// 从 tmp 尾部拷贝到 buff 并加结束符
+static inline uint8_t fmt_tail_copy(char *buff, const char *start, const char *end)
+{
+    uint8_t length = (uint8_t)(end - start);
+    memcpy(buff, start, length);
+    buff[length] = '\0';
+    return length;
+}
+
+// 无符号整数转十进制
+uint8_t fmt_u32_to_dec(char *buff, uint32_t value)
+{
+    char tmp[12];
+    char *end = tmp + sizeof(tmp);
+    return fmt_tail_copy(buff, fmt_dec32_write(end, value), end);
+}
+
+uint8_t fmt_u64_to_dec(char *buff, uint64_t value)
+{
+    char tmp[FMT_U64_DIGITS_MAX];
+    char *end = tmp + sizeof(tmp);
+    return fmt_tail_copy(buff, fmt_dec64_write(end, value), end);
+}
+
+// 有符号整数转十进制
+uint8_t fmt_i32_to_dec(char *buff, int32_t value)
+{
+    if (value < 0)
+    {
+        *buff = '-';
+        return fmt_u32_to_dec(buff + 1, 0u - (uint32_t)value) + 1;
+    }
+    return fmt_u32_to_dec(buff, (uint32_t)value);
+}
+
+uint8_t fmt_i64_to_dec(char *buff, int64_t value)
+{
+    if (value < 0)
+    {
+        *buff = '-';
+        return fmt_u64_to_dec(buff + 1, 0u - (uint64_t)value) + 1;
+    }
+    return fmt_u64_to_dec(buff, (uint64_t)value);
+}
+
+// 无符号整数转十六进制
+uint8_t fmt_u32_to_hex(char *buff, uint32_t value, uint8_t width, bool is_upper)
+{
+    char tmp[8];
+    char *end = tmp + sizeof(tmp);
+    width = (width > 8) ? 8 : width;
+    return fmt_tail_copy(buff, fmt_hex64_write(end, value, width, is_upper), end);
+}
+
+uint8_t fmt_u64_to_hex(char *buff, uint64_t value, uint8_t width, bool is_upper)
+{
+    char tmp[16];
+    char *end = tmp + sizeof(tmp);
+    width = (width > 16) ? 16 : width;
+    return fmt_tail_copy(buff, fmt_hex64_write(end, value, width, is_upper), end);
+}
+
+/**
+ * 浮点定点化：|value| × 10^p 四舍五入（向偶）到整数
+ * value = m × 2^e，m < 2^24；m × 5^p < 2^52，再乘 2^(e+p) 即 value × 10^p
+ * 返回 false 表示结果超出 u64
+ */
+static bool fmt_f32_scale(float value, uint8_t precision, uint64_t *result)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint32_t exponent = (bits >> 23) & 0xFF;
+    uint32_t mantissa = bits & 0x7FFFFF;
+    int32_t e;
+    if (exponent == 0)
+    {
+        e = -149; // 非规格化数
+    }
+    else
+    {
+        mantissa |= 0x800000;
+        e = (int32_t)exponent - 150;
+    }
+
+    uint64_t n = (uint64_t)mantissa * fmt_pow5[precision];
+    int32_t shift = e + precision;
+    if (n == 0)
+    {
+        *result = 0;
+    }
+    else if (shift >= 0)
+    {
+        if (shift > __builtin_clzll(n))
+        {
+            return false;
+        }
+        *result = n << shift;
+    }
+    else if (shift <= -64)
+    {
+        *result = 0; // n < 2^52 <= 半个单位
+    }
+    else
+    {
+        uint32_t s = (uint32_t)(-shift);
+        uint64_t q = n >> s;
+        uint64_t rem = n & ((1ull << s) - 1);
+        uint64_t half = 1ull << (s - 1);
+        q += (rem > half) || ((rem == half) && (q & 1));
+        *result = q;
+    }
+    return true;
+}
+
+// 浮点转定点小数文本，写到 end 之前；不含符号
+static char *fmt_fixed_write(char *end, uint64_t scaled, uint8_t precision, bool is_alt)
+{
+    uint64_t integer = scaled;
+    if (precision > 0)
+    {
+        uint64_t frac;
+        if (((scaled >> 32) == 0) && (precision <= 9))
+        {
+            uint32_t d = (uint32_t)fmt_pow10[precision];
+            uint32_t q = (uint32_t)scaled / d;
+            integer = q;
+            frac = (uint32_t)scaled - q * d;
+        }
+        else
+        {
+            integer = scaled / fmt_pow10[precision];
+            frac = scaled - integer * fmt_pow10[precision];
+        }
+        char *start = end - precision;
+        end = fmt_dec64_write(end, frac);
+        while (end > start)
+        {
+            *--end = '0';
+        }
+        *--end = '.';
+    }
+    else if (is_alt)
+    {
+        *--end = '.';
+    }
+    return fmt_dec64_write(end, integer);
+}
+
+// 非有限值
+static char *fmt_special_write(char *end, uint32_t bits, bool is_upper)
+{
+    const char *text = ((bits & 0x7FFFFF) != 0) ? (is_upper ? "NAN" : "nan") : (is_upper ? "INF" : "inf");
+    end -= 3;
+    memcpy(end, text, 3);
+    return end;
+}
+
+// 浮点转定点小数文本
+uint8_t fmt_f32_to_str(char *buff, float value, uint8_t precision)
+{
+    char tmp[FMT_F32_LENGTH_MAX];
+    char *end = tmp + sizeof(tmp);
+    char *start;
+    uint32_t bits;
+    uint64_t scaled;
+    memcpy(&bits, &value, sizeof(bits));
+
+    precision = (precision > FMT_FLOAT_PRECISION_MAX) ? FMT_FLOAT_PRECISION_MAX : precision;
+    if (((bits >> 23) & 0xFF) == 0xFF)
+    {
+        start = fmt_special_write(end, bits, false);
+    }
+    else if (fmt_f32_scale(value, precision, &scaled))
+    {
+        start = fmt_fixed_write(end, scaled, precision, false);
+    }
+    else
+    {
+        buff[0] = '\0';
+        return 0;
+    }
+    if (bits >> 31)
+    {
+        *--start = '-';
+    }
+    return fmt_tail_copy(buff, start, end);
+}
+
+// 追加一段，超出部分只计长度
+static inline void fmt_write(fmt_t *fmt, const char *str, uint32_t length)
+{
+    if (length == 0)
+    {
+        return; // 无符号/前缀时 str 为 NULL，memcpy 不允许空指针
+    }
+    if (fmt->length + 1 < fmt->size)
+    {
+        uint32_t space = fmt->size - 1 - fmt->length;
+        memcpy(fmt->buff + fmt->length, str, (length < space) ? length : space);
+    }
+    fmt->length += length;
+}
+
+// 追加 count 个相同字符
+static inline void fmt_fill(fmt_t *fmt, char ch, int32_t count)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+    if (fmt->length + 1 < fmt->size)
+    {
+        uint32_t space = fmt->size - 1 - fmt->length;
+        memset(fmt->buff + fmt->length, ch, ((uint32_t)count < space) ? (uint32_t)count : space);
+    }
+    fmt->length += (uint32_t)count;
+}
+
+// 结束符
+static inline void fmt_terminate(fmt_t *fmt)
+{
+    if (fmt->size > 0)
+    {
+        fmt->buff[(fmt->length < fmt->size) ? fmt->length : fmt->size - 1] = '\0';
+    }
+}
+
+// 初始化构建器
+void fmt_init(fmt_t *fmt, char *buff, uint32_t size)
+{
+    fmt->buff = buff;
+    fmt->size = size;
+    fmt->length = 0;
+    fmt_terminate(fmt);
+}
+
+// 追加字符
+void fmt_char(fmt_t *fmt, char ch)
+{
+    fmt_write(fmt, &ch, 1);
+    fmt_terminate(fmt);
+}
+
+// 追加字符串
+void fmt_str(fmt_t *fmt, const char *str)
+{
+    str = (str == NULL) ? "(null)" : str;
+    fmt_write(fmt, str, strlen(str));
+    fmt_terminate(fmt);
+}
+
+// 追加定长字符串
+void fmt_strn(fmt_t *fmt, const char *str, uint32_t length)
+{
+    fmt_write(fmt, str, length);
+    fmt_terminate(fmt);
+}
+
+// 追加无符号整数
+void fmt_u32(fmt_t *fmt, uint32_t value)
+{
+    char tmp[12];
+    char *end = tmp + sizeof(tmp);
+    char *start = fmt_dec32_write(end, value);
+    fmt_write(fmt, start, end - start);
+    fmt_terminate(fmt);
+}
+
+// 追加有符号整数
+void fmt_i32(fmt_t *fmt, int32_t value)
+{
+    char tmp[12];
+    char *end = tmp + sizeof(tmp);
+    char *start = fmt_dec32_write(end, (value < 0) ? 0u - (uint32_t)value : (uint32_t)value);
+    if (value < 0)
+    {
+        *--start = '-';
+    }
+    fmt_write(fmt, start, end - start);
+    fmt_terminate(fmt);
+}
+
+// 追加64位无符号整数
+void fmt_u64(fmt_t *fmt, uint64_t value)
+{
+    char tmp[FMT_U64_DIGITS_MAX];
+    char *end = tmp + sizeof(tmp);
+    char *start = fmt_dec64_write(end, value);
+    fmt_write(fmt, start, end - start);
+    fmt_terminate(fmt);
+}
+
+// 追加64位有符号整数
+void fmt_i64(fmt_t *fmt, int64_t value)
+{
+    char tmp[FMT_U64_DIGITS_MAX + 1];
+    char *end = tmp + sizeof(tmp);
+    char *start = fmt_dec64_write(end, (value < 0) ? 0u - (uint64_t)value : (uint64_t)value);
+    if (value < 0)
+    {
+        *--start = '-';
+    }
+    fmt_write(fmt, start, end - start);
+    fmt_terminate(fmt);
+}
+
+// 追加十六进制
+void fmt_hex32(fmt_t *fmt, uint32_t value, uint8_t width, bool is_upper)
+{
+    char tmp[8];
+    char *end = tmp + sizeof(tmp);
+    char *start = fmt_hex64_write(end, value, (width > 8) ? 8 : width, is_upper);
+    fmt_write(fmt, start, end - start);
+    fmt_terminate(fmt);
+}
+
+// 追加浮点，超范围时转交C库
+void fmt_f32(fmt_t *fmt, float value, uint8_t precision)
+{
+    char tmp[FMT_F32_LENGTH_MAX + 1];
+    uint8_t length = fmt_f32_to_str(tmp, value, precision);
+    if (length > 0)
+    {
+        fmt_write(fmt, tmp, length);
+        fmt_terminate(fmt);
+        return;
+    }
+
+    uint32_t space = (fmt->length < fmt->size) ? fmt->size - fmt->length : 0;
+    int n = snprintf((space > 0) ? fmt->buff + fmt->length : NULL, space, "%.*f", (int)precision, (double)value);
+    fmt->length += (n > 0) ? (uint32_t)n : 0;
+    fmt_terminate(fmt);
+}
+
+/**
+ * 按格式说明输出：[空格填充][符号/前缀][0填充][精度0][正文][左对齐空格]
+ * prefix 为符号或 "0x"，zeros 为精度要求的前导0
+ */
+static void fmt_pad_write(fmt_t *fmt, const fmt_spec_t *spec, const char *prefix, uint8_t prefix_length,
+                          int32_t zeros, const char *body, uint32_t body_length)
+{
+    int32_t pad = spec->width - (int32_t)(prefix_length + body_length) - ((zeros > 0) ? zeros : 0);
+    if (!(spec->flags & (FMT_FLAG_LEFT | FMT_FLAG_ZERO)))
+    {
+        fmt_fill(fmt, ' ', pad);
+    }
+    fmt_write(fmt, prefix, prefix_length);
+    if (spec->flags & FMT_FLAG_ZERO)
+    {
+        fmt_fill(fmt, '0', pad);
+    }
+    fmt_fill(fmt, '0', zeros);
+    fmt_write(fmt, body, body_length);
+    if (spec->flags & FMT_FLAG_LEFT)
+    {
+        fmt_fill(fmt, ' ', pad);
+    }
+}
+
+// 符号前缀
+static inline uint8_t fmt_sign(char *prefix, bool is_negative, uint8_t flags)
+{
+    if (is_negative)
+    {
+        prefix[0] = '-';
+    }
+    else if (flags & FMT_FLAG_PLUS)
+    {
+        prefix[0] = '+';
+    }
+    else if (flags & FMT_FLAG_SPACE)
+    {
+        prefix[0] = ' ';
+    }
+    else
+    {
+        return 0;
+    }
+    return 1;
+}
+
+// %d %i %u %x %X
+static void fmt_integer(fmt_t *fmt, fmt_spec_t *spec, uint64_t magnitude, bool is_negative, char conversion)
+{
+    char tmp[FMT_U64_DIGITS_MAX + 1];
+    char *end = tmp + sizeof(tmp);
+    char *start;
+    char prefix[2];
+    uint8_t prefix_length = 0;
+
+    if (spec->precision >= 0)
+    {
+        spec->flags &= ~FMT_FLAG_ZERO; // 指定精度时忽略0标志
+    }
+
+    if ((conversion == 'x') || (conversion == 'X'))
+    {
+        start = fmt_hex64_write(end, magnitude, 1, conversion == 'X');
+        if ((spec->flags & FMT_FLAG_ALT) && (magnitude != 0))
+        {
+            prefix[0] = '0';
+            prefix[1] = conversion;
+            prefix_length = 2;
+        }
+    }
+    else
+    {
+        start = ((magnitude >> 32) == 0) ? fmt_dec32_write(end, (uint32_t)magnitude) : fmt_dec64_write(end, magnitude);
+        if (conversion != 'u')
+        {
+            prefix_length = fmt_sign(prefix, is_negative, spec->flags);
+        }
+    }
+
+    uint32_t length = end - start;
+    if ((spec->precision == 0) && (magnitude == 0))
+    {
+        length = 0; // "%.0d" 输出空
+    }
+    int32_t zeros = spec->precision - (int32_t)length;
+    fmt_pad_write(fmt, spec, prefix, prefix_length, zeros, end - length, length);
+}
+
+// %f %F 快速路径，失败返回 false
+static bool fmt_float(fmt_t *fmt, fmt_spec_t *spec, double value, char conversion)
+{
+    float f = (float)value;
+    uint32_t bits;
+    uint64_t scaled;
+    char tmp[FMT_F32_LENGTH_MAX];
+    char *end = tmp + sizeof(tmp);
+    char *start;
+    char prefix[1];
+    int32_t precision = (spec->precision < 0) ? 6 : spec->precision;
+
+    memcpy(&bits, &f, sizeof(bits));
+    if (((bits >> 23) & 0xFF) == 0xFF)
+    {
+        if ((value == value) && ((double)f != value))
+        {
+            return false; // double 范围内的有限大数
+        }
+        start = fmt_special_write(end, bits, conversion == 'F');
+        spec->flags &= ~FMT_FLAG_ZERO;
+    }
+    else if (((double)f != value) || (precision > FMT_FLOAT_PRECISION_MAX) ||
+             !fmt_f32_scale(f, (uint8_t)precision, &scaled))
+    {
+        return false;
+    }
+    else
+    {
+        start = fmt_fixed_write(end, scaled, (uint8_t)precision, (spec->flags & FMT_FLAG_ALT) != 0);
+    }
+
+    uint8_t prefix_length = fmt_sign(prefix, (bits >> 31) != 0, spec->flags);
+    fmt_pad_write(fmt, spec, prefix, prefix_length, 0, start, end - start);
+    return true;
+}
+
+// %s %c
+static void fmt_string(fmt_t *fmt, fmt_spec_t *spec, const char *str, uint32_t length)
+{
+    spec->flags &= ~FMT_FLAG_ZERO;
+    fmt_pad_write(fmt, spec, NULL, 0, 0, str, length);
+}
+
+// 重建格式说明：宽度/精度已取出（含 *），长度修饰按实际取参类型给出
+static void fmt_spec_build(char *spec_str, const fmt_spec_t *spec, const char *length, char conversion)
+{
+    char *p = spec_str;
+    *p++ = '%';
+    if (spec->flags & FMT_FLAG_LEFT)
+        *p++ = '-';
+    if (spec->flags & FMT_FLAG_PLUS)
+        *p++ = '+';
+    if (spec->flags & FMT_FLAG_SPACE)
+        *p++ = ' ';
+    if (spec->flags & FMT_FLAG_ZERO)
+        *p++ = '0';
+    if (spec->flags & FMT_FLAG_ALT)
+        *p++ = '#';
+    if (spec->width > 0)
+    {
+        p += fmt_u32_to_dec(p, (uint32_t)spec->width);
+    }
+    if (spec->precision >= 0)
+    {
+        *p++ = '.';
+        p += fmt_u32_to_dec(p, (uint32_t)spec->precision);
+    }
+    while (*length)
+    {
+        *p++ = *length++;
+    }
+    *p++ = conversion;
+    *p = '\0';
+}
+
+// 转交C库：把当前格式说明原样交给 snprintf
+#define FMT_FALLBACK(_fmt, _spec_str, _value)                                                              \
+    {                                                                                                      \
+        uint32_t _space = ((_fmt)->length < (_fmt)->size) ? (_fmt)->size - (_fmt)->length : 0;             \
+        int _n = snprintf((_space > 0) ? (_fmt)->buff + (_fmt)->length : NULL, _space, _spec_str, _value); \
+        (_fmt)->length += (_n > 0) ? (uint32_t)_n : 0;                                                     \
+    }
+
+// vsnprintf 子集替代
+int fmt_vsnprintf(char *buff, size_t size, const char *format, va_list arg)
+{
+    fmt_t fmt = {.buff = buff, .size = (uint32_t)size, .length = 0};
+    va_list ap;
+    va_copy(ap, arg);
+
+    while (*format)
+    {
+        // 普通文本整段拷贝
+        const char *percent = strchr(format, '%');
+        if (percent == NULL)
+        {
+            fmt_write(&fmt, format, strlen(format));
+            break;
+        }
+        fmt_write(&fmt, format, percent - format);
+
+        const char *spec_begin = percent;
+        const char *p = percent + 1;
+        fmt_spec_t spec = {.flags = 0, .width = 0, .precision = -1};
+
+        // 标志
+        for (;; p++)
+        {
+            if (*p == '-')
+                spec.flags |= FMT_FLAG_LEFT;
+            else if (*p == '+')
+                spec.flags |= FMT_FLAG_PLUS;
+            else if (*p == ' ')
+                spec.flags |= FMT_FLAG_SPACE;
+            else if (*p == '0')
+                spec.flags |= FMT_FLAG_ZERO;
+            else if (*p == '#')
+                spec.flags |= FMT_FLAG_ALT;
+            else
+                break;
+        }
+
+        // 宽度
+        if (*p == '*')
+        {
+            spec.width = va_arg(ap, int);
+            if (spec.width < 0)
+            {
+                spec.flags |= FMT_FLAG_LEFT;
+                spec.width = -spec.width;
+            }
+            p++;
+        }
+        else
+        {
+            while ((*p >= '0') && (*p <= '9'))
+            {
+                spec.width = spec.width * 10 + (*p++ - '0');
+            }
+        }
+
+        // 精度
+        if (*p == '.')
+        {
+            p++;
+            spec.precision = 0;
+            if (*p == '*')
+            {
+                spec.precision = va_arg(ap, int);
+                spec.precision = (spec.precision < 0) ? -1 : spec.precision;
+                p++;
+            }
+            else
+            {
+                while ((*p >= '0') && (*p <= '9'))
+                {
+                    spec.precision = spec.precision * 10 + (*p++ - '0');
+                }
+            }
+        }
+
+        // 长度
+        char length = 0;
+        if (*p == 'h')
+        {
+            length = (*++p == 'h') ? (p++, 'H') : 'h';
+        }
+        else if (*p == 'l')
+        {
+            length = (*++p == 'l') ? (p++, 'q') : 'l';
+        }
+        else if ((*p == 'z') || (*p == 'j') || (*p == 't') || (*p == 'L'))
+        {
+            length = *p++;
+        }
+        if (spec.flags & FMT_FLAG_LEFT)
+        {
+            spec.flags &= ~FMT_FLAG_ZERO;
+        }
+
+        char conversion = *p++;
+        switch (conversion)
+        {
+        case 'd':
+        case 'i':
+        {
+            int64_t value;
+            switch (length)
+            {
+            case 'H': value = (signed char)va_arg(ap, int); break;
+            case 'h': value = (short)va_arg(ap, int); break;
+            case 'l': value = va_arg(ap, long); break;
+            case 'q': value = va_arg(ap, long long); break;
+            case 'j': value = va_arg(ap, intmax_t); break;
+            case 'z': value = (int64_t)va_arg(ap, size_t); break;
+            case 't': value = va_arg(ap, ptrdiff_t); break;
+            default: value = va_arg(ap, int); break;
+            }
+            fmt_integer(&fmt, &spec, (value < 0) ? 0u - (uint64_t)value : (uint64_t)value, value < 0, conversion);
+            break;
+        }
+
+        case 'u':
+        case 'x':
+        case 'X':
+        {
+            uint64_t value;
+            switch (length)
+            {
+            case 'H': value = (unsigned char)va_arg(ap, unsigned int); break;
+            case 'h': value = (unsigned short)va_arg(ap, unsigned int); break;
+            case 'l': value = va_arg(ap, unsigned long); break;
+            case 'q': value = va_arg(ap, unsigned long long); break;
+            case 'j': value = va_arg(ap, uintmax_t); break;
+            case 'z': value = va_arg(ap, size_t); break;
+            case 't': value = (uint64_t)va_arg(ap, ptrdiff_t); break;
+            default: value = va_arg(ap, unsigned int); break;
+            }
+            fmt_integer(&fmt, &spec, value, false, conversion);
+            break;
+        }
+
+        case 'c':
+        {
+            char ch = (char)va_arg(ap, int);
+            fmt_string(&fmt, &spec, &ch, 1);
+            break;
+        }
+
+        case 's':
+        {
+            const char *str = va_arg(ap, const char *);
+            str = (str == NULL) ? "(null)" : str;
+            uint32_t n = (spec.precision >= 0) ? (uint32_t)strnlen(str, spec.precision) : (uint32_t)strlen(str);
+            fmt_string(&fmt, &spec, str, n);
+            break;
+        }
+
+        case '%':
+            fmt_write(&fmt, "%", 1);
+            break;
+
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        {
+            char spec_str[FMT_SPEC_LENGTH_MAX];
+            if (length == 'L')
+            {
+                long double value = va_arg(ap, long double);
+                fmt_spec_build(spec_str, &spec, "L", conversion);
+                FMT_FALLBACK(&fmt, spec_str, value);
+                break;
+            }
+            double value = va_arg(ap, double);
+            if (((conversion == 'f') || (conversion == 'F')) && fmt_float(&fmt, &spec, value, conversion))
+            {
+                break;
+            }
+            fmt_spec_build(spec_str, &spec, "", conversion);
+            FMT_FALLBACK(&fmt, spec_str, value);
+            break;
+        }
+
+        case 'o':
+        {
+            char spec_str[FMT_SPEC_LENGTH_MAX];
+            unsigned long long value;
+            switch (length)
+            {
+            case 'H': value = (unsigned char)va_arg(ap, unsigned int); break;
+            case 'h': value = (unsigned short)va_arg(ap, unsigned int); break;
+            case 'l': value = va_arg(ap, unsigned long); break;
+            case 'q': value = va_arg(ap, unsigned long long); break;
+            case 'j': value = va_arg(ap, uintmax_t); break;
+            case 'z': value = va_arg(ap, size_t); break;
+            case 't': value = (uint64_t)va_arg(ap, ptrdiff_t); break;
+            default: value = va_arg(ap, unsigned int); break;
+            }
+            fmt_spec_build(spec_str, &spec, "ll", conversion);
+            FMT_FALLBACK(&fmt, spec_str, value);
+            break;
+        }
+
+        case 'p':
+        {
+            char spec_str[FMT_SPEC_LENGTH_MAX];
+            void *value = va_arg(ap, void *);
+            fmt_spec_build(spec_str, &spec, "", conversion);
+            FMT_FALLBACK(&fmt, spec_str, value);
+            break;
+        }
+
+        default:
+            // 未知转换：原样输出
+            fmt_write(&fmt, spec_begin, p - spec_begin - ((conversion == '\0') ? 1 : 0));
+            if (conversion == '\0')
+            {
+                p--;
+            }
+            break;
+        }
+        format = p;
+    }
+
+    va_end(ap);
+    fmt_terminate(&fmt);
+    return (int)fmt.length;
+}
+
+// snprintf 子集替代
+int fmt_snprintf(char *buff, size_t size, const char *format, ...)
+{
+    va_list arg;
+    va_start(arg, format);
+    int length = fmt_vsnprintf(buff, size, format, arg);
+    va_end(arg);
+    return length;
+}
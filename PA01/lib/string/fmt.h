@@ -0,0 +1,172 @@
+/**
+ * @file fmt.h
+ * @author WittXie
+ * @brief 快速格式化：整数/浮点转文本、追加式构建器、vsnprintf 子集替代
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 十进制转换用两位一查的 "00"~"99" 表，从低位向高位写，除法全部是除以常量（编译为乘法）；
+ * 64位数先按 10^8 分段，只有超过32位的部分才走64位除法；十六进制按半字节查表。
+ * 浮点按 float 的二进制精确值定点化：尾数 × 5^p 后按指数移位，舍入为向偶舍入，
+ * 结果与 glibc 的 %.pf 逐字一致，不经过 double 运算（精度 p <= FMT_FLOAT_PRECISION_MAX，整数部分 < 2^64/10^p）。
+ *
+ * fmt_vsnprintf 支持本工程用到的格式子集，返回值语义同 vsnprintf（应写长度，超出部分截断）：
+ *   标志 - + 空格 0 #，宽度/精度（含 *），长度 hh h l ll z j t，
+ *   转换 d i u x X c s f F %；%f 的参数是 float 提升来的（可无损转回 float）时走快速路径；
+ * 其余（%e %g %a %o %p、真正的 double、超范围值）逐个转交 C 库 snprintf，输出不变。
+ *
+ * @copyright Copyright (c) 2026
+ */
+#pragma once
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define FMT_FLOAT_PRECISION_MAX 12 // 浮点快速路径最大小数位数
+#define FMT_U64_DIGITS_MAX 20      // u64 十进制最大位数
+#define FMT_F32_LENGTH_MAX 36      // fmt_f32_to_str 最大输出长度（不含结束符）
+
+// 追加式构建器：length 为应写长度，缓存始终以 '\0' 结尾
+typedef struct
+{
+    char *buff;      // 输出缓存
+    uint32_t size;   // 缓存大小（含结束符）
+    uint32_t length; // 应写长度，可超过 size - 1
+} fmt_t;
+
+/**
+ * @brief 无符号整数转十进制
+ *
+ * @param buff 输出，至少 11/21 字节，以 '\0' 结尾
+ * @param value 数值
+ * @return uint8_t 长度
+ */
+uint8_t fmt_u32_to_dec(char *buff, uint32_t value);
+uint8_t fmt_u64_to_dec(char *buff, uint64_t value);
+
+/**
+ * @brief 有符号整数转十进制
+ *
+ * @param buff 输出，至少 12/21 字节，以 '\0' 结尾
+ * @param value 数值
+ * @return uint8_t 长度
+ */
+uint8_t fmt_i32_to_dec(char *buff, int32_t value);
+uint8_t fmt_i64_to_dec(char *buff, int64_t value);
+
+/**
+ * @brief 无符号整数转十六进制
+ *
+ * @param buff 输出，至少 9/17 字节，以 '\0' 结尾
+ * @param value 数值
+ * @param width 最少位数，不足补0；0 时同 1
+ * @param is_upper 是否大写
+ * @return uint8_t 长度
+ */
+uint8_t fmt_u32_to_hex(char *buff, uint32_t value, uint8_t width, bool is_upper);
+uint8_t fmt_u64_to_hex(char *buff, uint64_t value, uint8_t width, bool is_upper);
+
+/**
+ * @brief 浮点转定点小数文本，等价于 "%.*f"
+ *
+ * @param buff 输出，至少 FMT_F32_LENGTH_MAX + 1 字节，以 '\0' 结尾
+ * @param value 数值
+ * @param precision 小数位数，<= FMT_FLOAT_PRECISION_MAX
+ * @return uint8_t 长度；超出快速路径范围（过大、inf/nan 除外）返回0
+ */
+uint8_t fmt_f32_to_str(char *buff, float value, uint8_t precision);
+
+/**
+ * @brief 初始化构建器
+ *
+ * @param fmt 构建器
+ * @param buff 输出缓存
+ * @param size 缓存大小
+ */
+void fmt_init(fmt_t *fmt, char *buff, uint32_t size);
+
+/**
+ * @brief 追加内容，超出缓存部分只计长度
+ *
+ * @param fmt 构建器
+ */
+void fmt_char(fmt_t *fmt, char ch);
+void fmt_str(fmt_t *fmt, const char *str);
+void fmt_strn(fmt_t *fmt, const char *str, uint32_t length);
+void fmt_u32(fmt_t *fmt, uint32_t value);
+void fmt_i32(fmt_t *fmt, int32_t value);
+void fmt_u64(fmt_t *fmt, uint64_t value);
+void fmt_i64(fmt_t *fmt, int64_t value);
+void fmt_hex32(fmt_t *fmt, uint32_t value, uint8_t width, bool is_upper);
+void fmt_f32(fmt_t *fmt, float value, uint8_t precision);
+
+/**
+ * @brief 按类型追加（C11 _Generic），浮点默认2位小数
+ * @note 字符常量 'a' 在C中是 int，追加字符用 fmt_char
+ *
+ * @param _fmt 构建器
+ * @param _value 字符串/整数/浮点/字符
+ */
+static inline void fmt_f32_default(fmt_t *fmt, float value)
+{
+    fmt_f32(fmt, value, 2);
+}
+static inline void fmt_bool(fmt_t *fmt, bool value)
+{
+    fmt_str(fmt, value ? "true" : "false");
+}
+#define fmt_append(_fmt, _value) _Generic((_value), \
+    char *: fmt_str,                                \
+    const char *: fmt_str,                          \
+    char: fmt_char,                                 \
+    bool: fmt_bool,                                 \
+    signed char: fmt_i32,                           \
+    short: fmt_i32,                                 \
+    int: fmt_i32,                                   \
+    long: fmt_i64,                                  \
+    long long: fmt_i64,                             \
+    unsigned char: fmt_u32,                         \
+    unsigned short: fmt_u32,                        \
+    unsigned int: fmt_u32,                          \
+    unsigned long: fmt_u64,                         \
+    unsigned long long: fmt_u64,                    \
+    float: fmt_f32_default,                         \
+    double: fmt_f32_default)(_fmt, _value)
+
+/**
+ * @brief 应写长度
+ *
+ * @param fmt 构建器
+ * @return uint32_t 长度，>= size 表示已截断
+ */
+#define fmt_length(_fmt) ((_fmt)->length)
+
+/**
+ * @brief 是否截断
+ *
+ * @param fmt 构建器
+ */
+#define fmt_is_overflow(_fmt) ((_fmt)->size == 0 || (_fmt)->length >= (_fmt)->size)
+
+/**
+ * @brief vsnprintf 子集替代
+ *
+ * @param buff 输出缓存
+ * @param size 缓存大小
+ * @param format 格式串
+ * @param arg 参数
+ * @return int 应写长度
+ */
+int fmt_vsnprintf(char *buff, size_t size, const char *format, va_list arg);
+
+/**
+ * @brief snprintf 子集替代
+ *
+ * @param buff 输出缓存
+ * @param size 缓存大小
+ * @param format 格式串
+ * @return int 应写长度
+ */
+int fmt_snprintf(char *buff, size_t size, const char *format, ...);
@@ -0,0 +1,203 @@
+#include "./hex.h"
+
+static const char hex_upper[16] = "0123456789ABCDEF";
+static const char hex_lower[16] = "0123456789abcdef";
+
+// 字符 -> 半字节，非法为 0xFF
+static const uint8_t hex_table[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+// 读写 4 字节（允许非对齐，M7 支持非对齐 LDR/STR；按小端排列）
+static inline uint32_t hex_load32(const void *p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline void hex_store32(void *p, uint32_t value)
+{
+    memcpy(p, &value, sizeof(value));
+}
+
+// 4 个半字节（各占一字节）并行转 ASCII：>9 的加 7（大写）或 0x27（小写）
+static inline uint32_t hex_nibble_to_ascii(uint32_t nibbles, uint32_t alpha)
+{
+    uint32_t mask = ((nibbles + 0x06060606u) >> 4) & 0x01010101u;
+    return nibbles + 0x30303030u + mask * alpha;
+}
+
+// 16位低字节展开到字的第0、2字节
+static inline uint32_t hex_spread16(uint32_t value)
+{
+    return (value & 0xFFu) | ((value & 0xFF00u) << 8);
+}
+
+// 4 字节 -> 8 个字符（小端：低地址字节在字的低位）
+static inline void hex_encode4(char *text, uint32_t word, uint32_t alpha)
+{
+    uint32_t hi = (word >> 4) & 0x0F0F0F0Fu;
+    uint32_t lo = word & 0x0F0F0F0Fu;
+    hex_store32(text, hex_nibble_to_ascii(hex_spread16(hi & 0xFFFF) | (hex_spread16(lo & 0xFFFF) << 8), alpha));
+    hex_store32(text + 4, hex_nibble_to_ascii(hex_spread16(hi >> 16) | (hex_spread16(lo >> 16) << 8), alpha));
+}
+
+// 数据转十六进制字符串
+uint32_t hex_encode(char *text, const void *data, uint32_t length, bool is_upper)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    const char *table = is_upper ? hex_upper : hex_lower;
+    uint32_t alpha = is_upper ? 0x07u : 0x27u;
+    uint32_t i = 0;
+
+    for (; i + 4 <= length; i += 4)
+    {
+        hex_encode4(&text[i * 2], hex_load32(&p[i]), alpha);
+    }
+    for (; i < length; i++)
+    {
+        text[i * 2] = table[p[i] >> 4];
+        text[i * 2 + 1] = table[p[i] & 0x0F];
+    }
+    text[length * 2] = '\0';
+    return length * 2;
+}
+
+// 数据转十六进制字符串，每字节后跟分隔符
+uint32_t hex_encode_sep(char *text, const void *data, uint32_t length, char separator, bool is_upper)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    const char *table = is_upper ? hex_upper : hex_lower;
+    uint32_t alpha = is_upper ? 0x07u : 0x27u;
+    uint32_t i = 0;
+    char pair[8];
+
+    for (; i + 4 <= length; i += 4)
+    {
+        hex_encode4(pair, hex_load32(&p[i]), alpha);
+        char *out = &text[i * 3];
+        out[0] = pair[0], out[1] = pair[1], out[2] = separator;
+        out[3] = pair[2], out[4] = pair[3], out[5] = separator;
+        out[6] = pair[4], out[7] = pair[5], out[8] = separator;
+        out[9] = pair[6], out[10] = pair[7], out[11] = separator;
+    }
+    for (; i < length; i++)
+    {
+        text[i * 3] = table[p[i] >> 4];
+        text[i * 3 + 1] = table[p[i] & 0x0F];
+        text[i * 3 + 2] = separator;
+    }
+    text[length * 3] = '\0';
+    return length * 3;
+}
+
+// 十六进制字符串转数据
+bool hex_decode(void *data, const char *text, uint32_t length)
+{
+    uint8_t *out = (uint8_t *)data;
+    uint32_t i = 0;
+
+    if (length & 1)
+    {
+        return false;
+    }
+
+    for (; i + 4 <= length; i += 4)
+    {
+        uint32_t word = hex_load32(&text[i]);
+        uint32_t a = hex_table[word & 0xFF];
+        uint32_t b = hex_table[(word >> 8) & 0xFF];
+        uint32_t c = hex_table[(word >> 16) & 0xFF];
+        uint32_t d = hex_table[word >> 24];
+        if ((a | b | c | d) & 0xF0)
+        {
+            return false;
+        }
+        out[i / 2] = (uint8_t)((a << 4) | b);
+        out[i / 2 + 1] = (uint8_t)((c << 4) | d);
+    }
+    if (i < length)
+    {
+        uint32_t a = hex_table[(uint8_t)text[i]];
+        uint32_t b = hex_table[(uint8_t)text[i + 1]];
+        if ((a | b) & 0xF0)
+        {
+            return false;
+        }
+        out[i / 2] = (uint8_t)((a << 4) | b);
+    }
+    return true;
+}
+
+// 初始化转储
+void hexdump_init(hexdump_t *dump)
+{
+    if ((dump->cfg.width == 0) || (dump->cfg.width > HEXDUMP_WIDTH_MAX))
+    {
+        dump->cfg.width = 16;
+    }
+    dump->offset = 0;
+}
+
+// 转储下一批整行
+uint32_t hexdump_format(hexdump_t *dump, char *text, uint32_t size, const void *data, uint32_t length)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    const char *table = dump->cfg.is_upper ? hex_upper : hex_lower;
+    uint32_t width = dump->cfg.width;
+    uint32_t line_size = dump->cfg.is_ascii ? HEXDUMP_LINE_SIZE(width) : (width * 3 + 12);
+    char *out = text;
+
+    while ((dump->offset < length) && ((uint32_t)(out - text) + line_size < size))
+    {
+        uint32_t n = (length - dump->offset < width) ? length - dump->offset : width;
+        const uint8_t *line = &p[dump->offset];
+
+        // 地址
+        uint32_t address = dump->cfg.address + dump->offset;
+        for (int8_t shift = 28; shift >= 0; shift -= 4)
+        {
+            *out++ = table[(address >> shift) & 0x0F];
+        }
+        *out++ = ':';
+        *out++ = ' ';
+
+        // 十六进制列，不足一行补空格以对齐 ASCII 列
+        out += hex_encode_sep(out, line, n, ' ', dump->cfg.is_upper);
+        if (dump->cfg.is_ascii)
+        {
+            memset(out, ' ', (width - n) * 3);
+            out += (width - n) * 3;
+            *out++ = '|';
+            for (uint32_t i = 0; i < n; i++)
+            {
+                *out++ = ((line[i] >= 0x20) && (line[i] < 0x7F)) ? (char)line[i] : '.';
+            }
+            *out++ = '|';
+        }
+        *out++ = '\r';
+        *out++ = '\n';
+        dump->offset += n;
+    }
+    if (size > 0)
+    {
+        *out = '\0';
+    }
+    return (uint32_t)(out - text);
+}
@@ -2,8 +2,12 @@
  * @file hex.h
  * @author WittXie
  * @brief 进制处理
- * @version 0.1
+ * @version 0.2
  * @date 2023-05-11
+ * @note
+ * hex_encode 每次读 4 字节，半字节拆分与转 ASCII 在字内并行完成（SWAR），一次写 8 个字符；
+ * hex_decode 每次读 4 个字符查 256 字节表，4 个结果合并后只判断一次非法字符；
+ * hexdump 按整行写入调用方缓存，缓存不够一行时返回，下次调用从断点继续，不申请内存。
  *
  * @copyright Copyright (c) 2023
  *
@@ -102,3 +106,85 @@ typedef union
  *
  */
 #define countof(array) (sizeof(array) / sizeof(array[0]))
+
+#define HEX_ENCODE_SIZE(_length) ((_length) * 2 + 1)     // hex_encode 输出缓存大小（含结束符）
+#define HEX_ENCODE_SEP_SIZE(_length) ((_length) * 3 + 1) // hex_encode_sep 输出缓存大小（含结束符）
+#define HEXDUMP_WIDTH_MAX 64                             // hexdump 每行最大字节数
+#define HEXDUMP_LINE_SIZE(_width) ((_width) * 4 + 14)    // hexdump 一行长度："AAAAAAAA: " + "XX "*w + "|" + ascii*w + "|\r\n"
+
+/**
+ * @brief 流式十六进制转储
+ */
+typedef struct __hexdump
+{
+    // 参数
+    struct
+    {
+        uint32_t address; // 起始地址（仅用于显示）
+        uint8_t width;    // 每行字节数，0 时为16
+        bool is_ascii;    // 是否附带 ASCII 列
+        bool is_upper;    // 是否大写
+    } cfg;
+
+    uint32_t offset; // 已转储字节数
+} hexdump_t;
+
+/**
+ * @brief 数据转十六进制字符串
+ *
+ * @param text 输出，至少 HEX_ENCODE_SIZE(length)，以 '\0' 结尾
+ * @param data 数据
+ * @param length 数据长度
+ * @param is_upper 是否大写
+ * @return uint32_t 字符串长度
+ */
+uint32_t hex_encode(char *text, const void *data, uint32_t length, bool is_upper);
+
+/**
+ * @brief 数据转十六进制字符串，每字节后跟分隔符，如 "AA BB CC "
+ *
+ * @param text 输出，至少 HEX_ENCODE_SEP_SIZE(length)，以 '\0' 结尾
+ * @param data 数据
+ * @param length 数据长度
+ * @param separator 分隔符
+ * @param is_upper 是否大写
+ * @return uint32_t 字符串长度
+ */
+uint32_t hex_encode_sep(char *text, const void *data, uint32_t length, char separator, bool is_upper);
+
+/**
+ * @brief 十六进制字符串转数据，大小写均可，不接受空白和 0x 前缀
+ *
+ * @param data 输出，至少 length / 2
+ * @param text 十六进制字符串
+ * @param length 字符串长度，必须为偶数
+ * @return bool 是否成功，存在非法字符时 data 内容未定义
+ */
+bool hex_decode(void *data, const char *text, uint32_t length);
+
+/**
+ * @brief 初始化转储，cfg 需预先填好
+ *
+ * @param dump 转储指针
+ */
+void hexdump_init(hexdump_t *dump);
+
+/**
+ * @brief 转储下一批整行到 text
+ *
+ * @param dump 转储指针
+ * @param text 输出缓存，以 '\0' 结尾
+ * @param size 输出缓存大小，至少 HEXDUMP_LINE_SIZE(width) + 1 才能输出一行
+ * @param data 完整数据（每次传同一块）
+ * @param length 完整数据长度
+ * @return uint32_t 本次写入长度，0 表示已完成或缓存不足一行
+ */
+uint32_t hexdump_format(hexdump_t *dump, char *text, uint32_t size, const void *data, uint32_t length);
+
+/**
+ * @brief 是否已转储完
+ *
+ * @param _dump 转储指针
+ * @param _length 完整数据长度
+ */
+#define hexdump_is_done(_dump, _length) ((_dump)->offset >= (_length))
@@ -1,3 +1,4 @@
+#include "./string.h"
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
@@ -115,90 +116,307 @@ void split_string(char *str, char delimiter, char *argv[], uint32_t *argc)
     *argc = count;
 }
 
-// 分割字符串到缓冲区
+// 初始化字符类表
+void charset_init(charset_t *set, const char *chars)
+{
+    memset(set, 0, sizeof(charset_t));
+    if (chars == NULL)
+    {
+        return;
+    }
+    for (; *chars; chars++)
+    {
+        charset_add(set, *chars);
+    }
+}
+
+// 分割字符串到缓冲区：单遍拷贝，间隔字符与停止字符写为 '\0'
 void split_string_to_buff(char *buff, const char *str, const char *delimiters, const char *ignores, const char *stop, char *argv[], uint32_t *argc)
 {
+    charset_t gap, end;
+    charset_init(&gap, delimiters);
+    charset_init(&end, stop);
+    for (; ignores && *ignores; ignores++)
+    {
+        charset_add(&gap, *ignores);
+    }
+    charset_add(&end, '\0');
+
     uint32_t count = 0;
-    memcpy(buff, str, strlen(str) + 1);
+    bool is_token = false;
+    for (;; str++, buff++)
+    {
+        uint8_t ch = (uint8_t)*str;
+        if (charset_has(&end, ch))
+        {
+            *buff = '\0';
+            break;
+        }
+        if (charset_has(&gap, ch))
+        {
+            *buff = '\0';
+            is_token = false;
+            continue;
+        }
+        if (!is_token)
+        {
+            argv[count++] = buff; // 新参数开始
+            is_token = true;
+        }
+        *buff = (char)ch;
+    }
 
-    char *start = buff;
-    char *end;
+    *argc = count;
+}
 
-    while (*start != '\0' && !strchr(stop, *start))
+// 2~4 字节 needle：memchr 找首字节再比较剩余字节，最坏 O(4n)
+static void *memfind_short(const uint8_t *h, uint32_t hay_len, const uint8_t *n, uint32_t needle_len)
+{
+    const uint8_t *end = h + hay_len - needle_len + 1;
+    while (h < end)
     {
-        // 跳过任何连续的分隔符和忽略字符
-        while (strchr(delimiters, *start) || strchr(ignores, *start))
+        h = (const uint8_t *)memchr(h, n[0], end - h);
+        if (h == NULL)
         {
-            start++;
+            return NULL;
         }
-        if (*start == '\0' && !strchr(stop, *start))
+        if (memcmp(h + 1, n + 1, needle_len - 1) == 0)
         {
-            break;
+            return (void *)h;
         }
+        h++;
+    }
+    return NULL;
+}
 
-        // 找到下一个分隔符或字符串结尾
-        end = start;
-        while (*end != '\0' && !strchr(stop, *end) && !strchr(delimiters, *end) && !strchr(ignores, *end))
+// Horspool：按窗口末字节跳转
+static void *memfind_horspool(const uint8_t *h, uint32_t hay_len, const uint8_t *n, uint32_t needle_len)
+{
+    uint8_t shift[256];
+    memset(shift, needle_len, sizeof(shift));
+    for (uint32_t i = 0; i < needle_len - 1; i++)
+    {
+        shift[n[i]] = (uint8_t)(needle_len - 1 - i);
+    }
+
+    uint8_t last = n[needle_len - 1];
+    const uint8_t *end = h + hay_len - needle_len;
+    while (h <= end)
+    {
+        uint8_t ch = h[needle_len - 1];
+        if ((ch == last) && (memcmp(h, n, needle_len - 1) == 0))
         {
-            end++;
+            return (void *)h;
         }
+        h += shift[ch];
+    }
+    return NULL;
+}
 
-        // 终止子字符串
-        if (*end != '\0' || !strchr(stop, *end))
+// 最大后缀（is_reverse 为逆字典序），返回后缀起点 - 1，period 为其周期
+static inline uint32_t memfind_max_suffix(const uint8_t *n, uint32_t needle_len, bool is_reverse, uint32_t *period)
+{
+    uint32_t ms = UINT32_MAX, j = 0, k = 1, p = 1;
+    while (j + k < needle_len)
+    {
+        uint8_t a = n[j + k];
+        uint8_t b = n[ms + k];
+        if (is_reverse ? (a > b) : (a < b))
         {
-            *end = '\0';
-            end++;
+            j += k;
+            k = 1;
+            p = j - ms;
+        }
+        else if (a == b)
+        {
+            if (k != p)
+            {
+                k++;
+            }
+            else
+            {
+                j += p;
+                k = 1;
+            }
+        }
+        else
+        {
+            ms = j++;
+            k = p = 1;
         }
-
-        // 将子字符串的地址传给 argv
-        argv[count] = start;
-        count++;
-
-        // 移动到下一个子字符串的开始位置
-        start = end;
     }
+    *period = p;
+    return ms;
+}
 
-    *argc = count;
+// Two-Way 临界分解：正序、逆序最大后缀取靠后的，返回右半部分起点
+static uint32_t memfind_factorization(const uint8_t *n, uint32_t needle_len, uint32_t *period)
+{
+    uint32_t p, p_rev;
+    uint32_t ms = memfind_max_suffix(n, needle_len, false, &p);
+    uint32_t ms_rev = memfind_max_suffix(n, needle_len, true, &p_rev);
+    if (ms_rev + 1 < ms + 1)
+    {
+        *period = p;
+        return ms + 1;
+    }
+    *period = p_rev;
+    return ms_rev + 1;
 }
 
-// 字符串查找函数（指定长度）
-char *strnstr(const char *haystack, const char *needle, uint32_t hay_len, uint32_t needle_len)
+/**
+ * Two-Way：先按窗口末字节查 Horspool 跳转，末字节吻合时从临界位置向右比、再向左比；
+ * 周期串记住已匹配的前缀避免回退，整体最坏线性
+ */
+static void *memfind_two_way(const uint8_t *h, uint32_t hay_len, const uint8_t *n, uint32_t needle_len)
 {
-    if (needle_len == 0)
-        return (char *)haystack;
-    if (hay_len == 0 || hay_len < needle_len)
-        return NULL;
+    uint8_t shift[256];
+    memset(shift, (needle_len < UINT8_MAX) ? needle_len : UINT8_MAX, sizeof(shift));
+    for (uint32_t i = 0; i < needle_len; i++)
+    {
+        uint32_t distance = needle_len - 1 - i;
+        shift[n[i]] = (distance < UINT8_MAX) ? (uint8_t)distance : UINT8_MAX; // 超过 255 按 255 跳，仍安全
+    }
 
-    const char *end = haystack + hay_len - needle_len;
-    for (; haystack <= end; haystack++)
+    uint32_t period;
+    uint32_t suffix = memfind_factorization(n, needle_len, &period);
+    uint32_t j = 0;
+
+    if (memcmp(n, n + period, suffix) == 0)
     {
-        if (strncmp(haystack, needle, needle_len) == 0)
+        uint32_t memory = 0;
+        while (j <= hay_len - needle_len)
         {
-            return (char *)haystack;
+            uint32_t step = shift[h[j + needle_len - 1]];
+            if (step > 0)
+            {
+                if (memory && (step < period) && (step < UINT8_MAX))
+                {
+                    step = needle_len - period;
+                }
+                memory = 0;
+                j += step;
+                continue;
+            }
+            uint32_t i = (suffix > memory) ? suffix : memory;
+            while ((i < needle_len - 1) && (n[i] == h[i + j]))
+            {
+                i++;
+            }
+            if (i < needle_len - 1)
+            {
+                j += i - suffix + 1;
+                memory = 0;
+                continue;
+            }
+            i = suffix - 1;
+            while ((memory < i + 1) && (n[i] == h[i + j]))
+            {
+                i--;
+            }
+            if (i + 1 < memory + 1)
+            {
+                return (void *)(h + j);
+            }
+            j += period;
+            memory = needle_len - period;
+        }
+    }
+    else
+    {
+        period = ((suffix > needle_len - suffix) ? suffix : needle_len - suffix) + 1;
+        while (j <= hay_len - needle_len)
+        {
+            uint32_t step = shift[h[j + needle_len - 1]];
+            if (step > 0)
+            {
+                j += step;
+                continue;
+            }
+            uint32_t i = suffix;
+            while ((i < needle_len - 1) && (n[i] == h[i + j]))
+            {
+                i++;
+            }
+            if (i < needle_len - 1)
+            {
+                j += i - suffix + 1;
+                continue;
+            }
+            i = suffix - 1;
+            while ((i != UINT32_MAX) && (n[i] == h[i + j]))
+            {
+                i--;
+            }
+            if (i == UINT32_MAX)
+            {
+                return (void *)(h + j);
+            }
+            j += period;
         }
     }
     return NULL;
 }
 
+// 内存块查找
+void *memfind(const void *haystack, uint32_t hay_len, const void *needle, uint32_t needle_len)
+{
+    const uint8_t *h = (const uint8_t *)haystack;
+    const uint8_t *n = (const uint8_t *)needle;
+
+    if (needle_len == 0)
+        return (void *)haystack;
+    if (hay_len < needle_len)
+        return NULL;
+    if (needle_len == 1)
+        return memchr(h, n[0], hay_len);
+    if (needle_len <= 4)
+        return memfind_short(h, hay_len, n, needle_len);
+    if (needle_len <= STR_HORSPOOL_MAX)
+        return memfind_horspool(h, hay_len, n, needle_len);
+    return memfind_two_way(h, hay_len, n, needle_len);
+}
+
+// 字符串查找函数（指定长度）
+char *strnstr(const char *haystack, const char *needle, uint32_t hay_len, uint32_t needle_len)
+{
+    return (char *)memfind(haystack, hay_len, needle, needle_len);
+}
+
+typedef uint32_t __attribute__((may_alias)) str_word_t; // 按字读取字符串
+
 // 计算两个字符串的相同部分的长度
 uint32_t strlen_common(const char *str1, const char *str2)
 {
-    uint32_t len1 = strlen(str1);
-    uint32_t len2 = strlen(str2);
-    uint32_t min_len = len1 < len2 ? len1 : len2; // 取两个字符串长度的最小值
+    const char *start = str1;
 
-    uint32_t common_length = 0;
-    // 逐个字符比较直到遇到不同的字符或其中一个字符串结束
-    for (uint32_t i = 0; i < min_len; i++)
+    // 同对齐时按字比较：先逐字节对齐，之后每次读整字不会越过结束符所在的字
+    if ((((uintptr_t)str1 ^ (uintptr_t)str2) & 3) == 0)
     {
-        if (str1[i] == str2[i])
+        while (((uintptr_t)str1 & 3) && (*str1 != '\0') && (*str1 == *str2))
         {
-            common_length++;
+            str1++;
+            str2++;
         }
-        else
+        if (((uintptr_t)str1 & 3) == 0)
         {
-            break;
+            const str_word_t *w1 = (const str_word_t *)str1;
+            const str_word_t *w2 = (const str_word_t *)str2;
+            while ((*w1 == *w2) && (((*w1 - 0x01010101u) & ~*w1 & 0x80808080u) == 0))
+            {
+                w1++;
+                w2++;
+            }
+            str1 = (const char *)w1;
+            str2 = (const char *)w2;
         }
     }
-    return common_length;
+
+    // 逐个字符比较直到遇到不同的字符或其中一个字符串结束
+    while ((*str1 != '\0') && (*str1 == *str2))
+    {
+        str1++;
+        str2++;
+    }
+    return (uint32_t)(str1 - start);
 }
@@ -2,8 +2,12 @@
  * @file string.h
  * @author WittXie
  * @brief 字符串处理
- * @version 0.1
+ * @version 0.2
  * @date 2023-03-30
+ * @note
+ * 子串查找 memfind/strnstr：needle 1 字节用 memchr，2~4 字节用滑动字比较，
+ * <= STR_HORSPOOL_MAX 字节用 Horspool（256字节跳转表），更长的用 Two-Way（常数空间、最坏线性）；
+ * 分割函数用 256 位字符类表（charset_t）单遍扫描；strlen_common 两串同对齐时按字比较。
  *
  * @copyright Copyright (c) 2023
  *
@@ -18,9 +22,13 @@
 #include <string.h>
 
 #include "./ascii.h"
+#include "./base64.h"
+#include "./fmt.h"
 #include "./hex.h"
 
 // 配置
+#define STR_HORSPOOL_MAX 32 // Horspool 最长 needle，更长的用 Two-Way
+
 // 字符串操作工具
 #define __DEFINE_TO_STR(R) #R
 #define DEFINE_TO_STR(R) __DEFINE_TO_STR(R) // 宏定义转字符串
@@ -31,6 +39,15 @@
 #define __STRCAT_3(STR1, STR2, STR3) STR1##STR2##STR3
 #define STRCAT_3(STR1, STR2, STR3) __STRCAT_3(STR1, STR2, STR3) // 字符串拼接
 
+// 256 位字符类表
+typedef struct
+{
+    uint32_t bits[8];
+} charset_t;
+
+#define charset_add(_set, _ch) ((_set)->bits[(uint8_t)(_ch) >> 5] |= 1u << ((uint8_t)(_ch) & 31))
+#define charset_has(_set, _ch) (((_set)->bits[(uint8_t)(_ch) >> 5] >> ((uint8_t)(_ch) & 31)) & 1u)
+
 // 是否为汉字
 #define is_zh(_ch) (((~(_ch >> 8) == 0) || (_ch == ' ')) ? 0 : 1)
 
@@ -128,7 +145,8 @@ void split_string(char *str, char delimiter, char *argv[], uint32_t *argc);
 
 /**
  * 将字符串分割为参数列表，并存储到argv中，同时更新argc。
- * @param buff 存储参数字符串的缓冲区
+ * 分隔符与忽略字符都视为间隔，遇到停止字符（任意位置）结束。
+ * @param buff 存储参数字符串的缓冲区，至少 strlen(str)+1
  * @param str 待处理的字符串
  * @param delimiters 参数的分隔符字符串
  * @param ignores 要忽略的字符字符串
@@ -139,7 +157,26 @@ void split_string(char *str, char delimiter, char *argv[], uint32_t *argc);
 void split_string_to_buff(char *buff, const char *str, const char *delimiters, const char *ignores, const char *stop, char *argv[], uint32_t *argc);
 
 /**
- * @brief 字符串查找函数（指定长度）
+ * @brief 初始化字符类表
+ *
+ * @param set 字符类表
+ * @param chars 字符集合，可为 NULL
+ */
+void charset_init(charset_t *set, const char *chars);
+
+/**
+ * @brief 内存块查找，同 GNU memmem
+ *
+ * @param haystack 被查找数据
+ * @param hay_len 被查找数据长度
+ * @param needle 查找数据
+ * @param needle_len 查找数据长度
+ * @return void* 首次出现的地址，未找到返回 NULL
+ */
+void *memfind(const void *haystack, uint32_t hay_len, const void *needle, uint32_t needle_len);
+
+/**
+ * @brief 字符串查找函数（指定长度），按字节比较，同 memfind
  *
  * @param haystack 字符串
  * @param needle 查找字符串
@@ -0,0 +1,128 @@
+#include "./profile.h"
+
+#include <math.h>
+
+static profile_t *s_profile_head = NULL; // 统计点链表
+
+// log2直方图格号
+static inline uint32_t profile_hist_index(uint32_t cycles)
+{
+    return (cycles == 0) ? 0 : (31u - __builtin_clz(cycles));
+}
+
+// 记录一次耗时
+void profile_record(profile_t *profile, uint32_t cycles)
+{
+    if (!profile->is_registered)
+    {
+        CRITICAL_ENTER();
+        if (!profile->is_registered)
+        {
+            profile->min = UINT32_MAX;
+            profile->next = s_profile_head;
+            s_profile_head = profile;
+            profile->is_registered = true;
+        }
+        CRITICAL_EXIT();
+    }
+
+    profile->count++;
+    profile->sum += cycles;
+    if (cycles < profile->min)
+    {
+        profile->min = cycles;
+    }
+    if (cycles > profile->max)
+    {
+        profile->max = cycles;
+    }
+    profile->hist[profile_hist_index(cycles)]++;
+
+    // Welford 在线方差
+    float delta = (float)cycles - profile->mean;
+    profile->mean += delta / (float)profile->count;
+    profile->m2 += delta * ((float)cycles - profile->mean);
+}
+
+// 清空
+void profile_reset(void)
+{
+    CRITICAL_ENTER();
+    for (profile_t *profile = s_profile_head; profile != NULL; profile = profile->next)
+    {
+        profile->count = 0;
+        profile->min = UINT32_MAX;
+        profile->max = 0;
+        profile->sum = 0;
+        profile->mean = 0;
+        profile->m2 = 0;
+        memset(profile->hist, 0, sizeof(profile->hist));
+    }
+    CRITICAL_EXIT();
+}
+
+// 标准差
+float profile_stddev(const profile_t *profile)
+{
+    if (profile->count < 2)
+    {
+        return 0;
+    }
+    return sqrtf(profile->m2 / (float)(profile->count - 1));
+}
+
+// 链表按总耗时从大到小插入排序
+static void profile_sort(void)
+{
+    CRITICAL_ENTER();
+    profile_t *sorted = NULL;
+    profile_t *profile = s_profile_head;
+    while (profile != NULL)
+    {
+        profile_t *next = profile->next;
+        profile_t **pos = &sorted;
+        while (*pos != NULL && (*pos)->sum >= profile->sum)
+        {
+            pos = &(*pos)->next;
+        }
+        profile->next = *pos;
+        *pos = profile;
+        profile = next;
+    }
+    s_profile_head = sorted;
+    CRITICAL_EXIT();
+}
+
+// 周期数换算为纳秒
+#define PROFILE_NS(_cycles) ((float)(_cycles) * 1e9f / (float)PROFILE_CYCLES_FREQ())
+
+// 打印
+void profile_dump(bool is_hist)
+{
+    profile_sort();
+
+    PRINT("%-24s %10s %10s %10s %10s %10s %12s\r\n", "name", "count", "min(ns)", "mean(ns)", "max(ns)", "std(ns)", "total(us)");
+    for (profile_t *profile = s_profile_head; profile != NULL; profile = profile->next)
+    {
+        if (profile->count == 0)
+        {
+            continue;
+        }
+        PRINT("%-24s %10u %10.0f %10.0f %10.0f %10.0f %12.1f\r\n",
+              profile->name, profile->count,
+              PROFILE_NS(profile->min), PROFILE_NS(profile->mean), PROFILE_NS(profile->max),
+              PROFILE_NS(profile_stddev(profile)), PROFILE_NS(profile->sum) / 1000.0f);
+
+        if (!is_hist)
+        {
+            continue;
+        }
+        for (uint32_t i = 0; i < PROFILE_HIST_SIZE; i++)
+        {
+            if (profile->hist[i] != 0)
+            {
+                PRINT("    [%10.0f ns, %10.0f ns) %10u\r\n", PROFILE_NS(1ull << i), PROFILE_NS(2ull << i), profile->hist[i]);
+            }
+        }
+    }
+}
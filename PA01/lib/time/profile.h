@@ -0,0 +1,134 @@
+/**
+ * @file profile.h
+ * @author WittXie
+ * @brief 周期级性能统计：按代码位置聚合次数、最小/最大/均值/方差和log2直方图
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * PROFILE_ENABLE 为0时所有宏展开为空，不占代码和内存；
+ * 每个统计点是一个静态 profile_t，首次执行时挂入全局链表，profile_dump 按总耗时排序打印。
+ * 同一统计点不要同时在任务和中断中使用。
+ *
+ * 用法:
+ *  PROFILE_SCOPE("disp_flush");  // 统计到当前作用域结束
+ *  PROFILE_BEGIN(adc_filter);    // 统计 BEGIN 到 END 之间
+ *  ...
+ *  PROFILE_END(adc_filter);
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef PROFILE_ENABLE
+#define PROFILE_ENABLE 0
+#endif
+
+#ifndef PRINT
+#define PRINT(_format, ...) ((void)0)
+#endif
+
+#ifndef CRITICAL_ENTER
+#define CRITICAL_ENTER() ((void)0)
+#define CRITICAL_EXIT() ((void)0)
+#endif
+
+// 周期计数器，主机端用 clock_gettime 的纳秒计数
+#ifndef PROFILE_CYCLES
+#include <time.h>
+static inline uint32_t profile_host_cycles(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec);
+}
+#define PROFILE_CYCLES() profile_host_cycles()
+#define PROFILE_CYCLES_FREQ() 1000000000u
+#endif
+
+#define PROFILE_HIST_SIZE 32 // log2直方图，第k格为 [2^k, 2^(k+1)) 个周期
+
+// 统计点
+typedef struct __profile
+{
+    const char *name;                 // 名称
+    uint32_t count;                   // 次数
+    uint32_t min;                     // 最小周期数
+    uint32_t max;                     // 最大周期数
+    uint64_t sum;                     // 总周期数
+    float mean;                       // 均值（Welford）
+    float m2;                         // 偏差平方和（Welford）
+    uint32_t hist[PROFILE_HIST_SIZE]; // log2直方图
+    struct __profile *next;           // 链表
+    bool is_registered;               // 是否已挂入链表
+} profile_t;
+
+// 作用域统计
+typedef struct __profile_scope
+{
+    profile_t *profile;
+    uint32_t start;
+} profile_scope_t;
+
+/**
+ * @brief 记录一次耗时
+ *
+ * @param profile 统计点
+ * @param cycles 周期数
+ */
+void profile_record(profile_t *profile, uint32_t cycles);
+
+/**
+ * @brief 清空所有统计点的数据
+ *
+ */
+void profile_reset(void);
+
+/**
+ * @brief 按总耗时从大到小打印统计表
+ *
+ * @param is_hist 是否打印直方图
+ */
+void profile_dump(bool is_hist);
+
+/**
+ * @brief 标准差（周期数）
+ *
+ * @param profile 统计点
+ * @return float 标准差
+ */
+float profile_stddev(const profile_t *profile);
+
+/**
+ * @brief 作用域结束回调，供 PROFILE_SCOPE 使用
+ *
+ * @param scope 作用域
+ */
+static inline void profile_scope_exit(profile_scope_t *scope)
+{
+    profile_record(scope->profile, PROFILE_CYCLES() - scope->start);
+}
+
+#define __PROFILE_CONCAT(_a, _b) _a##_b
+#define PROFILE_CONCAT(_a, _b) __PROFILE_CONCAT(_a, _b)
+
+#if PROFILE_ENABLE == 1
+#define PROFILE_SCOPE(_name)                                                                                    \
+    static profile_t PROFILE_CONCAT(__profile_, __LINE__) = {.name = (_name)};                                  \
+    profile_scope_t PROFILE_CONCAT(__profile_scope_, __LINE__) __attribute__((cleanup(profile_scope_exit))) = { \
+        .profile = &PROFILE_CONCAT(__profile_, __LINE__),                                                       \
+        .start = PROFILE_CYCLES(),                                                                              \
+    }
+#define PROFILE_BEGIN(_id)                             \
+    static profile_t __profile_##_id = {.name = #_id}; \
+    uint32_t __profile_start_##_id = PROFILE_CYCLES()
+#define PROFILE_END(_id) profile_record(&__profile_##_id, PROFILE_CYCLES() - __profile_start_##_id)
+#else
+#define PROFILE_SCOPE(_name) ((void)0)
+#define PROFILE_BEGIN(_id) ((void)0)
+#define PROFILE_END(_id) ((void)0)
+#endif
@@ -0,0 +1,229 @@
+#include "./soft_timer.h"
+
+// 交换堆中两个位置
+static inline void soft_timer_heap_swap(soft_timer_t **heap, uint32_t a, uint32_t b)
+{
+    soft_timer_t *temp = heap[a];
+    heap[a] = heap[b];
+    heap[b] = temp;
+    heap[a]->slot = a + 1;
+    heap[b]->slot = b + 1;
+}
+
+// 上浮
+static void soft_timer_heap_up(soft_timer_t **heap, uint32_t index)
+{
+    while (index > 0)
+    {
+        uint32_t parent = (index - 1) >> 1;
+        if (heap[parent]->deadline <= heap[index]->deadline)
+        {
+            break;
+        }
+        soft_timer_heap_swap(heap, parent, index);
+        index = parent;
+    }
+}
+
+// 下沉
+static void soft_timer_heap_down(soft_timer_t **heap, uint32_t count, uint32_t index)
+{
+    for (;;)
+    {
+        uint32_t left = (index << 1) + 1;
+        uint32_t min = index;
+        if (left < count && heap[left]->deadline < heap[min]->deadline)
+        {
+            min = left;
+        }
+        if (left + 1 < count && heap[left + 1]->deadline < heap[min]->deadline)
+        {
+            min = left + 1;
+        }
+        if (min == index)
+        {
+            break;
+        }
+        soft_timer_heap_swap(heap, min, index);
+        index = min;
+    }
+}
+
+// 入堆（临界区内调用）
+static bool soft_timer_heap_push(soft_timer_service_t *service, soft_timer_t *timer)
+{
+    if (service->count >= service->cfg.size)
+    {
+        return false;
+    }
+    uint32_t index = service->count++;
+    service->heap[index] = timer;
+    timer->slot = index + 1;
+    soft_timer_heap_up(service->heap, index);
+    return true;
+}
+
+// 出堆任意位置（临界区内调用）
+static void soft_timer_heap_remove(soft_timer_service_t *service, soft_timer_t *timer)
+{
+    uint32_t index = timer->slot - 1;
+    uint32_t last = --service->count;
+    timer->slot = 0;
+    if (index == last)
+    {
+        return;
+    }
+
+    service->heap[index] = service->heap[last];
+    service->heap[index]->slot = index + 1;
+    soft_timer_heap_down(service->heap, service->count, index);
+    soft_timer_heap_up(service->heap, index);
+}
+
+// 排程，堆顶变化时唤醒服务
+static bool soft_timer_schedule(soft_timer_service_t *service, soft_timer_t *timer, uint64_t deadline, uint64_t period)
+{
+    bool ret = true;
+    bool is_first;
+
+    CRITICAL_ENTER();
+    if (timer->slot != 0)
+    {
+        soft_timer_heap_remove(service, timer);
+    }
+    timer->deadline = deadline;
+    timer->period = period;
+    timer->overrun = 0;
+    ret = soft_timer_heap_push(service, timer);
+    is_first = ret && (timer->slot == 1);
+    CRITICAL_EXIT();
+
+    if (!ret)
+    {
+        ERROR("[%s] timer full, drop %s.", service->cfg.name, timer->name);
+    }
+    else if (is_first && service->ops.notify != NULL)
+    {
+        service->ops.notify();
+    }
+    return ret;
+}
+
+// 初始化服务
+void soft_timer_service_init(soft_timer_service_t *service)
+{
+    ASSERT(service != NULL);
+    ASSERT(service->cfg.name != NULL);
+    ASSERT(service->cfg.size != 0);
+    ASSERT(service->ops.now != NULL);
+
+    service->flag.value = 0;
+    service->count = 0;
+    service->heap = (soft_timer_t **)MALLOC(service->cfg.size * sizeof(soft_timer_t *));
+    if (service->heap == NULL)
+    {
+        ERROR("[%s] heap malloc failed.", service->cfg.name);
+        return;
+    }
+    memset(service->heap, 0, service->cfg.size * sizeof(soft_timer_t *));
+    service->flag.is_inited = true;
+}
+
+// 启动定时器
+bool soft_timer_start(soft_timer_service_t *service, soft_timer_t *timer, uint64_t delay_us, uint64_t period_us)
+{
+    ASSERT(service != NULL);
+    ASSERT(timer != NULL);
+    ASSERT(timer->callback != NULL);
+    if (!service->flag.is_inited)
+    {
+        return false;
+    }
+    return soft_timer_schedule(service, timer, service->ops.now() + delay_us, period_us);
+}
+
+// 停止定时器
+void soft_timer_stop(soft_timer_service_t *service, soft_timer_t *timer)
+{
+    ASSERT(service != NULL);
+    ASSERT(timer != NULL);
+
+    CRITICAL_ENTER();
+    if (timer->slot != 0)
+    {
+        soft_timer_heap_remove(service, timer);
+    }
+    CRITICAL_EXIT();
+}
+
+// 修改下一次到期时间
+bool soft_timer_reschedule(soft_timer_service_t *service, soft_timer_t *timer, uint64_t delay_us)
+{
+    ASSERT(service != NULL);
+    ASSERT(timer != NULL);
+    if (!service->flag.is_inited)
+    {
+        return false;
+    }
+    return soft_timer_schedule(service, timer, service->ops.now() + delay_us, timer->period);
+}
+
+// 处理所有到期的定时器
+uint64_t soft_timer_service_poll(soft_timer_service_t *service)
+{
+    ASSERT(service != NULL);
+
+    for (;;)
+    {
+        soft_timer_t *timer = NULL;
+        uint64_t now = service->ops.now();
+        uint64_t remain = SOFT_TIMER_WAIT_FOREVER;
+
+        CRITICAL_ENTER();
+        if (service->count != 0)
+        {
+            timer = service->heap[0];
+            if (timer->deadline > now)
+            {
+                remain = timer->deadline - now;
+                timer = NULL;
+            }
+            else if (timer->period != 0)
+            {
+                // 周期：按截止时间累加，错过的周期跳过
+                timer->deadline += timer->period;
+                if (timer->deadline <= now)
+                {
+                    uint64_t missed = (now - timer->deadline) / timer->period + 1;
+                    timer->overrun += missed;
+                    timer->deadline += missed * timer->period;
+                }
+                soft_timer_heap_down(service->heap, service->count, 0);
+            }
+            else
+            {
+                soft_timer_heap_remove(service, timer);
+            }
+        }
+        CRITICAL_EXIT();
+
+        if (timer == NULL)
+        {
+            return remain;
+        }
+        timer->callback(timer, timer->userdata); // 锁外执行，回调里可以启停定时器
+    }
+}
+
+// 服务循环
+void soft_timer_service_run(soft_timer_service_t *service)
+{
+    ASSERT(service != NULL);
+    ASSERT(service->ops.wait != NULL);
+
+    service->flag.is_running = service->flag.is_inited;
+    while (service->flag.is_running)
+    {
+        service->ops.wait(soft_timer_service_poll(service));
+    }
+}
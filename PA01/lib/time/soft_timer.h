@@ -0,0 +1,164 @@
+/**
+ * @file soft_timer.h
+ * @author WittXie
+ * @brief 软件定时器服务：按截止时间排序的最小堆，单个任务阻塞等待最近一次到期
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 替代 time_invoke/is_timeout 轮询：没有定时器到期时服务任务一直阻塞，不周期唤醒。
+ * 周期定时器按 上次截止时间+周期 排程，回调耗时不累积漂移；错过的周期直接跳过并计入 overrun。
+ * 启动/停止/重排 O(log n)，在任务中调用；回调在服务任务中执行，不持锁。
+ * 所有定时器共用一个小栈的服务任务并串行回调：回调只做置标志、发信号量等短操作，
+ * flash 写入、屏幕/外设初始化、创建 UI 对象等耗时或耗栈的工作交给所属任务处理，否则会栈溢出并推迟其它定时器。
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef ASSERT
+#define ASSERT(_bool, ...) ((void)0)
+#endif
+
+#ifndef MALLOC
+#define MALLOC(_size) malloc(_size)
+#define FREE(_pv) free(_pv)
+#endif
+
+#ifndef ERROR
+#define ERROR(_format, ...) ((void)0)
+#endif
+
+#ifndef CRITICAL_ENTER
+#define CRITICAL_ENTER() ((void)0)
+#define CRITICAL_EXIT() ((void)0)
+#endif
+
+#define SOFT_TIMER_WAIT_FOREVER UINT64_MAX // 没有定时器时的等待时长
+
+typedef struct __soft_timer soft_timer_t;
+
+/**
+ * @brief 定时器回调
+ * @param timer 定时器
+ * @param userdata 用户参数
+ */
+typedef void (*soft_timer_callback_t)(soft_timer_t *timer, void *userdata);
+
+// 定时器，全零即为未启动状态，可静态定义
+struct __soft_timer
+{
+    const char *name;               // 名称
+    soft_timer_callback_t callback; // 回调
+    void *userdata;                 // 用户参数
+
+    uint64_t deadline; // 截止时间（微秒）
+    uint64_t period;   // 周期（微秒），0为单次
+    uint32_t slot;     // 堆位置+1，0表示未启动
+    uint32_t overrun;  // 跳过的周期数
+};
+
+typedef struct __soft_timer_service
+{
+    // 参数
+    struct
+    {
+        const char *name; // 名称
+        uint32_t size;    // 最多同时运行的定时器个数
+    } cfg;
+
+    // 函数接口
+    struct
+    {
+        uint64_t (*now)(void);             // 读取时间戳（微秒）
+        void (*wait)(uint64_t timeout_us); // 阻塞等待超时或被通知
+        void (*notify)(void);              // 唤醒 wait，任务和中断中均可能调用
+    } ops;
+
+    // 标志
+    union
+    {
+        uint8_t value;
+        struct
+        {
+            bool is_inited : 1;  // 是否已初始化
+            bool is_running : 1; // 服务是否在运行
+        };
+    } flag;
+
+    soft_timer_t **heap;     // 最小堆
+    volatile uint32_t count; // 运行中的定时器个数
+} soft_timer_service_t;
+
+/**
+ * @brief 初始化服务
+ *
+ * @param service 服务指针
+ */
+void soft_timer_service_init(soft_timer_service_t *service);
+
+/**
+ * @brief 处理所有到期的定时器
+ *
+ * @param service 服务指针
+ * @return uint64_t 距离下一次到期的时间（微秒），没有定时器时返回 SOFT_TIMER_WAIT_FOREVER
+ */
+uint64_t soft_timer_service_poll(soft_timer_service_t *service);
+
+/**
+ * @brief 服务循环，在服务任务中调用，不返回
+ *
+ * @param service 服务指针
+ */
+void soft_timer_service_run(soft_timer_service_t *service);
+
+/**
+ * @brief 启动定时器，已启动的定时器按新参数重新排程
+ *
+ * @param service 服务指针
+ * @param timer 定时器
+ * @param delay_us 首次到期延时（微秒）
+ * @param period_us 周期（微秒），0为单次
+ * @return true 成功
+ * @return false 定时器已满
+ */
+bool soft_timer_start(soft_timer_service_t *service, soft_timer_t *timer, uint64_t delay_us, uint64_t period_us);
+
+/**
+ * @brief 停止定时器，未启动时无操作
+ *
+ * @param service 服务指针
+ * @param timer 定时器
+ */
+void soft_timer_stop(soft_timer_service_t *service, soft_timer_t *timer);
+
+/**
+ * @brief 修改下一次到期时间，保留周期；未启动时按单次启动
+ *
+ * @param service 服务指针
+ * @param timer 定时器
+ * @param delay_us 距今延时（微秒）
+ * @return true 成功
+ * @return false 定时器已满
+ */
+bool soft_timer_reschedule(soft_timer_service_t *service, soft_timer_t *timer, uint64_t delay_us);
+
+/**
+ * @brief 定时器是否运行中
+ *
+ * @param _timer 定时器
+ */
+#define soft_timer_is_active(_timer) ((_timer)->slot != 0)
+
+/**
+ * @brief 服务是否初始化/运行
+ *
+ * @param _service 服务指针
+ */
+#define soft_timer_service_is_inited(_service) ((_service)->flag.is_inited)
+#define soft_timer_service_is_running(_service) ((_service)->flag.is_running)
@@ -7,6 +7,20 @@ void time_init(vtime_t *time)
     time->timestamp_letf = 0;
     time->ops.init();
 
+    // 快速路径: 预计算倒数，锚点最长有效半个回绕周期
+    time->fast.seq = 0;
+    if (time->ops.cycles != NULL && time->cfg.cycles_freq != 0)
+    {
+        time->fast.mult = (uint32_t)((1000000ull << 32) / time->cfg.cycles_freq);
+        time->fast.cycles_max = 0x80000000u;
+        time_fast_sync(time);
+    }
+    else
+    {
+        time->fast.mult = 0;
+        time->fast.cycles_max = 0;
+    }
+
     time->timestamp_startup = timestamp_us_get(time); // 获取启动时间
 }
 
@@ -19,7 +33,83 @@ void time_hook(vtime_t *time)
 // 获取时间戳
 uint64_t timestamp_us_get(vtime_t *time)
 {
-    return (time->timestamp_letf << time->cfg.timer_bits) | time->ops.read();
+    uint64_t high;
+    uint32_t low;
+
+    // 高位在两次读取之间变化（溢出中断已执行，或64位读被打断）则重读
+    do
+    {
+        high = time->timestamp_letf;
+        low = time->ops.read();
+
+        // 溢出已发生但中断尚未执行（关中断或更高优先级中断中调用）
+        if (time->ops.is_overflow != NULL && time->ops.is_overflow())
+        {
+            low = time->ops.read();
+            high++;
+            break;
+        }
+    } while (high != time->timestamp_letf);
+
+    return (high << time->cfg.timer_bits) | low;
+}
+
+// 快速路径锚点同步
+void time_fast_sync(vtime_t *time)
+{
+    if (time->fast.mult == 0)
+    {
+        return;
+    }
+
+    // 两次采样之间被打断会让锚点错开被打断的时长，关中断采样，并与其它调用者互斥
+    CRITICAL_ENTER();
+    uint32_t cycles = time->ops.cycles();
+    uint64_t us = timestamp_us_get(time);
+
+    time->fast.seq++; // 奇数：更新中
+    __DMB();
+    time->fast.cycles = cycles;
+    time->fast.us = us;
+    __DMB();
+    time->fast.seq++; // 偶数：更新完成
+    CRITICAL_EXIT();
+}
+
+// 快速获取时间戳
+uint64_t timestamp_us_fast_get(vtime_t *time)
+{
+    if (time->fast.mult == 0)
+    {
+        return timestamp_us_get(time);
+    }
+
+    uint32_t seq, cycles;
+    uint64_t us;
+    uint32_t retry = 0;
+    for (;;)
+    {
+        seq = time->fast.seq;
+        __DMB();
+        cycles = time->fast.cycles;
+        us = time->fast.us;
+        __DMB();
+        if (!(seq & 1u) && seq == time->fast.seq)
+        {
+            break;
+        }
+        if (++retry >= TIME_FAST_RETRY)
+        {
+            return timestamp_us_get(time); // 锚点一直在更新（如更新方被挂起），不死等
+        }
+    }
+
+    uint32_t delta = time->ops.cycles() - cycles;
+    if (delta >= time->fast.cycles_max)
+    {
+        return timestamp_us_get(time); // 锚点过期
+    }
+    return us + (((uint64_t)delta * time->fast.mult) >> 32);
 }
 
 // 获取当前日期
@@ -33,5 +123,6 @@ void current_date_set(vtime_t *time, const vdate_t *date)
 {
     uint64_t timestamp = date_to_timestamp(date);
     time->timestamp_letf = timestamp >> time->cfg.timer_bits;
-    time->ops.write(timestamp & ((1 << time->cfg.timer_bits) - 1));
+    time->ops.write(timestamp & (((uint64_t)1 << time->cfg.timer_bits) - 1));
+    time_fast_sync(time);
 }
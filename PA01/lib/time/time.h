@@ -21,6 +21,17 @@
 #define ASSERT(_bool, ...) ((void)0)
 #endif
 
+#ifndef __DMB
+#define __DMB() ((void)0)
+#endif
+
+#ifndef CRITICAL_ENTER
+#define CRITICAL_ENTER() ((void)0)
+#define CRITICAL_EXIT() ((void)0)
+#endif
+
+#define TIME_FAST_RETRY 4 // 快速路径读锚点的最多重试次数，仍读不到一致的锚点则走慢路径
+
 // 日期时间结构体
 typedef struct __date
 {
@@ -38,7 +49,8 @@ typedef struct __time_t
 {
     struct
     {
-        uint8_t timer_bits; // 计时器位数
+        uint8_t timer_bits;   // 计时器位数
+        uint32_t cycles_freq; // 周期计数器频率（Hz），0表示不使用快速路径
     } cfg;
 
     struct
@@ -46,18 +58,64 @@ typedef struct __time_t
         void (*init)(void);
         uint32_t (*read)(void);            // 读取定时器时间戳
         void (*write)(uint32_t timer_cnt); // 写入定时器时间戳
+        bool (*is_overflow)(void);         // 可选：溢出中断是否挂起未处理
+        uint32_t (*cycles)(void);          // 可选：读取自由运行的周期计数器（如DWT->CYCCNT）
     } ops;
 
-    uint64_t timestamp_letf;    // 时间戳高位（微秒为单位）
-    uint64_t timestamp_startup; // 开机时间戳（微秒为单位）
+    volatile uint64_t timestamp_letf; // 时间戳高位（微秒为单位）
+    uint64_t timestamp_startup;       // 开机时间戳（微秒为单位）
+
+    // 快速路径：周期计数器 + 锚点，seqlock保护
+    struct
+    {
+        volatile uint32_t seq;    // 序号，奇数表示正在更新
+        volatile uint32_t cycles; // 锚点周期计数
+        volatile uint64_t us;     // 锚点时间戳
+        uint32_t mult;            // 微秒换算倒数: us = (cycles * mult) >> 32
+        uint32_t cycles_max;      // 锚点最大有效跨度（周期）
+    } fast;
 } vtime_t;
 
 /**
- * @brief 获取时间戳
+ * @brief 获取时间戳（双读校验高位，任务/中断中均可调用）
  * @return uint64_t 获取us级时间戳
  */
 uint64_t timestamp_us_get(vtime_t *time);
 
+/**
+ * @brief 快速获取时间戳：周期计数器增量乘以预计算倒数，不访问外设定时器
+ * @note 锚点过期（超过 fast.cycles_max）、锚点正在更新（重试 TIME_FAST_RETRY 次仍不一致）或未配置周期计数器时退回 timestamp_us_get
+ *
+ * @param time 时间设备指针
+ * @return uint64_t 获取us级时间戳
+ */
+uint64_t timestamp_us_fast_get(vtime_t *time);
+
+/**
+ * @brief 快速路径锚点同步，需周期调用（间隔小于周期计数器回绕时间的一半）
+ * @note 关中断采样周期计数与时间戳，两者对应同一时刻
+ *
+ * @param time 时间设备指针
+ */
+void time_fast_sync(vtime_t *time);
+
+/**
+ * @brief 读取周期计数器（性能分析用），两次读数相减即为耗时周期
+ *
+ * @param time 时间设备指针
+ * @return uint32_t 周期计数，未配置时返回0
+ */
+#define timestamp_cycles_get(_time) (((_time)->ops.cycles != NULL) ? (_time)->ops.cycles() : 0u)
+
+/**
+ * @brief 周期数换算为纳秒
+ *
+ * @param _time 时间设备指针
+ * @param _cycles 周期数
+ * @return uint64_t 纳秒
+ */
+#define time_cycles_to_ns(_time, _cycles) (((uint64_t)(_cycles) * 1000000000ull) / (_time)->cfg.cycles_freq)
+
 /**
  * @brief 时间钩子函数
  *
@@ -180,3 +238,4 @@ uint64_t date_to_num(const vdate_t *date);
 
 // 加载其他文件
 #include "./nop.h"
+#include "./profile.h"
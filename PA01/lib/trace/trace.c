@@ -0,0 +1,188 @@
+#include "./trace.h"
+
+// 初始化
+void trace_init(trace_t *trace)
+{
+    ASSERT(trace != NULL);
+    ASSERT(trace->cfg.name != NULL);
+    ASSERT(trace->cfg.buff_size != 0);
+    ASSERT((trace->cfg.buff_size & (trace->cfg.buff_size - 1)) == 0); // 2的幂
+    ASSERT(trace->ops.cycles != NULL);
+
+    trace->flag.value = 0;
+    trace->head = 0;
+    trace->count = 0;
+    trace->mask = trace->cfg.buff_size - 1;
+
+    // 内存申请
+    trace->events = MALLOC(trace->cfg.buff_size * sizeof(trace_event_t));
+    trace->names = MALLOC(trace->cfg.name_size * sizeof(const char *));
+    trace->tasks = MALLOC(trace->cfg.task_size * sizeof(const char *));
+    if (trace->events == NULL || trace->names == NULL || trace->tasks == NULL)
+    {
+        ERROR("[%s] malloc failed.", trace->cfg.name);
+        if (trace->events != NULL)
+        {
+            FREE(trace->events);
+            trace->events = NULL;
+        }
+        if (trace->names != NULL)
+        {
+            FREE(trace->names);
+            trace->names = NULL;
+        }
+        if (trace->tasks != NULL)
+        {
+            FREE(trace->tasks);
+            trace->tasks = NULL;
+        }
+        return;
+    }
+    memset(trace->events, 0, trace->cfg.buff_size * sizeof(trace_event_t));
+    memset(trace->names, 0, trace->cfg.name_size * sizeof(const char *));
+    memset(trace->tasks, 0, trace->cfg.task_size * sizeof(const char *));
+
+    trace->count = 1; // 跳过 TRACE_ID_NONE
+    trace->flag.is_inited = true;
+}
+
+// 开始/停止记录
+void trace_enable(trace_t *trace, bool is_running)
+{
+    ASSERT(trace != NULL);
+    trace->flag.is_running = is_running && trace->flag.is_inited;
+}
+
+// 清空事件
+void trace_clear(trace_t *trace)
+{
+    ASSERT(trace != NULL);
+    trace->head = 0;
+}
+
+// 注册用户名称
+uint16_t trace_name_register(trace_t *trace, const char *name)
+{
+    if (!trace->flag.is_inited)
+    {
+        return TRACE_ID_NONE;
+    }
+
+    // 同名复用
+    uint16_t count = trace->count;
+    for (uint16_t i = 1; i < count; i++)
+    {
+        if (trace->names[i] == name || (trace->names[i] != NULL && strcmp(trace->names[i], name) == 0))
+        {
+            return i;
+        }
+    }
+
+    uint16_t id = __atomic_fetch_add(&trace->count, 1u, __ATOMIC_RELAXED);
+    if (id >= trace->cfg.name_size)
+    {
+        trace->count = trace->cfg.name_size;
+        return TRACE_ID_NONE;
+    }
+    trace->names[id] = name;
+    return id;
+}
+
+// 设置任务名称
+void trace_task_name_set(trace_t *trace, uint16_t id, const char *name)
+{
+    if (!trace->flag.is_inited || id >= trace->cfg.task_size)
+    {
+        return;
+    }
+    trace->tasks[id] = name;
+}
+
+// 导出名称表
+static void trace_dump_names(const char **names, uint16_t size, void (*write)(uint8_t *buff, uint32_t length))
+{
+    for (uint16_t i = 0; i < size; i++)
+    {
+        if (names[i] == NULL)
+        {
+            continue;
+        }
+        uint32_t length = strlen(names[i]);
+        if (length > 0xFF)
+        {
+            length = 0xFF;
+        }
+        uint8_t head[3] = {i & 0xFF, (i >> 8) & 0xFF, (uint8_t)length};
+        write(head, sizeof(head));
+        write((uint8_t *)names[i], length);
+    }
+}
+
+// 统计名称表有效项
+static uint16_t trace_names_count(const char **names, uint16_t size)
+{
+    uint16_t count = 0;
+    for (uint16_t i = 0; i < size; i++)
+    {
+        if (names[i] != NULL)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+// 导出
+uint32_t trace_dump(trace_t *trace, void (*write)(uint8_t *buff, uint32_t length))
+{
+    ASSERT(trace != NULL);
+    ASSERT(write != NULL);
+
+    if (!trace->flag.is_inited)
+    {
+        return 0;
+    }
+
+    // 暂停记录
+    bool is_running = trace->flag.is_running;
+    trace->flag.is_running = false;
+
+    uint32_t head = trace->head;
+    uint32_t count = (head > trace->cfg.buff_size) ? trace->cfg.buff_size : head;
+    uint32_t lost = head - count;
+    uint16_t name_count = trace_names_count(trace->names, trace->cfg.name_size);
+    uint16_t task_count = trace_names_count(trace->tasks, trace->cfg.task_size);
+
+    // 头
+    uint8_t header[24] = {'V', 'T', 'R', 'C'};
+    uint16_t version = TRACE_VERSION;
+    uint16_t event_size = sizeof(trace_event_t);
+    memcpy(&header[4], &version, 2);
+    memcpy(&header[6], &event_size, 2);
+    memcpy(&header[8], &trace->cfg.cycles_freq, 4);
+    memcpy(&header[12], &count, 4);
+    memcpy(&header[16], &lost, 4);
+    memcpy(&header[20], &name_count, 2);
+    memcpy(&header[22], &task_count, 2);
+    write(header, sizeof(header));
+
+    // 名称
+    trace_dump_names(trace->names, trace->cfg.name_size, write);
+    trace_dump_names(trace->tasks, trace->cfg.task_size, write);
+
+    // 事件：从最旧开始，按回绕分两段
+    uint32_t start = (head - count) & trace->mask;
+    uint32_t part1 = trace->cfg.buff_size - start;
+    if (part1 > count)
+    {
+        part1 = count;
+    }
+    write((uint8_t *)&trace->events[start], part1 * sizeof(trace_event_t));
+    if (count > part1)
+    {
+        write((uint8_t *)&trace->events[0], (count - part1) * sizeof(trace_event_t));
+    }
+
+    trace->flag.is_running = is_running;
+    return count;
+}
@@ -0,0 +1,210 @@
+/**
+ * @file trace.h
+ * @author WittXie
+ * @brief 事件追踪：无锁环形事件缓存，记录任务切换、中断、DDS发布和用户标记
+ * @version 0.1
+ * @date 2026-10-19
+ * @note
+ * 每个核一个 trace_t，缓存写满后覆盖最旧事件；
+ * 记录只做一次原子自增和12字节写入，不加锁、不关中断，任务和中断中均可调用；
+ * trace_dump 导出二进制流，主机端 tools/trace/trace2json.py 转为 Chrome trace / Perfetto 可读的 JSON。
+ *
+ * 导出格式（小端）:
+ * header : magic[4]="VTRC" version(u16) event_size(u16) cycles_freq(u32) event_count(u32) lost(u32) name_count(u16) task_count(u16)
+ * names  : name_count * { id(u16) length(u8) char[length] }
+ * tasks  : task_count * { id(u16) length(u8) char[length] }
+ * events : event_count * trace_event_t，按时间由旧到新
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef MALLOC
+#define MALLOC(_size) malloc(_size)
+#define FREE(_pv) free(_pv)
+#endif
+
+#ifndef ASSERT
+#define ASSERT(_bool, ...) ((void)0)
+#endif
+
+#ifndef ERROR
+#define ERROR(_format, ...) ((void)0)
+#endif
+
+#define TRACE_VERSION 1
+#define TRACE_ID_NONE 0 // 0号名称保留
+
+// 事件类型
+enum trace_type
+{
+    TRACE_TYPE_NONE = 0,
+    TRACE_TYPE_TASK_IN,   // 任务切入，id=任务号
+    TRACE_TYPE_TASK_OUT,  // 任务切出，id=任务号
+    TRACE_TYPE_ISR_ENTER, // 中断进入，id=中断号
+    TRACE_TYPE_ISR_EXIT,  // 中断退出，id=中断号
+    TRACE_TYPE_DDS_BEGIN, // DDS发布开始，arg=主题地址
+    TRACE_TYPE_DDS_END,   // DDS发布结束，arg=主题地址
+    TRACE_TYPE_BEGIN,     // 用户区间开始，id=名称号
+    TRACE_TYPE_END,       // 用户区间结束，id=名称号
+    TRACE_TYPE_COUNTER,   // 用户计数器，id=名称号，arg=数值
+    TRACE_TYPE_INSTANT,   // 用户瞬时事件，id=名称号，arg=参数
+};
+
+#pragma pack(4)
+// 事件：12字节
+typedef struct __trace_event
+{
+    uint32_t cycles; // 周期计数时间戳
+    uint8_t type;    // 事件类型 enum trace_type
+    uint8_t core;    // 核号
+    uint16_t id;     // 任务号/中断号/名称号
+    uint32_t arg;    // 参数
+} trace_event_t;
+#pragma pack()
+
+typedef struct __trace
+{
+    // 参数
+    struct
+    {
+        const char *name;     // 名称
+        uint32_t buff_size;   // 事件个数，必须为2的幂
+        uint16_t name_size;   // 用户名称表大小
+        uint16_t task_size;   // 任务名称表大小
+        uint8_t core;         // 核号
+        uint32_t cycles_freq; // 周期计数器频率（Hz）
+    } cfg;
+
+    // 函数接口
+    struct
+    {
+        uint32_t (*cycles)(void); // 读取周期计数器
+    } ops;
+
+    // 标志
+    union
+    {
+        uint8_t value;
+        struct
+        {
+            bool is_inited : 1;  // 是否已初始化
+            bool is_running : 1; // 是否正在记录
+        };
+    } flag;
+
+    trace_event_t *events;   // 事件缓存
+    volatile uint32_t head;  // 已写入事件总数（自增，取模得槽位）
+    uint32_t mask;           // 槽位掩码
+    const char **names;      // 用户名称表
+    volatile uint16_t count; // 已注册名称数
+    const char **tasks;      // 任务名称表
+} trace_t;
+
+/**
+ * @brief 初始化
+ *
+ * @param trace 追踪器指针
+ */
+void trace_init(trace_t *trace);
+
+/**
+ * @brief 开始/停止记录
+ *
+ * @param trace 追踪器指针
+ * @param is_running 是否记录
+ */
+void trace_enable(trace_t *trace, bool is_running);
+
+/**
+ * @brief 清空事件
+ *
+ * @param trace 追踪器指针
+ */
+void trace_clear(trace_t *trace);
+
+/**
+ * @brief 注册用户名称
+ *
+ * @param trace 追踪器指针
+ * @param name 名称（必须是常量字符串）
+ * @return uint16_t 名称号，失败返回 TRACE_ID_NONE
+ */
+uint16_t trace_name_register(trace_t *trace, const char *name);
+
+/**
+ * @brief 设置任务名称，导出前调用
+ *
+ * @param trace 追踪器指针
+ * @param id 任务号
+ * @param name 任务名
+ */
+void trace_task_name_set(trace_t *trace, uint16_t id, const char *name);
+
+/**
+ * @brief 导出事件，导出期间暂停记录
+ *
+ * @param trace 追踪器指针
+ * @param write 输出接口：串口/USB/SD卡文件
+ * @return uint32_t 导出的事件数
+ */
+uint32_t trace_dump(trace_t *trace, void (*write)(uint8_t *buff, uint32_t length));
+
+/**
+ * @brief 记录一个事件
+ *
+ * @param trace 追踪器指针
+ * @param type 事件类型
+ * @param id 任务号/中断号/名称号
+ * @param arg 参数
+ */
+static inline void trace_record(trace_t *trace, uint8_t type, uint16_t id, uint32_t arg)
+{
+    if (!trace->flag.is_running)
+    {
+        return;
+    }
+
+    uint32_t cycles = trace->ops.cycles(); // 先取时间戳再占位，被打断时只会相邻小幅倒序，不会晚于后占位的事件一整段
+    uint32_t index = __atomic_fetch_add(&trace->head, 1u, __ATOMIC_RELAXED); // 单条LDREX/STREX循环
+    trace_event_t *event = &trace->events[index & trace->mask];
+    event->cycles = cycles;
+    event->type = type;
+    event->core = trace->cfg.core;
+    event->id = id;
+    event->arg = arg;
+}
+
+/**
+ * @brief 用户区间/计数器标记，名称在首次执行时注册
+ *
+ * @param _trace 追踪器指针
+ * @param _name 名称（常量字符串）
+ */
+#define __trace_marker(_trace, _type, _name, _arg)                     \
+    {                                                                  \
+        static uint16_t __trace_id = TRACE_ID_NONE;                    \
+        if (__trace_id == TRACE_ID_NONE)                               \
+        {                                                              \
+            __trace_id = trace_name_register((_trace), (_name));       \
+        }                                                              \
+        trace_record((_trace), (_type), __trace_id, (uint32_t)(_arg)); \
+    }
+#define trace_begin(_trace, _name) __trace_marker(_trace, TRACE_TYPE_BEGIN, _name, 0)
+#define trace_end(_trace, _name) __trace_marker(_trace, TRACE_TYPE_END, _name, 0)
+#define trace_counter(_trace, _name, _value) __trace_marker(_trace, TRACE_TYPE_COUNTER, _name, _value)
+#define trace_instant(_trace, _name, _arg) __trace_marker(_trace, TRACE_TYPE_INSTANT, _name, _arg)
+
+/**
+ * @brief 是否初始化/正在记录
+ *
+ * @param trace 追踪器指针
+ */
+#define trace_is_inited(_trace) ((_trace)->flag.is_inited)
+#define trace_is_running(_trace) ((_trace)->flag.is_running)
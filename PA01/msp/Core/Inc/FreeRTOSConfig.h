@@ -192,6 +192,13 @@ standard names. */
 
 /* USER CODE BEGIN Defines */
 /* Section where parameter definitions can be added (for instance, to override default ones in FreeRTOS.h) */
+// 事件追踪：任务切换钩子，实现见 bsp/trace/trace_bsp.c
+#if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+extern void trace_task_switched_in_hook(uint32_t number);
+extern void trace_task_switched_out_hook(uint32_t number);
+#define traceTASK_SWITCHED_IN() trace_task_switched_in_hook(pxCurrentTCB->uxTCBNumber)
+#define traceTASK_SWITCHED_OUT() trace_task_switched_out_hook(pxCurrentTCB->uxTCBNumber)
+#endif
 /* USER CODE END Defines */
 
 #endif /* FREERTOS_CONFIG_H */
@@ -261,6 +261,8 @@ static int8_t CDC_Control_FS(uint8_t cmd, uint8_t* pbuf, uint16_t length)
 static int8_t CDC_Receive_FS(uint8_t* Buf, uint32_t *Len)
 {
   /* USER CODE BEGIN 6 */
+  void CDC_Receive_Callback(uint8_t *buff, uint32_t length);
+  CDC_Receive_Callback(Buf, *Len);
   USBD_CDC_SetRxBuffer(&hUsbDeviceFS, &Buf[0]);
   USBD_CDC_ReceivePacket(&hUsbDeviceFS);
   return (USBD_OK);
@@ -308,9 +310,9 @@ static int8_t CDC_TransmitCplt_FS(uint8_t *Buf, uint32_t *Len, uint8_t epnum)
 {
   uint8_t result = USBD_OK;
   /* USER CODE BEGIN 13 */
-  UNUSED(Buf);
-  UNUSED(Len);
   UNUSED(epnum);
+  void CDC_TransmitCplt_Callback(uint8_t *buff, uint32_t length);
+  CDC_TransmitCplt_Callback(Buf, *Len);
   /* USER CODE END 13 */
   return result;
 }
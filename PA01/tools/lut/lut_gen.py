@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+按 lut_spec.json 的声明生成常量查找表（放 FLASH），输出 lib/lut/lut_table.h 与 lut_table.c。
+
+用法: python lut_gen.py [lut_spec.json] [--check]
+  --check  只比对，不写文件；生成结果与仓库中的文件不一致时返回 1（可作为编译前检查）
+
+生成的文件随代码一起提交，编译不依赖 Python；改表只改 spec 再重新生成。
+表的类型（kind）：
+  crc      CRC 查表，MSB 先行，uint32_t[256]，与 lib/encryptor/crc 的 crc_t.table 相同
+  twiddle  FFT 旋转因子 W_N^k，k < 3N/4，float {real, imag} 交错
+  sin      正弦表，整周或 1/4 周，float 或 Q15，末尾多一项供插值
+  gamma    8 位 gamma 校正表
+  db       分贝转幅值增益表，均匀 dB 网格
+"""
+import json
+import math
+import os
+import struct
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", ".."))
+DEFAULT_SPEC = os.path.join(os.path.dirname(os.path.abspath(__file__)), "lut_spec.json")
+DATE = "2026-10-19"
+
+
+def f32(value):
+    """按单精度舍入"""
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+def fmt_f32(value):
+    return "%.9ef" % f32(value)
+
+
+def fmt_hex32(value):
+    return "0x%08X" % value
+
+
+def fmt_int(value):
+    return "%d" % value
+
+
+def rows(values, fmt, per_line):
+    """每行 per_line 项，4 空格缩进"""
+    items = [fmt(v) for v in values]
+    lines = []
+    for i in range(0, len(items), per_line):
+        lines.append("    " + ", ".join(items[i:i + per_line]) + ",")
+    lines[-1] = lines[-1][:-1]
+    return "\n".join(lines)
+
+
+def gen_crc(spec):
+    poly = int(spec["polynomial"], 0)
+    width = int(spec["width"])
+    assert width in (8, 16, 32), "crc width must be 8/16/32"
+    mask = (1 << width) - 1
+    top = 1 << (width - 1)
+    table = []
+    for i in range(256):
+        r = i << (width - 8)
+        for _ in range(8):
+            r = ((r << 1) ^ poly) if (r & top) else (r << 1)
+        table.append(r & mask)
+    upper = spec["name"].upper()
+    macros = [
+        ("LUT_%s_SIZE" % upper, "256", "表长"),
+        ("LUT_%s_POLYNOMIAL" % upper, "0x%X" % poly, "多项式"),
+        ("LUT_%s_WIDTH" % upper, "%d" % width, "CRC宽度"),
+    ]
+    return macros, "uint32_t", "LUT_%s_SIZE" % upper, rows(table, fmt_hex32, 8)
+
+
+def gen_twiddle(spec):
+    size = int(spec["size"])
+    assert size >= 4 and (size & (size - 1)) == 0, "fft size must be a power of 2"
+    count = size * 3 // 4
+    values = []
+    for k in range(count):
+        angle = -2.0 * math.pi * k / size
+        values += [math.cos(angle), math.sin(angle)]
+    upper = spec["name"].upper()
+    macros = [
+        ("LUT_%s_SIZE" % upper, "%d" % size, "对应的FFT点数"),
+        ("LUT_%s_COUNT" % upper, "%d" % count, "旋转因子个数"),
+    ]
+    return macros, "float", "LUT_%s_COUNT * 2" % upper, rows(values, fmt_f32, 8)
+
+
+def gen_sin(spec):
+    bits = int(spec["bits"])
+    size = 1 << bits
+    quarter = bool(spec.get("quarter", False))
+    span = (math.pi / 2) if quarter else (2 * math.pi)
+    values = [math.sin(span * i / size) for i in range(size + 1)]
+    if not quarter:
+        values[size] = values[0]  # 整周表末项即首项，插值回绕连续
+    upper = spec["name"].upper()
+    macros = [
+        ("LUT_%s_BITS" % upper, "%d" % bits, "表长位数"),
+        ("LUT_%s_SIZE" % upper, "(1u << LUT_%s_BITS)" % upper, "1/4 周点数" if quarter else "每周点数"),
+    ]
+    if spec["type"] == "q15":
+        values = [min(32767, int(round(v * 32768))) for v in values]
+        return macros, "int16_t", "LUT_%s_SIZE + 1" % upper, rows(values, fmt_int, 16)
+    return macros, "float", "LUT_%s_SIZE + 1" % upper, rows(values, fmt_f32, 8)
+
+
+def gen_gamma(spec):
+    gamma = float(spec["gamma"])
+    values = [int(math.floor(255.0 * math.pow(i / 255.0, gamma) + 0.5)) for i in range(256)]
+    upper = spec["name"].upper()
+    macros = [
+        ("LUT_%s_SIZE" % upper, "256", "表长"),
+        ("LUT_%s_GAMMA" % upper, "%gf" % gamma, "gamma 值"),
+    ]
+    return macros, "uint8_t", "LUT_%s_SIZE" % upper, rows(values, fmt_int, 16)
+
+
+def gen_db(spec):
+    db_min, db_max, step = float(spec["min"]), float(spec["max"]), float(spec["step"])
+    count = int(round((db_max - db_min) / step)) + 1
+    values = [math.pow(10.0, (db_min + i * step) / 20.0) for i in range(count)]
+    upper = spec["name"].upper()
+    macros = [
+        ("LUT_%s_MIN" % upper, "(%.1ff)" % db_min, "起点 dB"),
+        ("LUT_%s_MAX" % upper, "(%.1ff)" % db_max, "终点 dB"),
+        ("LUT_%s_STEP" % upper, "(%.1ff)" % step, "网格间距 dB"),
+        ("LUT_%s_SIZE" % upper, "%d" % count, "表长"),
+    ]
+    return macros, "float", "LUT_%s_SIZE" % upper, rows(values, fmt_f32, 8)
+
+
+GENERATORS = {
+    "crc": gen_crc,
+    "twiddle": gen_twiddle,
+    "sin": gen_sin,
+    "gamma": gen_gamma,
+    "db": gen_db,
+}
+
+
+def banner(file, brief, spec_path):
+    return "\n".join([
+        "/**",
+        " * @file %s" % file,
+        " * @author WittXie",
+        " * @brief %s" % brief,
+        " * @version 0.1",
+        " * @date %s" % DATE,
+        " * @note 由 tools/lut/lut_gen.py 按 tools/lut/%s 生成，勿手工修改" % os.path.basename(spec_path),
+        " *",
+        " * @copyright Copyright (c) 2026",
+        " */",
+    ])
+
+
+def align(lines):
+    """对齐 #define 的注释"""
+    defines = ["#define %s %s" % (name, value) for name, value, _ in lines]
+    width = max(len(d) for d in defines)
+    return ["%-*s // %s" % (width, d, comment) for d, (_, _, comment) in zip(defines, lines)]
+
+
+def generate(spec_path):
+    with open(spec_path, "r", encoding="utf-8") as f:
+        spec = json.load(f)
+    header_name = os.path.basename(spec["header"])
+
+    macros, decls, defs = [], [], []
+    for table in spec["tables"]:
+        gen = GENERATORS.get(table["kind"])
+        if gen is None:
+            raise ValueError("unknown kind: %s" % table["kind"])
+        table_macros, ctype, length, body = gen(table)
+        symbol = "g_lut_%s" % table["name"]
+        macros.append((table["name"], table_macros))
+        decls.append("// %s\nextern const %s %s[%s];" % (table["brief"], ctype, symbol, length))
+        defs.append("const %s %s[%s] = {\n%s};" % (ctype, symbol, length, body))
+
+    header = [banner(header_name, "常量查找表声明", spec_path), "#pragma once", "", "#include <stdint.h>", ""]
+    for name, table_macros in macros:
+        header += ["// %s" % name] + align(table_macros) + [""]
+    header += ["\n\n".join(decls), ""]
+
+    source = ["#include \"./%s\"" % header_name, "", "\n\n".join(defs), ""]
+    return {
+        os.path.join(ROOT, spec["header"]): "\n".join(header),
+        os.path.join(ROOT, spec["source"]): "\n".join(source),
+    }
+
+
+def main():
+    args = [a for a in sys.argv[1:] if not a.startswith("--")]
+    check = "--check" in sys.argv[1:]
+    spec_path = args[0] if args else DEFAULT_SPEC
+
+    outputs = generate(spec_path)
+    stale = 0
+    for path, text in outputs.items():
+        old = None
+        if os.path.exists(path):
+            with open(path, "r", encoding="utf-8") as f:
+                old = f.read()
+        if old == text:
+            print("up to date: %s" % os.path.relpath(path, ROOT))
+            continue
+        stale += 1
+        if check:
+            print("stale: %s" % os.path.relpath(path, ROOT))
+            continue
+        with open(path, "w", encoding="utf-8", newline="\n") as f:
+            f.write(text)
+        print("write: %s" % os.path.relpath(path, ROOT))
+    return 1 if (check and stale > 0) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
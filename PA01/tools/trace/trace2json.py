@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+将 trace_dump 导出的二进制流转换为 Chrome trace / Perfetto 可读的 JSON。
+
+用法: python trace2json.py trace.bin [trace.json]
+打开: chrome://tracing 或 https://ui.perfetto.dev
+
+格式见 lib/trace/trace.h。
+"""
+import json
+import struct
+import sys
+
+TYPE_TASK_IN = 1
+TYPE_TASK_OUT = 2
+TYPE_ISR_ENTER = 3
+TYPE_ISR_EXIT = 4
+TYPE_DDS_BEGIN = 5
+TYPE_DDS_END = 6
+TYPE_BEGIN = 7
+TYPE_END = 8
+TYPE_COUNTER = 9
+TYPE_INSTANT = 10
+
+ISR_TID = 0x10000  # 中断单独一行
+IDLE_TID = 0       # 未知任务
+
+
+def read_names(data, offset, count):
+    names = {}
+    for _ in range(count):
+        id, length = struct.unpack_from("<HB", data, offset)
+        offset += 3
+        names[id] = data[offset:offset + length].decode("utf-8", "replace")
+        offset += length
+    return names, offset
+
+
+def parse(data):
+    magic, version, event_size, freq, count, lost, name_count, task_count = struct.unpack_from("<4sHHIIIHH", data, 0)
+    if magic != b"VTRC":
+        raise ValueError("bad magic: %r" % magic)
+    if version != 1:
+        raise ValueError("unsupported version: %d" % version)
+    offset = 24
+    names, offset = read_names(data, offset, name_count)
+    tasks, offset = read_names(data, offset, task_count)
+    events = []
+    for i in range(count):
+        cycles, type, core, id, arg = struct.unpack_from("<IBBHI", data, offset + i * event_size)
+        events.append((cycles, type, core, id, arg))
+    return freq, lost, names, tasks, events
+
+
+def convert(data):
+    freq, lost, names, tasks, events = parse(data)
+    out = []
+    pid = 1
+
+    # 周期计数器回绕展开：按32位有符号差值累加，
+    # 差值 >= 2^31 视为倒退（记录被打断时相邻事件时间戳可小幅倒序），而不是回绕
+    now = None
+    last = 0
+    current = {}  # 核 -> 当前任务
+    for cycles, type, core, id, arg in events:
+        delta = (cycles - last) & 0xFFFFFFFF
+        if delta >= 1 << 31:
+            delta -= 1 << 32
+        now = cycles if now is None else now + delta
+        last = cycles
+        ts = now * 1e6 / freq
+
+        tid = current.get(core, IDLE_TID)
+        if type == TYPE_TASK_IN:
+            current[core] = id
+            out.append({"ph": "B", "pid": pid, "tid": id, "ts": ts, "name": tasks.get(id, "task%d" % id), "cat": "task"})
+        elif type == TYPE_TASK_OUT:
+            out.append({"ph": "E", "pid": pid, "tid": id, "ts": ts})
+            current[core] = IDLE_TID
+        elif type == TYPE_ISR_ENTER:
+            out.append({"ph": "B", "pid": pid, "tid": ISR_TID, "ts": ts, "name": "IRQ%d" % id, "cat": "isr"})
+        elif type == TYPE_ISR_EXIT:
+            out.append({"ph": "E", "pid": pid, "tid": ISR_TID, "ts": ts})
+        elif type == TYPE_DDS_BEGIN:
+            out.append({"ph": "B", "pid": pid, "tid": tid, "ts": ts, "name": "dds 0x%08X" % arg, "cat": "dds"})
+        elif type == TYPE_DDS_END:
+            out.append({"ph": "E", "pid": pid, "tid": tid, "ts": ts})
+        elif type == TYPE_BEGIN:
+            out.append({"ph": "B", "pid": pid, "tid": tid, "ts": ts, "name": names.get(id, "mark%d" % id), "cat": "user"})
+        elif type == TYPE_END:
+            out.append({"ph": "E", "pid": pid, "tid": tid, "ts": ts})
+        elif type == TYPE_COUNTER:
+            name = names.get(id, "counter%d" % id)
+            out.append({"ph": "C", "pid": pid, "ts": ts, "name": name, "args": {name: struct.unpack("<i", struct.pack("<I", arg))[0]}})
+        elif type == TYPE_INSTANT:
+            out.append({"ph": "i", "pid": pid, "tid": tid, "ts": ts, "s": "t", "name": names.get(id, "mark%d" % id), "args": {"arg": arg}})
+
+    # 线程名称
+    out.append({"ph": "M", "pid": pid, "name": "process_name", "args": {"name": "PA01"}})
+    out.append({"ph": "M", "pid": pid, "tid": ISR_TID, "name": "thread_name", "args": {"name": "ISR"}})
+    for id, name in tasks.items():
+        out.append({"ph": "M", "pid": pid, "tid": id, "name": "thread_name", "args": {"name": name}})
+
+    return {"traceEvents": out, "displayTimeUnit": "ns", "otherData": {"lost": lost, "cycles_freq": freq}}
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        return 1
+    with open(sys.argv[1], "rb") as f:
+        trace = convert(f.read())
+    output = sys.argv[2] if len(sys.argv) > 2 else sys.argv[1] + ".json"
+    with open(output, "w", encoding="utf-8") as f:
+        json.dump(trace, f)
+    print("events: %d, lost: %d -> %s" % (len(trace["traceEvents"]), trace["otherData"]["lost"], output))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
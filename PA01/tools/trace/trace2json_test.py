@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+trace2json.py 的转换测试：按 lib/trace/trace.h 的导出格式构造二进制流，检查回绕展开与事件映射。
+
+用法: python trace2json_test.py
+"""
+import struct
+import unittest
+
+import trace2json
+
+FREQ = 1000000  # 1 周期 = 1 us，ts 即周期数
+
+
+def names(table):
+    data = b""
+    for id, name in table.items():
+        raw = name.encode("utf-8")
+        data += struct.pack("<HB", id, len(raw)) + raw
+    return data
+
+
+def dump(events, user_names=None, tasks=None, lost=0):
+    """events: [(cycles, type, core, id, arg)]"""
+    user_names = user_names or {}
+    tasks = tasks or {}
+    data = struct.pack("<4sHHIIIHH", b"VTRC", 1, 12, FREQ, len(events), lost, len(user_names), len(tasks))
+    data += names(user_names) + names(tasks)
+    for event in events:
+        data += struct.pack("<IBBHI", *event)
+    return data
+
+
+def timestamps(trace):
+    return [e["ts"] for e in trace["traceEvents"] if e["ph"] != "M"]
+
+
+class ConvertTest(unittest.TestCase):
+    def test_wrap_forward(self):
+        # 跨越 32 位回绕：0xFFFFFFF0 -> 0x10 应前进 0x20
+        trace = trace2json.convert(dump([
+            (0xFFFFFFF0, trace2json.TYPE_INSTANT, 0, 1, 0),
+            (0x00000010, trace2json.TYPE_INSTANT, 0, 1, 0),
+            (0x00000100, trace2json.TYPE_INSTANT, 0, 1, 0),
+        ], user_names={1: "mark"}))
+        ts = timestamps(trace)
+        self.assertEqual(ts[1] - ts[0], 0x20)
+        self.assertEqual(ts[2] - ts[1], 0xF0)
+
+    def test_small_backward_is_not_wrap(self):
+        # 记录被中断打断：后占位的事件时间戳略小，不能当成回绕加上 2^32
+        trace = trace2json.convert(dump([
+            (1000, trace2json.TYPE_INSTANT, 0, 1, 0),
+            (990, trace2json.TYPE_INSTANT, 0, 1, 0),
+            (1010, trace2json.TYPE_INSTANT, 0, 1, 0),
+        ], user_names={1: "mark"}))
+        ts = timestamps(trace)
+        self.assertEqual(ts[1] - ts[0], -10)
+        self.assertEqual(ts[2] - ts[0], 10)
+
+    def test_backward_across_wrap(self):
+        # 回绕点附近的倒序：0x5 之后出现 0xFFFFFFFE，是倒退 7，不是前进
+        trace = trace2json.convert(dump([
+            (0xFFFFFFF0, trace2json.TYPE_INSTANT, 0, 1, 0),
+            (0x00000005, trace2json.TYPE_INSTANT, 0, 1, 0),
+            (0xFFFFFFFE, trace2json.TYPE_INSTANT, 0, 1, 0),
+        ], user_names={1: "mark"}))
+        ts = timestamps(trace)
+        self.assertEqual(ts[1] - ts[0], 0x15)
+        self.assertEqual(ts[2] - ts[1], -7)
+
+    def test_events(self):
+        trace = trace2json.convert(dump([
+            (100, trace2json.TYPE_TASK_IN, 0, 3, 0),
+            (110, trace2json.TYPE_BEGIN, 0, 1, 0),
+            (120, trace2json.TYPE_COUNTER, 0, 2, 0xFFFFFFFF),
+            (130, trace2json.TYPE_END, 0, 1, 0),
+            (140, trace2json.TYPE_ISR_ENTER, 0, 37, 0),
+            (150, trace2json.TYPE_ISR_EXIT, 0, 37, 0),
+            (160, trace2json.TYPE_TASK_OUT, 0, 3, 0),
+        ], user_names={1: "work", 2: "depth"}, tasks={3: "main"}, lost=5))
+        events = [e for e in trace["traceEvents"] if e["ph"] != "M"]
+        self.assertEqual([e["ph"] for e in events], ["B", "B", "C", "E", "B", "E", "E"])
+        self.assertEqual(events[0]["name"], "main")
+        self.assertEqual(events[1]["name"], "work")
+        self.assertEqual(events[1]["tid"], 3)  # 用户区间归属当前任务
+        self.assertEqual(events[2]["args"], {"depth": -1})
+        self.assertEqual(events[4]["name"], "IRQ37")
+        self.assertEqual(events[4]["tid"], trace2json.ISR_TID)
+        self.assertEqual(trace["otherData"]["lost"], 5)
+        thread_names = {e["tid"]: e["args"]["name"] for e in trace["traceEvents"] if e.get("name") == "thread_name"}
+        self.assertEqual(thread_names[3], "main")
+
+    def test_bad_magic(self):
+        data = bytearray(dump([]))
+        data[0:4] = b"XXXX"
+        with self.assertRaises(ValueError):
+            trace2json.convert(bytes(data))
+
+
+if __name__ == "__main__":
+    unittest.main()